@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""Regenerate include/roxy/vm/superinstructions.def from bytecode n-gram profiles.
+
+Runs an ENABLE_BC_PROFILE build of `roxy` over the benchmark workloads with
+ROXY_BC_PROFILE_NGRAMS set, so each run appends its dynamic opcode bigram and
+trigram counts to a file. Counts are normalized per workload (a long-running
+benchmark must not drown out the others), summed, and the hottest eligible
+pairs become the 16 superinstruction slots 0x70-0x7F.
+
+A pair is eligible when its first op has an RX_BODY_<OP> macro in
+src/roxy/vm/interpreter.cpp (the handler body a superinstruction reuses). The
+second op can be anything: the superinstruction jumps into its handler.
+
+Usage:
+  cmake -B build-bcprofile -G Ninja -DCMAKE_BUILD_TYPE=RelWithDebInfo -DENABLE_BC_PROFILE=ON
+  ninja -C build-bcprofile roxy
+  benchmarks/gen_superinstructions.py --roxy build-bcprofile/roxy
+  benchmarks/gen_superinstructions.py --roxy build-bcprofile/roxy my_game/main.roxy
+  benchmarks/gen_superinstructions.py --ngrams a.txt b.txt      # reuse saved counts
+  benchmarks/gen_superinstructions.py --roxy ... --dry-run      # print, don't write
+
+Rebuild afterwards; nothing else needs editing.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import textwrap
+from collections import defaultdict
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+PROJECT_ROOT = os.path.dirname(SCRIPT_DIR)
+DEF_PATH = os.path.join(PROJECT_ROOT, "include", "roxy", "vm", "superinstructions.def")
+INTERPRETER_PATH = os.path.join(PROJECT_ROOT, "src", "roxy", "vm", "interpreter.cpp")
+
+FIRST_SLOT = 0x70
+SLOT_COUNT = 16
+
+# Default workloads: (label, argv after the roxy binary). The Lox interpreter
+# runs the small Crafting Interpreters programs, which exercise calls, fields,
+# maps and strings rather than the numeric kernels.
+DEFAULT_WORKLOADS = [
+    ("nbody", ["benchmarks/nbody/nbody.roxy"]),
+    ("mandelbrot", ["benchmarks/mandelbrot/mandelbrot.roxy"]),
+    ("quicksort", ["benchmarks/quicksort/quicksort.roxy"]),
+    ("struct_copy", ["benchmarks/struct_copy/struct_copy.roxy"]),
+    ("lox_fib", ["examples/lox/main.roxy", "benchmarks/lox/fib_small.lox"]),
+    ("lox_trees", ["examples/lox/main.roxy", "benchmarks/lox/binary_trees_small.lox"]),
+    ("lox_method_call", ["examples/lox/main.roxy", "benchmarks/lox/method_call_small.lox"]),
+]
+
+HEADER = """\
+// Superinstruction table — GENERATED by benchmarks/gen_superinstructions.py
+// from ENABLE_BC_PROFILE bigram counts. Regenerate instead of hand-editing;
+// see docs/internals/vm-optimization.md → "Superinstructions".
+//
+// X-macro rows, one per opcode byte in the 0x70-0x7F block:
+//   RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND)
+//     NAME executes FIRST, then jumps straight into SECOND's handler without a
+//     dispatch-table lookup. Only FIRST's opcode byte is rewritten at lowering
+//     (form_superinstructions), so the code stays length-preserving and
+//     SECOND remains an ordinary instruction that branches may still target.
+//     FIRST must have an RX_BODY_<FIRST> macro in interpreter.cpp.
+//   RX_SUPERINSTRUCTION_UNUSED(byte)
+//     A free slot; the interpreter maps it to the unknown-opcode handler.
+//
+// Includers define the macros they need; the rest default to nothing.
+"""
+
+DEFAULTS = """\
+#ifndef RX_SUPERINSTRUCTION
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND)
+#endif
+#ifndef RX_SUPERINSTRUCTION_UNUSED
+#define RX_SUPERINSTRUCTION_UNUSED(byte)
+#endif
+"""
+
+FOOTER = """\
+#undef RX_SUPERINSTRUCTION
+#undef RX_SUPERINSTRUCTION_UNUSED
+"""
+
+
+def fusable_first_ops():
+    with open(INTERPRETER_PATH) as f:
+        return set(re.findall(r"^#define RX_BODY_(\w+)", f.read(), re.MULTILINE))
+
+
+def read_ngrams(path):
+    """Returns (bigrams, trigrams) as {tuple(op names): count}."""
+    bigrams = defaultdict(int)
+    trigrams = defaultdict(int)
+    with open(path) as f:
+        for line in f:
+            parts = line.split()
+            if len(parts) == 4 and parts[0] == "bigram":
+                bigrams[(parts[1], parts[2])] += int(parts[3])
+            elif len(parts) == 5 and parts[0] == "trigram":
+                trigrams[(parts[1], parts[2], parts[3])] += int(parts[4])
+    return bigrams, trigrams
+
+
+def profile_workload(roxy, label, argv, out_path):
+    env = dict(os.environ, ROXY_BC_PROFILE_NGRAMS=out_path)
+    cmd = [roxy] + argv
+    print(f"  {label}: {' '.join(argv)}", file=sys.stderr)
+    result = subprocess.run(cmd, cwd=PROJECT_ROOT, env=env, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL)
+    if result.returncode != 0:
+        print(f"    (exit {result.returncode}, skipped)", file=sys.stderr)
+        return False
+    return os.path.exists(out_path)
+
+
+def collect(args):
+    """Returns a list of (label, bigrams, trigrams), one per workload."""
+    runs = []
+    if args.ngrams:
+        for path in args.ngrams:
+            bigrams, trigrams = read_ngrams(path)
+            runs.append((os.path.basename(path), bigrams, trigrams))
+        return runs
+
+    workloads = list(DEFAULT_WORKLOADS)
+    for extra in args.scripts:
+        workloads.append((os.path.basename(extra), [os.path.abspath(extra)]))
+
+    with tempfile.TemporaryDirectory() as tmp:
+        print("Profiling workloads:", file=sys.stderr)
+        for label, argv in workloads:
+            out_path = os.path.join(tmp, label + ".ngrams")
+            if profile_workload(args.roxy, label, argv, out_path):
+                bigrams, trigrams = read_ngrams(out_path)
+                runs.append((label, bigrams, trigrams))
+    return runs
+
+
+def normalized_sum(runs, index):
+    """Sums each run's n-gram shares (count / run total) so workloads weigh equally."""
+    total = defaultdict(float)
+    for run in runs:
+        grams = run[index]
+        run_total = sum(grams.values())
+        if run_total == 0:
+            continue
+        for gram, count in grams.items():
+            total[gram] += count / run_total
+    return total
+
+
+def choose(pair_share, first_ops, count):
+    chosen = []
+    for (first, second), share in sorted(pair_share.items(), key=lambda kv: -kv[1]):
+        if len(chosen) == count:
+            break
+        if first not in first_ops:
+            continue
+        chosen.append((first, second, share))
+    return chosen
+
+
+def render(chosen, labels):
+    lines = [HEADER]
+    workloads = textwrap.wrap(f"Profiled workloads: {', '.join(labels)}.", width=77)
+    lines.extend("// " + line for line in workloads)
+    lines.append("// Share = the pair's summed per-workload fraction of executed ops.")
+    lines.append("")
+    lines.append(DEFAULTS)
+    for slot in range(SLOT_COUNT):
+        byte = f"0x{FIRST_SLOT + slot:02X}"
+        if slot < len(chosen):
+            first, second, share = chosen[slot]
+            lines.append(f"RX_SUPERINSTRUCTION({byte}, {first}__{second}, {first}, {second}) "
+                         f"// share {share:.3f}")
+        else:
+            lines.append(f"RX_SUPERINSTRUCTION_UNUSED({byte})")
+    lines.append("")
+    lines.append(FOOTER)
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--roxy", help="roxy binary built with -DENABLE_BC_PROFILE=ON")
+    parser.add_argument("--ngrams", nargs="+", help="saved ROXY_BC_PROFILE_NGRAMS files")
+    parser.add_argument("--count", type=int, default=SLOT_COUNT,
+                        help=f"number of superinstructions (max {SLOT_COUNT})")
+    parser.add_argument("--dry-run", action="store_true", help="print instead of writing")
+    parser.add_argument("scripts", nargs="*", help="extra .roxy programs to profile")
+    args = parser.parse_args()
+
+    if not args.ngrams and not args.roxy:
+        parser.error("pass --roxy (to profile) or --ngrams (to reuse counts)")
+    args.count = max(0, min(args.count, SLOT_COUNT))
+
+    runs = collect(args)
+    if not runs:
+        print("error: no n-gram data collected (is --roxy a bcprofile build?)", file=sys.stderr)
+        return 1
+
+    pair_share = normalized_sum(runs, 1)
+    chosen = choose(pair_share, fusable_first_ops(), args.count)
+
+    print("\nTop trigrams (candidates for a longer fusion):", file=sys.stderr)
+    triple_share = normalized_sum(runs, 2)
+    for (a, b, c), share in sorted(triple_share.items(), key=lambda kv: -kv[1])[:10]:
+        print(f"  {share:7.3f}  {a} -> {b} -> {c}", file=sys.stderr)
+
+    text = render(chosen, [run[0] for run in runs])
+    if args.dry_run:
+        print(text)
+    else:
+        with open(DEF_PATH, "w") as f:
+            f.write(text)
+        print(f"\nWrote {len(chosen)} superinstructions to {os.path.relpath(DEF_PATH)}",
+              file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
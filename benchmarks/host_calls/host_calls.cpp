@@ -0,0 +1,129 @@
+// Host->script call overhead: 100k calls of a small per-entity `update`
+// through each host entry point, looped single calls against one batch.
+// Usage: roxy_host_call_bench [calls]   (see docs/internals/vm.md)
+
+#include "roxy/compiler/driver/compiler.hpp"
+#include "roxy/core/bump_allocator.hpp"
+#include "roxy/vm/binding/interop.hpp"
+#include "roxy/vm/bytecode.hpp"
+#include "roxy/vm/vm.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace rx;
+
+static const char* k_source = R"(
+pub fun update(id: i32, dt: f32): f32 {
+    return f32(id) * dt + 1.0f;
+}
+)";
+
+static inline u64 now_ns() {
+    return static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+// Best of `k_rounds` runs of `body`, in nanoseconds per call
+constexpr u32 k_rounds = 5;
+
+template <typename Body> static double time_per_call(u32 calls, Body body) {
+    u64 best = UINT64_MAX;
+    for (u32 round = 0; round < k_rounds; round++) {
+        u64 start = now_ns();
+        body();
+        u64 elapsed = now_ns() - start;
+        if (elapsed < best)
+            best = elapsed;
+    }
+    return static_cast<double>(best) / calls;
+}
+
+int main(int argc, char** argv) {
+    u32 calls = argc > 1 ? static_cast<u32>(strtoul(argv[1], nullptr, 10)) : 100000;
+    if (calls == 0) {
+        fprintf(stderr, "usage: roxy_host_call_bench [calls]\n");
+        return 1;
+    }
+
+    BumpAllocator allocator(65536);
+    Compiler compiler(allocator);
+    compiler.add_source("host_calls", k_source, static_cast<u32>(strlen(k_source)));
+    BCModule* module = compiler.compile();
+    if (!module) {
+        for (const char* error : compiler.errors())
+            fprintf(stderr, "%s\n", error);
+        return 1;
+    }
+
+    RoxyVM vm;
+    vm_init(&vm);
+    vm_load_module(&vm, module);
+
+    // Entity state as a host would keep it: parallel typed arrays, plus the
+    // same values pre-encoded as registers for the raw batch forms.
+    i32* ids = new i32[calls];
+    f32* dts = new f32[calls];
+    f32* out = new f32[calls];
+    u64* rows = new u64[calls * 2];
+    u64* id_regs = new u64[calls];
+    u64* dt_regs = new u64[calls];
+    u64* raw_out = new u64[calls];
+    for (u32 i = 0; i < calls; i++) {
+        ids[i] = static_cast<i32>(i);
+        dts[i] = 1.0f / 60.0f;
+        id_regs[i] = rows[i * 2] = RoxyType<i32>::to_reg(ids[i]);
+        dt_regs[i] = rows[i * 2 + 1] = RoxyType<f32>::to_reg(dts[i]);
+    }
+    const u64* columns[] = {id_regs, dt_regs};
+
+    RoxyFunctionHandle handle = vm_resolve(&vm, "update");
+    auto update = ScriptFunction<f32(i32, f32)>::resolve(&vm, "update");
+    bool ok = true;
+
+    printf("%u calls of update(id: i32, dt: f32): f32, best of %u\n\n", calls, k_rounds);
+    printf("  %-34s %8s\n", "entry point", "ns/call");
+
+    auto report = [&](const char* name, double ns) { printf("  %-34s %8.1f\n", name, ns); };
+
+    report("vm_call (by name, Value args)", time_per_call(calls, [&] {
+               for (u32 i = 0; i < calls && ok; i++) {
+                   Value args[] = {Value::from_u64(rows[i * 2]), Value::from_u64(rows[i * 2 + 1])};
+                   ok = vm_call(&vm, "update", Span<Value>(args, 2));
+               }
+           }));
+    report("vm_call_handle_regs (loop)", time_per_call(calls, [&] {
+               for (u32 i = 0; i < calls && ok; i++) {
+                   ok = vm_call_handle_regs(&vm, handle, &rows[i * 2], 2);
+                   raw_out[i] = vm_get_result_reg(&vm);
+               }
+           }));
+    report("ScriptFunction::operator() (loop)", time_per_call(calls, [&] {
+               for (u32 i = 0; i < calls; i++)
+                   out[i] = update(ids[i], dts[i]);
+           }));
+    report("vm_call_batch (rows)", time_per_call(calls, [&] {
+               ok = ok && vm_call_batch(&vm, handle, rows, calls, raw_out) == calls;
+           }));
+    report("vm_call_batch_columns", time_per_call(calls, [&] {
+               ok = ok && vm_call_batch_columns(&vm, handle, columns, calls, raw_out) == calls;
+           }));
+    report("ScriptFunction::call_batch (SoA)", time_per_call(calls, [&] {
+               ok = ok && update.call_batch(calls, out, ids, dts) == calls;
+           }));
+
+    if (!ok)
+        fprintf(stderr, "call failed: %s\n", vm_get_error(&vm));
+
+    delete[] ids;
+    delete[] dts;
+    delete[] out;
+    delete[] rows;
+    delete[] id_regs;
+    delete[] dt_regs;
+    delete[] raw_out;
+    vm_destroy(&vm);
+    delete module;
+    return ok ? 0 : 1;
+}
@@ -32,7 +32,35 @@ fi
 "$ROXY" "$SCRIPT_DIR/nbody.roxy"
 echo ""
 
+# Same simulation with the body state in f64x2 vectors; the energies match.
+echo "--- Roxy SIMD (VM interpreter, f64x2) ---"
+"$ROXY" "$SCRIPT_DIR/nbody_simd.roxy"
+echo ""
+
+# --- Roxy through the C backend ---
+# `roxy --emit-c` writes the program as C++; it links against the runtime
+# sources directly, with the same flags as the C version above.
+RT_SOURCES="$PROJECT_ROOT/src/roxy/rt/roxy_rt.cpp $PROJECT_ROOT/src/roxy/rt/slab_allocator.cpp \
+    $PROJECT_ROOT/src/roxy/rt/string_intern.cpp $PROJECT_ROOT/src/roxy/rt/vmem_unix.cpp"
+for prog in nbody nbody_simd; do
+    echo "Compiling $prog.roxy through the C backend..."
+    "$ROXY" --emit-c="$SCRIPT_DIR/${prog}_roxy.cpp" "$SCRIPT_DIR/$prog.roxy"
+    c++ -O2 -ffp-contract=off -std=c++17 -I"$PROJECT_ROOT/include/roxy/rt" \
+        -I"$PROJECT_ROOT/include" -o "$SCRIPT_DIR/${prog}_roxy_c" \
+        "$SCRIPT_DIR/${prog}_roxy.cpp" $RT_SOURCES
+done
+
+echo "--- Roxy (C backend, -O2) ---"
+"$SCRIPT_DIR/nbody_roxy_c"
+echo ""
+
+echo "--- Roxy SIMD (C backend, -O2, f64x2) ---"
+"$SCRIPT_DIR/nbody_simd_roxy_c"
+echo ""
+
 # Cleanup
 rm -f "$SCRIPT_DIR/nbody_c"
+rm -f "$SCRIPT_DIR"/nbody_roxy.cpp "$SCRIPT_DIR"/nbody_roxy_c
+rm -f "$SCRIPT_DIR"/nbody_simd_roxy.cpp "$SCRIPT_DIR"/nbody_simd_roxy_c
 
 echo "=== Done ==="
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""Sweep roxy_gen workload presets across corpus sizes and report every phase.
+
+For each preset x size, `roxy_gen --preset` emits an executable corpus (runtime
+kernels in every module, a deterministic checksum from main) and `roxy
+--time=json` compiles and runs it. The table shows compile time, peak RSS and
+execution time per cell, and flags any compile phase or execution whose cost
+grows more than --cliff times faster than the corpus does between adjacent
+sizes. That is the scaling cliff a project hits long before the absolute
+numbers look bad.
+
+Usage:
+  cmake -B build -G Ninja -DCMAKE_BUILD_TYPE=Release && ninja -C build roxy roxy_gen
+  benchmarks/roxy_bench.py --build build                        # mixed/dag/... x 10,100,1000
+  benchmarks/roxy_bench.py --build build --sizes 10,100,1000,10000 --presets dag
+  benchmarks/roxy_bench.py --build build --json after.json      # save the results
+  benchmarks/roxy_bench.py --build build --baseline before.json # diff against a save
+
+`cmake --build build --target roxy_bench` runs the default sweep.
+
+Exit status is 1 if a corpus fails to compile or run, its checksum changed
+from the baseline, or a cell regressed by more than --threshold percent.
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+DEFAULT_PRESETS = ["mixed", "dag", "collections", "closures", "coroutines", "generics"]
+DEFAULT_SIZES = [10, 100, 1000]
+
+# Phases below this many milliseconds are too noisy to call a cliff on.
+CLIFF_MIN_MS = 5.0
+
+GENERATED_RE = re.compile(r"Generated: .* (\d+) lines")
+CHECKSUM_RE = re.compile(r"^checksum: (-?\d+)$", re.M)
+
+
+def run_cell(args, preset, size, work_dir):
+    """Generate, compile and run one corpus. Returns a result dict."""
+    out_dir = os.path.join(work_dir, f"{preset}_{size}")
+    shutil.rmtree(out_dir, ignore_errors=True)
+    gen = subprocess.run(
+        [args.roxy_gen, f"--preset={preset}", f"--modules={size}", f"--seed={args.seed}",
+         f"--work={args.work}", f"--out={out_dir}"],
+        capture_output=True, text=True)
+    if gen.returncode != 0:
+        return {"error": "roxy_gen: " + gen.stderr.strip()}
+    match = GENERATED_RE.search(gen.stderr)
+    lines = int(match.group(1)) if match else 0
+
+    # Best of --runs: the minimum is the least noisy estimate of each phase.
+    best = None
+    for _ in range(args.runs):
+        run = subprocess.run([args.roxy, "--time=json", os.path.join(out_dir, "main.roxy")],
+                             capture_output=True, text=True)
+        json_lines = [l for l in run.stdout.splitlines() if l.startswith("{")]
+        if run.returncode != 0 or not json_lines:
+            return {"lines": lines, "error": (run.stderr.strip() or "exit %d" % run.returncode)}
+        stats = json.loads(json_lines[-1])
+        checksum = CHECKSUM_RE.search(run.stdout)
+        cell = {
+            "lines": lines,
+            "checksum": int(checksum.group(1)) if checksum else None,
+            "phases": {name: phase["ms"] for name, phase in stats["phases"].items()},
+            "compile_ms": stats["phases"]["compile"]["ms"],
+            "peak_rss_bytes": stats["phases"]["compile"]["peak_rss_bytes"],
+            "execute_ms": stats.get("execute_ms", 0.0),
+        }
+        if best is None:
+            best = cell
+        else:
+            for name, ms in cell["phases"].items():
+                best["phases"][name] = min(best["phases"][name], ms)
+            best["compile_ms"] = min(best["compile_ms"], cell["compile_ms"])
+            best["execute_ms"] = min(best["execute_ms"], cell["execute_ms"])
+            best["peak_rss_bytes"] = min(best["peak_rss_bytes"], cell["peak_rss_bytes"])
+    if not args.keep:
+        shutil.rmtree(out_dir, ignore_errors=True)
+    return best
+
+
+def find_cliffs(preset, cells, factor):
+    """Compare adjacent sizes; report costs growing `factor`x faster than LOC."""
+    cliffs = []
+    sizes = sorted(cells)
+    for small, large in zip(sizes, sizes[1:]):
+        a, b = cells[small], cells[large]
+        if "error" in a or "error" in b or not a["lines"]:
+            continue
+        loc_growth = b["lines"] / a["lines"]
+        costs = dict(b["phases"])
+        costs["execute"] = b["execute_ms"]
+        for name, ms in costs.items():
+            before = a["execute_ms"] if name == "execute" else a["phases"].get(name, 0.0)
+            if ms < CLIFF_MIN_MS or before <= 0.0:
+                continue
+            growth = ms / before
+            if growth > loc_growth * factor:
+                cliffs.append(f"{preset}: {name} x{growth:.1f} from {small} to {large} modules "
+                              f"(LOC x{loc_growth:.1f})")
+    return cliffs
+
+
+def compare(results, baseline, threshold):
+    """Per-cell regressions against a saved --json run."""
+    problems = []
+    for preset, cells in results.items():
+        for size, cell in cells.items():
+            old = baseline.get(preset, {}).get(str(size))
+            if old is None or "error" in cell or "error" in old:
+                continue
+            if old.get("checksum") != cell.get("checksum"):
+                problems.append(f"{preset}/{size}: checksum {old.get('checksum')} -> "
+                                f"{cell.get('checksum')}")
+            for key in ("compile_ms", "execute_ms", "peak_rss_bytes"):
+                if old[key] > 0 and cell[key] > old[key] * (1.0 + threshold / 100.0):
+                    pct = (cell[key] / old[key] - 1.0) * 100.0
+                    problems.append(f"{preset}/{size}: {key} {old[key]:.1f} -> {cell[key]:.1f} "
+                                    f"(+{pct:.1f}%)")
+    return problems
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--build", help="build directory holding roxy and roxy_gen")
+    parser.add_argument("--roxy", help="roxy binary (default: BUILD/roxy)")
+    parser.add_argument("--roxy-gen", help="roxy_gen binary (default: BUILD/roxy_gen)")
+    parser.add_argument("--presets", default=",".join(DEFAULT_PRESETS))
+    parser.add_argument("--sizes", default=",".join(str(s) for s in DEFAULT_SIZES),
+                        help="comma-separated module counts")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--work", type=int, default=64, help="per-kernel work size")
+    parser.add_argument("--runs", type=int, default=3, help="compile+run each corpus N times")
+    parser.add_argument("--cliff", type=float, default=2.0,
+                        help="flag costs growing this many times faster than LOC")
+    parser.add_argument("--json", help="write results to this file")
+    parser.add_argument("--baseline", help="compare against a previous --json file")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="regression threshold in percent for --baseline")
+    parser.add_argument("--work-dir", help="where corpora are generated (default: a temp dir)")
+    parser.add_argument("--keep", action="store_true", help="keep the generated corpora")
+    args = parser.parse_args()
+
+    if not args.roxy or not args.roxy_gen:
+        if not args.build:
+            parser.error("pass --build, or both --roxy and --roxy-gen")
+        args.roxy = args.roxy or os.path.join(args.build, "roxy")
+        args.roxy_gen = args.roxy_gen or os.path.join(args.build, "roxy_gen")
+    presets = [p for p in args.presets.split(",") if p]
+    sizes = [int(s) for s in args.sizes.split(",") if s]
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix="roxy_bench_")
+
+    results = {}
+    failures = []
+    print(f"{'preset':<12} {'modules':>7} {'KLOC':>8} {'compile ms':>11} {'peak RSS MB':>12} "
+          f"{'execute ms':>11}  checksum")
+    for preset in presets:
+        results[preset] = {}
+        for size in sizes:
+            cell = run_cell(args, preset, size, work_dir)
+            results[preset][size] = cell
+            if "error" in cell:
+                failures.append(f"{preset}/{size}: {cell['error'].splitlines()[-1]}")
+                print(f"{preset:<12} {size:>7}  FAILED")
+                continue
+            print(f"{preset:<12} {size:>7} {cell['lines'] / 1000.0:>8.1f} "
+                  f"{cell['compile_ms']:>11.1f} {cell['peak_rss_bytes'] / 2**20:>12.1f} "
+                  f"{cell['execute_ms']:>11.1f}  {cell['checksum']}")
+            sys.stdout.flush()
+    if not args.work_dir and not args.keep:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    cliffs = []
+    for preset, cells in results.items():
+        cliffs += find_cliffs(preset, cells, args.cliff)
+    if cliffs:
+        print("\nScaling cliffs (cost growing faster than the corpus):")
+        for line in cliffs:
+            print("  " + line)
+
+    regressions = []
+    if args.baseline:
+        with open(args.baseline) as f:
+            regressions = compare(results, json.load(f), args.threshold)
+        print(f"\nAgainst {args.baseline}: " +
+              ("no regressions" if not regressions else f"{len(regressions)} regression(s)"))
+        for line in regressions:
+            print("  " + line)
+
+    if failures:
+        print("\nFailed corpora:")
+        for line in failures:
+            print("  " + line)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(results, f, indent=1)
+    return 1 if failures or regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -91,6 +91,16 @@ private:
     String m_drop_glue_defs;                // the glue function definitions
     tsl::robin_set<Type*> m_drop_glue_seen; // container types already emitted
 
+    // --- List.sort_by comparator adapters ---
+    // roxy_list_sort_by takes a `bool (*)(void* ctx, const void* a, const void* b)`
+    // over element bytes; the comparator is a closure with typed params. One
+    // static adapter per comparator parameter type loads both elements and
+    // calls through g_closure_fns with the env as ctx. Lazily emitted like the
+    // drop glue and spliced after it.
+    String request_sort_less_adapter(Type* less_fn_type);
+    String m_sort_less_defs;
+    tsl::robin_set<Type*> m_sort_less_seen; // comparator param types already emitted
+
     // The C return type for a function. Normally `func->return_type`, but a
     // method returning a closure has its IR return_type left unset (the VM
     // returns by register regardless); fall back to the type of the actual
@@ -24,6 +24,7 @@ class TypeEnv;
 struct LiveRange {
     u32 def_point;      // program point where value is defined
     u32 last_use_point; // latest program point where value is read
+    u32 spill_weight;   // def + uses, each weighted by its block's loop depth
 };
 
 // Active allocation entry for free-list register allocator
@@ -52,6 +53,11 @@ public:
     bool has_error() const { return m_has_error; }
     const char* error() const { return m_error; }
 
+    // Bytes held by the dense ValueId/BlockId side tables. They keep their
+    // capacity from function to function, so after build() this is the
+    // high-water mark set by the largest function (see CompileMemory).
+    u64 side_table_bytes() const;
+
 private:
     // Report an internal compiler error
     void report_error(const char* message);
@@ -99,8 +105,12 @@ private:
     // cleanly instead of looping forever.
     void ensure_register_window(u16 needed_regs);
 
-    // Register spilling
-    void spill_furthest();
+    // Register spilling. Evicts the active value with the lowest spill cost:
+    // its loop-depth-weighted def/use count over the rest of its live range,
+    // so a value that is touched inside a hot loop stays in a register and a
+    // long-lived value used once after the loop goes to a wide register. Ties
+    // keep the historical choice — the furthest-living value.
+    void spill_cheapest();
     u8 get_result_register(ValueId value);
     u8 ensure_in_register(ValueId value, u8 scratch_index);
     // Emit the LOAD_INT/LOAD_CONST sequence for a Const{Int,F,D} definition
@@ -126,6 +136,14 @@ private:
     // Populates m_requires_register (queried via is_skip_load_const()).
     void compute_const_use_modes(IRFunction* ir_func);
 
+    // Pre-pass: marks struct-element list reads (`index_get` of a List whose
+    // elements are non-inline, so the result is an element pointer) whose only
+    // use is an immediately following get_field/set_field on that pointer. The
+    // pair lowers to one INDEX_FIELD_GET_LIST / INDEX_FIELD_SET_LIST; the
+    // index_get itself gets no register and emits nothing. Populates
+    // m_fused_index_get (queried via is_fused_index_get()).
+    void compute_list_field_fusion(IRFunction* ir_func);
+
     // Free-list register allocation support
     void expire_before(u32 current_point);
 
@@ -306,6 +324,11 @@ private:
     // Fuse adjacent compare + conditional branch into single two-word instruction
     void fuse_compare_branch();
 
+    // Rewrite the first op of each hot adjacent pair listed in
+    // superinstructions.def to its superinstruction (runs after
+    // fuse_compare_branch, so fused branches can be a pair's second op)
+    void form_superinstructions();
+
     // Get opcode for IR operation
     Opcode get_opcode(IROp op) const;
 
@@ -365,6 +388,7 @@ private:
 
     // Liveness data (computed per function)
     Vector<LiveRange> m_live_ranges;
+    Vector<u32> m_block_loop_depth;  // BlockId.id -> back-edge nesting depth (spill weights)
     Vector<bool> m_value_same_block; // true if value's def and last use are in the same block
 
     // Dense ValueId-indexed flag: true if the value has at least one use that
@@ -374,6 +398,23 @@ private:
     // ids are dense and it's probed twice per result-producing instruction (§3.8).
     Vector<bool> m_requires_register;
 
+    // Dense ValueId-indexed flag: true for an index_get result folded into the
+    // following field access (compute_list_field_fusion). m_use_counts is that
+    // pass's scratch buffer, kept to reuse its capacity across functions.
+    Vector<bool> m_fused_index_get;
+    Vector<u8> m_use_counts;
+    // The fused index_get whose field access is lowered next (emission state).
+    IRInst* m_pending_index_get = nullptr;
+
+    bool is_fused_index_get(ValueId value) const {
+        return value.is_valid() && value.id < m_fused_index_get.size() &&
+               m_fused_index_get[value.id];
+    }
+    // True if `object` is the pending fused index_get's element pointer.
+    bool take_pending_index_get(ValueId object) const {
+        return m_pending_index_get && m_pending_index_get->result == object;
+    }
+
     // A Const{Int,F,D} SSA value is skip-load eligible iff no use requires a
     // register. Derived from m_requires_register (built by compute_const_use_modes).
     bool is_skip_load_const(const IRInst* inst) const {
@@ -422,14 +463,24 @@ private:
 
     Vector<ActiveAlloc> m_active; // sorted by last_use ascending
 
-    // Register spilling state
-    tsl::robin_map<u32, u32> m_spill_slots; // ValueId.id -> spill stack slot offset
+    // Register spilling state. A spilled value lives in a wide register: one
+    // at 256 or above, past what 8-bit operands reach, which only the 16-bit
+    // operand of SPILL_REG/RELOAD_REG addresses.
+    static constexpr u32 FIRST_WIDE_REG = 256;
+    static constexpr u32 WIDE_REG_LIMIT = 65536; // imm16 addresses 0..65535
+    tsl::robin_map<u32, u32> m_spill_regs; // ValueId.id -> wide register
+    u32 m_next_wide_reg = FIRST_WIDE_REG;
     // Reverse map register -> ValueId.id, as a fixed 256-entry table (NO_VALUE =
     // register free). Only 256 possible register keys, so an array beats a map.
     static constexpr u32 NO_VALUE = UINT32_MAX; // == ValueId::invalid().id
     u32 m_reg_to_value[256] = {};
     bool m_has_spilling = false;
     u8 m_scratch_regs[2] = {0xFF, 0xFF}; // two scratch registers for reload/spill
+    // Program point preallocate_registers is at (set by expire_before), for
+    // spill_cheapest's remaining-range length.
+    u32 m_alloc_point = 0;
+    // Per-function spill statistics, copied to BCFunction (see CompileTimings).
+    u32 m_spill_ops = 0; // SPILL_REG + RELOAD_REG instructions emitted
 
     u32 m_next_stack_slot = 0;
 
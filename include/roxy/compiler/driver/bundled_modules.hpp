@@ -0,0 +1,21 @@
+#pragma once
+
+#include "roxy/core/string_view.hpp"
+#include "roxy/core/types.hpp"
+
+namespace rx {
+
+// A script module that ships inside the compiler. Compiler::compile() adds one
+// on demand when a source imports it and no module of that name was added, so
+// `from sched import Scheduler;` works without a sched.roxy on disk; a source
+// the embedder adds under the same name takes precedence.
+struct BundledModule {
+    const char* name;
+    const char* source;
+    u32 length;
+};
+
+// The bundled module called `name`, or nullptr
+const BundledModule* find_bundled_module(StringView name);
+
+} // namespace rx
@@ -17,6 +17,7 @@ namespace rx {
 
 // Forward declarations
 struct Program;
+struct IRFunction;
 struct IRModule;
 
 // Source module - represents a single source file with its module name
@@ -26,6 +27,44 @@ struct SourceModule {
     u32 length;         // Source length
 };
 
+// One function's register-spill counts (see CompileTimings::spills).
+struct FunctionSpillStats {
+    StringView function;
+    u32 spilled_values; // BCFunction::spilled_values
+    u32 spill_ops;      // BCFunction::spill_ops
+};
+
+// Memory counters for one compile phase, as deltas across it (see
+// CompileMemory).
+struct PhaseMemory {
+    u64 arena_bytes = 0;        // BumpAllocator bytes handed out, padding included
+    u32 arena_chunks = 0;       // BumpAllocator chunks malloc'd
+    u64 vector_reallocs = 0;    // Vector buffer growths (g_vector_growth)
+    u64 vector_bytes_moved = 0; // element bytes those growths moved
+    u64 peak_rss_bytes = 0;     // growth of the process's peak RSS (0 = unsupported)
+};
+
+// Per-compile memory accounting. Unlike the timings these cost a chunk-list
+// walk and a getrusage() per phase, so compile() only fills them after
+// Compiler::set_track_memory(true). See `roxy --time=mem`.
+struct CompileMemory {
+    PhaseMemory parse;
+    PhaseMemory topo;
+    PhaseMemory sema;
+    PhaseMemory ir_build;
+    PhaseMemory coro_lower;
+    PhaseMemory ir_optimize;
+    PhaseMemory ir_validate;
+    PhaseMemory bc_lower;
+    PhaseMemory total; // Whole compile() call
+
+    // The big dense side tables, at their high-water mark.
+    u64 values_by_id_bytes = 0;  // IRFunction::values_by_id, summed over linked functions
+    u32 max_value_ids = 0;       // Largest IRFunction::next_value_id
+    u64 bc_side_table_bytes = 0; // BytecodeBuilder's per-value/per-block tables (liveness,
+                                 // register map, value types), sized for the largest function
+};
+
 // Per-compile wall-clock breakdown, in nanoseconds. Always populated by
 // compile() (the steady_clock overhead is a handful of calls per compile, so
 // there is no reason to gate it). `total_ns` is the whole compile(); the named
@@ -41,6 +80,15 @@ struct CompileTimings {
     u64 ir_validate_ns = 0; // Phase 5c: IR structural validation
     u64 bc_lower_ns = 0;    // Phase 5d: SSA IR -> bytecode (incl. regalloc)
     u64 total_ns = 0;       // Whole compile() call
+
+    // Register-spill counts from bc-lower (not times, but tracked alongside
+    // them so `--time` shows when a change makes large functions spill more).
+    // Deterministic per compile, so `--repeat` reports them unaveraged.
+    u32 spilled_values = 0;            // SSA values evicted, summed over functions
+    u32 spill_ops = 0;                 // SPILL_REG + RELOAD_REG emitted, summed
+    Vector<FunctionSpillStats> spills; // Per function, only those that spilled
+
+    CompileMemory memory; // Zero unless Compiler::set_track_memory(true)
 };
 
 // Compiler - compiles multiple source modules into a single linked BCModule
@@ -74,9 +122,24 @@ public:
     u32 module_count() const { return static_cast<u32>(m_module_states.size()); }
     IRModule* ir_module(u32 index) const { return m_module_states[index].ir_module; }
 
+    // The whole program as the backends see it: every module's functions,
+    // globals and types, after coroutine lowering and optimization (valid
+    // after compile() succeeds; the C backend's input).
+    const IRModule* linked_ir_module() const { return m_linked_ir; }
+
     // Per-phase wall-clock breakdown of the last compile() call.
     const CompileTimings& timings() const { return m_timings; }
 
+    // Also fill CompileTimings::memory on the following compiles.
+    void set_track_memory(bool track) { m_track_memory = track; }
+
+    // Long-lived use (see CompilerSession). save_prelude() registers the
+    // builtin types up front and checkpoints the allocator, TypeEnv and module
+    // registry; restore_prelude() discards the last compile — its sources,
+    // ASTs, IR, errors and everything it allocated — back to that checkpoint.
+    void save_prelude();
+    void restore_prelude();
+
 private:
     // Compilation phases
     bool parse_all();
@@ -92,6 +155,18 @@ private:
     bool detect_cycle(u32 module_idx, Vector<u8>& state, Vector<u32>& order,
                       const tsl::robin_map<StringView, u32>& name_to_idx);
 
+    // Counter values at a phase boundary (see PhaseMemory).
+    struct MemorySample {
+        u64 arena_bytes = 0;
+        u32 arena_chunks = 0;
+        u64 vector_reallocs = 0;
+        u64 vector_bytes_moved = 0;
+        u64 peak_rss_bytes = 0;
+    };
+    // Both are no-ops unless m_track_memory is set.
+    MemorySample sample_memory() const;
+    void record_memory(const MemorySample& start, PhaseMemory& out) const;
+
     // Error reporting
     void add_error(const char* message);
     template <typename... Args>
@@ -132,6 +207,14 @@ private:
 
     // Per-phase wall-clock breakdown of the last compile() (see timings()).
     CompileTimings m_timings;
+    bool m_track_memory = false;
+
+    // Allocator position after the prelude (see save_prelude()).
+    BumpAllocator::Mark m_prelude_mark{};
+
+    // The last link's merged module, including coroutine lowering's
+    // additions; restore_prelude() releases its heap storage.
+    IRModule* m_linked_ir = nullptr;
 
     // Errors
     Vector<const char*> m_errors;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "roxy/compiler/driver/compiler.hpp"
+#include "roxy/core/bump_allocator.hpp"
+#include "roxy/core/string_view.hpp"
+#include "roxy/core/types.hpp"
+
+namespace rx {
+
+// CompilerSession - a long-lived Compiler for hot-reload loops
+//
+// A fresh Compiler rebuilds the builtin prelude (the builtin NativeRegistry,
+// builtin traits, primitive operator tables) and grows a new arena on every
+// compile. A session builds the prelude once, checkpoints it, and rolls back
+// to that checkpoint at the start of each compile, so the arena's chunks stay
+// warm and a small edit only pays for the edited program.
+//
+// Usage:
+//   CompilerSession session;
+//   session.add_native_registry("math", &math_natives);
+//   // on every reload:
+//   Compiler& compiler = session.begin_compile();
+//   compiler.add_source("main", main_source, main_len);
+//   BCModule* module = compiler.compile();
+//
+// begin_compile() frees everything the previous compile put in the arena, and
+// the BCModule it returned names functions through that memory: unload (and
+// delete) the previous module before starting the next compile.
+class CompilerSession {
+public:
+    explicit CompilerSession(u64 arena_capacity = 65536);
+
+    // Add a native module registry. Becomes part of the prelude; the registry
+    // must outlive the session.
+    void add_native_registry(StringView module_name, NativeRegistry* registry);
+
+    // Roll back to the prelude and return the compiler, ready for add_source().
+    Compiler& begin_compile();
+
+    // The compiler of the current (or last) compile, e.g. for errors().
+    Compiler& compiler() { return m_compiler; }
+
+private:
+    BumpAllocator m_allocator;
+    Compiler m_compiler;
+};
+
+} // namespace rx
@@ -94,9 +94,15 @@ public:
     // Get all registered modules
     const tsl::robin_map<StringView, ModuleInfo*>& modules() const { return m_modules; }
 
+    // Prelude checkpoint for CompilerSession: restore_checkpoint() drops every
+    // module registered after save_checkpoint().
+    void save_checkpoint() { m_checkpoint_modules = m_modules; }
+    void restore_checkpoint();
+
 private:
     BumpAllocator& m_allocator;
     tsl::robin_map<StringView, ModuleInfo*> m_modules;
+    tsl::robin_map<StringView, ModuleInfo*> m_checkpoint_modules;
 };
 
 } // namespace rx
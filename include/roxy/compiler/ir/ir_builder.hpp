@@ -140,7 +140,7 @@ private:
     // Bounds-check a `list[i]` read: branch to a `throw IndexError` block when
     // `(u32)index >= len` (a negative index wraps to a huge u32 and is caught,
     // matching the runtime's unsigned compare), else continue in a fresh block.
-    void emit_list_bounds_check(ValueId list_val, ValueId index_val);
+    void emit_list_bounds_check(ValueId list_val, ValueId index_val, Type* list_type);
 
     // Block management
     IRBlock* create_block(StringView name = {});
@@ -203,6 +203,19 @@ private:
     ValueId emit_index_addr(ValueId container, ValueId index, ContainerKind kind,
                             Type* result_type);
     ValueId emit_index_try_addr(ValueId map, ValueId key);
+    // Map bucket scan for range-for: op is MapIterNext / MapIterKey / MapIterValue.
+    ValueId emit_map_iter(IROp op, ValueId map, ValueId index, Type* result_type);
+    // Builtin SIMD vectors (f32x4 / f64x2 / i32x4): one Simd / SimdStore
+    // instruction. Unused operands stay invalid; `imm` is the shuffle pattern.
+    ValueId emit_simd(IROp op, SimdOp simd_op, SimdKind kind, Type* result_type, ValueId a,
+                      ValueId b = ValueId::invalid(), ValueId c = ValueId::invalid(),
+                      u8 imm = 0);
+    // Lower a SIMD method (or the operator / compound assignment resolved to it)
+    // by name — sema registered exactly this set. `arg_exprs` is only read for
+    // shuffle's literal lane selectors.
+    ValueId gen_simd_method(Type* simd_type, StringView name, ValueId self, Span<ValueId> args,
+                            Span<CallArg> arg_exprs, Type* result_type);
+    ValueId gen_simd_constructor(Type* simd_type, CallExpr& call_expr);
     ValueId emit_new(StringView type_name, Span<ValueId> args, Type* result_type);
     ValueId emit_stack_alloc(u32 slot_count, Type* result_type);
     ValueId emit_get_field(ValueId object, StringView field_name, u32 slot_offset, u32 slot_count,
@@ -269,6 +282,21 @@ private:
     void emit_list_elements_retain(ValueId list_val, Type* list_type);
     void emit_map_values_retain(ValueId map_obj, Type* map_type);
 
+    // One counted walk over list elements [start, len), applying `on_elem` to
+    // each (a struct element's address, otherwise the slot value). The list
+    // form of emit_map_value_walk. Returns false (emitting nothing) if the len
+    // native is unavailable.
+    template <typename OnElem>
+    bool emit_list_element_walk(ValueId list_val, Type* elem_type, ValueId start, StringView tag,
+                                OnElem&& on_elem);
+    // Drop the elements `xs.truncate(n)` is about to discard. No-op unless the
+    // element type carries compiler-run drop glue (`ref` elements are released
+    // by the runtime's element_is_ref path).
+    void emit_list_truncate_drops(ValueId list_val, Type* list_type, ValueId new_len);
+    // Balance counts around `xs.fill(v)`: acquire one per slot for `v`, release
+    // what each slot held. Same gate as emit_list_truncate_drops.
+    void emit_list_fill_ownership(ValueId list_val, Type* list_type, ValueId value_val);
+
     // One counted walk over a map's occupied buckets, applying `on_value` to
     // each stored value. Shared by the clear-time destroy and the copy-time
     // retain — the same traversal with one statement swapped. Returns false
@@ -342,8 +370,9 @@ private:
     // pure field paths, so the extra load it emits is side-effect-free.
     ValueId heap_root_of_lvalue(Expr* lvalue, Type** out_type);
 
-    // Local variable mapping entry: name -> SSA value + type (the scope maps
-    // in m_local_scopes hold these; declared here so ScopeSnapshot can use it).
+    // Local variable binding: SSA value + type for one slot of m_local_slots
+    // (declared here so ScopeSnapshot can use it). Trivially copyable, so a
+    // snapshot of every binding is one memcpy.
     struct LocalVar {
         ValueId value;
         Type* type;
@@ -352,18 +381,22 @@ private:
         // LocalVar it already found instead of a separate m_param_is_ptr probe
         // (§3.7). Fixed at definition — reassignments store through the pointer.
         bool is_ptr = false;
+        // Scope depth the binding was declared at; 0 = the slot's name is not
+        // bound right now (never declared, its scope popped, or a snapshot from
+        // before its declaration was restored).
+        u32 depth = 0;
     };
 
     // ── Branch/merge machinery shared by if / else-if chain / when / try ──
 
-    // Deep snapshot of the local-scope SSA bindings, optionally including the
-    // owned locals' is_moved flags. Branch codegen snapshots before the first
-    // branch and restores per branch so each sees the pre-branch state, then
-    // picks a merge-point state (see each statement's policy comment). These
-    // copies were a top profile entry in the 2026-07-05 measurement — if that
-    // ever matters, this type is the single place to swap in an undo log.
+    // Snapshot of the local SSA bindings, optionally including the owned
+    // locals' is_moved flags. Branch codegen snapshots before the first branch
+    // and restores per branch so each sees the pre-branch state, then picks a
+    // merge-point state (see each statement's policy comment). Only the flat
+    // m_local_slots array is copied — the name -> slot map is never part of it
+    // (OPTIMIZATION.md §5.3).
     struct ScopeSnapshot {
-        Vector<tsl::robin_map<StringView, LocalVar>> scopes;
+        Vector<LocalVar> slots;
         Vector<bool> is_moved; // captured only when has_move_state
         bool has_move_state = false;
     };
@@ -371,7 +404,7 @@ private:
     // Copy-restore (snapshot stays reusable). is_moved flags are restored only
     // when the snapshot captured them AND restore_move_state is true.
     void restore_scopes(const ScopeSnapshot& snapshot, bool restore_move_state = true);
-    // Move-restore (single use; steals the scope maps instead of deep-copying).
+    // Move-restore (single use; steals the slot array instead of copying it).
     void restore_scopes_move(ScopeSnapshot&& snapshot);
 
     // Info about a variable needing a phi (block param) at a merge point.
@@ -423,6 +456,8 @@ private:
     void gen_if_else_chain(Stmt* stmt); // Flattened codegen for else-if chains
     void gen_while_stmt(Stmt* stmt);
     void gen_for_stmt(Stmt* stmt);
+    void gen_for_in_stmt(Stmt* stmt);
+    void bind_for_in_element(StringView name, ValueId elem, Type* type);
     void gen_return_stmt(Stmt* stmt);
     void gen_break_stmt(Stmt* stmt);
     void gen_continue_stmt(Stmt* stmt);
@@ -439,6 +474,12 @@ private:
     ValueId gen_unary_expr(Expr* expr);
     ValueId gen_binary_expr(Expr* expr);
     ValueId gen_ternary_expr(Expr* expr);
+    // Generate an operand that only runs on some paths (the right side of
+    // `&&`/`||`, a ternary arm) in its own scope, so the temporaries it creates
+    // are released on that path instead of at the enclosing scope's exit, where
+    // the other paths would release registers they never wrote. The result
+    // itself must not be an owned temporary.
+    ValueId gen_conditional_operand(Expr* expr);
     ValueId gen_call_expr(Expr* expr);
 
     // gen_call_expr decomposition. gen_call_expr handles the early type-driven
@@ -707,9 +748,27 @@ private:
     // `gen_stmt` / `gen_decl`. 0 = unknown (synthesized stubs, builtins).
     u32 m_current_source_line = 0;
 
-    // Local variable mapping: name -> LocalVar (struct declared above the
-    // branch/merge machinery section)
-    Vector<tsl::robin_map<StringView, LocalVar>> m_local_scopes;
+    // Local variable environment (OPTIMIZATION.md §5.3). Local shadowing is
+    // rejected by sema and temporaries get unique names, so a name has at most
+    // one live binding and can own a fixed slot for the whole function:
+    // m_local_slot_index maps name -> slot (filled lazily, never copied or
+    // shrunk until the next function), and m_local_slots holds the slots'
+    // current bindings (LocalVar declared above the branch/merge machinery).
+    tsl::robin_map<StringView, u32> m_local_slot_index;
+    Vector<StringView> m_local_slot_names; // slot -> name
+    Vector<LocalVar> m_local_slots;
+    // Slots declared in each open scope, innermost last: m_scope_marks[d] is
+    // m_scope_bindings.size() when scope d + 1 was pushed, so the scope depth
+    // is m_scope_marks.size(). pop_scope unbinds the slots recorded past the
+    // mark that are still bound at the popped depth (a restore may already
+    // have unbound or re-declared them).
+    Vector<u32> m_scope_bindings;
+    Vector<u32> m_scope_marks;
+    u32 current_scope_depth() const { return static_cast<u32>(m_scope_marks.size()); }
+    // Unbind the innermost scope's slots and drop its mark.
+    void unbind_innermost_scope();
+    // Append the slot of every currently bound local, in slot order.
+    void collect_live_slots(Vector<u32>& out) const;
 
     // Track which parameters are pointers (for out/inout semantics)
     tsl::robin_map<StringView, bool> m_param_is_ptr;
@@ -751,6 +810,10 @@ private:
         Type* type;
         ValueId header_param;  // Block param ValueId in header
         ValueId initial_value; // Value before loop
+        // Params on the merges `break` / `continue` reach from inside the body
+        // (see add_loop_merge_params); invalid until added.
+        ValueId exit_param = ValueId::invalid();
+        ValueId continue_param = ValueId::invalid();
     };
 
     // Loop control flow info (for break/continue)
@@ -968,6 +1031,11 @@ private:
     void collect_assigned_vars_impl(Stmt* stmt, Vector<StringView>& out);
     void collect_assigned_vars_expr_impl(Expr* expr, Vector<StringView>& out);
     Span<BlockArgPair> make_loop_args(const Vector<LoopVarInfo>& loop_vars);
+    // Give a loop's exit block (and, for `for` loops, its increment block) one
+    // param per loop-carried variable: `break` / `continue` leave from the middle
+    // of the body, with values the header params no longer describe.
+    void add_loop_merge_params(IRBlock* exit_block, IRBlock* incr_block,
+                               Vector<LoopVarInfo>& loop_vars);
 
     // Helper to create a span in the allocator
     template <typename T> Span<T> alloc_span(u32 count) {
@@ -261,6 +261,9 @@ template <typename Fn> inline void for_each_operand(IRInst* inst, Fn&& fn) {
         case IROp::IndexGet:
         case IROp::IndexAddr:
         case IROp::IndexTryAddr:
+        case IROp::MapIterNext:
+        case IROp::MapIterKey:
+        case IROp::MapIterValue:
             fn(inst->index_data.container);
             fn(inst->index_data.index);
             break;
@@ -270,6 +273,16 @@ template <typename Fn> inline void for_each_operand(IRInst* inst, Fn&& fn) {
             fn(inst->index_data.value);
             break;
 
+        // ── SIMD (operands a/b/c; unused ones are invalid) ──
+        case IROp::Simd:
+        case IROp::SimdStore:
+            fn(inst->simd.a);
+            if (inst->simd.b.is_valid())
+                fn(inst->simd.b);
+            if (inst->simd.c.is_valid())
+                fn(inst->simd.c);
+            break;
+
         // ── Memory / pointer ops ──
         case IROp::StructCopy:
             fn(inst->struct_copy.dest_ptr);
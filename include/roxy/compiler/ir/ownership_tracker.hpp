@@ -12,10 +12,11 @@ namespace rx {
 struct Type;
 
 // Whether a tracked local owns its value (destroy on cleanup), is a `ref`
-// borrow (decrement its count on cleanup), or an owned string (release on
-// cleanup). RefBorrow/StrOwn locals reuse the owned-local machinery (LIFO
-// scope cleanup, exception records, liveness) with a different cleanup op.
-enum class OwnedKind : u8 { Owned, RefBorrow, StrOwn };
+// borrow (decrement its count on cleanup), an owned string (release on
+// cleanup), or a container pinned for a range-for loop (unpin on cleanup).
+// RefBorrow/StrOwn/Pin locals reuse the owned-local machinery (LIFO scope
+// cleanup, exception records, liveness) with a different cleanup op.
+enum class OwnedKind : u8 { Owned, RefBorrow, StrOwn, Pin };
 
 // A local (or compiler temporary) that owns a value needing cleanup: uniq
 // references, value structs with destructors, containers, ref borrows, and
@@ -178,6 +178,15 @@ enum class IROp : u8 {
     ContainerPin,   // pin a container for a call (borrow_count++) — blocks realloc/free while an
                     // element is borrowed
     ContainerUnpin, // unpin a container after a call (borrow_count--)
+    MapIterNext,    // first occupied bucket at or after index (capacity when none) — range-for
+    MapIterKey,     // key stored in bucket `index` (struct keys: pointer into the bucket)
+    MapIterValue,   // value stored in bucket `index` (struct values: pointer into the bucket)
+
+    // Builtin SIMD value types (f32x4 / f64x2 / i32x4). Operands and vector
+    // results are 16-byte structs addressed by pointer, like every struct
+    // rvalue; `simd.op` picks the lane operation.
+    Simd,      // lane-wise op (vector or scalar result) — see SimdOp
+    SimdStore, // store vector `a` to List `b` at element `c` (bounds-checked)
 
     // Block argument (phi-like)
     BlockArg, // Block parameter - receives value from predecessor
@@ -326,17 +335,59 @@ struct StorePtrData {
     u32 slot_count; // Number of slots to store (1 or 2 for primitives)
 };
 
-// Container kind for IndexGet/IndexSet
-enum class ContainerKind : u8 { List, Map };
+// Container kind for IndexGet/IndexSet. Array is a List whose elements are
+// packed at their natural width (Array<T>).
+enum class ContainerKind : u8 { List, Map, Array };
 
-// Index access data (for IndexGet/IndexSet)
+// Index access data (for IndexGet/IndexSet, and the MapIter* bucket reads)
 struct IndexData {
     ValueId container;
-    ValueId index; // index for List, key for Map
+    ValueId index; // index for List/Array, key for Map
     ValueId value; // only used by IndexSet
     ContainerKind kind;
 };
 
+// Lane operation of an IROp::Simd / IROp::SimdStore instruction.
+enum class SimdOp : u8 {
+    Add,
+    Sub,
+    Mul,
+    Div, // float kinds only
+    Min,
+    Max,
+    And, // i32x4 only
+    Or,
+    Xor,
+    CmpEq, // lane mask (all ones / zero) as an i32x4; f64x2 masks span two i32 lanes
+    CmpNe,
+    CmpLt,
+    CmpLe,
+    Neg,
+    Abs,
+    Sqrt,    // float kinds only
+    Scale,   // vector * scalar `b`
+    Splat,   // scalar `a` broadcast to every lane
+    Shuffle, // lane i of the result = lane `(imm >> 2*i) & 3` of `a`
+    Select,  // bits of `a` where mask `c` is set, else bits of `b`
+    Convert, // f32x4 <-> i32x4 (kind = the source kind); truncates toward zero
+    Hsum,    // scalar: sum of all lanes, (x + y) + (z + w)
+    Dot,     // scalar: hsum(a * b)
+    Eq,      // bool: every lane equal
+    Ne,
+    Load,  // lanes from List `a` starting at element `b` (bounds-checked)
+    Store, // SimdStore only
+};
+
+// SIMD instruction data (for Simd / SimdStore). Unused operands are invalid.
+struct SimdData {
+    SimdOp op;
+    SimdKind kind; // lane layout of the operand vectors
+    u8 imm;        // Shuffle: four 2-bit lane selectors
+    ValueId a;
+    ValueId b;
+    ValueId c;
+};
+
 // Cast data
 struct CastData {
     ValueId source;
@@ -379,6 +430,7 @@ struct IRInst {
         StorePtrData store_ptr;         // For StorePtr
         CastData cast;                  // For Cast
         IndexData index_data;           // For IndexGet/IndexSet
+        SimdData simd;                  // For Simd/SimdStore
         u32 block_arg_index;            // For BlockArg (parameter index)
     };
 
@@ -633,6 +685,9 @@ struct IRModule {
 
 // String representations for debugging
 const char* ir_op_to_string(IROp op);
+const char* simd_op_to_string(SimdOp op);       // "add", "cmp_lt", ... (C helper suffix)
+const char* simd_kind_to_string(SimdKind kind); // "f32x4" / "f64x2" / "i32x4"
+const char* container_kind_to_string(ContainerKind kind); // "list" / "array" / "map"
 void ir_inst_to_string(const IRInst* inst, String& out);
 void ir_block_to_string(const IRBlock* block, String& out);
 void ir_function_to_string(const IRFunction* func, String& out);
@@ -42,6 +42,7 @@ enum class AstKind : u8 {
     StmtIf,
     StmtWhile,
     StmtFor,
+    StmtForIn,
     StmtReturn,
     StmtBreak,
     StmtContinue,
@@ -558,6 +559,19 @@ struct ForStmt {
     Stmt* body;
 };
 
+// Range statement: for x in list body / for (k, v) in map body
+struct ForInStmt {
+    StringView key_name;   // map key binding; empty for the list form
+    StringView value_name; // element (list) or value (map) binding
+    Expr* iterable;
+    Stmt* body;
+    // Set by semantic analysis: the binding types (the element / key / value
+    // type after the `borrowed` transform). key_type is nullptr for a list.
+    // See the annotation contract above struct Expr.
+    Type* key_type;
+    Type* value_type;
+};
+
 // Return statement: return expr;
 struct ReturnStmt {
     Expr* value; // nullptr if just "return;"
@@ -639,6 +653,7 @@ struct Stmt {
         IfStmt if_stmt;
         WhileStmt while_stmt;
         ForStmt for_stmt;
+        ForInStmt for_in_stmt;
         ReturnStmt return_stmt;
         BreakStmt break_stmt;
         ContinueStmt continue_stmt;
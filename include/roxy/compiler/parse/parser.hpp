@@ -78,6 +78,7 @@ private:
     Stmt* if_statement();
     Stmt* while_statement();
     Stmt* for_statement();
+    Stmt* for_in_statement(SourceLocation loc);
     Stmt* return_statement();
     Stmt* break_statement();
     Stmt* continue_statement();
@@ -52,6 +52,12 @@ public:
     // Uses the already-populated TypeEnv for type lookups
     void analyze_single_function(Decl* decl);
 
+    // Register the TypeEnv-wide builtins (builtin traits, KeyError/IndexError,
+    // the SIMD vector types, primitive operator methods) without analyzing a program. Each step is
+    // guarded, so a later analyze() skips it. CompilerSession uses this to
+    // build its prelude once.
+    void register_builtin_types();
+
     // Set the program context (used by the post-pass below to know the
     // analyzer's module name without re-running body analysis).
     void set_program(Program* program);
@@ -211,6 +217,9 @@ private:
     void analyze_if_stmt(Stmt* stmt);
     void analyze_while_stmt(Stmt* stmt);
     void analyze_for_stmt(Stmt* stmt);
+    void analyze_for_in_stmt(Stmt* stmt);
+    bool declare_for_in_binding(StringView name, Type* elem_type, SourceLocation loc,
+                                Type*& out_type);
     void analyze_return_stmt(Stmt* stmt);
     void analyze_break_stmt(Stmt* stmt);
     void analyze_continue_stmt(Stmt* stmt);
@@ -235,7 +244,8 @@ private:
     // Call expression sub-helpers (extracted from analyze_call_expr).
     // Generic function calls (explicit and inferred type args) live on
     // m_generic_calls (see generic_call_resolver.hpp).
-    Type* analyze_list_constructor_call(Expr* expr, CallExpr& ce);
+    // List<T>(cap) and Array<T>(len) share the two-step alloc + init shape.
+    Type* analyze_list_constructor_call(Expr* expr, CallExpr& ce, bool is_array);
     Type* analyze_map_constructor_call(Expr* expr, CallExpr& ce);
     Type* analyze_generic_struct_constructor_call(Expr* expr, CallExpr& ce, StringView func_name);
     Type* analyze_super_call(Expr* expr, CallExpr& ce);
@@ -334,6 +344,11 @@ private:
     // a TypeParam consults the active Phase B trait bounds, and containers
     // recurse so List<T>/Map<K,T> work inside bounded template bodies too.
     bool type_implements_printable(Type* type);
+    // Element-type requirements of the List bulk methods that the native
+    // signature can't express: sort / binary_search need a primitive order,
+    // fill copies its value into every slot, sort_by hands the comparator
+    // element copies. Reports and returns false on a violation.
+    bool check_list_method_element(SourceLocation loc, Type* list_type, StringView method);
     Type* get_unary_result_type(UnaryOp op, Type* operand, SourceLocation loc);
 
     // Unified operator dispatch helpers (work for both primitives and structs)
@@ -391,8 +406,14 @@ private:
     // module's `catch (e: KeyError)` without a per-module symbol.
     void register_builtin_exception_types();
 
-    // List/Map/Coro/enum method population
+    // Register the builtin SIMD value types f32x4 / f64x2 / i32x4 (constructors,
+    // lane-wise methods and operators). Shared TypeEnv, registered once.
+    void register_builtin_simd_types();
+
+    // List/Map/Coro/enum method population (populate_list_methods covers Array)
     void populate_list_methods(Type* list_type);
+    // Array<T> holds bool or numeric primitives only; reports the error.
+    bool check_array_element_type(SourceLocation loc, Type* elem);
     void populate_map_methods(Type* map_type);
     void populate_coro_methods(Type* coro_type);
 
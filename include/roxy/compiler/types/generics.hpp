@@ -128,6 +128,11 @@ public:
     bool has_pending_structs() const;
     Vector<GenericStructInstance*> take_pending_structs();
 
+    // Forget every template and instance (see TypeEnv::restore_checkpoint).
+    // Instances live in the arena, so only their heap-owning members are
+    // released here.
+    void clear();
+
     // Access all instances (for IR builder)
     const Vector<GenericFunInstance*>& all_fun_instances() const { return m_all_fun_instances; }
     const Vector<GenericStructInstance*>& all_struct_instances() const {
@@ -123,6 +123,12 @@ class SymbolTable {
 public:
     explicit SymbolTable(BumpAllocator& allocator);
 
+    // Free the symbol lists of the scopes still open (the global scope at
+    // least), as pop_scope() does for the rest. Scopes are arena-placed, so an
+    // owner about to rewind the arena calls this first; the table must not be
+    // used afterwards.
+    void release_scopes();
+
     // Scope management
     void push_scope(ScopeKind kind);
     void push_function_scope(Type* return_type);
@@ -5,6 +5,7 @@
 #include "roxy/core/bump_allocator.hpp"
 #include "roxy/core/string_view.hpp"
 #include "roxy/core/types.hpp"
+#include "roxy/core/vector.hpp"
 
 #include "roxy/core/tsl/robin_map.h"
 
@@ -48,7 +49,24 @@ public:
     GenericInstantiator& generics() { return m_generics; }
     const GenericInstantiator& generics() const { return m_generics; }
 
+    // Prelude checkpoint for CompilerSession. save_checkpoint() records the
+    // registries and the contents of every type that exists now;
+    // restore_checkpoint() drops what later compiles registered and undoes
+    // their in-place edits to those types (a user `trait Eq;` attaches its decl
+    // to the builtin trait, containers gain methods lazily). Types created after
+    // the checkpoint must not be used once it is restored.
+    void save_checkpoint();
+    void restore_checkpoint();
+
 private:
+    struct TypeSnapshot {
+        Type* type;
+        Type contents;
+        // A trait's method entries are edited in place too (a redeclared
+        // builtin method adopts the user's default body).
+        Vector<TraitMethodInfo> trait_methods;
+    };
+
     TypeCache m_types;
     GenericInstantiator m_generics;
     tsl::robin_map<StringView, Type*> m_named_types;
@@ -58,6 +76,10 @@ private:
     Type* m_eq_type = nullptr;
     Type* m_ord_type = nullptr;
     Type* m_exception_type = nullptr;
+
+    tsl::robin_map<StringView, Type*> m_checkpoint_named_types;
+    tsl::robin_map<StringView, Type*> m_checkpoint_trait_types;
+    Vector<TypeSnapshot> m_checkpoint_types;
 };
 
 } // namespace rx
@@ -74,6 +74,17 @@ enum class TypeKind : u8 {
     Error, // Sentinel for type errors, allows analysis to continue
 };
 
+// Lane layout of a builtin SIMD value type. The three vector types are
+// ordinary 16-byte structs to the type system (fields x/y/z/w, 4 slots); the
+// tag is what routes their methods and operators to the IROp::Simd lowering
+// instead of a call. None for every other struct.
+enum class SimdKind : u8 {
+    None,
+    F32x4, // 4 x f32
+    F64x2, // 2 x f64
+    I32x4, // 4 x i32 (also the lane-mask type of the comparisons)
+};
+
 // Constructor information for struct types
 struct ConstructorInfo {
     StringView name; // empty for default constructor
@@ -214,6 +225,14 @@ struct StructTypeInfo {
     // unsound direction — so `noncopyable()` asserts on it rather than letting a
     // default-initialized `false` through.
     bool move_only_derived;
+    // Synthesized coroutine state struct (`__coro_<fn>`, coroutine_lowering).
+    // Its heap objects are recycled through a per-type free pool.
+    bool is_coro_state;
+    // Coroutine state whose `$$delete` releases nothing (set by
+    // generate_coro_destructor).
+    bool coro_dtor_is_noop;
+    // Builtin SIMD vector type (f32x4 / f64x2 / i32x4, register_builtin_simd_types).
+    SimdKind simd_kind;
 
     // Find a field by name, returns nullptr if not found
     const FieldInfo* find_field(StringView field_name) const;
@@ -252,6 +271,7 @@ struct ListTypeInfo {
     Span<MethodInfo> methods;     // Builtin methods with concrete types
     StringView alloc_native_name; // "list_alloc" — set by SemanticAnalyzer
     StringView copy_native_name;  // "list_copy" — deep-copy for value parameter passing
+    bool is_array;                // Array<T>: fixed-length, elements packed at natural width
 };
 
 // Type info for map types
@@ -347,6 +367,7 @@ struct Type {
     bool is_trait() const { return kind == TypeKind::Trait; }
 
     bool is_list() const { return kind == TypeKind::List; }
+    bool is_array() const { return kind == TypeKind::List && list_info.is_array; }
 
     bool is_map() const { return kind == TypeKind::Map; }
 
@@ -502,6 +523,7 @@ public:
 
     // Factory methods for compound types (with interning)
     Type* list_type(Type* element_type);
+    Type* array_type(Type* element_type);
     Type* map_type(Type* key_type, Type* value_type);
     Type* coroutine_type(Type* yield_type);
     Type* coroutine_type_for_func(Type* yield_type, StringView func_name);
@@ -557,6 +579,16 @@ public:
     // Lookup primitive type by name
     Type* primitive_by_name(StringView name);
 
+    // Prelude checkpoint (driven by TypeEnv::save_checkpoint). Remembers the
+    // interned compound types so restore_checkpoint() forgets the ones interned
+    // since. The primitive method/trait tables are only written while the
+    // prelude is built, so they need no snapshot.
+    void save_checkpoint();
+    void restore_checkpoint();
+
+    // Appends every primitive singleton and interned compound type.
+    void collect_types(Vector<Type*>& out) const;
+
 private:
     Type* create_primitive(TypeKind kind);
     Type* intern_type(Type* type);
@@ -586,6 +618,7 @@ private:
 
     // Type interning cache for compound types
     tsl::robin_map<Type*, Type*, TypeHash, TypeEqual> m_interned;
+    tsl::robin_map<Type*, Type*, TypeHash, TypeEqual> m_checkpoint_interned;
 
     // Primitive method and trait tables (keyed by TypeKind)
     tsl::robin_map<u8, Vector<MethodInfo>> m_primitive_methods;
@@ -763,6 +796,11 @@ void type_to_string(const Type* type, String& out);
 // 0 for null or types with no value representation (void, never, trait, ...).
 u32 get_type_slot_count(Type* type);
 
+// Byte width of an `Array<T>` element, which is stored at its natural size:
+// 1 for bool/i8/u8, 2 for i16/u16, 4 for i32/u32/f32, 8 for i64/u64/f64.
+// Returns 0 for types that can't be Array elements.
+u32 array_element_size(Type* type);
+
 // Append one entry to a bump-allocated Span list on StructTypeInfo. Each call
 // rebuilds the span into fresh arena memory (O(n) copy) — fine at
 // declaration-pass rates; see TODO.md for the Vector-freeze alternative.
@@ -13,6 +13,12 @@ namespace rx {
 
 // Chunk-based bump allocator that never frees memory until destruction.
 // This ensures pointers remain valid even when new chunks are allocated.
+//
+// mark()/rewind() let a long-lived owner (CompilerSession) drop everything
+// allocated after a point in one step. Rewinding keeps the chunks: later
+// allocations refill them instead of going back to malloc. No destructors run,
+// so objects past the mark must not own heap memory the caller still cares
+// about.
 class BumpAllocator {
     struct Chunk {
         Chunk* next;
@@ -23,6 +29,12 @@ class BumpAllocator {
     };
 
 public:
+    // A position in the allocator, from mark().
+    struct Mark {
+        Chunk* chunk;
+        u64 used;
+    };
+
     BumpAllocator(u64 initial_capacity) : m_head(nullptr), m_current(nullptr) {
         assert(initial_capacity >= 64);
         m_current = m_head = allocate_chunk(initial_capacity);
@@ -49,15 +61,23 @@ public:
 
         // Check if current chunk has enough space
         if (m_current->used + total_size > m_current->capacity) {
-            // Allocate a new chunk (at least double the size, or enough for this allocation)
-            u64 new_capacity = m_current->capacity * 2;
-            if (new_capacity < size + align) {
-                new_capacity = size + align;
+            Chunk* next = m_current->next;
+            if (next && next->capacity >= size + align) {
+                // Reuse a chunk kept by rewind()
+                next->used = 0;
+                m_current = next;
+            } else {
+                // Allocate a new chunk (at least double the size, or enough for this
+                // allocation), ahead of any kept chunk too small for it
+                u64 new_capacity = m_current->capacity * 2;
+                if (new_capacity < size + align) {
+                    new_capacity = size + align;
+                }
+                Chunk* new_chunk = allocate_chunk(new_capacity);
+                new_chunk->next = next;
+                m_current->next = new_chunk;
+                m_current = new_chunk;
             }
-            Chunk* new_chunk = allocate_chunk(new_capacity);
-            new_chunk->next = nullptr;
-            m_current->next = new_chunk;
-            m_current = new_chunk;
 
             // Recalculate alignment in new chunk
             base = m_current->data();
@@ -71,6 +91,34 @@ public:
         return aligned;
     }
 
+    Mark mark() const { return {m_current, m_current->used}; }
+
+    // Free everything allocated since `mark` for reuse. Pointers into that
+    // range dangle afterwards.
+    void rewind(Mark mark) {
+        m_current = mark.chunk;
+        m_current->used = mark.used;
+    }
+
+    // Bytes handed out so far, alignment padding included (walks the chunk
+    // list; meant for accounting, not hot paths — see CompileMemory).
+    u64 bytes_used() const {
+        u64 total = 0;
+        for (Chunk* chunk = m_head; chunk != m_current; chunk = chunk->next) {
+            total += chunk->used;
+        }
+        return total + m_current->used;
+    }
+
+    // Chunks malloc'd so far, including ones kept by rewind().
+    u32 chunk_count() const {
+        u32 count = 0;
+        for (Chunk* chunk = m_head; chunk; chunk = chunk->next) {
+            count++;
+        }
+        return count;
+    }
+
     template <typename T> Span<T> alloc_span(const Vector<T>& vec) {
         if (vec.empty())
             return Span<T>();
@@ -10,6 +10,15 @@
 
 namespace rx {
 
+// Buffer growth counters for every Vector on this thread, read as deltas by
+// `roxy --time=mem` (see CompileMemory). Only bumped when a Vector reallocates,
+// which already pays for a new[] and a delete[].
+struct VectorGrowthStats {
+    u64 reallocs = 0;    // buffer (re)allocations from push/insert/reserve/resize
+    u64 bytes_moved = 0; // element bytes moved from the old buffer
+};
+inline thread_local VectorGrowthStats g_vector_growth;
+
 template <typename T, typename Index = u32> class Vector {
     Index m_capacity, m_size;
     T* m_data = nullptr;
@@ -123,6 +132,7 @@ public:
     }
 
     void resize(Index new_size) {
+        count_realloc();
         T* new_data = new T[new_size];
         move(m_data, m_size, new_data);
         delete[] m_data;
@@ -133,6 +143,7 @@ public:
     void reserve(Index new_capacity) {
         if (new_capacity <= m_capacity)
             return;
+        count_realloc();
         T* new_data = new T[new_capacity];
         move(m_data, m_size, new_data);
         delete[] m_data;
@@ -193,11 +204,17 @@ private:
         }
     }
 
+    void count_realloc() const {
+        g_vector_growth.reallocs++;
+        g_vector_growth.bytes_moved += sizeof(T) * m_size;
+    }
+
     void ensure_capacity(Index min_capacity) {
 #define MAX(a, b) (((a) > (b)) ? (a) : (b))
         if (min_capacity <= m_capacity)
             return;
         size_t new_capacity = MAX(m_capacity * 2, min_capacity);
+        count_realloc();
         T* new_data = new T[new_capacity];
         move(m_data, m_size, new_data);
         delete[] m_data;
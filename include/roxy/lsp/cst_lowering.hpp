@@ -38,6 +38,7 @@ private:
     Stmt* lower_if_stmt(SyntaxNode* node);
     Stmt* lower_while_stmt(SyntaxNode* node);
     Stmt* lower_for_stmt(SyntaxNode* node);
+    Stmt* lower_for_in_stmt(SyntaxNode* node);
     Stmt* lower_return_stmt(SyntaxNode* node);
     Stmt* lower_when_stmt(SyntaxNode* node);
     Stmt* lower_try_stmt(SyntaxNode* node);
@@ -88,6 +88,7 @@ private:
     SyntaxNode* parse_if_stmt();
     SyntaxNode* parse_while_stmt();
     SyntaxNode* parse_for_stmt();
+    SyntaxNode* parse_for_in_stmt();
     SyntaxNode* parse_return_stmt();
     SyntaxNode* parse_break_stmt();
     SyntaxNode* parse_continue_stmt();
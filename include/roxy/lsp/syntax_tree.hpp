@@ -154,6 +154,7 @@ enum class SyntaxKind : u16 {
     NodeIfStmt,
     NodeWhileStmt,
     NodeForStmt,
+    NodeForInStmt,
     NodeReturnStmt,
     NodeBreakStmt,
     NodeContinueStmt,
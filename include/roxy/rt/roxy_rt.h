@@ -1,9 +1,11 @@
 #pragma once
 
 #include <assert.h>
+#include <math.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -96,8 +98,15 @@ typedef struct {
 // generated `main()` (or the embedder, via `roxy::ScopedContext`) does the
 // same. The `allocator` slot is a function-pointer vtable (see
 // `roxy_allocator` below); `exception_state` and `user_data` are
-// embedder-defined `void*` placeholders today.
+// embedder-defined `void*` placeholders today. The `output_*` fields are the
+// print buffer (see "Output channel"); `pools` are the free pools (see
+// "Free Pools").
 struct roxy_allocator;
+struct roxy_free_pool;
+
+// Receives a batch of script output. `data` is not NUL-terminated.
+typedef void (*roxy_output_sink)(void* userdata, const char* data, uint32_t length);
+
 typedef struct roxy_ctx {
     struct roxy_allocator* allocator;
     // Optional content-keyed string intern table. When non-null,
@@ -107,6 +116,12 @@ typedef struct roxy_ctx {
     void* string_intern;
     void* exception_state;
     void* user_data;
+    roxy_output_sink output_sink; // null = stdout
+    void* output_userdata;
+    char* output_buf; // ROXY_OUTPUT_BUFFER_SIZE bytes, allocated on first write
+    uint32_t output_len;
+    uint32_t pool_count;          // Entries in `pools`
+    struct roxy_free_pool* pools; // Indexed by type_id; grown on the first park
 } roxy_ctx;
 
 // ===== Allocator vtable =====
@@ -189,8 +204,8 @@ roxy_heap_stats roxy_rt_heap_stats(void);
 // Zero-initialize a context. Safe to call again after `roxy_ctx_destroy`.
 void roxy_ctx_init(roxy_ctx* ctx);
 
-// Tear down any owned state. Currently a no-op; reserved for future
-// allocator/exception-state cleanup.
+// Tear down owned state: flushes and frees the output buffer and frees every
+// object parked in the context's free pools.
 void roxy_ctx_destroy(roxy_ctx* ctx);
 
 // Replace the current thread's active context. Pass `nullptr` to clear it.
@@ -217,6 +232,37 @@ void roxy_free(void* data);
 // Get the object header from a data pointer.
 roxy_object_header* roxy_get_header(void* data);
 
+// ===== Free Pools =====
+//
+// A free pool parks freed objects of one type so the next allocation of that
+// type takes one back instead of going through the allocator. Coroutine state
+// structs are pooled: a generator in a hot loop is created and exhausted on
+// every iteration, and each cycle would otherwise cost an allocator round-trip.
+//
+// A parked object keeps its header with weak_generation 0, so weak refs and
+// double-free checks see it as dead. Its data is zeroed and it gets a fresh
+// generation when reused. The pools belong to the active `roxy_ctx`, one per
+// type_id, so threads and contexts never share one. Parked objects stay
+// allocated until `roxy_ctx_destroy`, which must run before a heap census or
+// allocator shutdown. The VM keeps its own pools with the same layout (vm.hpp).
+typedef struct roxy_free_pool {
+    void* head;        // Most recently parked object's data; the link is its first word
+    uint32_t count;    // Objects parked
+    uint32_t capacity; // Park at most this many (0 = pass every free through)
+} roxy_free_pool;
+
+// Bounds what a burst of frees can pin.
+#define ROXY_FREE_POOL_CAPACITY 64
+
+// roxy_alloc, reusing an object parked in the active context's pool for
+// `type_id` when there is one. `data_size` must be the same for every call
+// with one type_id and at least a pointer wide.
+void* roxy_pool_alloc(uint32_t data_size, uint32_t type_id);
+
+// roxy_free, parking the object in the active context's pool for its type
+// instead while that pool has room. With no active context it is roxy_free.
+void roxy_pool_free(void* data);
+
 // ===== Reference Counting =====
 
 void roxy_ref_inc(void* data);
@@ -311,14 +357,19 @@ bool roxy_weak_valid(void* ptr, uint64_t generation);
 //
 // Strings are immutable in Roxy, so capacity is always `length+1` and isn't
 // stored. The 8-byte slot is reused for a cached hash — `hash` holds the low
-// 32 bits of XXH3_64 over the character bytes, computed at allocation time.
-// `Map<string, V>` lookups read this field directly to avoid re-hashing on
-// every probe.
+// 32 bits of XXH3_64 over the character bytes. It is filled lazily: dynamic
+// strings (concat / substr / to_string / f-string parts) start at
+// ROXY_STR_HASH_UNSET and pay for the pass only on the first
+// `roxy_string_hash` or `Map<string, V>` probe, after which every probe reads
+// the field. Interned literals get it for free from their intern probe. A real
+// hash that folds to the sentinel is stored as 1.
 typedef struct {
     uint32_t length;
     uint32_t hash;
 } roxy_string_header;
 
+#define ROXY_STR_HASH_UNSET 0u
+
 // ===== String Operations =====
 
 // Strings are reference-counted (lifetime audit finding 9b). `ref_count` in the
@@ -351,6 +402,22 @@ char* roxy_string_chars(void* s);
 // Get string length.
 int32_t roxy_string_len(void* s);
 
+// ===== Output channel =====
+//
+// `print` appends to the active context's buffer instead of calling printf per
+// line. The buffer goes to the context's sink (stdout by default) when it fills,
+// on roxy_output_flush (the `flush()` builtin), when the outermost VM entry call
+// returns or fails, and in roxy_ctx_destroy. With no active context a write goes
+// straight to stdout.
+#define ROXY_OUTPUT_BUFFER_SIZE 16384
+
+// Route `ctx`'s output to `sink` (null restores stdout). Pending output goes to
+// the old sink first.
+void roxy_ctx_set_output_sink(roxy_ctx* ctx, roxy_output_sink sink, void* userdata);
+void roxy_ctx_flush_output(roxy_ctx* ctx);
+void roxy_output_write(const char* data, uint32_t length);
+void roxy_output_flush(void);
+
 // Print a string followed by newline.
 void roxy_print(void* s);
 void roxy_print_bool(bool v);
@@ -377,17 +444,47 @@ int32_t roxy_string_char_at(void* s, int32_t index);
 // VM: require start <= length, then len <= length - start).
 void* roxy_string_substr(void* s, int32_t start, int32_t len);
 
-// Parse a string as a double (via strtod; trailing junk is ignored).
+// Parse a string as a double. Lenient: leading whitespace and trailing junk are
+// ignored, and no number at all gives 0.
 double roxy_string_to_f64(void* s);
 
+// Strict parses (from_chars): the whole string must be the number, with an
+// optional sign and no whitespace. On failure the plain forms raise the runtime
+// trap and return 0; the `_or` forms return `fallback`.
+int64_t roxy_string_to_i64(void* s);
+int32_t roxy_string_to_i32(void* s);
+int64_t roxy_string_to_i64_or(void* s, int64_t fallback);
+int32_t roxy_string_to_i32_or(void* s, int32_t fallback);
+double roxy_string_to_f64_or(void* s, double fallback);
+
 // Single-character string from an ASCII code.
 void* roxy_string_from_code(int32_t code);
 
+// Byte offset of the first `needle` at or after `start`, or -1. A start past the
+// end finds nothing; a negative start raises the runtime trap. Searches run on
+// memchr, so long gaps between candidate bytes are skipped a vector at a time.
+int32_t roxy_string_find(void* s, void* needle, int32_t start);
+int32_t roxy_string_find_char(void* s, int32_t code, int32_t start);
+bool roxy_string_starts_with(void* s, void* prefix);
+bool roxy_string_ends_with(void* s, void* suffix);
+// Strip leading and trailing ASCII whitespace. Returns `s` itself (retained)
+// when there is none.
+void* roxy_string_trim(void* s);
+// Every non-overlapping `target` replaced by `replacement`, in a single
+// allocation. An empty `target` raises the runtime trap.
+void* roxy_string_replace(void* s, void* target, void* replacement);
+// The pieces between separators as a List<string> ("a,,b" gives "a", "", "b").
+// An empty separator raises the runtime trap and gives an empty list.
+void* roxy_string_split(void* s, void* sep);
+// A List<string> joined with `sep`; the result is sized first and allocated once.
+void* roxy_string_join(void* parts, void* sep);
+
 // Intern-table operations exposed for the runtime's own string-allocating
 // helpers. The `table` argument is a `rx::StringInternTable*` cast to `void*`
 // (same type as `roxy_ctx.string_intern`). Callers should not hold the
-// looked-up pointer across mutations of the same table.
-void* roxy_string_intern_lookup(void* table, const char* chars, uint32_t length);
+// looked-up pointer across mutations of the same table. `hash` is
+// XXH3_64bits(chars, length), which the caller keeps for the new string.
+void* roxy_string_intern_lookup(void* table, const char* chars, uint32_t length, uint64_t hash);
 void roxy_string_intern_insert(void* table, const char* chars, uint32_t length, void* string_obj);
 
 // ===== to_string conversions =====
@@ -401,6 +498,14 @@ void* roxy_f32_to_string(float val);
 void* roxy_f64_to_string(double val);
 void* roxy_string_to_string(void* val);
 
+// Float formatting beyond to_string's six significant digits: the shortest
+// text that parses back to exactly `val`, and fixed-point with `decimals`
+// (0..ROXY_FMT_MAX_DECIMALS; outside that raises the runtime trap).
+#define ROXY_FMT_MAX_DECIMALS 20
+void* roxy_f64_fmt(double val);
+void* roxy_f32_fmt(float val);
+void* roxy_f64_fmt_fixed(double val, int32_t decimals);
+
 // ===== Utility natives =====
 
 // Seconds since an arbitrary epoch (high-resolution monotonic-ish clock).
@@ -451,6 +556,375 @@ void* roxy_list_copy(void* src);
 // roxy_map_mark_ref_values). Emitted right after a List<ref T> is constructed.
 void roxy_list_mark_ref_elements(void* self);
 
+// ===== List Bulk Operations =====
+
+// Element ordering for roxy_list_sort / roxy_list_binary_search. The compiler
+// passes it as a hidden constant derived from the static element type (the
+// header only knows slot widths). Floats order NaN after every number;
+// strings order bytewise, a proper prefix first. The narrow orders (bool
+// sorts as U8) compare only the low bytes of each 32-bit element slot.
+typedef enum {
+    ROXY_LIST_ORDER_I32 = 0,
+    ROXY_LIST_ORDER_U32 = 1,
+    ROXY_LIST_ORDER_I64 = 2,
+    ROXY_LIST_ORDER_U64 = 3,
+    ROXY_LIST_ORDER_F32 = 4,
+    ROXY_LIST_ORDER_F64 = 5,
+    ROXY_LIST_ORDER_STRING = 6,
+    ROXY_LIST_ORDER_I8 = 7,
+    ROXY_LIST_ORDER_U8 = 8,
+    ROXY_LIST_ORDER_I16 = 9,
+    ROXY_LIST_ORDER_U16 = 10
+} roxy_list_order;
+
+// Strict "a before b" over two element byte pointers, for roxy_list_sort_by.
+// `ctx` is passed through untouched (a closure env in AOT code, a dispatch
+// frame in the VM).
+typedef bool (*roxy_list_less_fn)(void* ctx, const void* a, const void* b);
+
+// Sort ascending in place (unstable). Moves no storage, so allowed while pinned.
+void roxy_list_sort(void* self, int32_t order);
+// Stable sort by a caller-supplied comparator. The list is pinned for the
+// duration so the comparator can read it but not reshape it.
+void roxy_list_sort_by(void* self, roxy_list_less_fn less, void* ctx);
+// Search a list sorted by `order`: the index of an element equal to *value_src,
+// or -(insertion_point + 1) when there is none.
+int32_t roxy_list_binary_search(void* self, const void* value_src, int32_t order);
+// Move every element of `other` onto the end of `self`, leaving `other` empty.
+// The caller still drops `other`: after a refusal (self-extend, `self` pinned,
+// out of memory) it holds all of its elements. Refused while `self` is pinned.
+void roxy_list_extend(void* self, void* other);
+// Overwrite every element with *value_src. In place, so allowed while pinned.
+void roxy_list_fill(void* self, const void* value_src);
+// Drop elements past `length` (no-op when already shorter). Refused while pinned.
+void roxy_list_truncate(void* self, int32_t length);
+// Grow capacity to at least `capacity` elements. Refused while pinned.
+void roxy_list_reserve(void* self, int32_t capacity);
+// Exchange two elements. In place, so allowed while pinned.
+void roxy_list_swap(void* self, int32_t i, int32_t j);
+
+// ===== Array Header =====
+
+// Dense `Array<T>` of a primitive element type. Layout-compatible with
+// roxy_list_header and allocated under ROXY_TYPEID_LIST, so pin/unpin, the
+// length read and the buffer free are shared with List. Elements are packed at
+// their natural width: element[i] starts at &data[i * element_size].
+typedef struct {
+    uint32_t length;
+    uint32_t capacity;
+    uint32_t element_size;     // bytes per element: 1, 2, 4 or 8
+    uint8_t element_is_signed; // narrow loads sign-extend (signed ints, f32 bits)
+    uint8_t is_mapped;         // 1 = data is a private file mapping (roxy_map_file): unmapped, not freed
+    uint16_t borrow_count; // outstanding element borrows (for-in); see roxy_list_header
+    uint8_t* data;
+} roxy_array_header;
+
+// ===== Array Operations =====
+//
+// Values are byte pointers to `element_size` bytes. Range errors raise the
+// runtime trap and leave the array untouched; a resize is refused while the
+// array is pinned, like a structural List mutation.
+
+void* roxy_array_alloc(int32_t element_size, int32_t element_is_signed);
+// Allocate `length` zeroed elements (capacity == length).
+void roxy_array_init(void* self, int32_t length);
+void roxy_array_delete(void* self);
+int32_t roxy_array_len(void* self);
+void* roxy_array_get(void* self, int32_t index);
+void roxy_array_set(void* self, int32_t index, const void* value_src);
+void* roxy_array_copy(void* src);
+// Overwrite every element with *value_src.
+void roxy_array_fill(void* self, const void* value_src);
+// A new array holding elements [start, end).
+void* roxy_array_slice(void* self, int32_t start, int32_t end);
+// memmove `count` elements from src[src_start..] to self[dst_start..]; src may
+// be self. Both arrays must have the same element size.
+void roxy_array_copy_from(void* self, int32_t dst_start, void* src, int32_t src_start,
+                          int32_t count);
+// Set the length; new elements are zero. Refused while pinned.
+void roxy_array_resize(void* self, int32_t length);
+
+// Address of element `index`, the C backend's subscript. Out-of-range asserts,
+// as roxy_list_get does.
+static inline void* roxy_array_elem(void* self, int32_t index) {
+    roxy_array_header* hdr = (roxy_array_header*)self;
+    assert(index >= 0 && (uint32_t)index < hdr->length && "Array index out of bounds");
+    return hdr->data + (size_t)index * hdr->element_size;
+}
+
+// ===== File I/O =====
+//
+// Streaming and mapped file access for inputs too large to read_file. A reader
+// or writer is an opaque handle (0 = none) owned by the script-side wrapper in
+// the bundled `io` module, which closes it on destruction. Open failures and
+// use of a closed handle raise the runtime trap.
+
+// The file as an Array<u8>. The bytes are a private copy-on-write mapping, so
+// nothing is read up front and writes stay in this process. Where mapping is
+// unavailable the file is read into an ordinary buffer instead.
+void* roxy_map_file(void* path);
+
+// Bytes [start, end) of an Array<u8> as a new string.
+void* roxy_bytes_to_string(void* bytes, int32_t start, int32_t end);
+
+// Reader: next() buffers up to the next `delim` byte (dropped, as is a '\r'
+// before a '\n' delimiter); record() is that record as a string. next() is
+// false once the input is exhausted. The last record needn't be terminated.
+uint64_t roxy_file_reader_open(void* path);
+bool roxy_file_reader_next(uint64_t reader, int32_t delim);
+void* roxy_file_reader_record(uint64_t reader);
+void roxy_file_reader_close(uint64_t reader);
+
+// Writer: writes collect in a 64 KiB buffer that reaches the file when it
+// fills, on flush(), and on close().
+uint64_t roxy_file_writer_open(void* path, bool append);
+void roxy_file_writer_write(uint64_t writer, void* s);
+void roxy_file_writer_flush(uint64_t writer);
+void roxy_file_writer_close(uint64_t writer);
+
+// ===== SIMD vectors (f32x4 / f64x2 / i32x4) =====
+//
+// The builtin vector types are 16-byte structs (x/y/z/w or x/y). Helpers take
+// byte pointers to them — generated struct locals are only 4-byte aligned, so
+// operands are memcpy'd through a register-sized temp, which compiles to one
+// unaligned vector load. Element-wise arithmetic, bitwise ops and compares use
+// GCC/Clang vector extensions; everything else is a fixed-trip lane loop the
+// optimizer unrolls (and SLP-vectorizes where the target has the instruction).
+// i32x4 arithmetic runs on uint32 lanes so it wraps like the scalar i32 ops.
+// Compare results are lane masks: all-ones or zero in each lane.
+
+#if defined(__GNUC__) || defined(__clang__)
+typedef float roxy_v4f32 __attribute__((vector_size(16)));
+typedef double roxy_v2f64 __attribute__((vector_size(16)));
+typedef int32_t roxy_v4i32 __attribute__((vector_size(16)));
+typedef uint32_t roxy_v4u32 __attribute__((vector_size(16)));
+
+#define ROXY_VEC_LANEWISE(kind, name, VT, LT, MT, N, OP)                                 \
+    static inline void roxy_##kind##_##name(void* d, const void* a, const void* b) {     \
+        VT x, y, r;                                                                       \
+        memcpy(&x, a, 16);                                                                \
+        memcpy(&y, b, 16);                                                                \
+        r = x OP y;                                                                       \
+        memcpy(d, &r, 16);                                                                \
+    }
+#define ROXY_VEC_COMPARE(kind, name, VT, LT, MT, N, OP)                                  \
+    static inline void roxy_##kind##_##name(void* d, const void* a, const void* b) {     \
+        VT x, y;                                                                          \
+        memcpy(&x, a, 16);                                                                \
+        memcpy(&y, b, 16);                                                                \
+        __typeof__(x OP y) r = x OP y;                                                    \
+        memcpy(d, &r, 16);                                                                \
+    }
+#else
+#define ROXY_VEC_LANEWISE(kind, name, VT, LT, MT, N, OP)                                 \
+    static inline void roxy_##kind##_##name(void* d, const void* a, const void* b) {     \
+        LT x[N], y[N], r[N];                                                              \
+        memcpy(x, a, 16);                                                                 \
+        memcpy(y, b, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = x[i] OP y[i];                                                          \
+        memcpy(d, r, 16);                                                                 \
+    }
+#define ROXY_VEC_COMPARE(kind, name, VT, LT, MT, N, OP)                                  \
+    static inline void roxy_##kind##_##name(void* d, const void* a, const void* b) {     \
+        LT x[N], y[N];                                                                    \
+        MT r[N];                                                                          \
+        memcpy(x, a, 16);                                                                 \
+        memcpy(y, b, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = (x[i] OP y[i]) ? ~(MT)0 : 0;                                           \
+        memcpy(d, r, 16);                                                                 \
+    }
+#endif
+
+// Ops every layout shares. LT is the lane type, AT the lane type arithmetic
+// runs in (uint32_t for i32x4), MT the same-width mask lane.
+#define ROXY_VEC_COMMON(kind, VT, AVT, LT, AT, MT, N)                                    \
+    ROXY_VEC_LANEWISE(kind, add, AVT, AT, MT, N, +)                                       \
+    ROXY_VEC_LANEWISE(kind, sub, AVT, AT, MT, N, -)                                       \
+    ROXY_VEC_LANEWISE(kind, mul, AVT, AT, MT, N, *)                                       \
+    ROXY_VEC_COMPARE(kind, cmp_eq, VT, LT, MT, N, ==)                                     \
+    ROXY_VEC_COMPARE(kind, cmp_ne, VT, LT, MT, N, !=)                                     \
+    ROXY_VEC_COMPARE(kind, cmp_lt, VT, LT, MT, N, <)                                      \
+    ROXY_VEC_COMPARE(kind, cmp_le, VT, LT, MT, N, <=)                                     \
+    static inline void roxy_##kind##_min(void* d, const void* a, const void* b) {        \
+        LT x[N], y[N], r[N];                                                              \
+        memcpy(x, a, 16);                                                                 \
+        memcpy(y, b, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = x[i] < y[i] ? x[i] : y[i];                                             \
+        memcpy(d, r, 16);                                                                 \
+    }                                                                                     \
+    static inline void roxy_##kind##_max(void* d, const void* a, const void* b) {        \
+        LT x[N], y[N], r[N];                                                              \
+        memcpy(x, a, 16);                                                                 \
+        memcpy(y, b, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = x[i] > y[i] ? x[i] : y[i];                                             \
+        memcpy(d, r, 16);                                                                 \
+    }                                                                                     \
+    static inline void roxy_##kind##_neg(void* d, const void* a) {                       \
+        AT x[N], r[N];                                                                    \
+        memcpy(x, a, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = -x[i];                                                                 \
+        memcpy(d, r, 16);                                                                 \
+    }                                                                                     \
+    static inline void roxy_##kind##_scale(void* d, const void* a, LT s) {               \
+        AT x[N], r[N];                                                                    \
+        memcpy(x, a, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = x[i] * (AT)s;                                                          \
+        memcpy(d, r, 16);                                                                 \
+    }                                                                                     \
+    static inline void roxy_##kind##_splat(void* d, LT s) {                              \
+        LT r[N];                                                                          \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = s;                                                                     \
+        memcpy(d, r, 16);                                                                 \
+    }                                                                                     \
+    static inline void roxy_##kind##_shuffle(void* d, const void* a, int imm) {          \
+        LT x[N], r[N];                                                                    \
+        memcpy(x, a, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            r[i] = x[(imm >> (2 * i)) & 3];                                               \
+        memcpy(d, r, 16);                                                                 \
+    }                                                                                     \
+    /* Bitwise over the raw 16 bytes: mask bits set take `a`. */                          \
+    static inline void roxy_##kind##_select(void* d, const void* a, const void* b,       \
+                                            const void* m) {                              \
+        uint32_t x[4], y[4], k[4], r[4];                                                  \
+        memcpy(x, a, 16);                                                                 \
+        memcpy(y, b, 16);                                                                 \
+        memcpy(k, m, 16);                                                                 \
+        for (int i = 0; i < 4; i++)                                                       \
+            r[i] = (x[i] & k[i]) | (y[i] & ~k[i]);                                        \
+        memcpy(d, r, 16);                                                                 \
+    }                                                                                     \
+    static inline LT roxy_##kind##_hsum(const void* a) {                                 \
+        AT x[N];                                                                          \
+        memcpy(x, a, 16);                                                                 \
+        return (LT)(N == 4 ? (x[0] + x[1]) + (x[2] + x[3 % N]) : x[0] + x[1]);            \
+    }                                                                                     \
+    static inline LT roxy_##kind##_dot(const void* a, const void* b) {                   \
+        AT x[N], y[N];                                                                    \
+        memcpy(x, a, 16);                                                                 \
+        memcpy(y, b, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            x[i] = x[i] * y[i];                                                           \
+        return (LT)(N == 4 ? (x[0] + x[1]) + (x[2] + x[3 % N]) : x[0] + x[1]);            \
+    }                                                                                     \
+    static inline bool roxy_##kind##_eq(const void* a, const void* b) {                  \
+        LT x[N], y[N];                                                                    \
+        bool equal = true;                                                                \
+        memcpy(x, a, 16);                                                                 \
+        memcpy(y, b, 16);                                                                 \
+        for (int i = 0; i < N; i++)                                                       \
+            equal = equal && x[i] == y[i];                                                \
+        return equal;                                                                     \
+    }                                                                                     \
+    static inline bool roxy_##kind##_ne(const void* a, const void* b) {                  \
+        return !roxy_##kind##_eq(a, b);                                                   \
+    }                                                                                     \
+    static inline void roxy_##kind##_load(void* d, void* list, int32_t index) {          \
+        memcpy(d, roxy_list_lanes(list, index, N, sizeof(LT) / 4), 16);                   \
+    }                                                                                     \
+    static inline void roxy_##kind##_store(const void* a, void* list, int32_t index) {   \
+        memcpy(roxy_list_lanes(list, index, N, sizeof(LT) / 4), a, 16);                   \
+    }
+
+// Start of `lanes` consecutive elements at `index` of a primitive List, for
+// vector load/store. Out-of-range asserts, as roxy_list_get does.
+static inline uint32_t* roxy_list_lanes(void* list, int32_t index, uint32_t lanes,
+                                        uint32_t lane_slots) {
+    roxy_list_header* hdr = (roxy_list_header*)list;
+    assert(index >= 0 && (uint64_t)index + lanes <= hdr->length && "List index out of bounds");
+    return hdr->elements + (size_t)index * lane_slots;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+ROXY_VEC_COMMON(f32x4, roxy_v4f32, roxy_v4f32, float, float, uint32_t, 4)
+ROXY_VEC_COMMON(f64x2, roxy_v2f64, roxy_v2f64, double, double, uint64_t, 2)
+ROXY_VEC_COMMON(i32x4, roxy_v4i32, roxy_v4u32, int32_t, uint32_t, uint32_t, 4)
+ROXY_VEC_LANEWISE(f32x4, div, roxy_v4f32, float, uint32_t, 4, /)
+ROXY_VEC_LANEWISE(f64x2, div, roxy_v2f64, double, uint64_t, 2, /)
+ROXY_VEC_LANEWISE(i32x4, bit_and, roxy_v4u32, uint32_t, uint32_t, 4, &)
+ROXY_VEC_LANEWISE(i32x4, bit_or, roxy_v4u32, uint32_t, uint32_t, 4, |)
+ROXY_VEC_LANEWISE(i32x4, bit_xor, roxy_v4u32, uint32_t, uint32_t, 4, ^)
+#else
+ROXY_VEC_COMMON(f32x4, void, void, float, float, uint32_t, 4)
+ROXY_VEC_COMMON(f64x2, void, void, double, double, uint64_t, 2)
+ROXY_VEC_COMMON(i32x4, void, void, int32_t, uint32_t, uint32_t, 4)
+ROXY_VEC_LANEWISE(f32x4, div, void, float, uint32_t, 4, /)
+ROXY_VEC_LANEWISE(f64x2, div, void, double, uint64_t, 2, /)
+ROXY_VEC_LANEWISE(i32x4, bit_and, void, uint32_t, uint32_t, 4, &)
+ROXY_VEC_LANEWISE(i32x4, bit_or, void, uint32_t, uint32_t, 4, |)
+ROXY_VEC_LANEWISE(i32x4, bit_xor, void, uint32_t, uint32_t, 4, ^)
+#endif
+
+static inline void roxy_f32x4_abs(void* d, const void* a) {
+    float x[4];
+    memcpy(x, a, 16);
+    for (int i = 0; i < 4; i++)
+        x[i] = fabsf(x[i]);
+    memcpy(d, x, 16);
+}
+static inline void roxy_f64x2_abs(void* d, const void* a) {
+    double x[2];
+    memcpy(x, a, 16);
+    for (int i = 0; i < 2; i++)
+        x[i] = fabs(x[i]);
+    memcpy(d, x, 16);
+}
+static inline void roxy_i32x4_abs(void* d, const void* a) {
+    int32_t x[4];
+    uint32_t r[4];
+    memcpy(x, a, 16);
+    for (int i = 0; i < 4; i++)
+        r[i] = x[i] < 0 ? 0u - (uint32_t)x[i] : (uint32_t)x[i];
+    memcpy(d, r, 16);
+}
+static inline void roxy_f32x4_sqrt(void* d, const void* a) {
+    float x[4];
+    memcpy(x, a, 16);
+    for (int i = 0; i < 4; i++)
+        x[i] = sqrtf(x[i]);
+    memcpy(d, x, 16);
+}
+static inline void roxy_f64x2_sqrt(void* d, const void* a) {
+    double x[2];
+    memcpy(x, a, 16);
+    for (int i = 0; i < 2; i++)
+        x[i] = sqrt(x[i]);
+    memcpy(d, x, 16);
+}
+// f32x4 -> i32x4 truncates toward zero; NaN lanes become 0 and out-of-range
+// lanes saturate (the interpreter's VEC_F32X4 Convert does the same).
+static inline void roxy_f32x4_convert(void* d, const void* a) {
+    float x[4];
+    int32_t r[4];
+    memcpy(x, a, 16);
+    for (int i = 0; i < 4; i++) {
+        r[i] = x[i] != x[i]               ? 0
+               : x[i] >= 2147483648.0f    ? INT32_MAX
+               : x[i] <= -2147483648.0f   ? INT32_MIN
+                                          : (int32_t)x[i];
+    }
+    memcpy(d, r, 16);
+}
+static inline void roxy_i32x4_convert(void* d, const void* a) {
+    int32_t x[4];
+    float r[4];
+    memcpy(x, a, 16);
+    for (int i = 0; i < 4; i++)
+        r[i] = (float)x[i];
+    memcpy(d, r, 16);
+}
+
+#undef ROXY_VEC_COMMON
+#undef ROXY_VEC_COMPARE
+#undef ROXY_VEC_LANEWISE
+
 // ===== Map Key Kind =====
 
 // A real enum rather than #defines so the dispatch switches in roxy_rt.cpp get
@@ -556,6 +1030,25 @@ uint64_t roxy_map_iter_value_at(void* self, int32_t idx);
 void* roxy_map_iter_key_ptr_at(void* self, int32_t idx);
 void* roxy_map_iter_value_ptr_at(void* self, int32_t idx);
 
+// Range-for bucket scan (`for (k, v) in map`). Inline so the loop compiles to a
+// plain walk over the distance array; the loop pins the map, so the capacity
+// and bucket buffers are stable for its whole duration.
+static inline int32_t roxy_map_iter_next(void* self, int32_t idx) {
+    const roxy_map_header* hdr = (const roxy_map_header*)self;
+    uint32_t i = (uint32_t)idx;
+    while (i < hdr->capacity && hdr->distances[i] == 0)
+        i++;
+    return (int32_t)i;
+}
+static inline void* roxy_map_iter_key(void* self, int32_t idx) {
+    const roxy_map_header* hdr = (const roxy_map_header*)self;
+    return hdr->keys + (size_t)idx * hdr->key_slot_count;
+}
+static inline void* roxy_map_iter_value(void* self, int32_t idx) {
+    const roxy_map_header* hdr = (const roxy_map_header*)self;
+    return hdr->values + (size_t)idx * hdr->value_slot_count;
+}
+
 // ===== Hash Functions =====
 
 uint64_t roxy_bool_hash(bool val);
@@ -588,6 +1081,7 @@ uint64_t roxy_weak_generation(void* data);
 #include <cassert>
 #include <cstddef>
 #include <cstring>
+#include <type_traits>
 #include <utility>
 
 namespace roxy {
@@ -825,6 +1319,38 @@ private:
     void* m_data;
 };
 
+// Dense Array<T>: the elements are a plain T[len()], so a native can read or
+// fill the buffer in place through elements() without copying.
+template <typename T> class Array {
+public:
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "Array elements are 1, 2, 4 or 8 bytes");
+
+    static Array<T> alloc(int32_t length = 0) {
+        void* data = roxy_array_alloc(static_cast<int32_t>(sizeof(T)),
+                                      std::is_signed<T>::value ? 1 : 0);
+        if (data)
+            roxy_array_init(data, length);
+        return Array<T>(data);
+    }
+
+    Array() : m_data(nullptr) {}
+    explicit Array(void* data) : m_data(data) {}
+
+    T* elements() const {
+        return reinterpret_cast<T*>(static_cast<roxy_array_header*>(m_data)->data);
+    }
+    T& operator[](int32_t index) const { return *static_cast<T*>(roxy_array_elem(m_data, index)); }
+
+    int32_t len() const { return roxy_array_len(m_data); }
+
+    bool is_valid() const { return m_data != nullptr; }
+    void* data() const { return m_data; }
+
+private:
+    void* m_data;
+};
+
 template <typename K, typename V> class Map {
 public:
     static constexpr int32_t key_slot_count =
@@ -10,12 +10,18 @@
 
 namespace rx {
 
+// XXH3_64 over the key bytes — the same function behind a string's cached hash,
+// so a literal's intern probe hash doubles as that cache (roxy_rt.cpp).
+struct StringInternHash {
+    size_t operator()(StringView key) const noexcept;
+};
+
 // Content-keyed table used by `roxy_string_from_literal` to dedup heap strings.
 // Key is a StringView over the stored string object's char data (stable for
 // the object's lifetime, which is the owner's — typically the VM). Value is
 // the string data pointer.
 struct StringInternTable {
-    tsl::robin_map<StringView, void*> table;
+    tsl::robin_map<StringView, void*, StringInternHash> table;
 };
 
 } // namespace rx
@@ -5,6 +5,8 @@
 #include "roxy/vm/binding/binder.hpp"
 #include "roxy/vm/binding/function_traits.hpp"
 #include "roxy/vm/binding/registry.hpp"
+#include "roxy/vm/binding/roxy_array.hpp"
 #include "roxy/vm/binding/roxy_list.hpp"
 #include "roxy/vm/binding/roxy_string.hpp"
+#include "roxy/vm/binding/script_function.hpp"
 #include "roxy/vm/binding/type_traits.hpp"
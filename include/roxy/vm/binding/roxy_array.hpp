@@ -0,0 +1,21 @@
+#pragma once
+
+#include "roxy/core/types.hpp"
+#include "roxy/rt/roxy_rt.h"
+#include "roxy/vm/binding/type_traits.hpp"
+#include "roxy/vm/value.hpp"
+
+namespace rx {
+
+// `RoxyArray<T>` is a thin alias of `roxy::Array<T>` (see roxy_list.hpp). A
+// native receives the script's array itself, so elements() is a zero-copy view.
+template <typename T> using RoxyArray = roxy::Array<T>;
+
+// RoxyType specialization for RoxyArray<T>
+template <typename T> struct RoxyType<RoxyArray<T>> {
+    static Type* get(TypeCache& tc) { return tc.array_type(RoxyType<T>::get(tc)); }
+    static RoxyArray<T> from_reg(u64 r) { return RoxyArray<T>(reinterpret_cast<void*>(r)); }
+    static u64 to_reg(RoxyArray<T> array) { return reinterpret_cast<u64>(array.data()); }
+};
+
+} // namespace rx
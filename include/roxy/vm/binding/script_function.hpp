@@ -0,0 +1,144 @@
+#pragma once
+
+#include "roxy/core/string_view.hpp"
+#include "roxy/core/types.hpp"
+#include "roxy/vm/binding/type_traits.hpp"
+#include "roxy/vm/vm.hpp"
+
+#include <tuple>
+#include <type_traits>
+
+namespace rx {
+
+// ScriptFunction<Ret(Args...)> is the host->script mirror of FunctionBinder.
+// It resolves a script function once; each call then writes the C++ arguments
+// straight into the callee's register window with RoxyType<Arg>::to_reg and
+// reads the result with RoxyType<Ret>::from_reg. No tagged Value is built and
+// no generic argument loop runs. A call costs one frame push plus the
+// interpreter run.
+//
+//   auto on_tick = ScriptFunction<i32(i32, f64)>::resolve(&vm, "on_tick");
+//   if (on_tick.valid())
+//       i32 status = on_tick(frame, dt);
+//
+// Bytecode carries no parameter types, so resolve() can only check the
+// arity. The signature is the caller's promise, as it is for
+// NativeRegistry::bind. Like a RoxyFunctionHandle, a ScriptFunction is valid
+// while the module it was resolved against stays loaded.
+template <typename Sig> class ScriptFunction;
+
+template <typename Ret, typename... Args> class ScriptFunction<Ret(Args...)> {
+public:
+    ScriptFunction() = default;
+
+    // Resolve `name` in the VM's loaded module. The result is invalid if there
+    // is no such function, or if it doesn't take exactly sizeof...(Args)
+    // single-register parameters.
+    static ScriptFunction resolve(RoxyVM* vm, StringView name) {
+        ScriptFunction fn;
+        RoxyFunctionHandle handle = vm_resolve(vm, name);
+        if (!handle.valid())
+            return fn;
+        const BCFunction* func = vm->function_ptrs[handle.index];
+        if (func->param_count != sizeof...(Args) ||
+            func->param_register_count != sizeof...(Args))
+            return fn;
+        fn.m_vm = vm;
+        fn.m_handle = handle;
+        return fn;
+    }
+
+    bool valid() const { return m_vm != nullptr; }
+    RoxyFunctionHandle handle() const { return m_handle; }
+
+    // Run the function. False if the call failed (vm_get_error says why);
+    // otherwise result() holds the return value until the next call.
+    bool call(Args... args) {
+        if (!m_vm)
+            return false;
+        u64* regs = vm_push_entry_frame(m_vm, m_handle.index);
+        if (!regs)
+            return false;
+        u32 i = 0;
+        ((regs[i++] = RoxyType<Args>::to_reg(args)), ...);
+        (void)i; // unused for a nullary function
+        return vm_run_entry_frame(m_vm);
+    }
+
+    // The last successful call's return value
+    Ret result() const {
+        if constexpr (!std::is_void_v<Ret>)
+            return RoxyType<Ret>::from_reg(vm_get_result_reg(m_vm));
+    }
+
+    // Call and return the result. On failure this returns Ret{} and leaves the
+    // VM's error set; use call() when the distinction matters.
+    Ret operator()(Args... args) {
+        if constexpr (std::is_void_v<Ret>) {
+            call(args...);
+        } else {
+            if (!call(args...))
+                return Ret{};
+            return result();
+        }
+    }
+
+    // Structure-of-args batch (see vm_call_batch): call i takes columns[k][i]
+    // for each parameter k, read straight from the host's typed arrays. When
+    // `results` is non-null, results[i] receives call i's return value (void
+    // functions pass nullptr). Returns the number of calls completed; fewer
+    // than `count` means one failed and vm_get_error says why.
+    u32 call_batch(u32 count, Ret* results, const Args*... columns) {
+        if (!m_vm)
+            return 0;
+        Columns state{std::tuple<const Args*...>(columns...), 0};
+        if constexpr (std::is_void_v<Ret>) {
+            return vm_call_batch_with(m_vm, m_handle, count, &fill_from_columns, &state, nullptr);
+        } else {
+            if (!results)
+                return vm_call_batch_with(m_vm, m_handle, count, &fill_from_columns, &state,
+                                          nullptr);
+            // Results come back as raw registers; decode them a chunk at a time
+            // so no count-sized scratch buffer is needed.
+            constexpr u32 chunk_size = 256;
+            u64 raw[chunk_size];
+            u32 completed = 0;
+            while (completed < count) {
+                u32 chunk = count - completed < chunk_size ? count - completed : chunk_size;
+                state.base = completed;
+                u32 done = vm_call_batch_with(m_vm, m_handle, chunk, &fill_from_columns, &state,
+                                              raw);
+                for (u32 i = 0; i < done; i++)
+                    results[completed + i] = RoxyType<Ret>::from_reg(raw[i]);
+                completed += done;
+                if (done < chunk)
+                    break;
+            }
+            return completed;
+        }
+    }
+
+private:
+    struct Columns {
+        std::tuple<const Args*...> columns;
+        u32 base; // Offset of the current chunk into the columns
+    };
+
+    static void fill_from_columns(void* user, u32 index, u64* regs) {
+        auto* state = static_cast<Columns*>(user);
+        u32 row = state->base + index;
+        std::apply(
+            [&](const Args*... cols) {
+                u32 i = 0;
+                ((regs[i++] = RoxyType<Args>::to_reg(cols[row])), ...);
+                (void)i;
+            },
+            state->columns);
+        (void)row;
+    }
+
+    RoxyVM* m_vm = nullptr;
+    RoxyFunctionHandle m_handle;
+};
+
+} // namespace rx
@@ -104,16 +104,17 @@ template <> struct RoxyType<f32> {
     static f32 from_value(const Value& v) { return static_cast<f32>(v.as_float); }
     static Value to_value(f32 val) { return Value::make_float(val); }
     static f32 from_reg(u64 r) {
-        // f32 is stored as f64 bits in register
-        f64 d;
-        memcpy(&d, &r, sizeof(d));
-        return static_cast<f32>(d);
+        // f32 is stored as its bit pattern in the low 32 bits of the register
+        // (the interpreter's reg_as_f32 / reg_from_f32)
+        u32 bits = static_cast<u32>(r);
+        f32 v;
+        memcpy(&v, &bits, sizeof(v));
+        return v;
     }
     static u64 to_reg(f32 val) {
-        f64 d = static_cast<f64>(val);
-        u64 r;
-        memcpy(&r, &d, sizeof(r));
-        return r;
+        u32 bits;
+        memcpy(&bits, &val, sizeof(bits));
+        return static_cast<u64>(bits);
     }
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "roxy/core/string.hpp"
+#include "roxy/core/tsl/robin_map.h"
 #include "roxy/core/string_view.hpp"
 #include "roxy/core/types.hpp"
 #include "roxy/core/unique_ptr.hpp"
@@ -93,6 +94,13 @@ enum class Opcode : u8 {
     // pattern. Slots 0x61-0x62 are free for future logical ops.
     NOT = 0x60, // dst = !src1
 
+    // 0x70-0x7F: Superinstructions — a hot opcode pair run by one handler.
+    // Same width and operands as the first op of the pair; the second op is
+    // the unchanged instruction that follows. Generated from bigram profiles,
+    // see superinstructions.def.
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND) NAME = byte,
+#include "roxy/vm/superinstructions.def"
+
     // 0x80-0x8F: Type Conversions
     I_TO_F64 = 0x80,   // dst = (f64)src - integer to f64
     F64_TO_I = 0x81,   // dst = (i64)src - f64 to integer (truncate toward zero)
@@ -160,8 +168,8 @@ enum class Opcode : u8 {
     STRUCT_STORE_REGS = 0xB5, // *dst = src (store consecutive registers to struct)
     STRUCT_COPY = 0xB6,       // [dst_ptr src_ptr slot_count] - memory copy
     RET_STRUCT_SMALL = 0xB7,  // return small struct (≤4 slots) in registers
-    SPILL_REG = 0xB8,         // spill regs[reg] to local_stack[base + imm16] (2 u32 slots)
-    RELOAD_REG = 0xB9,        // reload regs[reg] from local_stack[base + imm16] (2 u32 slots)
+    SPILL_REG = 0xB8,         // regs[imm16] = regs[a] (imm16: a wide register, >= 256)
+    RELOAD_REG = 0xB9,        // regs[a] = regs[imm16] (imm16: a wide register, >= 256)
 
     // Specialized STRUCT_COPY for small slot counts. Same ABC encoding as
     // STRUCT_COPY but slot_count is implicit in the opcode, eliminating the
@@ -225,12 +233,27 @@ enum class Opcode : u8 {
     // branches on dst == 0 to a `throw KeyError` block.
     INDEX_TRYADDR_MAP = 0xEA,
 
+    // Struct-element list field access: `list[index].field` in one dispatch,
+    // without materializing the element pointer. Two-word, bounds-checked:
+    //   word 1: ABC — GET: a=dst, b=list, c=index; SET: a=list, b=index, c=value
+    //   word 2: [slot_offset:16][slot_count:8] (encode_field_word)
+    // Field semantics (slot widths, sign extension) match GET_FIELD/SET_FIELD.
+    INDEX_FIELD_GET_LIST = 0xEB, // dst = list[index].field
+    INDEX_FIELD_SET_LIST = 0xEC, // list[index].field = value
+
     // Container element-borrow pin/unpin around a call (lifetimes.md "Container element lvalues").
     // ABC: a=container pointer. Bumps/decrements the header borrow_count so a
     // mid-call realloc/free of the container traps instead of dangling the borrow.
     CONTAINER_PIN = 0xE6,   // pin(regs[a])
     CONTAINER_UNPIN = 0xE7, // unpin(regs[a])
 
+    // Range-for over a pinned map (`for (k, v) in map`): scan the bucket array in
+    // place instead of a CALL_NATIVE per step. ABC: a=dst, b=map, c=bucket index.
+    // KEY/VALUE load like INDEX_GET_MAP (struct entries yield a bucket pointer).
+    ITER_NEXT_MAP = 0xED,  // dst = first occupied bucket >= index (capacity if none)
+    ITER_KEY_MAP = 0xEE,   // dst = key of bucket index
+    ITER_VALUE_MAP = 0xEF, // dst = value of bucket index
+
     // 0xD2-0xD4: Exception Handling and Typed Delete
     THROW = 0xD2,        // throw regs[a] (exception object pointer)
     CALL_EXC_MSG = 0xD3, // dst = exception_message(regs[src]) - call stored message fn ptr
@@ -252,11 +275,13 @@ enum class Opcode : u8 {
     // 0xDD: Indirect call (closures and first-class function values).
     // dst = call closure(args...) — two-word
     //   word 0: [CALL_INDIRECT][dst][closure_reg][arg_count]
-    //   word 1: [reserved:32]   (future inline-cache slot)
+    //   word 1: [ic_slot:32]    (inline-cache slot, assigned by vm_load_module)
     // The closure value is a uniq pointer to a heap-allocated env struct whose
     // first u32 field holds the target function index. The interpreter reads
     // that field, sets up the call frame with the env pointer as the first
-    // argument, copies the explicit args after it, and dispatches.
+    // argument, copies the explicit args after it, and dispatches. Lowering
+    // emits word 1 as 0; the VM numbers the sites at load time and caches the
+    // last callee's frame layout per site.
     CALL_INDIRECT = 0xDD,
 
     // 0xDE: Trap if pointer in regs[a] is not owned by the slab allocator.
@@ -264,14 +289,74 @@ enum class Opcode : u8 {
     // stack-allocated. Single-word: [ASSERT_HEAP][a][_][_].
     ASSERT_HEAP = 0xDE,
 
-    // 0xF0-0xFD: Debug/Error
+    // 0xF0: Debug/Error
     TRAP = 0xF0, // runtime error trap (for variant field access checks)
 
+    // 0xF1-0xF3: Builtin SIMD vectors, one opcode per lane layout. Two-word:
+    //   word 0: [VEC_*][dst][a][b]
+    //   word 1: [VecOp:8][c | shuffle pattern:8][stack slot:16]
+    // A vector operand is a register holding the address of its 16 bytes, like
+    // any struct rvalue. A vector result is written to the frame's local-stack
+    // temp at `stack slot` and dst receives its address; a scalar result (hsum,
+    // dot, eq, ne) goes straight into dst. VecOp lists each op's operands.
+    VEC_F32X4 = 0xF1, // 4 x f32
+    VEC_F64X2 = 0xF2, // 2 x f64
+    VEC_I32X4 = 0xF3, // 4 x i32 (wrapping), also the lane-mask layout
+
+    // 0xF4-0xFD: Array<T> element access, packed at the element's natural width.
+    // Same ABC layout as INDEX_GET_LIST / INDEX_SET_LIST; out-of-range traps.
+    INDEX_GET_ARR_I8 = 0xF4,  // dst = sext(arr[index]), 1 byte  — ABC: a=dst, b=arr, c=index
+    INDEX_GET_ARR_U8 = 0xF5,  // dst = zext(arr[index]), 1 byte (u8, bool)
+    INDEX_GET_ARR_I16 = 0xF6, // dst = sext(arr[index]), 2 bytes
+    INDEX_GET_ARR_U16 = 0xF7, // dst = zext(arr[index]), 2 bytes
+    INDEX_GET_ARR_32 = 0xF8,  // dst = sext(arr[index]), 4 bytes (i32, u32, f32 bits)
+    INDEX_GET_ARR_64 = 0xF9,  // dst = arr[index], 8 bytes
+    INDEX_SET_ARR_8 = 0xFA,   // arr[index] = low byte of value — ABC: a=arr, b=index, c=value
+    INDEX_SET_ARR_16 = 0xFB,  // arr[index] = low 2 bytes of value
+    INDEX_SET_ARR_32 = 0xFC,  // arr[index] = low 4 bytes of value
+    INDEX_SET_ARR_64 = 0xFD,  // arr[index] = value
+
     // 0xFF: Invalid/Debug
     NOP = 0xFE,  // no operation
     HALT = 0xFF, // halt execution
 };
 
+// Lane operation of a VEC_F32X4 / VEC_F64X2 / VEC_I32X4 instruction (word 1,
+// top byte). Kept in the same order as the compiler's SimdOp. Operands are the
+// a / b / c fields; a lane mask is an i32x4 of all-ones / zero lanes (an f64x2
+// mask lane spans two i32 lanes).
+enum class VecOp : u8 {
+    Add,     // a + b
+    Sub,     // a - b
+    Mul,     // a * b
+    Div,     // a / b (float layouts)
+    Min,     // a < b ? a : b
+    Max,     // a > b ? a : b
+    And,     // a & b (i32x4)
+    Or,      // a | b
+    Xor,     // a ^ b
+    CmpEq,   // mask(a == b)
+    CmpNe,   // mask(a != b)
+    CmpLt,   // mask(a < b)
+    CmpLe,   // mask(a <= b)
+    Neg,     // -a
+    Abs,     // |a|
+    Sqrt,    // sqrt(a) (float layouts)
+    Scale,   // a * scalar b
+    Splat,   // scalar a in every lane
+    Shuffle, // lane i = a[(c >> 2i) & 3]
+    Select,  // bits of a where mask c is set, else bits of b
+    Convert, // f32x4 <-> i32x4; the opcode names the source layout
+    Hsum,    // scalar (a.x + a.y) + (a.z + a.w)
+    Dot,     // scalar hsum(a * b)
+    Eq,      // bool: every lane of a equals b
+    Ne,      // bool: some lane differs
+    Load,    // lanes from List a at element b (bounds-checked)
+    Store,   // vector dst to List a at element b (bounds-checked; no result)
+};
+
+const char* vec_op_to_string(VecOp op);
+
 // Get string representation of opcode
 const char* opcode_to_string(Opcode op);
 
@@ -306,23 +391,76 @@ inline u16 decode_imm16(u32 instr) { return static_cast<u16>(instr & 0xFFFF); }
 
 inline i16 decode_offset(u32 instr) { return static_cast<i16>(instr & 0xFFFF); }
 
+// Second word of INDEX_FIELD_GET_LIST / INDEX_FIELD_SET_LIST:
+// [slot_offset:16][slot_count:8] (low bits first).
+inline u32 encode_field_word(u16 slot_offset, u8 slot_count) {
+    return static_cast<u32>(slot_offset) | (static_cast<u32>(slot_count) << 16);
+}
+
+inline u16 decode_field_offset(u32 word) { return static_cast<u16>(word & 0xFFFF); }
+
+inline u8 decode_field_slot_count(u32 word) { return static_cast<u8>((word >> 16) & 0xFF); }
+
+// Second word of a VEC_* instruction: [VecOp:8][c:8][stack slot:16].
+inline u32 encode_vec_word(VecOp op, u8 c, u16 stack_slot) {
+    return (static_cast<u32>(op) << 24) | (static_cast<u32>(c) << 16) | stack_slot;
+}
+
+inline VecOp decode_vec_op(u32 word) { return static_cast<VecOp>(word >> 24); }
+
+inline u8 decode_vec_c(u32 word) { return static_cast<u8>((word >> 16) & 0xFF); }
+
+inline u16 decode_vec_slot(u32 word) { return static_cast<u16>(word & 0xFFFF); }
+
+// Superinstructions (0x70-0x7F): the first op of the fused pair, or `op`
+// itself when it is not a superinstruction. The operands and width of a
+// superinstruction are those of its first op.
+inline Opcode superinstruction_first_op(Opcode op) {
+    switch (op) {
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND)                                             \
+    case Opcode::NAME:                                                                             \
+        return Opcode::FIRST;
+#include "roxy/vm/superinstructions.def"
+        default:
+            return op;
+    }
+}
+
+// The superinstruction that fuses `first` followed by `second`, or
+// Opcode::NOP if the pair has none.
+inline Opcode find_superinstruction(Opcode first, Opcode second) {
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND)                                             \
+    if (first == Opcode::FIRST && second == Opcode::SECOND)                                        \
+        return Opcode::NAME;
+#include "roxy/vm/superinstructions.def"
+    (void)first;
+    (void)second;
+    return Opcode::NOP;
+}
+
 // True for opcodes that occupy two code words (payload in the second word):
 // calls (function index / reserved slot), field ops (slot offset),
 // packed-struct register transfers (padding word), and the fused
 // compare-and-branch family (i32 branch offset). Anything that walks raw code
 // words — the disassembler, fuse_compare_branch — must skip the payload word,
 // or it would misread it as an instruction. Keep in sync with the interpreter
-// handlers that read or skip an extra `*pc++`.
+// handlers that read or skip an extra `*pc++`. A superinstruction is as wide
+// as its first op.
 inline bool is_two_word_instruction(Opcode op) {
-    switch (op) {
+    switch (superinstruction_first_op(op)) {
         case Opcode::CALL:
         case Opcode::CALL_NATIVE:
         case Opcode::CALL_INDIRECT:
         case Opcode::GET_FIELD:
         case Opcode::SET_FIELD:
         case Opcode::GET_FIELD_ADDR:
+        case Opcode::INDEX_FIELD_GET_LIST:
+        case Opcode::INDEX_FIELD_SET_LIST:
         case Opcode::STRUCT_LOAD_REGS:
         case Opcode::STRUCT_STORE_REGS:
+        case Opcode::VEC_F32X4:
+        case Opcode::VEC_F64X2:
+        case Opcode::VEC_I32X4:
         case Opcode::JMP_IF_EQ_I:
         case Opcode::JMP_IF_NE_I:
         case Opcode::JMP_IF_LT_I:
@@ -418,6 +556,8 @@ struct BCTypeInfo {
     u32 slot_count;                 // For field access
     u32 dtor_func_idx = 0xFFFFFFFF; // Synthesized destructor fn index, or 0xFFFFFFFF.
                                     // Used to dispatch closure-env cleanup by type_id.
+    bool pooled = false;            // Recycle freed objects through a per-type free pool
+                                    // (coroutine state structs; RoxyVM::state_pools).
 };
 
 // Exception handler entry in bytecode
@@ -476,6 +616,8 @@ struct BCDeleteDesc {
                 // pointer in the slot), never free the pointee (lifetimes.md "Applying the model").
         StrRelease, // `string` element/field/value: release the owned string
                     // (roxy_string_release; frees at zero, no-op if immortal — finding 9b).
+        Array,      // Array<T>: no elements to walk; release the buffer (free or
+                    // munmap a roxy_map_file mapping) via roxy_array_delete.
     };
 
     Cleanup cleanup;
@@ -550,9 +692,20 @@ struct BCFunction {
     Vector<BCStructFieldDelete>
         struct_field_deletes; // Field-cleanup actions for STRUCT descriptors (kinds 5/6)
 
+    // Register-allocator statistics (compile-time only; see CompileTimings)
+    u32 spilled_values; // SSA values evicted to the local stack
+    u32 spill_ops;      // SPILL_REG + RELOAD_REG instructions emitted for them
+
+    // Direct-threaded copy of `code`, built by vm_load_module when
+    // VMConfig::threaded_dispatch is set (empty otherwise). One u64 per code
+    // word: the low half is the original word, the high half the handler's
+    // offset from the interpreter's base label. Word indices match `code`, so
+    // exception-handler and cleanup-record PCs apply unchanged.
+    Vector<u64> threaded_code;
+
     BCFunction()
         : param_count(0), param_register_count(0), register_count(0), local_stack_slots(0),
-          ret_reg_count(1) {}
+          ret_reg_count(1), spilled_values(0), spill_ops(0) {}
 };
 
 // Native function signature
@@ -576,11 +729,38 @@ struct BCModule {
     Vector<u32> type_ids;                      // Global type IDs after registration
     u32 global_slot_count = 0;                 // Module-global storage size (u32 slots)
 
+    // Name -> index lookups behind find_function / find_native_function.
+    // vm_load_module builds them (index_names); until then the finds fall back
+    // to a linear scan, so a module still under construction answers too.
+    tsl::robin_map<StringView, u32> function_names;
+    tsl::robin_map<StringView, u32> native_function_names;
+    bool names_indexed = false;
+
     BCModule() = default;
     ~BCModule() = default;
 
+    // Build (or rebuild) the name lookups. On duplicate names the first entry
+    // wins, matching the linear scan.
+    void index_names() {
+        function_names.clear();
+        function_names.reserve(functions.size());
+        for (u32 i = 0; i < functions.size(); i++) {
+            function_names.emplace(functions[i]->name, i);
+        }
+        native_function_names.clear();
+        native_function_names.reserve(native_functions.size());
+        for (u32 i = 0; i < native_functions.size(); i++) {
+            native_function_names.emplace(native_functions[i].name, i);
+        }
+        names_indexed = true;
+    }
+
     // Find function by name, returns index or -1 if not found
     i32 find_function(StringView name) const {
+        if (names_indexed) {
+            auto it = function_names.find(name);
+            return it != function_names.end() ? static_cast<i32>(it->second) : -1;
+        }
         for (u32 i = 0; i < functions.size(); i++) {
             if (functions[i]->name == name) {
                 return static_cast<i32>(i);
@@ -591,6 +771,10 @@ struct BCModule {
 
     // Find native function by name, returns index or -1 if not found
     i32 find_native_function(StringView name) const {
+        if (names_indexed) {
+            auto it = native_function_names.find(name);
+            return it != native_function_names.end() ? static_cast<i32>(it->second) : -1;
+        }
         for (u32 i = 0; i < native_functions.size(); i++) {
             if (native_functions[i].name == name) {
                 return static_cast<i32>(i);
@@ -18,12 +18,28 @@ void bc_profile_dump(FILE* out);
 // stop_depth: if > 0, stop when call stack reaches this depth (for nested interpretation)
 bool interpret(RoxyVM* vm, u32 stop_depth = 0);
 
+// Threaded dispatch (VMConfig::threaded_dispatch). Supported when the
+// interpreter is built with computed goto; the switch fallback has no handler
+// addresses to thread through.
+bool interpreter_supports_threaded_dispatch();
+
+// Fill func->threaded_code from func->code: each instruction word is paired
+// with its handler's address, so dispatch skips the opcode-table load.
+// Deterministic — rebuilding for a module shared by several VMs rewrites the
+// same stream.
+void build_threaded_code(BCFunction* func);
+
 // Re-entrant call from native code into a bytecode function. Pushes a frame
 // for `func_idx`, copies `argc` u64 args into the new frame's regs[0..argc),
 // runs the interpreter until the frame returns, and returns its result.
 //
-// Used by Map's struct-key Hash/Eq dispatch to invoke user `hash()` / `eq()`
-// methods from inside `map_hash_key` / `map_keys_equal`.
+// Used by List.sort_by to invoke the user's comparator closure per comparison.
 u64 call_user_function(RoxyVM* vm, u32 func_idx, const u64* args, u32 argc);
 
+// The same call for a callee resolved up front: no index lookup, and the frame
+// is set up exactly as OP(CALL) sets it up. Map's struct-key Hash/Eq
+// trampolines use it, resolving the user `hash()` / `eq()` once per map op and
+// calling it on every probe from inside `map_hash_key` / `map_keys_equal`.
+u64 call_resolved_function(RoxyVM* vm, const BCFunction* fn, const u64* args, u32 argc);
+
 } // namespace rx
@@ -6,18 +6,20 @@
 namespace rx {
 
 struct RoxyVM;
+struct BCFunction;
 
 // Per-frame state pushed by the VM before each map op so the unified
 // `roxy_map_*` runtime — which dispatches custom Hash/Eq through C function
 // pointers — can re-enter the interpreter for user-defined `K::hash` /
-// `K::eq` impls. The trampoline functions (vm_hash_trampoline /
-// vm_eq_trampoline) read the topmost frame, pack args per Roxy's struct ABI,
-// and call `call_user_function`.
+// `K::eq` impls. The callees are resolved when the frame is pushed, so the
+// trampoline functions (vm_hash_trampoline / vm_eq_trampoline) only read the
+// topmost frame, pack args per Roxy's struct ABI, and call
+// `call_resolved_function` on every probe.
 struct MapDispatchFrame {
     RoxyVM* vm;
-    u32 hash_fn_idx;   // UINT32_MAX = no custom hash
-    u32 eq_fn_idx;     // UINT32_MAX = no custom eq
-    u8 key_slot_count; // For eq's struct-arg packing (≤2 / ≤4 / ≥5 slots)
+    const BCFunction* hash_fn; // null = no custom hash
+    const BCFunction* eq_fn;   // null = no custom eq
+    u8 key_slot_count;         // For eq's struct-arg packing (≤2 / ≤4 / ≥5 slots)
 };
 
 // Push/pop a dispatch frame around a single map operation. The push site
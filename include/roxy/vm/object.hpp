@@ -42,6 +42,13 @@ struct RoxyVM;
 // Returns pointer to object data (not header)
 void* object_alloc(RoxyVM* vm, u32 type_id, u32 data_size);
 
+// object_alloc for a pooled type (BCTypeInfo::pooled): reuses an object that
+// object_free parked in `pool`, zeroed and restamped, when there is one
+void* object_alloc_pooled(RoxyVM* vm, roxy_free_pool* pool, u32 type_id, u32 data_size);
+
+// Return every object parked in the VM's state pools to the allocator
+void object_drain_pools(RoxyVM* vm);
+
 // Increment reference count
 inline void ref_inc(void* data) {
     if (data == nullptr)
@@ -61,7 +68,8 @@ u64 weak_ref_create(void* data);
 // Uses 64-bit generation; weak_generation == 0 means tombstoned
 bool weak_ref_valid(void* data, u64 generation);
 
-// Deallocate an object (for explicit delete)
+// Deallocate an object (for explicit delete). An object of a pooled type is
+// parked in its state pool instead while the pool has room.
 void object_free(RoxyVM* vm, void* data);
 
 // Object type registry
@@ -17,7 +17,8 @@ struct StringInternTable;
 // Call frame - represents an active function call
 struct CallFrame {
     const BCFunction* func; // Current function
-    const u32* pc;          // Program counter (pointer into code)
+    const u32* pc;          // Program counter (pointer into code, or into threaded_code when the
+                            // VM runs threaded — see vm_entry_pc)
     u64* registers;         // Register window base (untyped 8-byte slots)
     u8 return_reg;          // Register to store return value in caller
     u32 local_stack_base;   // Base slot index in local_stack for this frame
@@ -29,16 +30,40 @@ struct CallFrame {
         : func(f), pc(p), registers(r), return_reg(ret), local_stack_base(stack_base) {}
 };
 
+// Monomorphic inline cache for one CALL_INDIRECT site. vm_load_module numbers
+// the sites and writes each one's slot into the instruction's second word; the
+// handler compares the env's `__call_idx` against `func_idx` and, on a hit,
+// takes the callee's frame layout from here instead of validating the index
+// and chasing function_ptrs. A miss refills the entry (last callee wins).
+struct IndirectCallCache {
+    u32 func_idx;             // Cached callee index (UINT32_MAX = empty)
+    u32 register_count;       // callee->register_count
+    u32 local_stack_slots;    // callee->local_stack_slots
+    u32 explicit_param_regs;  // Param registers after the hidden env pointer
+    u32 ret_reg_count;        // callee->ret_reg_count (explicit args start at dst + this)
+    const BCFunction* callee; // function_ptrs[func_idx]
+    const u32* code;          // vm_entry_pc(vm, callee)
+    u32 miss_count;           // Refills, including the first fill (diagnostics/tests)
+
+    IndirectCallCache()
+        : func_idx(UINT32_MAX), register_count(0), local_stack_slots(0), explicit_param_regs(0),
+          ret_reg_count(1), callee(nullptr), code(nullptr), miss_count(0) {}
+};
+
 // VM configuration
 struct VMConfig {
     u32 register_file_size; // Maximum number of registers (8-byte slots)
     u32 local_stack_size;   // Maximum local stack size (4-byte slots)
     u32 max_call_depth;     // Maximum call stack depth
+    // Run from a load-time direct-threaded translation of each function
+    // (BCFunction::threaded_code) instead of dispatching through the opcode
+    // table. Ignored where the interpreter has no computed goto.
+    bool threaded_dispatch;
 
     VMConfig()
         : register_file_size(65536), local_stack_size(262144) // 256K slots = 1MB
           ,
-          max_call_depth(1024) {}
+          max_call_depth(1024), threaded_dispatch(false) {}
 };
 
 // Roxy Virtual Machine
@@ -82,6 +107,13 @@ struct RoxyVM {
     // cleanup here by the env's type_id (built at vm_load_module).
     tsl::robin_map<u32, u32> closure_env_dtors;
 
+    // Free pools for pooled types (BCTypeInfo::pooled: coroutine state
+    // structs), indexed by type_id. A type that isn't pooled has capacity 0.
+    // object_free parks a freed state struct here and NEW_OBJ takes it back, so
+    // a generator created and exhausted in a loop stops reaching the allocator.
+    // Drained before the teardown census.
+    Vector<roxy_free_pool> state_pools;
+
     UniquePtr<CallFrame[]> call_stack; // Pre-allocated call stack
     u32 call_stack_size;               // Current call stack depth
     u32 call_stack_capacity;           // Maximum call stack depth
@@ -89,8 +121,14 @@ struct RoxyVM {
     const BCFunction** function_ptrs; // Flat function pointer cache (owned by module)
     u32 function_count;               // Number of cached function pointers
 
-    bool running;      // Execution state
-    const char* error; // Error message (null if no error)
+    // One inline cache per CALL_INDIRECT site in the loaded module, indexed by
+    // the slot vm_load_module wrote into the site's second word.
+    UniquePtr<IndirectCallCache[]> indirect_call_caches;
+    u32 indirect_call_cache_count;
+
+    bool threaded_dispatch; // VMConfig::threaded_dispatch, if the interpreter supports it
+    bool running;           // Execution state
+    const char* error;      // Error message (null if no error)
 
     // Heap census taken by vm_destroy at the true end of the VM's life — after
     // __module_shutdown has torn down globals, before the slabs are freed.
@@ -120,6 +158,13 @@ struct RoxyVM {
     ~RoxyVM();
 };
 
+// Entry PC for a new frame running `func` on this VM: the function's threaded
+// stream when the VM dispatches threaded, else its packed code.
+inline const u32* vm_entry_pc(const RoxyVM* vm, const BCFunction* func) {
+    return vm->threaded_dispatch ? reinterpret_cast<const u32*>(func->threaded_code.data())
+                                 : func->code.data();
+}
+
 // Initialize VM with configuration
 bool vm_init(RoxyVM* vm, const VMConfig& config = VMConfig());
 
@@ -136,14 +181,82 @@ bool vm_call(RoxyVM* vm, StringView func_name, Span<Value> args);
 // Call a function by index
 bool vm_call_index(RoxyVM* vm, u32 func_index, Span<Value> args);
 
+// A script function resolved once by name. Hosts that call the same entry
+// point repeatedly (`on_tick`, `on_event`) resolve it after vm_load_module and
+// call through the handle, skipping the name lookup on every call. A handle
+// stays valid for as long as the same module is loaded.
+struct RoxyFunctionHandle {
+    u32 index = UINT32_MAX; // Function index in the loaded module
+
+    bool valid() const { return index != UINT32_MAX; }
+};
+
+// Resolve a function by name (invalid handle if there is none)
+RoxyFunctionHandle vm_resolve(RoxyVM* vm, StringView func_name);
+
+// Call a resolved function
+bool vm_call_handle(RoxyVM* vm, RoxyFunctionHandle func, Span<Value> args);
+
+// Call a resolved function with its argument registers already encoded:
+// `arg_regs` is copied straight into the callee's R0..R(n-1), with no tagged
+// Value per argument. `arg_reg_count` must equal the callee's
+// param_register_count (a 3-4 slot struct argument takes two registers).
+bool vm_call_handle_regs(RoxyVM* vm, RoxyFunctionHandle func, const u64* arg_regs,
+                         u32 arg_reg_count);
+
+// Call a resolved function `count` times in one VM entry, for per-entity
+// hooks (`update(entity)` over every entity in a frame). The frame is checked
+// and laid out once, and the runtime context is activated once; each call then
+// only writes its argument registers and runs. `args` holds `count` rows of
+// param_register_count encoded registers each (as for vm_call_handle_regs).
+// When `results` is non-null, results[i] receives call i's result register.
+// Returns the number of calls that completed: `count` on success, otherwise
+// the index of the call that failed (vm_get_error says why; the calls before
+// it have run and written their results).
+u32 vm_call_batch(RoxyVM* vm, RoxyFunctionHandle func, const u64* args, u32 count,
+                  u64* results);
+
+// Structure-of-args form of vm_call_batch: `arg_columns[p]` points at `count`
+// encoded registers for parameter register p, so hosts that keep entity state
+// in parallel arrays pass them without interleaving first.
+u32 vm_call_batch_columns(RoxyVM* vm, RoxyFunctionHandle func, const u64* const* arg_columns,
+                          u32 count, u64* results);
+
+// The loop behind both forms. `fill(user, i, regs)` writes call i's argument
+// registers into the callee's window just before the call runs (ScriptFunction
+// uses it to encode typed host arrays in place).
+using RoxyBatchArgFn = void (*)(void* user, u32 index, u64* regs);
+u32 vm_call_batch_with(RoxyVM* vm, RoxyFunctionHandle func, u32 count, RoxyBatchArgFn fill,
+                       void* user, u64* results);
+
+// The two halves of every host->script call, for callers that encode their
+// own arguments (ScriptFunction in binding/script_function.hpp).
+// vm_push_entry_frame validates `func_index`, reserves the callee's register
+// window and local stack, and pushes its frame; it returns the register window
+// to write the arguments into, or nullptr (error set, nothing reserved) if the
+// call can't be made. vm_run_entry_frame then executes that frame. The
+// argument count is the caller's to check.
+u64* vm_push_entry_frame(RoxyVM* vm, u32 func_index);
+bool vm_run_entry_frame(RoxyVM* vm);
+
 // Get the result of the last call (value in R0)
 Value vm_get_result(RoxyVM* vm);
 
+// The raw bits of the last call's result register, for vm_call_handle_regs
+// callers that know the return type
+u64 vm_get_result_reg(RoxyVM* vm);
+
 // Census of everything this VM's slab allocator still holds. After a program
 // has run to completion, `leaked` must be 0 — see roxy_rt_heap_stats for the
-// full contract. Call it BEFORE vm_destroy, which frees the slabs.
+// full contract. Call it BEFORE vm_destroy, which frees the slabs. It drains
+// the state pools first, so parked coroutine states don't count as live.
 roxy_heap_stats vm_heap_stats(RoxyVM* vm);
 
+// Send script output (print) to `sink` instead of stdout; null restores stdout.
+// Output is buffered per VM and delivered when the buffer fills, on the
+// script's flush(), and when the outermost call returns or fails.
+void vm_set_output_sink(RoxyVM* vm, roxy_output_sink sink, void* userdata);
+
 // Get error message (or nullptr if no error)
 const char* vm_get_error(RoxyVM* vm);
 
@@ -1,10 +1,15 @@
 // Roxy standalone interpreter
 // Usage: roxy [options] <source_file> [program_args...]
 
+#include "roxy/compiler/codegen/c_emitter.hpp"
+#include "roxy/compiler/driver/bundled_modules.hpp"
 #include "roxy/compiler/driver/compiler.hpp"
+#include "roxy/compiler/driver/compiler_session.hpp"
 #include "roxy/compiler/ir/ssa_ir.hpp"
 #include "roxy/core/bump_allocator.hpp"
 #include "roxy/core/file.hpp"
+#include "roxy/core/json.hpp"
+#include "roxy/core/string.hpp"
 #include "roxy/core/trace.hpp"
 #include "roxy/core/unique_ptr.hpp"
 #include "roxy/core/vector.hpp"
@@ -16,6 +21,7 @@
 #include "roxy/vm/string.hpp"
 #include "roxy/vm/vm.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
@@ -75,6 +81,151 @@ static void print_timings(const CompileTimings& t, u64 runs, u64 execute_ns) {
     if (execute_ns > 0) {
         fprintf(stderr, "  %-12s %10.3f ms\n", "execute", static_cast<double>(execute_ns) / 1.0e6);
     }
+
+    // Register spills: totals, then the worst functions by emitted spill ops.
+    // Most programs never spill; say nothing then.
+    if (t.spilled_values == 0)
+        return;
+    fprintf(stderr, "\n== roxy --time: register spills ==\n");
+    fprintf(stderr, "  %u values spilled in %u functions, %u SPILL_REG/RELOAD_REG emitted\n",
+            t.spilled_values, static_cast<u32>(t.spills.size()), t.spill_ops);
+    Vector<FunctionSpillStats> worst = t.spills;
+    std::sort(worst.begin(), worst.end(),
+              [](const FunctionSpillStats& a, const FunctionSpillStats& b) {
+                  return a.spill_ops > b.spill_ops;
+              });
+    constexpr u32 max_listed = 10;
+    for (u32 i = 0; i < worst.size() && i < max_listed; i++) {
+        const FunctionSpillStats& f = worst[i];
+        fprintf(stderr, "  %8u ops  %6u values  %.*s\n", f.spill_ops, f.spilled_values,
+                (int)f.function.size(), f.function.data());
+    }
+}
+
+// One phase's name and counters, in the table/JSON order.
+struct PhaseRow {
+    const char* name;
+    u64 ns;
+    const PhaseMemory* memory;
+};
+
+static void phase_rows(const CompileTimings& t, PhaseRow (&rows)[9]) {
+    const CompileMemory& m = t.memory;
+    PhaseRow filled[9] = {
+        {"parse", t.parse_ns, &m.parse},
+        {"topo-sort", t.topo_ns, &m.topo},
+        {"sema", t.sema_ns, &m.sema},
+        {"ir-build", t.ir_build_ns, &m.ir_build},
+        {"coro-lower", t.coro_lower_ns, &m.coro_lower},
+        {"ir-optimize", t.ir_optimize_ns, &m.ir_optimize},
+        {"ir-validate", t.ir_validate_ns, &m.ir_validate},
+        {"bc-lower", t.bc_lower_ns, &m.bc_lower},
+        {"compile", t.total_ns, &m.total},
+    };
+    for (u32 i = 0; i < 9; i++) {
+        rows[i] = filled[i];
+    }
+}
+
+// Print the per-phase memory counters (see `roxy --time=mem`), averaged over
+// `runs` compiles like print_timings.
+static void print_memory(const CompileTimings& t, u64 runs) {
+    auto kib = [runs](u64 bytes) {
+        return static_cast<double>(bytes) / 1024.0 / static_cast<double>(runs);
+    };
+    auto avg = [runs](u64 count) { return static_cast<double>(count) / static_cast<double>(runs); };
+
+    PhaseRow rows[9];
+    phase_rows(t, rows);
+
+    fprintf(stderr, "\n== roxy --time=mem: compile memory");
+    if (runs > 1)
+        fprintf(stderr, " (avg of %llu runs)", (unsigned long long)runs);
+    fprintf(stderr, " ==\n");
+    fprintf(stderr, "  %-12s %12s %7s %10s %14s %13s\n", "", "arena KiB", "chunks", "vec grows",
+            "vec KiB moved", "peak RSS KiB");
+    for (const PhaseRow& r : rows) {
+        if (r.memory == &t.memory.total)
+            fprintf(stderr, "  %-12s %12s %7s %10s %14s %13s\n", "", "----------", "------",
+                    "---------", "-------------", "------------");
+        const PhaseMemory& m = *r.memory;
+        fprintf(stderr, "  %-12s %12.1f %7.1f %10.0f %14.1f %13.1f\n", r.name, kib(m.arena_bytes),
+                avg(m.arena_chunks), avg(m.vector_reallocs), kib(m.vector_bytes_moved),
+                kib(m.peak_rss_bytes));
+    }
+
+    const CompileMemory& m = t.memory;
+    fprintf(stderr, "\n  side tables: values_by_id %.1f KiB (largest function %u values), "
+                    "bc-lower %.1f KiB\n",
+            kib(m.values_by_id_bytes), m.max_value_ids, kib(m.bc_side_table_bytes));
+}
+
+// Print everything --time and --time=mem report as one JSON object on stdout
+// (see `roxy --time=json`), for CI to diff against a baseline. Times are
+// per-compile averages in milliseconds; byte and count fields are averages too.
+static void print_timings_json(const CompileTimings& t, u64 runs, u64 execute_ns) {
+    auto ms = [runs](u64 ns) {
+        return static_cast<double>(ns) / 1.0e6 / static_cast<double>(runs);
+    };
+    auto avg = [runs](u64 value) { return static_cast<i64>(value / runs); };
+
+    PhaseRow rows[9];
+    phase_rows(t, rows);
+
+    String out;
+    JsonWriter json(out);
+    json.write_start_object();
+    json.write_key_int("runs", static_cast<i64>(runs));
+    json.write_key("phases");
+    json.write_start_object();
+    for (const PhaseRow& r : rows) {
+        const PhaseMemory& m = *r.memory;
+        json.write_key(r.name);
+        json.write_start_object();
+        json.write_key_double("ms", ms(r.ns));
+        json.write_key_int("arena_bytes", avg(m.arena_bytes));
+        json.write_key_int("arena_chunks", avg(m.arena_chunks));
+        json.write_key_int("vector_reallocs", avg(m.vector_reallocs));
+        json.write_key_int("vector_bytes_moved", avg(m.vector_bytes_moved));
+        json.write_key_int("peak_rss_bytes", avg(m.peak_rss_bytes));
+        json.write_end_object();
+    }
+    json.write_end_object();
+    if (execute_ns > 0)
+        json.write_key_double("execute_ms", static_cast<double>(execute_ns) / 1.0e6);
+    json.write_key_int("values_by_id_bytes", avg(t.memory.values_by_id_bytes));
+    json.write_key_int("max_value_ids", t.memory.max_value_ids);
+    json.write_key_int("bc_side_table_bytes", avg(t.memory.bc_side_table_bytes));
+    json.write_key_int("spilled_values", t.spilled_values);
+    json.write_key_int("spill_ops", t.spill_ops);
+    json.write_end_object();
+    out.push_back('\0');
+    printf("%s\n", out.data());
+    fflush(stdout);
+}
+
+// Sum one compile's memory counters into `into` (the --repeat aggregate).
+static void add_phase_memory(PhaseMemory& into, const PhaseMemory& from) {
+    into.arena_bytes += from.arena_bytes;
+    into.arena_chunks += from.arena_chunks;
+    into.vector_reallocs += from.vector_reallocs;
+    into.vector_bytes_moved += from.vector_bytes_moved;
+    into.peak_rss_bytes += from.peak_rss_bytes;
+}
+
+static void add_memory(CompileMemory& into, const CompileMemory& from) {
+    add_phase_memory(into.parse, from.parse);
+    add_phase_memory(into.topo, from.topo);
+    add_phase_memory(into.sema, from.sema);
+    add_phase_memory(into.ir_build, from.ir_build);
+    add_phase_memory(into.coro_lower, from.coro_lower);
+    add_phase_memory(into.ir_optimize, from.ir_optimize);
+    add_phase_memory(into.ir_validate, from.ir_validate);
+    add_phase_memory(into.bc_lower, from.bc_lower);
+    add_phase_memory(into.total, from.total);
+    into.values_by_id_bytes += from.values_by_id_bytes;
+    into.max_value_ids = from.max_value_ids; // deterministic, like the spill counts
+    into.bc_side_table_bytes += from.bc_side_table_bytes;
 }
 
 static void print_usage(const char* program) {
@@ -88,14 +239,25 @@ static void print_usage(const char* program) {
     fprintf(stderr, "  --help, -h     Show this help message\n");
     fprintf(stderr, "  --dump-ir      Print SSA IR to stderr after compilation\n");
     fprintf(stderr, "  --dump-bc      Print bytecode disassembly to stderr after compilation\n");
+    fprintf(stderr, "  --emit-c=FILE  Write the program as C++ for the C backend to FILE instead\n");
+    fprintf(stderr, "                 of running it (build it against src/roxy/rt)\n");
     fprintf(stderr,
             "  --time         Print per-phase compile timing and compile-vs-execute split\n");
+    fprintf(stderr, "  --time=mem     Also print per-phase memory: arena bytes/chunks, Vector\n");
+    fprintf(stderr, "                 growths, peak RSS, and the big side tables' sizes\n");
+    fprintf(stderr, "  --time=json    Print the timing and memory counters as one JSON object\n");
+    fprintf(stderr, "                 on stdout instead of the tables (for CI baselines)\n");
     fprintf(stderr, "  --repeat=N     Compile N times and report averaged phase timing (skips\n");
     fprintf(stderr,
             "                 execution when N>1; the in-process loop for sampling profilers)\n");
     fprintf(stderr,
             "  --check-leaks  After the program exits, report any heap objects still alive\n");
     fprintf(stderr, "                 (a missing drop or unbalanced retain); exit 70 if any\n");
+    fprintf(stderr, "  --threaded     Run from load-time direct-threaded code\n");
+    fprintf(stderr, "                 (VMConfig::threaded_dispatch)\n");
+    fprintf(stderr, "  --serve        Compile server: read `compile <file>` / `run <file>` lines\n");
+    fprintf(stderr, "                 from stdin and answer on stdout, reusing one compiler\n");
+    fprintf(stderr, "                 session (builtin prelude, warm arena) across requests\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "The program must define a main() function as the entry point.\n");
     fprintf(stderr, "Imported modules are auto-discovered from the source file's directory.\n");
@@ -106,11 +268,28 @@ struct Options {
     int program_args_start = 0; // Index into argv where program args begin (0 = none)
     bool dump_ir = false;
     bool dump_bc = false;
+    const char* emit_c = nullptr; // --emit-c=FILE: C backend output path (skips execution)
     bool time = false;        // Print per-phase compile timing + compile-vs-execute split
+    bool time_memory = false; // --time=mem: also track and print CompileMemory
+    bool time_json = false;   // --time=json: report as JSON on stdout instead
     u32 repeat = 1;           // Compile-only benchmark loop count (>1 skips execution)
     bool check_leaks = false; // Report objects still alive at VM teardown
+    bool threaded = false;    // VMConfig::threaded_dispatch
+    bool serve = false;       // Compile server on stdin/stdout (see serve())
 };
 
+// Print what --time / --time=mem / --time=json asked for.
+static void report_timings(const CompileTimings& t, u64 runs, u64 execute_ns,
+                           const Options& opts) {
+    if (opts.time_json) {
+        print_timings_json(t, runs, execute_ns);
+        return;
+    }
+    print_timings(t, runs, execute_ns);
+    if (opts.time_memory)
+        print_memory(t, runs);
+}
+
 static bool parse_args(int argc, char** argv, Options& opts) {
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
@@ -120,10 +299,24 @@ static bool parse_args(int argc, char** argv, Options& opts) {
             opts.dump_ir = true;
         } else if (strcmp(argv[i], "--dump-bc") == 0) {
             opts.dump_bc = true;
+        } else if (strncmp(argv[i], "--emit-c=", 9) == 0) {
+            if (argv[i][9] == '\0') {
+                fprintf(stderr, "Error: --emit-c requires an output path\n");
+                return false;
+            }
+            opts.emit_c = argv[i] + 9;
         } else if (strcmp(argv[i], "--time") == 0) {
             opts.time = true;
+        } else if (strcmp(argv[i], "--time=mem") == 0) {
+            opts.time = opts.time_memory = true;
+        } else if (strcmp(argv[i], "--time=json") == 0) {
+            opts.time = opts.time_memory = opts.time_json = true;
         } else if (strcmp(argv[i], "--check-leaks") == 0) {
             opts.check_leaks = true;
+        } else if (strcmp(argv[i], "--threaded") == 0) {
+            opts.threaded = true;
+        } else if (strcmp(argv[i], "--serve") == 0) {
+            opts.serve = true;
         } else if (strncmp(argv[i], "--repeat=", 9) == 0) {
             long n = strtol(argv[i] + 9, nullptr, 10);
             if (n < 1) {
@@ -143,7 +336,7 @@ static bool parse_args(int argc, char** argv, Options& opts) {
         }
     }
 
-    if (!opts.source_file) {
+    if (!opts.source_file && !opts.serve) {
         fprintf(stderr, "Error: No source file specified\n\n");
         print_usage(argv[0]);
         return false;
@@ -270,6 +463,10 @@ static bool discover_modules(const String& base_dir, const String& module_name,
         SourceFile source_file;
         source_file.module_name = import_name;
         if (!read_file_to_buf(file_path.data(), source_file.buffer)) {
+            // No file of that name: a bundled module (`sched`) is added by the
+            // compiler itself.
+            if (find_bundled_module(StringView(import_name.data(), import_name.size())))
+                continue;
             fprintf(stderr, "Error: Could not read imported module '%s' (expected at '%s')\n",
                     import_name.c_str(), file_path.data());
             return false;
@@ -289,119 +486,56 @@ static bool discover_modules(const String& base_dir, const String& module_name,
     return true;
 }
 
-int main(int argc, char** argv) {
-    Options opts;
-    if (!parse_args(argc, argv, opts)) {
-        return 1;
-    }
-
-    // Read main source file
+// A source file plus every module it imports, read from disk and ready to hand
+// to a compiler.
+struct LoadedProgram {
     Vector<u8> main_source_buf;
-    if (!read_file_to_buf(opts.source_file, main_source_buf)) {
-        fprintf(stderr, "Error: Could not read file '%s'\n", opts.source_file);
-        return 1;
+    String main_module_name;
+    Vector<SourceFile> discovered_modules; // Dependencies before dependents
+};
+
+static bool load_program(const char* source_file, LoadedProgram& program) {
+    if (!read_file_to_buf(source_file, program.main_source_buf)) {
+        fprintf(stderr, "Error: Could not read file '%s'\n", source_file);
+        return false;
     }
 
-    const char* main_source = reinterpret_cast<const char*>(main_source_buf.data());
-    u32 main_len = static_cast<u32>(main_source_buf.size() - 1);
+    const char* main_source = reinterpret_cast<const char*>(program.main_source_buf.data());
+    u32 main_len = static_cast<u32>(program.main_source_buf.size() - 1);
 
     // Determine base directory and module name
-    String base_dir = get_directory(opts.source_file);
-    String main_module_name = get_module_name(opts.source_file);
+    String base_dir = get_directory(source_file);
+    program.main_module_name = get_module_name(source_file);
 
     // Discover all imported modules recursively
-    Vector<SourceFile> discovered_modules;
     tsl::robin_map<String, bool> visited;
-    if (!discover_modules(base_dir, main_module_name, main_source, main_len, discovered_modules,
-                          visited)) {
-        return 1;
-    }
-
-    // Register all discovered source modules (dependencies before dependents,
-    // main last) onto a compiler. Reused by both the normal path and the
-    // --repeat benchmark loop, which builds a fresh compiler each iteration.
-    auto add_sources = [&](Compiler& c) {
-        for (auto& source_file : discovered_modules) {
-            const char* source = reinterpret_cast<const char*>(source_file.buffer.data());
-            u32 len = static_cast<u32>(source_file.buffer.size() - 1);
-            c.add_source(StringView(source_file.module_name.data(),
-                                    static_cast<u32>(source_file.module_name.size())),
-                         source, len);
-        }
-        c.add_source(StringView(main_module_name.data(), static_cast<u32>(main_module_name.size())),
-                     main_source, main_len);
-    };
-
-    // --repeat=N (N>1): compile-only benchmark loop. A fresh allocator +
-    // compiler per iteration keeps each compile independent; timings are summed
-    // and reported as a per-compile average. Execution is skipped — this is the
-    // in-process loop to run under a sampling profiler for compiler hotspots.
-    if (opts.repeat > 1) {
-        CompileTimings agg{};
-        for (u32 iter = 0; iter < opts.repeat; iter++) {
-            BumpAllocator loop_alloc(65536);
-            Compiler loop_compiler(loop_alloc);
-            add_sources(loop_compiler);
-            BCModule* m = loop_compiler.compile();
-            if (!m) {
-                fprintf(stderr, "Compilation failed (iteration %u):\n", iter);
-                for (const char* error : loop_compiler.errors()) {
-                    fprintf(stderr, "  %s\n", error);
-                }
-                return 1;
-            }
-            const CompileTimings& t = loop_compiler.timings();
-            agg.parse_ns += t.parse_ns;
-            agg.topo_ns += t.topo_ns;
-            agg.sema_ns += t.sema_ns;
-            agg.ir_build_ns += t.ir_build_ns;
-            agg.coro_lower_ns += t.coro_lower_ns;
-            agg.ir_optimize_ns += t.ir_optimize_ns;
-            agg.ir_validate_ns += t.ir_validate_ns;
-            agg.bc_lower_ns += t.bc_lower_ns;
-            agg.total_ns += t.total_ns;
-            ROXY_FRAME_MARK; // one Tracy frame per compile (no-op unless ENABLE_TRACY)
-        }
-        print_timings(agg, opts.repeat, 0);
-        return 0;
-    }
-
-    // Create allocator and compiler
-    BumpAllocator allocator(65536);
-    Compiler compiler(allocator);
-    add_sources(compiler);
-
-    // Compile all modules
-    BCModule* module = compiler.compile();
-    if (!module) {
-        fprintf(stderr, "Compilation failed:\n");
-        for (const char* error : compiler.errors()) {
-            fprintf(stderr, "  %s\n", error);
-        }
-        return 1;
-    }
-
-    // Dump IR if requested
-    if (opts.dump_ir) {
-        for (u32 i = 0; i < compiler.module_count(); i++) {
-            IRModule* ir_module = compiler.ir_module(i);
-            if (ir_module) {
-                String ir_str;
-                ir_module_to_string(ir_module, ir_str);
-                ir_str.push_back('\0');
-                fprintf(stderr, "%s\n", ir_str.data());
-            }
-        }
-    }
+    return discover_modules(base_dir, program.main_module_name, main_source, main_len,
+                            program.discovered_modules, visited);
+}
 
-    // Dump bytecode if requested
-    if (opts.dump_bc) {
-        String bc_str;
-        disassemble_module(module, bc_str);
-        bc_str.push_back('\0');
-        fprintf(stderr, "%s\n", bc_str.data());
+// Register all of a program's source modules (dependencies before dependents,
+// main last) onto a compiler.
+static void add_sources(Compiler& compiler, const LoadedProgram& program) {
+    for (const auto& source_file : program.discovered_modules) {
+        const char* source = reinterpret_cast<const char*>(source_file.buffer.data());
+        u32 len = static_cast<u32>(source_file.buffer.size() - 1);
+        compiler.add_source(StringView(source_file.module_name.data(),
+                                       static_cast<u32>(source_file.module_name.size())),
+                            source, len);
     }
+    compiler.add_source(StringView(program.main_module_name.data(),
+                                   static_cast<u32>(program.main_module_name.size())),
+                        reinterpret_cast<const char*>(program.main_source_buf.data()),
+                        static_cast<u32>(program.main_source_buf.size() - 1));
+}
 
+// Run a compiled program's main(). Program arguments are
+// argv[opts.program_args_start..] (none when that is 0). Returns false when
+// main() could not run to completion (or leaked, under --check-leaks);
+// `exit_code` is the process exit code either way and `execute_ns` main()'s
+// run time.
+static bool run_main(BCModule* module, const Options& opts, int argc, char** argv,
+                     int& exit_code, u64& execute_ns) {
     // Find main() function
     StringView main_func_name("main", 4);
     BCFunction* main_func = nullptr;
@@ -414,18 +548,22 @@ int main(int argc, char** argv) {
 
     if (!main_func) {
         fprintf(stderr, "Error: No main() function found\n");
-        return 1;
+        exit_code = 1;
+        return false;
     }
 
     if (main_func->param_count > 1) {
         fprintf(stderr, "Error: main() must take 0 or 1 argument (found %u parameters)\n",
                 main_func->param_count);
-        return 1;
+        exit_code = 1;
+        return false;
     }
 
     // Initialize VM and run
     RoxyVM vm;
-    vm_init(&vm);
+    VMConfig vm_config;
+    vm_config.threaded_dispatch = opts.threaded;
+    vm_init(&vm, vm_config);
     vm_load_module(&vm, module);
 
     // Build argument list for main() if it takes a parameter
@@ -475,12 +613,13 @@ int main(int argc, char** argv) {
 
     u64 exec_start = now_ns();
     bool run_ok = vm_call(&vm, main_func_name, call_args);
-    u64 execute_ns = now_ns() - exec_start;
+    execute_ns = now_ns() - exec_start;
 
     if (!run_ok) {
         fprintf(stderr, "Runtime error: %s\n", vm.error ? vm.error : "unknown error");
         vm_destroy(&vm);
-        return 1;
+        exit_code = 1;
+        return false;
     }
 
     Value result = vm_get_result(&vm);
@@ -501,17 +640,220 @@ int main(int argc, char** argv) {
             fprintf(stderr, "  %8llu  %.*s\n", (unsigned long long)entry.second, (int)name.size(),
                     name.data());
         }
-        return 70; // EX_SOFTWARE — distinct from a program's own exit code
+        exit_code = 70; // EX_SOFTWARE — distinct from a program's own exit code
+        return false;
     }
 
-    // Phase timing: compile breakdown (from the compiler) + execute split.
-    if (opts.time) {
-        print_timings(compiler.timings(), 1, execute_ns);
+    // Use integer return value as exit code
+    exit_code = result.is_int() ? static_cast<int>(result.as_int) : 0;
+    return true;
+}
+
+// --serve: a compile server for editor hot-reload loops. Requests arrive on
+// stdin one per line:
+//   compile <file>   compile the file and its imports
+//   run <file>       compile, then run main() (its output goes to stdout first)
+// and each gets one status line on stdout:
+//   ok compile_ms=<ms>            (run adds ` exit=<code>`)
+//   error <n>                     followed by n lines, one per error
+// One CompilerSession serves every request, so the builtin prelude is built
+// once and the arena stays warm; only per-compile state is reset.
+static int serve(const Options& opts) {
+    CompilerSession session;
+    char line[4096];
+    while (fgets(line, sizeof(line), stdin)) {
+        u32 len = static_cast<u32>(strlen(line));
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+            line[--len] = '\0';
+        }
+        if (len == 0)
+            continue;
+
+        bool run = false;
+        const char* path = nullptr;
+        if (strncmp(line, "compile ", 8) == 0) {
+            path = line + 8;
+        } else if (strncmp(line, "run ", 4) == 0) {
+            run = true;
+            path = line + 4;
+        } else {
+            printf("error 1\nunknown request: %s\n", line);
+            fflush(stdout);
+            continue;
+        }
+
+        LoadedProgram program;
+        if (!load_program(path, program)) {
+            printf("error 1\ncould not load '%s'\n", path);
+            fflush(stdout);
+            continue;
+        }
+
+        u64 compile_start = now_ns();
+        Compiler& compiler = session.begin_compile();
+        add_sources(compiler, program);
+        BCModule* module = compiler.compile();
+        double compile_ms = static_cast<double>(now_ns() - compile_start) / 1.0e6;
+        if (!module) {
+            printf("error %u\n", static_cast<u32>(compiler.errors().size()));
+            for (const char* error : compiler.errors()) {
+                printf("%s\n", error);
+            }
+            fflush(stdout);
+            continue;
+        }
+
+        if (run) {
+            Options run_opts = opts;
+            run_opts.source_file = path;
+            run_opts.program_args_start = 0;
+            int exit_code = 0;
+            u64 execute_ns = 0;
+            fflush(stdout);
+            run_main(module, run_opts, 0, nullptr, exit_code, execute_ns);
+            fflush(stdout);
+            printf("ok compile_ms=%.3f exit=%d\n", compile_ms, exit_code);
+        } else {
+            printf("ok compile_ms=%.3f\n", compile_ms);
+        }
+        fflush(stdout);
+
+        // The module names functions through session memory that the next
+        // begin_compile() reclaims.
+        delete module;
     }
+    return 0;
+}
 
-    // Use integer return value as exit code
-    if (result.is_int()) {
-        return static_cast<int>(result.as_int);
+// Write the compiled program through the C backend (see `roxy --emit-c`): the
+// linked module, so imports and coroutine lowering's additions are included.
+static int emit_c_source(BumpAllocator& allocator, const Compiler& compiler, const char* path) {
+    CEmitterConfig config;
+    config.emit_main_entry = true;
+    CEmitter emitter(allocator, config);
+    String output;
+    emitter.emit_source(compiler.linked_ir_module(), output);
+
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        fprintf(stderr, "Error: could not open '%s' for writing\n", path);
+        return 1;
+    }
+    bool ok = fwrite(output.data(), 1, output.size(), f) == output.size();
+    ok = fclose(f) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "Error: could not write '%s'\n", path);
+        return 1;
     }
     return 0;
 }
+
+int main(int argc, char** argv) {
+    Options opts;
+    if (!parse_args(argc, argv, opts)) {
+        return 1;
+    }
+
+    if (opts.serve) {
+        return serve(opts);
+    }
+
+    LoadedProgram program;
+    if (!load_program(opts.source_file, program)) {
+        return 1;
+    }
+
+    // --repeat=N (N>1): compile-only benchmark loop. A fresh allocator +
+    // compiler per iteration keeps each compile independent; timings are summed
+    // and reported as a per-compile average. Execution is skipped — this is the
+    // in-process loop to run under a sampling profiler for compiler hotspots.
+    if (opts.repeat > 1) {
+        CompileTimings agg{};
+        for (u32 iter = 0; iter < opts.repeat; iter++) {
+            BumpAllocator loop_alloc(65536);
+            Compiler loop_compiler(loop_alloc);
+            loop_compiler.set_track_memory(opts.time_memory);
+            add_sources(loop_compiler, program);
+            BCModule* m = loop_compiler.compile();
+            if (!m) {
+                fprintf(stderr, "Compilation failed (iteration %u):\n", iter);
+                for (const char* error : loop_compiler.errors()) {
+                    fprintf(stderr, "  %s\n", error);
+                }
+                return 1;
+            }
+            const CompileTimings& t = loop_compiler.timings();
+            agg.parse_ns += t.parse_ns;
+            agg.topo_ns += t.topo_ns;
+            agg.sema_ns += t.sema_ns;
+            agg.ir_build_ns += t.ir_build_ns;
+            agg.coro_lower_ns += t.coro_lower_ns;
+            agg.ir_optimize_ns += t.ir_optimize_ns;
+            agg.ir_validate_ns += t.ir_validate_ns;
+            agg.bc_lower_ns += t.bc_lower_ns;
+            agg.total_ns += t.total_ns;
+            add_memory(agg.memory, t.memory);
+            // Spill counts are deterministic — keep one compile's, not a sum.
+            agg.spilled_values = t.spilled_values;
+            agg.spill_ops = t.spill_ops;
+            agg.spills = t.spills;
+            ROXY_FRAME_MARK; // one Tracy frame per compile (no-op unless ENABLE_TRACY)
+        }
+        report_timings(agg, opts.repeat, 0, opts);
+        return 0;
+    }
+
+    // Create allocator and compiler
+    BumpAllocator allocator(65536);
+    Compiler compiler(allocator);
+    compiler.set_track_memory(opts.time_memory);
+    add_sources(compiler, program);
+
+    // Compile all modules
+    BCModule* module = compiler.compile();
+    if (!module) {
+        fprintf(stderr, "Compilation failed:\n");
+        for (const char* error : compiler.errors()) {
+            fprintf(stderr, "  %s\n", error);
+        }
+        return 1;
+    }
+
+    // Dump IR if requested
+    if (opts.dump_ir) {
+        for (u32 i = 0; i < compiler.module_count(); i++) {
+            IRModule* ir_module = compiler.ir_module(i);
+            if (ir_module) {
+                String ir_str;
+                ir_module_to_string(ir_module, ir_str);
+                ir_str.push_back('\0');
+                fprintf(stderr, "%s\n", ir_str.data());
+            }
+        }
+    }
+
+    // Dump bytecode if requested
+    if (opts.dump_bc) {
+        String bc_str;
+        disassemble_module(module, bc_str);
+        bc_str.push_back('\0');
+        fprintf(stderr, "%s\n", bc_str.data());
+    }
+
+    if (opts.emit_c) {
+        return emit_c_source(allocator, compiler, opts.emit_c);
+    }
+
+    int exit_code = 0;
+    u64 execute_ns = 0;
+    if (!run_main(module, opts, argc, argv, exit_code, execute_ns)) {
+        return exit_code;
+    }
+
+    // Phase timing: compile breakdown (from the compiler) + execute split.
+    if (opts.time) {
+        report_timings(compiler.timings(), 1, execute_ns, opts);
+    }
+
+    return exit_code;
+}
@@ -246,18 +246,18 @@ static bool is_cpp_keyword(StringView s) {
 }
 
 void CEmitter::emit_mangled_name(StringView name, String& out) {
-    // Translate Roxy mangling ($$ -> __, $ -> _) into a temp, then escape any
-    // result that collides with a C/C++ keyword by prefixing a reserved marker
-    // (`double` -> `roxy_kw_double`). A prefix (vs a `_` suffix) keeps `double`
+    // Translate Roxy mangling ($$ -> __, $ -> _, module-qualified mod::fn ->
+    // mod__fn) into a temp, then escape any result that collides with a C/C++
+    // keyword by prefixing a reserved marker (`double` -> `roxy_kw_double`). A prefix (vs a `_` suffix) keeps `double`
     // and a user's `double_` distinct. Applied uniformly to type/function/field
     // names so definitions and uses agree.
     String mangled;
     const char* data = name.data();
     u32 len = name.size();
     for (u32 i = 0; i < len; i++) {
-        if (data[i] == '$' && i + 1 < len && data[i + 1] == '$') {
+        if ((data[i] == '$' || data[i] == ':') && i + 1 < len && data[i + 1] == data[i]) {
             mangled.append("__");
-            i++; // skip second $
+            i++; // skip the second $ or :
         } else if (data[i] == '$') {
             mangled.push_back('_');
         } else {
@@ -320,12 +320,18 @@ void CEmitter::emit_field_access(ValueId object, StringView field_name, String&
     // A Coroutine-typed object (done()'s __state read) is a first-class value
     // whose concrete state struct may be erased (void*). Read the reserved header
     // field via the common __coro_header prefix — valid for both erased and known
-    // (`__coro_<fn>*`) representations.
+    // (`__coro_<fn>*`) representations. The read goes through a plain scalar
+    // pointer at the header offset: resume writes the field as a `__coro_<fn>`
+    // member, and an access through the unrelated `__coro_header` struct type
+    // may be assumed not to alias it once resume is inlined (-O2 then hoisted
+    // done() out of the drain loop, which never ended).
     if (ot && ot->kind == TypeKind::Coroutine) {
-        out.append("((__coro_header*)");
+        out.append(field_name == "__resume_idx"_sv ? "(*(uint32_t*)((char*)"
+                                                   : "(*(int32_t*)((char*)");
         emit_value(object, out);
-        out.append(")->");
+        out.append(" + offsetof(__coro_header, ");
         emit_mangled_name(field_name, out);
+        out.append(")))");
         return;
     }
     emit_value(object, out);
@@ -429,7 +435,9 @@ void CEmitter::collect_value_types(const IRFunction* func) {
             // the container's backing storage (matches Roxy's "all struct
             // rvalues are pointers" convention). Tracked as pointer values
             // so the local declaration emits `StructType* vN;`.
-            if (inst->op == IROp::IndexGet && inst->type && inst->type->is_struct()) {
+            if ((inst->op == IROp::IndexGet || inst->op == IROp::MapIterKey ||
+                 inst->op == IROp::MapIterValue) &&
+                inst->type && inst->type->is_struct()) {
                 m_pointer_values.insert(inst->result.id);
             }
             if (inst->op == IROp::CallNative && inst->type && inst->type->is_struct()) {
@@ -491,6 +499,28 @@ void CEmitter::emit_global_definitions(const IRModule* module, String& out) {
 // Append an rx::String to the output buffer.
 static inline void ap(String& out, const String& s) { out.append(StringView(s.data(), s.size())); }
 
+// NaN and the infinities have no literal spelling ("%g" prints "nan" / "inf"),
+// so a folded non-finite constant is emitted through the compiler builtins.
+// Finishes the assignment the caller started; returns false for finite values.
+static bool emit_nonfinite_const(double v, const char* suffix, String& out) {
+    if (v == v && v - v == 0.0)
+        return false;
+    out.append(" = ");
+    if (v != v) {
+        out.append("__builtin_nan");
+        out.append(suffix);
+        out.append("(\"\")");
+    } else {
+        if (v < 0)
+            out.append("-");
+        out.append("__builtin_inf");
+        out.append(suffix);
+        out.append("()");
+    }
+    out.append(";\n");
+    return true;
+}
+
 void CEmitter::emit_delete_slot(Type* elem, StringView slot_expr, String& out) {
     if (!elem)
         return;
@@ -625,7 +655,11 @@ void CEmitter::emit_typed_delete(Type* type, StringView ptr_expr, bool free_obj,
                 ap(out, pv);
                 out.append(") {\n");
                 emit_dtor_call(StringView(pv.data(), pv.size()));
-                out.append("    roxy_free(");
+                if (st->struct_info.is_coro_state) {
+                    out.append("    roxy_pool_free(");
+                } else {
+                    out.append("    roxy_free(");
+                }
                 ap(out, pv);
                 out.append(");\n");
                 out.append("    } }\n");
@@ -649,7 +683,7 @@ void CEmitter::append_type_mangle(Type* type, String& out) {
     }
     switch (type->kind) {
         case TypeKind::List:
-            out.append("List$");
+            out.append(type->is_array() ? "Array$" : "List$");
             append_type_mangle(type->list_info.element_type, out);
             break;
         case TypeKind::Map:
@@ -766,7 +800,8 @@ void CEmitter::emit_container_drop_body(Type* type, StringView self_var, String&
             emit_delete_slot(elem, StringView(sv.data(), sv.size()), out);
             out.append("    }\n");
         }
-        out.append("    roxy_list_delete(");
+        // An Array's buffer may be a file mapping: roxy_array_delete unmaps it.
+        out.append(type->is_array() ? "    roxy_array_delete(" : "    roxy_list_delete(");
         ap(out, h);
         out.append(");\n");
         out.append("    roxy_free(");
@@ -871,6 +906,45 @@ String CEmitter::request_container_drop_glue(Type* container) {
     return name;
 }
 
+String CEmitter::request_sort_less_adapter(Type* less_fn_type) {
+    // Both params share the element's borrowed type, which names the adapter
+    // (function types mangle erased). Struct params travel by pointer;
+    // everything else is loaded out of the element bytes.
+    Type* param = less_fn_type->func_info.param_types[0];
+    String name;
+    name.append("roxy_sort_less__");
+    append_type_mangle(param, name);
+    if (m_sort_less_seen.insert(param).second) {
+        bool by_pointer = param && param->is_struct();
+        String param_c;
+        emit_type(param, param_c);
+        if (by_pointer)
+            param_c.push_back('*');
+        StringView pc(param_c.data(), param_c.size());
+
+        String def;
+        def.append("static bool ");
+        def.append(StringView(name.data(), name.size()));
+        def.append("(void* env, const void* a, const void* b) {\n");
+        def.append("    return ((bool(*)(void*, ");
+        def.append(pc);
+        def.append(", ");
+        def.append(pc);
+        def.append("))g_closure_fns[*(uint32_t*)env])(env, ");
+        for (int k = 0; k < 2; k++) {
+            if (k > 0)
+                def.append(", ");
+            def.append(by_pointer ? "(" : "*(");
+            def.append(pc);
+            def.append(by_pointer ? ")" : "*)");
+            def.append(k == 0 ? "a" : "b");
+        }
+        def.append(");\n}\n\n");
+        m_sort_less_defs.append(StringView(def.data(), def.size()));
+    }
+    return name;
+}
+
 // --- Enum typedefs ---
 
 void CEmitter::emit_enum_typedefs(const IRModule* module, String& out) {
@@ -1220,6 +1294,8 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
         case IROp::ConstF: {
             out.append("    ");
             emit_value(inst->result, out);
+            if (emit_nonfinite_const(static_cast<double>(inst->const_data.f32_val), "f", out))
+                return;
             char numbuf[48];
             snprintf(numbuf, sizeof(numbuf), "%.9g", static_cast<double>(inst->const_data.f32_val));
             // A whole-number f32 formats as a bare integer ("0", "42"); the 'f'
@@ -1240,6 +1316,8 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
         case IROp::ConstD: {
             out.append("    ");
             emit_value(inst->result, out);
+            if (emit_nonfinite_const(inst->const_data.f64_val, "", out))
+                return;
             char buf[48];
             snprintf(buf, sizeof(buf), " = %.17g;\n", inst->const_data.f64_val);
             out.append(buf);
@@ -2048,7 +2126,11 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
             Type* val_type = inst->type;
             bool is_struct_val = val_type && val_type->is_struct();
             bool is_map = inst->index_data.kind == ContainerKind::Map;
-            const char* fn = is_map ? "roxy_map_get" : "roxy_list_get";
+            // An Array index is already bounds-checked (or in range by
+            // construction), so it reads through the inline element address.
+            const char* fn = is_map ? "roxy_map_get"
+                             : inst->index_data.kind == ContainerKind::Array ? "roxy_array_elem"
+                                                                             : "roxy_list_get";
             // For maps, the key is now a `const void*` to bytes. Primitive
             // keys are bit-copied into a 2-slot uint64_t temp so the runtime
             // sees the full 8 bytes per key (matches the runtime's
@@ -2097,6 +2179,91 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
             return;
         }
 
+        case IROp::MapIterNext: {
+            out.append("    ");
+            emit_value(inst->result, out);
+            out.append(" = roxy_map_iter_next((void*)");
+            emit_value(inst->index_data.container, out);
+            out.append(", ");
+            emit_value(inst->index_data.index, out);
+            out.append(");\n");
+            return;
+        }
+
+        case IROp::MapIterKey:
+        case IROp::MapIterValue: {
+            // Bucket entry of a pinned map: a struct entry stays a pointer into
+            // the bucket (like IndexGet), anything else is read in place.
+            Type* val_type = inst->type;
+            out.append("    ");
+            emit_value(inst->result, out);
+            out.append(val_type && val_type->is_struct() ? " = (" : " = *(");
+            emit_type(val_type, out);
+            out.append("*)");
+            out.append(inst->op == IROp::MapIterKey ? "roxy_map_iter_key" : "roxy_map_iter_value");
+            out.append("((void*)");
+            emit_value(inst->index_data.container, out);
+            out.append(", ");
+            emit_value(inst->index_data.index, out);
+            out.append(");\n");
+            return;
+        }
+
+        case IROp::Simd:
+        case IROp::SimdStore: {
+            // One roxy_<kind>_<op> helper from roxy_rt.h. A vector result is a
+            // plain struct local written through its address; vector operands
+            // are passed by address, scalars (splat / scale lane, List, index)
+            // by value. The bitwise ops are `bit_*` there: `and` / `or` / `xor`
+            // are reserved tokens when the header is compiled as C++.
+            const SimdData& simd = inst->simd;
+            bool vector_result = inst->type && inst->type->is_struct();
+            auto emit_vector_operand = [&](ValueId id) {
+                if (!is_pointer_value(id))
+                    out.push_back('&');
+                emit_value(id, out);
+            };
+            out.append("    ");
+            if (inst->op == IROp::Simd && !vector_result) {
+                emit_value(inst->result, out);
+                out.append(" = ");
+            }
+            out.append("roxy_");
+            out.append(simd_kind_to_string(simd.kind));
+            out.push_back('_');
+            if (simd.op == SimdOp::And || simd.op == SimdOp::Or || simd.op == SimdOp::Xor)
+                out.append("bit_");
+            out.append(simd_op_to_string(simd.op));
+            out.push_back('(');
+            bool first = true;
+            if (vector_result) {
+                out.push_back('&');
+                emit_value(inst->result, out);
+                first = false;
+            }
+            ValueId operands[] = {simd.a, simd.b, simd.c};
+            for (ValueId operand : operands) {
+                if (!operand.is_valid())
+                    continue;
+                if (!first)
+                    out.append(", ");
+                first = false;
+                Type* operand_type = get_value_type(operand);
+                if (operand_type && operand_type->is_struct()) {
+                    emit_vector_operand(operand);
+                } else {
+                    emit_value(operand, out);
+                }
+            }
+            if (simd.op == SimdOp::Shuffle) {
+                char buf[16];
+                format_to(buf, sizeof(buf), ", {}", simd.imm);
+                out.append(buf);
+            }
+            out.append(");\n");
+            return;
+        }
+
         case IROp::IndexAddr: {
             // &container[index] — the runtime get returns a void* into the
             // backing buffer; keep it as a typed element pointer (no deref). Map
@@ -2178,7 +2345,15 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
             Type* val_type = get_value_type(inst->index_data.value);
             bool is_struct_val = val_type && val_type->is_struct();
             bool is_map = inst->index_data.kind == ContainerKind::Map;
-            const char* fn = is_map ? "roxy_map_insert" : "roxy_list_set";
+            bool is_array = inst->index_data.kind == ContainerKind::Array;
+            const char* fn = is_map ? "roxy_map_insert" : is_array ? "roxy_array_set" : "roxy_list_set";
+            if (is_array) {
+                // The temp is copied at the element's width.
+                Type* array_type = get_value_type(inst->index_data.container);
+                array_type = array_type ? array_type->base_type() : nullptr;
+                if (array_type && array_type->is_list())
+                    val_type = array_type->list_info.element_type;
+            }
             Type* key_type = is_map ? get_value_type(inst->index_data.index) : nullptr;
             bool key_is_struct = key_type && key_type->is_struct();
             bool needs_key_temp = is_map && !key_is_struct;
@@ -2235,12 +2410,22 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
             emit_value(inst->result, out);
             out.append(" = (");
             emit_type(inst->type, out);
-            out.append(")roxy_alloc(sizeof(");
             // The result type is a pointer (Uniq/Ref), so get the inner struct type
             Type* inner_type = inst->type;
             if (inner_type && inner_type->is_reference()) {
                 inner_type = inner_type->ref_info.inner_type;
             }
+            if (inner_type && inner_type->is_struct() && inner_type->struct_info.is_coro_state) {
+                // Coroutine state: reuse one parked in the context's pool for
+                // its type (roxy_pool_alloc zeroes it)
+                out.append(")roxy_pool_alloc(sizeof(");
+                emit_type(inner_type, out);
+                out.append("), TYPEID_");
+                emit_mangled_name(inst->new_data.type_name, out);
+                out.append(");\n");
+                return;
+            }
+            out.append(")roxy_alloc(sizeof(");
             if (inner_type) {
                 emit_type(inner_type, out);
             } else {
@@ -2497,7 +2682,12 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
             if (ft && ft->is_function()) {
                 for (u32 p = 0; p < ft->func_info.param_types.size(); p++) {
                     out.append(", ");
-                    emit_type(ft->func_info.param_types[p], out);
+                    Type* param_type = ft->func_info.param_types[p];
+                    emit_type(param_type, out);
+                    // Struct params arrive through a pointer at the C ABI
+                    // boundary, as in every emitted function signature.
+                    if (param_type && param_type->is_struct())
+                        out.push_back('*');
                 }
             }
             out.append("))g_closure_fns[*(uint32_t*)");
@@ -2518,7 +2708,8 @@ void CEmitter::emit_instruction(const IRInst* inst, String& out) {
             // promotion. Mirrors the VM's ASSERT_HEAP owns() check.
             out.append("    if (!roxy_heap_owns(");
             emit_value(inst->unary, out);
-            out.append(")) { fprintf(stderr, \"cannot retain a reference to 'self': "
+            out.append(")) { roxy_output_flush(); "
+                       "fprintf(stderr, \"cannot retain a reference to 'self': "
                        "the receiver is stack-allocated. Snapshot it (a copy / "
                        "'[copy self]'), or call this method on a 'uniq' receiver.\\n\"); "
                        "abort(); }\n");
@@ -3142,15 +3333,26 @@ void CEmitter::emit_closure_dispatch(String& out) {
     for (u32 i = 0; i < m_closure_env_names.size(); i++) {
         StringView env_name = m_closure_env_names[i];
         String dtor = mangle_destructor_owned(env_name);
-        if (!find_function(StringView(dtor.data(), dtor.size())))
-            continue; // no dtor
+        bool has_dtor = find_function(StringView(dtor.data(), dtor.size())) != nullptr;
+        Type* env_type = find_struct_type(env_name);
+        bool pooled = env_type && env_type->struct_info.is_coro_state;
+        if (!has_dtor && !pooled)
+            continue;
         char cb[32];
         format_to(cb, sizeof(cb), "    case {}: ", i);
         out.append(cb);
-        emit_function_symbol(StringView(dtor.data(), dtor.size()), out);
-        out.append("((");
-        emit_mangled_name(env_name, out);
-        out.append("*)env); break;\n");
+        if (has_dtor) {
+            emit_function_symbol(StringView(dtor.data(), dtor.size()), out);
+            out.append("((");
+            emit_mangled_name(env_name, out);
+            out.append("*)env); ");
+        }
+        if (pooled) {
+            // A coroutine state goes back to its pool, not the allocator
+            out.append("roxy_pool_free(env); return;\n");
+        } else {
+            out.append("break;\n");
+        }
     }
     out.append("    default: break;\n");
     out.append("    }\n");
@@ -3351,7 +3553,9 @@ void CEmitter::emit_function(const IRFunction* func, String& out) {
             continue;
         out.append("    ");
         emit_value(func->params[i].value, out);
-        out.append(pt->is_list() ? " = roxy_list_copy(" : " = roxy_map_copy(");
+        out.append(pt->is_array()  ? " = roxy_array_copy("
+                   : pt->is_list() ? " = roxy_list_copy("
+                                   : " = roxy_map_copy(");
         emit_value(func->params[i].value, out);
         out.append(");\n");
     }
@@ -3944,6 +4148,9 @@ static const char* lookup_static_native_mapping(StringView name) {
         {"$ol$print$u64", "roxy_print_u64"},
         {"$ol$print$f32", "roxy_print_f32"},
         {"$ol$print$f64", "roxy_print_f64"},
+        {"$ol$fmt$f64", "roxy_f64_fmt"},
+        {"$ol$fmt$f32", "roxy_f32_fmt"},
+        {"flush", "roxy_output_flush"},
         // String functions
         {"str_concat", "roxy_string_concat"},
         {"str_eq", "roxy_string_eq"},
@@ -3952,10 +4159,34 @@ static const char* lookup_static_native_mapping(StringView name) {
         {"str_char_at", "roxy_string_char_at"},
         {"str_substr", "roxy_string_substr"},
         {"str_to_f64", "roxy_string_to_f64"},
+        {"str_to_i64", "roxy_string_to_i64"},
+        {"str_to_i32", "roxy_string_to_i32"},
+        {"str_to_i64_or", "roxy_string_to_i64_or"},
+        {"str_to_i32_or", "roxy_string_to_i32_or"},
+        {"str_to_f64_or", "roxy_string_to_f64_or"},
+        {"fmt_fixed", "roxy_f64_fmt_fixed"},
+        {"str_find", "roxy_string_find"},
+        {"str_find_char", "roxy_string_find_char"},
+        {"str_starts_with", "roxy_string_starts_with"},
+        {"str_ends_with", "roxy_string_ends_with"},
+        {"str_trim", "roxy_string_trim"},
+        {"str_replace", "roxy_string_replace"},
+        {"str_split", "roxy_string_split"},
+        {"str_join", "roxy_string_join"},
         {"str_from_code", "roxy_string_from_code"},
         // Utility functions
         {"clock", "roxy_clock"},
         {"read_file", "roxy_read_file"},
+        {"map_file", "roxy_map_file"},
+        {"bytes_to_string", "roxy_bytes_to_string"},
+        {"__file_reader_open", "roxy_file_reader_open"},
+        {"__file_reader_next", "roxy_file_reader_next"},
+        {"__file_reader_record", "roxy_file_reader_record"},
+        {"__file_reader_close", "roxy_file_reader_close"},
+        {"__file_writer_open", "roxy_file_writer_open"},
+        {"__file_writer_write", "roxy_file_writer_write"},
+        {"__file_writer_flush", "roxy_file_writer_flush"},
+        {"__file_writer_close", "roxy_file_writer_close"},
         // to_string
         {"bool$$to_string", "roxy_bool_to_string"},
         {"i32$$to_string", "roxy_i32_to_string"},
@@ -3985,6 +4216,8 @@ static const char* lookup_static_native_mapping(StringView name) {
         {"list_copy", "roxy_list_copy"},
         {"map_alloc", "roxy_map_alloc"},
         {"map_copy", "roxy_map_copy"},
+        {"array_alloc", "roxy_array_alloc"},
+        {"array_copy", "roxy_array_copy"},
         {"__list_mark_ref_elements", "roxy_list_mark_ref_elements"},
         {"__map_mark_ref_values", "roxy_map_mark_ref_values"},
         // Internal map iteration
@@ -4001,9 +4234,35 @@ static const char* lookup_static_native_mapping(StringView name) {
     // reduce to the method after the last "$$". Single source of truth, so a new
     // List/Map method is added in exactly one place.
     static const tsl::robin_map<StringView, const char*> list_methods = {
-        {"new", "roxy_list_init"},  {"delete", "roxy_list_delete"}, {"len", "roxy_list_len"},
-        {"cap", "roxy_list_cap"},   {"push", "roxy_list_push"},     {"pop", "roxy_list_pop"},
-        {"index", "roxy_list_get"}, {"index_mut", "roxy_list_set"}, {"copy", "roxy_list_copy"},
+        {"new", "roxy_list_init"},
+        {"delete", "roxy_list_delete"},
+        {"len", "roxy_list_len"},
+        {"cap", "roxy_list_cap"},
+        {"push", "roxy_list_push"},
+        {"pop", "roxy_list_pop"},
+        {"index", "roxy_list_get"},
+        {"index_mut", "roxy_list_set"},
+        {"copy", "roxy_list_copy"},
+        {"sort", "roxy_list_sort"},
+        {"sort_by", "roxy_list_sort_by"},
+        {"binary_search", "roxy_list_binary_search"},
+        {"extend", "roxy_list_extend"},
+        {"fill", "roxy_list_fill"},
+        {"truncate", "roxy_list_truncate"},
+        {"reserve", "roxy_list_reserve"},
+        {"swap", "roxy_list_swap"},
+    };
+    static const tsl::robin_map<StringView, const char*> array_methods = {
+        {"new", "roxy_array_init"},
+        {"delete", "roxy_array_delete"},
+        {"len", "roxy_array_len"},
+        {"index", "roxy_array_get"},
+        {"index_mut", "roxy_array_set"},
+        {"copy", "roxy_array_copy"},
+        {"fill", "roxy_array_fill"},
+        {"slice", "roxy_array_slice"},
+        {"copy_from", "roxy_array_copy_from"},
+        {"resize", "roxy_array_resize"},
     };
     static const tsl::robin_map<StringView, const char*> map_methods = {
         {"new", "roxy_map_init"},
@@ -4057,6 +4316,8 @@ static const char* lookup_static_native_mapping(StringView name) {
         return c;
     if (const char* c = match_method("Map", map_methods))
         return c;
+    if (const char* c = match_method("Array", array_methods))
+        return c;
 
     // Monomorphized list_alloc / list_copy / map_alloc / map_copy
     if (name.size() > 10 && StringView(name.data(), 10) == StringView("list_alloc"))
@@ -4067,6 +4328,10 @@ static const char* lookup_static_native_mapping(StringView name) {
         return "roxy_map_alloc";
     if (name.size() > 8 && StringView(name.data(), 8) == StringView("map_copy"))
         return "roxy_map_copy";
+    if (name.size() > 11 && StringView(name.data(), 11) == StringView("array_alloc"))
+        return "roxy_array_alloc";
+    if (name.size() > 10 && StringView(name.data(), 10) == StringView("array_copy"))
+        return "roxy_array_copy";
 
     return nullptr;
 }
@@ -4132,6 +4397,13 @@ void CEmitter::emit_native_call(const IRInst* inst, String& out) {
     bool is_list_set = name_eq(c_func_name, "roxy_list_set");
     bool is_list_pop = name_eq(c_func_name, "roxy_list_pop");
     bool is_list_get = name_eq(c_func_name, "roxy_list_get");
+    bool is_list_sort_by = name_eq(c_func_name, "roxy_list_sort_by");
+    bool takes_list_value = name_eq(c_func_name, "roxy_list_binary_search") ||
+                            name_eq(c_func_name, "roxy_list_fill") ||
+                            name_eq(c_func_name, "roxy_array_fill");
+    bool is_array_init = name_eq(c_func_name, "roxy_array_init");
+    bool is_array_get = name_eq(c_func_name, "roxy_array_get");
+    bool is_array_set = name_eq(c_func_name, "roxy_array_set");
     bool is_map_init = name_eq(c_func_name, "roxy_map_init");
     bool is_map_insert = name_eq(c_func_name, "roxy_map_insert");
     bool is_map_get = name_eq(c_func_name, "roxy_map_get");
@@ -4151,9 +4423,9 @@ void CEmitter::emit_native_call(const IRInst* inst, String& out) {
     // List values at index 1 (push) or 2 (set).
     int key_arg_idx = -1;   // map key arg (always idx 1)
     int value_arg_idx = -1; // value arg
-    if (is_list_push)
+    if (is_list_push || takes_list_value)
         value_arg_idx = 1;
-    else if (is_list_set)
+    else if (is_list_set || is_array_set)
         value_arg_idx = 2;
     else if (is_map_insert || is_map_index_mut || is_map_get_or) {
         key_arg_idx = 1;
@@ -4181,8 +4453,8 @@ void CEmitter::emit_native_call(const IRInst* inst, String& out) {
     // For struct return type → cast to (T*); for primitive → deref via *(T*).
     // map_iter_key_at / map_iter_value_at return uint64_t directly (need a
     // C-style cast to inst->type so e.g. an int32_t result narrows correctly).
-    bool returns_value_ptr = is_list_pop || is_list_get || is_map_get || is_map_get_or ||
-                             is_map_index || is_map_iter_ptr_at;
+    bool returns_value_ptr = is_list_pop || is_list_get || is_array_get || is_map_get ||
+                             is_map_get_or || is_map_index || is_map_iter_ptr_at;
     bool returns_value_u64 = is_map_iter_key_at || is_map_iter_value_at;
     bool result_is_struct = inst->type && inst->type->is_struct();
 
@@ -4248,8 +4520,12 @@ void CEmitter::emit_native_call(const IRInst* inst, String& out) {
             out.append(", ");
 
         // Key arg: struct keys pass pointer directly; primitive keys → &_ktmp.
+        // A by-value struct rvalue (a small-struct call or vector op result)
+        // is a value local, so its address is taken, as in StructCopy.
         if (static_cast<int>(i) == key_arg_idx) {
             if (key_arg_is_struct) {
+                if (!is_pointer_value(inst->call.args[i]))
+                    out.push_back('&');
                 emit_value(inst->call.args[i], out);
             } else {
                 out.append("&_ktmp");
@@ -4259,6 +4535,8 @@ void CEmitter::emit_native_call(const IRInst* inst, String& out) {
         // Value arg: struct values pass pointer directly; primitive → &_vtmp.
         if (static_cast<int>(i) == value_arg_idx) {
             if (value_arg_is_struct) {
+                if (!is_pointer_value(inst->call.args[i]))
+                    out.push_back('&');
                 emit_value(inst->call.args[i], out);
             } else {
                 out.append("&_vtmp");
@@ -4289,6 +4567,20 @@ void CEmitter::emit_native_call(const IRInst* inst, String& out) {
             continue;
         }
 
+        // sort_by's comparator: the adapter that calls the closure, then the
+        // closure env itself as the adapter's ctx.
+        if (is_list_sort_by && i == 1) {
+            Type* less_type = get_value_type(inst->call.args[i]);
+            if (less_type && less_type->is_reference())
+                less_type = less_type->ref_info.inner_type;
+            String adapter = request_sort_less_adapter(less_type);
+            out.append("&");
+            out.append(StringView(adapter.data(), adapter.size()));
+            out.append(", (void*)");
+            emit_value(inst->call.args[i], out);
+            continue;
+        }
+
         emit_value(inst->call.args[i], out);
     }
 
@@ -4296,6 +4588,10 @@ void CEmitter::emit_native_call(const IRInst* inst, String& out) {
     if (is_list_init && inst->call.args.size() == 1) {
         out.append(", 0");
     }
+    // Array$$new(self) -> roxy_array_init(self, 0) - an empty array
+    if (is_array_init && inst->call.args.size() == 1) {
+        out.append(", 0");
+    }
     // Map$$new(self, key_kind) -> roxy_map_init(self, key_kind, 0) - add default capacity
     if (is_map_init && inst->call.args.size() == 2) {
         out.append(", 0");
@@ -4474,6 +4770,9 @@ void CEmitter::emit_source(const IRModule* module, String& output) {
         output.append("\n");
         output.append(StringView(m_drop_glue_defs.data(), m_drop_glue_defs.size()));
     }
+    if (m_sort_less_defs.size() > 0) {
+        output.append(StringView(m_sort_less_defs.data(), m_sort_less_defs.size()));
+    }
     output.append(StringView(body_out.data(), body_out.size()));
 
     // Emit the standalone C `main()` wrapper that initializes the runtime
@@ -4509,8 +4808,9 @@ void CEmitter::emit_source(const IRModule* module, String& output) {
             // An exception that propagates out of main_entry is unhandled: report
             // it and exit nonzero (matches the VM's "Unhandled exception" path).
             const char* unhandled_check =
-                m_module_uses_exceptions ? "    if (roxy_exception_pending()) { fprintf(stderr, "
-                                           "\"Unhandled exception\\n\"); return 1; }\n"
+                m_module_uses_exceptions ? "    if (roxy_exception_pending()) { roxy_output_flush(); "
+                                           "fprintf(stderr, \"Unhandled exception\\n\"); "
+                                           "return 1; }\n"
                                          : "";
             if (main_returns_void) {
                 output.append("    main_entry();\n");
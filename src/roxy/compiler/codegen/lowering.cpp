@@ -153,25 +153,32 @@ BCFunction* BytecodeBuilder::build_function(IRFunction* ir_func) {
     compute_cleanup_coverage(ir_func);
     compute_liveness(ir_func);
     compute_const_use_modes(ir_func);
+    compute_list_field_fusion(ir_func);
 
     // Register assignment: pre-color the parameter registers, then walk the
     // function in program order assigning every other SSA value its register.
     precolor_parameters(ir_func);
     preallocate_registers(ir_func);
 
-    // Emission over the RPO block layout, then jump resolution and
-    // compare-branch fusion over the finished code.
+    // Emission over the RPO block layout, then jump resolution and the
+    // compare-branch and superinstruction peepholes over the finished code.
     emit_prologue(ir_func);
     emit_blocks(ir_func);
     patch_jumps();
     fuse_compare_branch();
+    form_superinstructions();
 
     // PC-range metadata over the final layout.
     build_exception_handler_table(ir_func);
     build_cleanup_records(ir_func);
 
-    m_current_func->register_count = m_next_reg;
+    // Wide registers, when any were spilled to, sit above the whole 8-bit
+    // window.
+    m_current_func->register_count =
+        m_next_wide_reg > FIRST_WIDE_REG ? m_next_wide_reg : m_next_reg;
     m_current_func->local_stack_slots = m_next_stack_slot;
+    m_current_func->spilled_values = static_cast<u32>(m_spill_regs.size());
+    m_current_func->spill_ops = m_spill_ops;
     return m_current_func;
 }
 
@@ -205,18 +212,33 @@ void BytecodeBuilder::reset_function_state(IRFunction* ir_func) {
     m_nullify_pcs.clear();
     m_ref_inc_pcs.clear();
     m_cleanup_kill_pcs.clear();
-    // m_requires_register is rebuilt fresh by compute_const_use_modes().
+    // m_requires_register is rebuilt fresh by compute_const_use_modes(),
+    // m_fused_index_get by compute_list_field_fusion().
+    m_pending_index_get = nullptr;
     m_jump_patches.clear_keep_capacity();
     free_regs_reset();
     m_active.clear_keep_capacity();
-    m_spill_slots.clear();
+    m_spill_regs.clear();
     m_delete_desc_cache.clear();
     m_has_spilling = false;
     m_scratch_regs[0] = m_scratch_regs[1] = 0xFF;
+    m_alloc_point = 0;
+    m_spill_ops = 0;
     m_next_reg = 0;
+    m_next_wide_reg = FIRST_WIDE_REG;
     m_next_stack_slot = 0;
 }
 
+u64 BytecodeBuilder::side_table_bytes() const {
+    return sizeof(u16) * m_value_to_reg.capacity() + sizeof(Type*) * m_value_types.capacity() +
+           sizeof(u32) * m_value_ready_pcs.capacity() +
+           sizeof(LiveRange) * m_live_ranges.capacity() +
+           sizeof(bool) * m_value_same_block.capacity() +
+           sizeof(bool) * m_requires_register.capacity() +
+           sizeof(bool) * m_fused_index_get.capacity() + sizeof(u8) * m_use_counts.capacity() +
+           sizeof(u32) * m_block_offsets.capacity() + sizeof(u32) * m_block_loop_depth.capacity();
+}
+
 // Pre-color function parameters: the calling convention delivers them in
 // registers 0..n at fixed offsets, so they are mapped rather than allocated.
 void BytecodeBuilder::precolor_parameters(IRFunction* ir_func) {
@@ -266,7 +288,10 @@ void BytecodeBuilder::preallocate_registers(IRFunction* ir_func) {
         // Block parameters
         for (const auto& param : block->params) {
             expire_before(alloc_point);
-            if (!has_register(param.value)) {
+            // A param pre-allocated at a forward edge may have been spilled
+            // since; it lives in its wide register now — don't hand it a
+            // second home (see pre_alloc_target_params below).
+            if (!has_register(param.value) && !m_spill_regs.count(param.value.id)) {
                 u32 reg_count = get_value_reg_count(param.type);
                 if (reg_count > 1) {
                     allocate_multi_register_value(param.value, reg_count);
@@ -290,8 +315,9 @@ void BytecodeBuilder::preallocate_registers(IRFunction* ir_func) {
             if (inst->result.is_valid() && !has_register(inst->result)) {
                 // Skip register allocation for RK-only constants: the LOAD
                 // is also skipped in lower_instruction, and try_emit_rk_binary
-                // reads the value directly from the constant pool.
-                if (!is_skip_load_const(inst)) {
+                // reads the value directly from the constant pool. A fused
+                // index_get likewise never materializes its element pointer.
+                if (!is_skip_load_const(inst) && !is_fused_index_get(inst->result)) {
                     u32 reg_count = get_value_reg_count(inst->type);
                     if (is_call) {
                         // Calls allocate dst + their contiguous arg window
@@ -358,7 +384,12 @@ void BytecodeBuilder::preallocate_registers(IRFunction* ir_func) {
                 return;
             IRBlock* target_block = ir_func->blocks[target.block.id];
             for (const auto& param : target_block->params) {
-                if (!has_register(param.value)) {
+                // Skip params already spilled: re-allocating one here (a back
+                // edge reaching a loop header whose param was evicted inside
+                // the loop) gave it a register *and* a wide register, and the
+                // header's uses then read the register while other paths wrote
+                // the wide one.
+                if (!has_register(param.value) && !m_spill_regs.count(param.value.id)) {
                     u32 reg_count = get_value_reg_count(param.type);
                     if (reg_count > 1) {
                         allocate_multi_register_value(param.value, reg_count);
@@ -920,7 +951,7 @@ void BytecodeBuilder::reserve_call_window(IRInst* inst, u32 extra_regs_for_retur
     // params whose back-edge arg uses keep them in the active set here.
     // Inserting the dst registers into the active set (unlike the historical
     // bump-only path) lets them expire and return to the free list. Call
-    // results still never *spill* — see spill_furthest.
+    // results still never *spill* — see spill_cheapest.
     while (true) {
         u32 floor_reg = 0;
         for (u32 i = 0; i < m_active.size(); i++) {
@@ -957,10 +988,10 @@ void BytecodeBuilder::reserve_call_window(IRInst* inst, u32 extra_regs_for_retur
             ensure_register_window(static_cast<u16>(floor_reg + block_size));
             return;
         }
-        // Doesn't fit above the live values — spill the furthest-living ones
-        // until it does.
+        // Doesn't fit above the live values — spill the cheapest ones until
+        // it does.
         u32 active_before = m_active.size();
-        spill_furthest();
+        spill_cheapest();
         if (m_active.size() >= active_before)
             break; // nothing spillable left
     }
@@ -1005,7 +1036,7 @@ u8 BytecodeBuilder::allocate_register(ValueId value) {
             reg = free_reg_take_min();
         } else if (m_next_reg >= reg_limit) {
             // No free registers and at the limit — spill to free one
-            spill_furthest();
+            spill_cheapest();
             // After spilling, there should be a register in the free list
             if (free_regs_empty()) {
                 report_error("Internal error: spilling failed to free a register");
@@ -1049,14 +1080,35 @@ bool BytecodeBuilder::has_register(ValueId value) const {
     return value.id < m_value_to_reg.size() && m_value_to_reg[value.id] != NO_REG;
 }
 
-void BytecodeBuilder::spill_furthest() {
-    // Helper to compute spill slot size for a value
-    auto spill_slot_size = [this](u32 value_id) -> u32 {
-        Type* value_type = value_type_of(value_id);
-        return (value_type && value_type->kind == TypeKind::Weak) ? 4 : 2;
+void BytecodeBuilder::spill_cheapest() {
+    // Move the value owning `reg` (if any) to fresh wide registers: two for a
+    // weak ref, one otherwise. Returns false once the 16-bit range is used up.
+    auto spill_to_wide = [this](u8 reg) -> bool {
+        u32 spilled_val = m_reg_to_value[reg];
+        if (spilled_val == NO_VALUE)
+            return true;
+        Type* value_type = value_type_of(spilled_val);
+        u32 width = (value_type && value_type->kind == TypeKind::Weak) ? 2 : 1;
+        if (m_next_wide_reg + width > WIDE_REG_LIMIT) {
+            report_error("Register overflow: function uses too many values (max 65535)");
+            return false;
+        }
+        m_spill_regs[spilled_val] = m_next_wide_reg;
+        m_next_wide_reg += width;
+        m_value_to_reg[spilled_val] = NO_REG;
+        m_reg_to_value[reg] = NO_VALUE;
+        return true;
     };
 
-    // Pick the furthest-living *spillable* active entry and remove it.
+    // Pick the cheapest *spillable* active entry and remove it. Cost is the
+    // value's loop-weighted def/use count (compute_liveness) per point of
+    // remaining live range: every use of a spilled value becomes a RELOAD_REG,
+    // so frequently-read values — above all those read inside loops — should
+    // keep their registers, while a value that merely stays live across a long
+    // stretch frees the most register-time per reload it costs. Compared by
+    // cross-multiplication (weight_a * length_b < weight_b * length_a), walking
+    // from the furthest-living entry down so equal costs keep the old
+    // furthest-last-use choice.
     // Not spillable:
     //  - Call results: the CALL's argument window is anchored at the result
     //    register (first_arg = dst + ret_reg_count), so a spilled dst would
@@ -1067,7 +1119,10 @@ void BytecodeBuilder::spill_furthest() {
     //    a single register per value, so evicting part of a pair would free a
     //    live register without saving it.
     // Returns false when nothing spillable remains (caller reports the error).
-    auto take_furthest_spillable = [this](ActiveAlloc& out) -> bool {
+    auto take_cheapest_spillable = [this](ActiveAlloc& out) -> bool {
+        u32 best = UINT32_MAX;
+        u64 best_weight = 0;
+        u64 best_length = 1;
         for (u32 i = m_active.size(); i > 0; i--) {
             u32 idx = i - 1;
             u32 val = m_reg_to_value[m_active[idx].reg];
@@ -1078,39 +1133,37 @@ void BytecodeBuilder::spill_furthest() {
             Type* value_type = value_type_of(val);
             if (value_type && get_value_reg_count(value_type) > 1)
                 continue;
-            out = m_active[idx];
-            for (u32 j = idx + 1; j < m_active.size(); j++)
-                m_active[j - 1] = m_active[j];
-            m_active.pop_back();
-            return true;
+            u64 weight = val < m_live_ranges.size() ? m_live_ranges[val].spill_weight : 0;
+            u32 last_use = m_active[idx].last_use;
+            u64 length = last_use >= m_alloc_point ? last_use - m_alloc_point + 1 : 1;
+            if (best == UINT32_MAX || weight * best_length < best_weight * length) {
+                best = idx;
+                best_weight = weight;
+                best_length = length;
+            }
         }
-        return false;
+        if (best == UINT32_MAX)
+            return false;
+        out = m_active[best];
+        for (u32 j = best + 1; j < m_active.size(); j++)
+            m_active[j - 1] = m_active[j];
+        m_active.pop_back();
+        return true;
     };
 
-    // First time: reserve 2 scratch registers by spilling the 2 furthest-living values
+    // First time: reserve 2 scratch registers by spilling the 2 cheapest values
     if (!m_has_spilling) {
         m_has_spilling = true;
         for (int s = 0; s < 2; s++) {
-            ActiveAlloc furthest;
-            if (!take_furthest_spillable(furthest)) {
+            ActiveAlloc victim;
+            if (!take_cheapest_spillable(victim)) {
                 report_error("Internal error: no active values to spill for scratch registers");
                 return;
             }
+            if (!spill_to_wide(victim.reg))
+                return;
 
-            u32 spilled_val = m_reg_to_value[furthest.reg];
-            u32 slot_size = 2;
-            if (spilled_val != NO_VALUE) {
-                slot_size = spill_slot_size(spilled_val);
-                u32 spill_slot = m_next_stack_slot;
-                m_next_stack_slot += slot_size;
-                m_spill_slots[spilled_val] = spill_slot;
-                m_value_to_reg[spilled_val] = NO_REG;
-                m_reg_to_value[furthest.reg] = NO_VALUE;
-            } else {
-                m_next_stack_slot += 2;
-            }
-
-            m_scratch_regs[s] = furthest.reg;
+            m_scratch_regs[s] = victim.reg;
             // Scratch regs are NOT added to free list — they're permanently reserved
         }
         // Ensure scratch_regs[0] < scratch_regs[1] for consistent ordering
@@ -1122,25 +1175,15 @@ void BytecodeBuilder::spill_furthest() {
     }
 
     // Spill one more value to free a register for the caller
-    ActiveAlloc furthest;
-    if (!take_furthest_spillable(furthest)) {
+    ActiveAlloc victim;
+    if (!take_cheapest_spillable(victim)) {
         report_error("Internal error: no active values to spill");
         return;
     }
+    if (!spill_to_wide(victim.reg))
+        return;
 
-    u32 spilled_val = m_reg_to_value[furthest.reg];
-    if (spilled_val != NO_VALUE) {
-        u32 slot_size = spill_slot_size(spilled_val);
-        u32 spill_slot = m_next_stack_slot;
-        m_next_stack_slot += slot_size;
-        m_spill_slots[spilled_val] = spill_slot;
-        m_value_to_reg[spilled_val] = NO_REG;
-        m_reg_to_value[furthest.reg] = NO_VALUE;
-    } else {
-        m_next_stack_slot += 2;
-    }
-
-    free_reg_add(furthest.reg);
+    free_reg_add(victim.reg);
 }
 
 u8 BytecodeBuilder::get_result_register(ValueId value) {
@@ -1151,10 +1194,10 @@ u8 BytecodeBuilder::get_result_register(ValueId value) {
         return static_cast<u8>(m_value_to_reg[value.id]);
 
     // Spilled result: compute into scratch[0], will be spilled after
-    if (m_spill_slots.count(value.id))
+    if (m_spill_regs.count(value.id))
         return m_scratch_regs[0];
 
-    report_error("Internal error: SSA value has no register or spill slot");
+    report_error("Internal error: SSA value has no register or spill register");
     return 0xFF;
 }
 
@@ -1165,15 +1208,17 @@ u8 BytecodeBuilder::ensure_in_register(ValueId value, u8 scratch_index) {
     if (m_value_to_reg[value.id] != NO_REG)
         return static_cast<u8>(m_value_to_reg[value.id]);
 
-    auto spill_it = m_spill_slots.find(value.id);
-    if (spill_it != m_spill_slots.end()) {
+    auto spill_it = m_spill_regs.find(value.id);
+    if (spill_it != m_spill_regs.end()) {
         u8 scratch = m_scratch_regs[scratch_index];
         emit_abi(Opcode::RELOAD_REG, scratch, static_cast<u16>(spill_it->second));
+        m_spill_ops++;
 
         // If this is a weak value (2 registers), also reload the second register
         Type* value_type = value_type_of(value.id);
         if (value_type && value_type->kind == TypeKind::Weak) {
-            emit_abi(Opcode::RELOAD_REG, scratch + 1, static_cast<u16>(spill_it->second + 2));
+            emit_abi(Opcode::RELOAD_REG, scratch + 1, static_cast<u16>(spill_it->second + 1));
+            m_spill_ops++;
         }
 
         return scratch;
@@ -1249,18 +1294,56 @@ void BytecodeBuilder::spill_if_needed(ValueId value, u8 reg) {
     if (!value.is_valid())
         return;
 
-    auto spill_it = m_spill_slots.find(value.id);
-    if (spill_it != m_spill_slots.end()) {
+    auto spill_it = m_spill_regs.find(value.id);
+    if (spill_it != m_spill_regs.end()) {
         emit_abi(Opcode::SPILL_REG, reg, static_cast<u16>(spill_it->second));
+        m_spill_ops++;
 
         // If this is a weak value (2 registers), also spill the second register
         Type* value_type = value_type_of(value.id);
         if (value_type && value_type->kind == TypeKind::Weak) {
-            emit_abi(Opcode::SPILL_REG, reg + 1, static_cast<u16>(spill_it->second + 2));
+            emit_abi(Opcode::SPILL_REG, reg + 1, static_cast<u16>(spill_it->second + 1));
+            m_spill_ops++;
         }
     }
 }
 
+// Array element access opcode for the element's width. Loads narrower than a
+// register sign-extend for signed types and zero-extend otherwise; f32 bits load
+// like an i32 (as INDEX_GET_LIST does). Stores only need the width.
+static Opcode array_get_opcode(Type* elem_type) {
+    switch (elem_type ? elem_type->kind : TypeKind::I64) {
+        case TypeKind::I8:
+            return Opcode::INDEX_GET_ARR_I8;
+        case TypeKind::Bool:
+        case TypeKind::U8:
+            return Opcode::INDEX_GET_ARR_U8;
+        case TypeKind::I16:
+            return Opcode::INDEX_GET_ARR_I16;
+        case TypeKind::U16:
+            return Opcode::INDEX_GET_ARR_U16;
+        case TypeKind::I32:
+        case TypeKind::U32:
+        case TypeKind::F32:
+            return Opcode::INDEX_GET_ARR_32;
+        default:
+            return Opcode::INDEX_GET_ARR_64;
+    }
+}
+
+static Opcode array_set_opcode(Type* elem_type) {
+    switch (array_element_size(elem_type)) {
+        case 1:
+            return Opcode::INDEX_SET_ARR_8;
+        case 2:
+            return Opcode::INDEX_SET_ARR_16;
+        case 4:
+            return Opcode::INDEX_SET_ARR_32;
+        default:
+            return Opcode::INDEX_SET_ARR_64;
+    }
+}
+
 void BytecodeBuilder::canonicalize_u32(IRInst* inst, u8 reg) {
     if (reg == 0xFF)
         return;
@@ -1280,6 +1363,19 @@ static void mark_use(Vector<LiveRange>& live_ranges, ValueId value, u32 point) {
     }
 }
 
+// Spill weight of one def or use at the given loop depth: 8^depth, capped at
+// depth 5 so deeply nested loops can't overflow the u32 sum.
+static u32 loop_depth_weight(u32 depth) {
+    return 1u << (3 * (depth < 5 ? depth : 5));
+}
+
+static void add_spill_weight(Vector<LiveRange>& live_ranges, ValueId value, u32 weight) {
+    if (!value.is_valid() || value.id >= live_ranges.size())
+        return;
+    u32& sum = live_ranges[value.id].spill_weight;
+    sum = (sum > UINT32_MAX - weight) ? UINT32_MAX : sum + weight;
+}
+
 void BytecodeBuilder::compute_const_use_modes(IRFunction* ir_func) {
     // Mark every value that has at least one use requiring a register. A
     // ConstInt/ConstF/ConstD value not so marked is skip-load eligible — its
@@ -1329,6 +1425,67 @@ void BytecodeBuilder::compute_const_use_modes(IRFunction* ir_func) {
     // no separate collection pass or set to populate (§3.8).
 }
 
+void BytecodeBuilder::compute_list_field_fusion(IRFunction* ir_func) {
+    u32 num_values = ir_func->next_value_id;
+    m_fused_index_get.clear_keep_capacity();
+    m_fused_index_get.reserve(num_values);
+    for (u32 i = 0; i < num_values; i++)
+        m_fused_index_get.push_back(false);
+
+    // Candidates: a List index_get yielding an element pointer (struct
+    // elements are stored out of line — element_is_inline is false), directly
+    // followed by a field access through that pointer. Adjacency keeps the
+    // container and index registers valid at the fused op without touching
+    // liveness: nothing is allocated or emitted between the two instructions,
+    // and the fused handlers read every operand before writing a result.
+    bool any = false;
+    for (IRBlock* block : ir_func->blocks) {
+        u32 count = block->instructions.size();
+        for (u32 i = 0; i + 1 < count; i++) {
+            IRInst* get = block->instructions[i];
+            if (get->op != IROp::IndexGet || get->index_data.kind != ContainerKind::List ||
+                !get->type || !get->type->is_struct() || !get->result.is_valid()) {
+                continue;
+            }
+            IRInst* next = block->instructions[i + 1];
+            bool fusable = false;
+            if (next->op == IROp::GetField) {
+                fusable = next->field.object == get->result;
+            } else if (next->op == IROp::SetField) {
+                fusable = next->field.object == get->result && next->store_value != get->result;
+            }
+            if (fusable) {
+                m_fused_index_get[get->result.id] = true;
+                any = true;
+            }
+        }
+    }
+    if (!any)
+        return;
+
+    // The element pointer must have no other use — it is never materialized.
+    // Saturating u8 counts: only "exactly one" matters.
+    m_use_counts.clear_keep_capacity();
+    m_use_counts.reserve(num_values);
+    for (u32 i = 0; i < num_values; i++)
+        m_use_counts.push_back(0);
+    auto count_use = [&](ValueId& v) {
+        if (v.is_valid() && v.id < num_values && m_fused_index_get[v.id] &&
+            m_use_counts[v.id] < 2) {
+            m_use_counts[v.id]++;
+        }
+    };
+    for (IRBlock* block : ir_func->blocks) {
+        for (IRInst* inst : block->instructions)
+            for_each_operand(inst, count_use);
+        for_each_terminator_operand(block->terminator, count_use);
+    }
+    for (u32 i = 0; i < num_values; i++) {
+        if (m_fused_index_get[i] && m_use_counts[i] != 1)
+            m_fused_index_get[i] = false;
+    }
+}
+
 // Compute, per cleanup record, the set of blocks in which the record's value is
 // owned on the way to a potential throw: every block reachable from the
 // record's start block without passing an ownership-ending kill. A kill is a
@@ -1370,9 +1527,9 @@ void BytecodeBuilder::compute_cleanup_coverage(IRFunction* ir_func) {
         if (info.whole_function_scope)
             return false; // already spans [0, end)
         if (info.call_borrow)
-            return false; // sub-block [RefInc, Nullify) window
-        if (info.kind == IRCleanupKind::Unpin)
-            return false;
+            return false; // sub-block [RefInc, Nullify) window (incl. call-site pins)
+        // A range-for pin (OwnedKind::Pin) spans the loop's blocks like any
+        // owned local, so a throw laid out past the loop exit needs coverage.
         return true;
     };
 
@@ -1566,7 +1723,7 @@ void BytecodeBuilder::compute_liveness(IRFunction* ir_func) {
     m_live_ranges.clear_keep_capacity();
     m_live_ranges.reserve(num_values);
     for (u32 i = 0; i < num_values; i++) {
-        m_live_ranges.push_back(LiveRange{0, 0});
+        m_live_ranges.push_back(LiveRange{0, 0, 0});
     }
 
     // Fused Pass 1+2+3: a single forward walk assigns definition points (Pass 1),
@@ -1581,13 +1738,75 @@ void BytecodeBuilder::compute_liveness(IRFunction* ir_func) {
     // terminator point), and the transient mark is overwritten when the walk
     // later defines those params; a *back-edge* target was already defined
     // earlier in the walk, so its extension lands. Same result as three passes.
+    //
+    // The same walk sums each value's spill weight (spill_cheapest): one
+    // loop_depth_weight per def and per use, by the enclosing block's loop
+    // depth. Depth counts the natural loops a block belongs to: for each back
+    // edge B -> H (H at or before B in RPO), the blocks that reach B without
+    // passing through H. Pass 4's [H, B] layout range would be wrong here —
+    // RPO often lays the loop's exit path out between header and body.
+    u32 num_blocks = ir_func->blocks.size();
+    Vector<u32>& loop_depth = m_block_loop_depth;
+    loop_depth.clear_keep_capacity();
+    loop_depth.reserve(num_blocks);
+    for (u32 i = 0; i < num_blocks; i++)
+        loop_depth.push_back(0);
+    PredecessorMap preds;
+    Vector<u32> loop_mark; // block -> last loop (1-based) whose walk visited it
+    Vector<u32> worklist;
+    u32 loop_count = 0;
+    for (u32 block_index = 0; block_index < num_blocks; block_index++) {
+        auto add_loop = [&](BlockId header_id) {
+            if (!header_id.is_valid() || header_id.id > block_index)
+                return;
+            if (preds.offsets.empty()) {
+                preds = compute_predecessors(ir_func);
+                for (u32 i = 0; i < num_blocks; i++)
+                    loop_mark.push_back(0);
+            }
+            u32 header = header_id.id;
+            u32 stamp = ++loop_count;
+            loop_mark[header] = stamp;
+            loop_depth[header]++;
+            worklist.clear_keep_capacity();
+            if (loop_mark[block_index] != stamp) {
+                loop_mark[block_index] = stamp;
+                loop_depth[block_index]++;
+                worklist.push_back(block_index);
+            }
+            while (!worklist.empty()) {
+                u32 current = worklist.back();
+                worklist.pop_back();
+                for (BlockId pred : preds[current]) {
+                    if (pred.id >= num_blocks || loop_mark[pred.id] == stamp)
+                        continue;
+                    loop_mark[pred.id] = stamp;
+                    loop_depth[pred.id]++;
+                    worklist.push_back(pred.id);
+                }
+            }
+        };
+        const Terminator& term = ir_func->blocks[block_index]->terminator;
+        if (term.kind == TerminatorKind::Goto) {
+            add_loop(term.goto_target.block);
+        } else if (term.kind == TerminatorKind::Branch) {
+            add_loop(term.branch.then_target.block);
+            if (term.branch.else_target.block.id != term.branch.then_target.block.id)
+                add_loop(term.branch.else_target.block);
+        }
+    }
+
     u32 point = 0;
-    for (IRBlock* block : ir_func->blocks) {
+    for (u32 block_index = 0; block_index < num_blocks; block_index++) {
+        IRBlock* block = ir_func->blocks[block_index];
+        u32 weight = loop_depth_weight(loop_depth[block_index]);
+
         // Block params: definition points (Pass 1).
         for (const auto& param : block->params) {
             if (param.value.is_valid() && param.value.id < num_values) {
                 m_live_ranges[param.value.id].def_point = point;
                 m_live_ranges[param.value.id].last_use_point = point; // at least live at def
+                add_spill_weight(m_live_ranges, param.value, weight);
             }
             point++;
         }
@@ -1597,12 +1816,15 @@ void BytecodeBuilder::compute_liveness(IRFunction* ir_func) {
             if (inst->result.is_valid() && inst->result.id < num_values) {
                 m_live_ranges[inst->result.id].def_point = point;
                 m_live_ranges[inst->result.id].last_use_point = point; // at least live at def
+                add_spill_weight(m_live_ranges, inst->result, weight);
             }
             // Operand last-uses (Pass 2), via the shared operand walker
             // (ir_optimize.hpp) — one op-shape enumeration for the whole
             // compiler instead of a per-pass copy.
-            for_each_operand(inst,
-                             [&](ValueId& operand) { mark_use(m_live_ranges, operand, point); });
+            for_each_operand(inst, [&](ValueId& operand) {
+                mark_use(m_live_ranges, operand, point);
+                add_spill_weight(m_live_ranges, operand, weight);
+            });
             point++;
         }
 
@@ -1612,8 +1834,10 @@ void BytecodeBuilder::compute_liveness(IRFunction* ir_func) {
         // of that block's block-arg MOVs are emitted (parallel-assignment safety).
         u32 terminator_point = point;
         Terminator& term = block->terminator;
-        for_each_terminator_operand(
-            term, [&](ValueId& operand) { mark_use(m_live_ranges, operand, terminator_point); });
+        for_each_terminator_operand(term, [&](ValueId& operand) {
+            mark_use(m_live_ranges, operand, terminator_point);
+            add_spill_weight(m_live_ranges, operand, weight);
+        });
         auto extend_target_params = [&](const JumpTarget& target) {
             if (target.args.size() == 0)
                 return;
@@ -1822,6 +2046,9 @@ void BytecodeBuilder::compute_liveness(IRFunction* ir_func) {
 }
 
 void BytecodeBuilder::expire_before(u32 current_point) {
+    // Every allocation is preceded by an expiry at its program point, so this
+    // is also where the allocator learns where it is (for spill_cheapest).
+    m_alloc_point = current_point;
     // Return every register whose value dies before current_point to the free
     // set. m_active is sorted by last_use ascending, so the expiring entries are
     // a prefix — count it once, free those registers, then shift the surviving
@@ -2148,6 +2375,11 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
     if (is_skip_load_const(inst)) {
         return;
     }
+    // A fused index_get is emitted by the field access that follows it.
+    if (is_fused_index_get(inst->result)) {
+        m_pending_index_get = inst;
+        return;
+    }
     u8 dst = get_result_register(inst->result);
 
     switch (inst->op) {
@@ -2280,7 +2512,7 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
 
         case IROp::BlockArg:
             // Block arguments are handled by MOV instructions at jump sites
-            // The value should already be in the register (or spill slot)
+            // The value should already be in the register (or spill register)
             break;
 
         case IROp::Call:
@@ -2323,7 +2555,7 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
                            true);
 
             // Two-word CALL_INDIRECT: word 1 = [op][dst][closure_reg][arg_count],
-            // word 2 = reserved (future inline-cache slot).
+            // word 2 = inline-cache slot, numbered by vm_load_module.
             emit_abc(Opcode::CALL_INDIRECT, dst, closure_reg,
                      static_cast<u8>(inst->call_indirect.args.size()));
             emit(0u);
@@ -2339,6 +2571,14 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
         case IROp::IndexGet: {
             u8 obj_reg = ensure_in_register(inst->index_data.container, 0);
             u8 idx_reg = ensure_in_register(inst->index_data.index, 0);
+            if (inst->index_data.kind == ContainerKind::Array) {
+                // Packed elements: the load width and extension come from the
+                // element type; a u32 re-zero-extends after the 32-bit load.
+                emit_abc(array_get_opcode(inst->type), dst, obj_reg, idx_reg);
+                canonicalize_u32(inst, dst);
+                spill_if_needed(inst->result, dst);
+                break;
+            }
             Opcode op = (inst->index_data.kind == ContainerKind::List) ? Opcode::INDEX_GET_LIST
                                                                        : Opcode::INDEX_GET_MAP;
             emit_abc(op, dst, obj_reg, idx_reg);
@@ -2346,9 +2586,72 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
             break;
         }
 
+        case IROp::MapIterNext:
+        case IROp::MapIterKey:
+        case IROp::MapIterValue: {
+            // Range-for bucket scan over a pinned map: the next occupied bucket
+            // at or after the cursor, or the key/value stored in one (same
+            // register format as INDEX_GET_MAP).
+            u8 obj_reg = ensure_in_register(inst->index_data.container, 0);
+            u8 idx_reg = ensure_in_register(inst->index_data.index, 0);
+            Opcode op = inst->op == IROp::MapIterNext  ? Opcode::ITER_NEXT_MAP
+                        : inst->op == IROp::MapIterKey ? Opcode::ITER_KEY_MAP
+                                                       : Opcode::ITER_VALUE_MAP;
+            emit_abc(op, dst, obj_reg, idx_reg);
+            spill_if_needed(inst->result, dst);
+            break;
+        }
+
+        case IROp::Simd:
+        case IROp::SimdStore: {
+            // Format: [VEC_* dst a b] + [vec_op c stack_slot]. A vector result
+            // gets its own 4-slot stack temp (like a small-struct call return);
+            // Store names the vector in the dst field and has no result.
+            static_assert(static_cast<u8>(SimdOp::Add) == static_cast<u8>(VecOp::Add) &&
+                              static_cast<u8>(SimdOp::Select) == static_cast<u8>(VecOp::Select) &&
+                              static_cast<u8>(SimdOp::Store) == static_cast<u8>(VecOp::Store),
+                          "SimdOp and VecOp must stay in the same order");
+            const SimdData& simd = inst->simd;
+            Opcode op = simd.kind == SimdKind::F32x4   ? Opcode::VEC_F32X4
+                        : simd.kind == SimdKind::F64x2 ? Opcode::VEC_F64X2
+                                                       : Opcode::VEC_I32X4;
+            u8 a = ensure_in_register(simd.a, 0);
+            u8 b = simd.b.is_valid() ? ensure_in_register(simd.b, 1) : 0;
+            u8 c = simd.imm; // third register operand, or the shuffle pattern
+            if (simd.c.is_valid()) {
+                // Only two scratch registers: a third operand may reuse the
+                // first's, which is only wrong when both are actually spilled.
+                c = ensure_in_register(simd.c, 0);
+                if (c == a && simd.c.id != simd.a.id && m_value_to_reg[simd.a.id] == NO_REG) {
+                    report_error("Internal error: SIMD operands exceed the spill scratch registers");
+                    return;
+                }
+            }
+            if (inst->op == IROp::SimdStore) {
+                // Store: [VEC_* vector list index]
+                emit_abc(op, a, b, c);
+                emit(encode_vec_word(VecOp::Store, 0, 0));
+                break;
+            }
+            u16 stack_slot = 0;
+            if (inst->type && inst->type->is_struct()) {
+                stack_slot = static_cast<u16>(m_next_stack_slot);
+                m_next_stack_slot += inst->type->struct_info.slot_count;
+            }
+            emit_abc(op, dst, a, b);
+            emit(encode_vec_word(static_cast<VecOp>(simd.op), c, stack_slot));
+            spill_if_needed(inst->result, dst);
+            break;
+        }
+
         case IROp::IndexAddr: {
             // Element address (out/inout lvalue): bounds-/key-checked pointer into
             // the container's backing buffer, stored in dst as a raw pointer.
+            if (inst->index_data.kind == ContainerKind::Array) {
+                // Sema rejects out/inout on Array elements: they aren't slots.
+                report_error("Internal error: cannot take the address of an Array element");
+                return;
+            }
             u8 obj_reg = ensure_in_register(inst->index_data.container, 0);
             u8 idx_reg = ensure_in_register(inst->index_data.index, 0);
             Opcode op = (inst->index_data.kind == ContainerKind::List) ? Opcode::INDEX_ADDR_LIST
@@ -2373,15 +2676,32 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
             u8 val_reg = ensure_in_register(inst->index_data.value, 0);
             Opcode op = (inst->index_data.kind == ContainerKind::List) ? Opcode::INDEX_SET_LIST
                                                                        : Opcode::INDEX_SET_MAP;
+            if (inst->index_data.kind == ContainerKind::Array) {
+                Type* array_type = m_value_types[inst->index_data.container.id];
+                array_type = array_type ? array_type->base_type() : nullptr;
+                op = array_set_opcode(array_type ? array_type->list_info.element_type : nullptr);
+            }
             emit_abc(op, obj_reg, idx_reg, val_reg);
             break;
         }
 
         case IROp::GetField: {
-            // Format: [GET_FIELD dst obj slot_count] + [slot_offset:16 padding:16]
-            u8 obj = ensure_in_register(inst->field.object, 1);
             u8 slot_count = static_cast<u8>(inst->field.slot_count);
             u16 slot_offset = static_cast<u16>(inst->field.slot_offset);
+            if (take_pending_index_get(inst->field.object)) {
+                // Format: [INDEX_FIELD_GET_LIST dst list index] + [slot_offset:16 slot_count:8]
+                const IndexData& index = m_pending_index_get->index_data;
+                u8 list_reg = ensure_in_register(index.container, 0);
+                u8 idx_reg = ensure_in_register(index.index, 1);
+                m_pending_index_get = nullptr;
+                emit_abc(Opcode::INDEX_FIELD_GET_LIST, dst, list_reg, idx_reg);
+                emit(encode_field_word(slot_offset, slot_count));
+                canonicalize_u32(inst, dst);
+                spill_if_needed(inst->result, dst);
+                break;
+            }
+            // Format: [GET_FIELD dst obj slot_count] + [slot_offset:16 padding:16]
+            u8 obj = ensure_in_register(inst->field.object, 1);
             emit_abc(Opcode::GET_FIELD, dst, obj, slot_count);
             emit(static_cast<u32>(slot_offset)); // Second instruction word with slot offset
             // A u32 field ≥ 2^31 sign-extends through GET_FIELD's 1-slot load;
@@ -2403,11 +2723,33 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
         }
 
         case IROp::SetField: {
+            u8 slot_count = static_cast<u8>(inst->field.slot_count);
+            u16 slot_offset = static_cast<u16>(inst->field.slot_offset);
+            if (take_pending_index_get(inst->field.object)) {
+                const IndexData& index = m_pending_index_get->index_data;
+                u8 list_reg = ensure_in_register(index.container, 0);
+                u8 idx_reg = ensure_in_register(index.index, 1);
+                m_pending_index_get = nullptr;
+                if (has_register(inst->store_value)) {
+                    // Format: [INDEX_FIELD_SET_LIST list index val] + [slot_offset:16
+                    // slot_count:8]
+                    u8 val = static_cast<u8>(m_value_to_reg[inst->store_value.id]);
+                    emit_abc(Opcode::INDEX_FIELD_SET_LIST, list_reg, idx_reg, val);
+                    emit(encode_field_word(slot_offset, slot_count));
+                    break;
+                }
+                // A spilled value would need a third scratch register: split
+                // back into the element-pointer read plus a plain SET_FIELD.
+                u8 elem_reg = m_scratch_regs[0];
+                emit_abc(Opcode::INDEX_GET_LIST, elem_reg, list_reg, idx_reg);
+                u8 val = ensure_in_register(inst->store_value, 1);
+                emit_abc(Opcode::SET_FIELD, elem_reg, val, slot_count);
+                emit(static_cast<u32>(slot_offset));
+                break;
+            }
             // Format: [SET_FIELD obj val slot_count] + [slot_offset:16 padding:16]
             u8 obj = ensure_in_register(inst->field.object, 0);
             u8 val = ensure_in_register(inst->store_value, 1);
-            u8 slot_count = static_cast<u8>(inst->field.slot_count);
-            u16 slot_offset = static_cast<u16>(inst->field.slot_offset);
             emit_abc(Opcode::SET_FIELD, obj, val, slot_count);
             emit(static_cast<u32>(slot_offset)); // Second instruction word with slot offset
             break;
@@ -2492,11 +2834,15 @@ void BytecodeBuilder::lower_instruction(IRInst* inst) {
                 // (BCDeleteDesc::Closure — used to drop an erased Coro<T> whose
                 // concrete state struct isn't statically known) can dispatch it
                 // by runtime type_id. Mirrors the closure-env registration below.
-                if (struct_has_default_dtor(struct_type)) {
+                // A coroutine state whose `$$delete` releases nothing gets no
+                // entry, so dropping it is just a free (no nested interpret).
+                if (struct_has_default_dtor(struct_type) &&
+                    !struct_type->struct_info.coro_dtor_is_noop) {
                     u16 dtor_idx = lookup_destructor_index(struct_type);
                     if (dtor_idx != 0)
                         info.dtor_func_idx = dtor_idx;
                 }
+                info.pooled = struct_type->struct_info.is_coro_state;
                 m_module->types.push_back(info);
                 m_type_indices[type_name] = type_idx;
             }
@@ -3107,6 +3453,33 @@ void BytecodeBuilder::fuse_compare_branch() {
     }
 }
 
+void BytecodeBuilder::form_superinstructions() {
+    auto& code = m_current_func->code;
+
+    // Same instruction-by-instruction walk as fuse_compare_branch. Only the
+    // first op's opcode byte changes, so code stays the same length and every
+    // PC — jump targets, handler and cleanup ranges — stays valid; a branch
+    // into the second instruction simply runs it unfused. Pairs don't chain:
+    // the second instruction of a pair is never itself rewritten.
+    u32 i = 0;
+    while (i < code.size()) {
+        Opcode first_op = decode_opcode(code[i]);
+        u32 first_width = is_two_word_instruction(first_op) ? 2 : 1;
+        u32 next = i + first_width;
+        if (next >= code.size())
+            break;
+
+        Opcode super_op = find_superinstruction(first_op, decode_opcode(code[next]));
+        if (super_op == Opcode::NOP) {
+            i = next;
+            continue;
+        }
+
+        code[i] = (code[i] & 0x00FFFFFFu) | (static_cast<u32>(super_op) << 24);
+        i = next + (is_two_word_instruction(decode_opcode(code[next])) ? 2 : 1);
+    }
+}
+
 u32 BytecodeBuilder::get_struct_slot_count(Type* type) {
     if (!type || !type->is_struct())
         return 0;
@@ -3524,8 +3897,10 @@ u16 BytecodeBuilder::build_delete_desc(Type* type) {
                                        desc.fields.field_count);
             break;
         case DropKind::List:
-            desc.cleanup = BCDeleteDesc::List;
-            desc.container.elem_desc_idx = build_delete_desc(plan.elem_type);
+            // Array elements are packed primitives: nothing to walk, just the buffer.
+            desc.cleanup = type->is_array() ? BCDeleteDesc::Array : BCDeleteDesc::List;
+            desc.container.elem_desc_idx =
+                type->is_array() ? 0xFFFF : build_delete_desc(plan.elem_type);
             desc.container.key_desc_idx = 0xFFFF; // unused for lists
             break;
         case DropKind::Map:
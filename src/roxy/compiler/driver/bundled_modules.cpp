@@ -0,0 +1,363 @@
+#include "roxy/compiler/driver/bundled_modules.hpp"
+
+namespace rx {
+
+// sched: cooperative scheduler for Coro<Wait> tasks (docs/internals/coroutines.md,
+// "Scheduler"). Plain Roxy, so it runs unchanged on the VM and the C backend.
+static const char k_sched_source[] = R"roxy(// Cooperative scheduler for long-lived scripted tasks.
+//
+// A task is a Coro<Wait>: each `yield` hands the scheduler a wait descriptor
+// saying when to resume it next. tick() resumes every task that is due, in a
+// loop inside the script, with no host round-trip per task. Waiting tasks
+// cost nothing per tick: they sit in a heap (frame and time waits) or a
+// waiter list (signals) until they come due.
+
+pub enum WaitKind { NextFrame, Frames, Sleep, Signal }
+
+// What a task waits for. `count` is the frame count (Frames) or the signal
+// id (Signal); `seconds` is the delay (Sleep). Four slots, so it comes back
+// from resume() in registers.
+pub struct Wait {
+    kind: WaitKind;
+    count: i32;
+    seconds: f64;
+}
+
+pub fun next_frame(): Wait {
+    return Wait { kind = WaitKind::NextFrame, count = 1, seconds = 0.0 };
+}
+
+pub fun wait_frames(frames: i32): Wait {
+    return Wait { kind = WaitKind::Frames, count = frames, seconds = 0.0 };
+}
+
+pub fun sleep(seconds: f64): Wait {
+    return Wait { kind = WaitKind::Sleep, count = 0, seconds = seconds };
+}
+
+pub fun wait_signal(signal: i32): Wait {
+    return Wait { kind = WaitKind::Signal, count = signal, seconds = 0.0 };
+}
+
+// Tasks are addressed by slot, an index into `tasks`. A slot keeps its task
+// for the task's whole life, so every queue below is a plain List<i32> of
+// slots and a wake-up never moves a coroutine. A finished task's slot goes on
+// `free_slots` and is refilled by the next spawn(), which also drops the
+// finished coroutine it still holds.
+//
+// Waiting tasks are filed where their wake-up is found without a scan:
+//   - frame waits shorter than 64 frames go in the wheel bucket for
+//     their wake frame (NextFrame is a one-frame wait);
+//   - longer frame waits and sleeps go in a min-heap keyed by wake frame or
+//     wake time (tasks due on the same tick come off it in heap order, not
+//     the order they went to sleep);
+//   - signal waits go in the bucket for their signal id.
+pub struct Scheduler {
+    tasks: List<Coro<Wait>>;
+    free_slots: List<i32>;
+    ready: List<i32>;              // Spawned or signalled: run on the next tick()
+    wheel: List<List<i32>>;        // Bucket (wake frame % 64)
+    frame_keys: List<i64>;         // Min-heap of long frame waits: wake frame
+    frame_slots: List<i32>;        //   ... and the waiting slot
+    time_keys: List<f64>;          // Min-heap of sleeps: wake time
+    time_slots: List<i32>;
+    signal_buckets: Map<i32, i32>; // Signal id -> index into signal_waiters
+    signal_waiters: List<List<i32>>;
+    live: i32;
+    frame: i64;
+    time: f64;
+}
+
+fun new Scheduler() {
+    self.tasks = List<Coro<Wait>>();
+    self.free_slots = List<i32>();
+    self.ready = List<i32>();
+    self.wheel = List<List<i32>>();
+    for (var i: i32 = 0; i < 64; i = i + 1) {
+        self.wheel.push(List<i32>());
+    }
+    self.frame_keys = List<i64>();
+    self.frame_slots = List<i32>();
+    self.time_keys = List<f64>();
+    self.time_slots = List<i32>();
+    self.signal_buckets = Map<i32, i32>();
+    self.signal_waiters = List<List<i32>>();
+    self.live = 0;
+    self.frame = 0l;
+    self.time = 0.0;
+}
+
+// Binary min-heap over parallel key/slot lists
+fun heap_push<K>(keys: inout List<K>, slots: inout List<i32>, key: K, slot: i32) {
+    keys.push(key);
+    slots.push(slot);
+    var i = keys.len() - 1;
+    while (i > 0) {
+        var parent = (i - 1) / 2;
+        if (!(key < keys[parent])) {
+            break;
+        }
+        keys[i] = keys[parent];
+        slots[i] = slots[parent];
+        i = parent;
+    }
+    keys[i] = key;
+    slots[i] = slot;
+}
+
+// Remove the minimum and return its slot
+fun heap_pop<K>(keys: inout List<K>, slots: inout List<i32>): i32 {
+    var top = slots[0];
+    var last_key = keys.pop();
+    var last_slot = slots.pop();
+    var n = keys.len();
+    if (n == 0) {
+        return top;
+    }
+    var i: i32 = 0;
+    while (true) {
+        var child = i * 2 + 1;
+        if (child >= n) {
+            break;
+        }
+        if (child + 1 < n && keys[child + 1] < keys[child]) {
+            child = child + 1;
+        }
+        if (!(keys[child] < last_key)) {
+            break;
+        }
+        keys[i] = keys[child];
+        slots[i] = slots[child];
+        i = child;
+    }
+    keys[i] = last_key;
+    slots[i] = last_slot;
+    return top;
+}
+
+// Take ownership of `task`; it first runs on the next tick().
+fun Scheduler.spawn(task: Coro<Wait>) {
+    var slot: i32 = 0;
+    if (self.free_slots.len() > 0) {
+        slot = self.free_slots.pop();
+        self.tasks[slot] = task;
+    } else {
+        slot = self.tasks.len();
+        self.tasks.push(task);
+    }
+    self.ready.push(slot);
+    self.live = self.live + 1;
+}
+
+// Live (unfinished) tasks
+fun Scheduler.len(): i32 {
+    return self.live;
+}
+
+// Frames completed so far
+fun Scheduler.frame(): i64 {
+    return self.frame;
+}
+
+// Seconds accumulated by tick()
+fun Scheduler.time(): f64 {
+    return self.time;
+}
+
+// Make every task waiting on `signal` due on the next tick(). Returns how many
+// were woken.
+fun Scheduler.signal(signal: i32): i32 {
+    var bucket = self.signal_buckets.get_or(signal, -1);
+    if (bucket < 0) {
+        return 0;
+    }
+    var woken = self.signal_waiters[bucket].len();
+    for (var i: i32 = 0; i < woken; i = i + 1) {
+        self.ready.push(self.signal_waiters[bucket][i]);
+    }
+    truncate(inout self.signal_waiters[bucket], 0);
+    return woken;
+}
+
+fun truncate(list: inout List<i32>, len: i32) {
+    while (list.len() > len) {
+        list.pop();
+    }
+}
+
+// Remove the first `n` entries, keeping the rest in order
+fun drop_front(list: inout List<i32>, n: i32) {
+    var len = list.len();
+    for (var i: i32 = n; i < len; i = i + 1) {
+        list[i - n] = list[i];
+    }
+    truncate(inout list, len - n);
+}
+
+// Resume one task and file it under the wait it yields
+fun Scheduler.run(slot: i32, frame: i64, now: f64) {
+    var wait = self.tasks[slot].resume();
+    if (self.tasks[slot].done()) {
+        self.free_slots.push(slot);
+        self.live = self.live - 1;
+        return;
+    }
+    when wait.kind {
+        case NextFrame:
+            self.wheel[i32((frame + 1l) % 64l)].push(slot);
+        case Frames:
+            var frames = wait.count;
+            if (frames < 1) {
+                frames = 1;
+            }
+            if (frames < 64) {
+                self.wheel[i32((frame + i64(frames)) % 64l)].push(slot);
+            } else {
+                heap_push(inout self.frame_keys, inout self.frame_slots, frame + i64(frames), slot);
+            }
+        case Sleep:
+            heap_push(inout self.time_keys, inout self.time_slots, now + wait.seconds, slot);
+        case Signal:
+            var bucket = self.signal_buckets.get_or(wait.count, -1);
+            if (bucket < 0) {
+                bucket = self.signal_waiters.len();
+                self.signal_waiters.push(List<i32>());
+                self.signal_buckets.insert(wait.count, bucket);
+            }
+            self.signal_waiters[bucket].push(slot);
+    }
+}
+
+// Advance the clock by `dt` seconds and resume every due task once: those
+// spawned or signalled since the last tick, frame waits that reach this frame,
+// then sleeps that reach the new time. A task that finishes is dropped from
+// the queues. Returns how many tasks were resumed.
+fun Scheduler.tick(dt: f64): i32 {
+    self.time = self.time + dt;
+    var frame = self.frame;
+    var now = self.time;
+    while (self.frame_keys.len() > 0 && self.frame_keys[0] <= frame) {
+        self.ready.push(heap_pop(inout self.frame_keys, inout self.frame_slots));
+    }
+    while (self.time_keys.len() > 0 && self.time_keys[0] <= now) {
+        self.ready.push(heap_pop(inout self.time_keys, inout self.time_slots));
+    }
+
+    // A task run here may spawn another or signal a wait, which appends to
+    // `ready` behind the entries being walked. Those first run next tick, so
+    // only the walked prefix is removed.
+    var count = self.ready.len();
+    for (var i: i32 = 0; i < count; i = i + 1) {
+        self.run(self.ready[i], frame, now);
+    }
+    drop_front(inout self.ready, count);
+
+    // Tasks run here are refiled at least a frame ahead, never into this
+    // bucket; anything they spawn or signal lands in `ready`.
+    var bucket = i32(frame % 64l);
+    var due = self.wheel[bucket].len();
+    for (var i: i32 = 0; i < due; i = i + 1) {
+        self.run(self.wheel[bucket][i], frame, now);
+    }
+    truncate(inout self.wheel[bucket], 0);
+
+    self.frame = frame + 1l;
+    return count + due;
+}
+)roxy";
+
+// io: buffered record reader and writer over the runtime's file handles
+// (docs/internals/modules.md, "io"). The byte view, map_file(), is a builtin.
+static const char k_io_source[] = R"roxy(// Buffered file streams.
+//
+// Both types own a runtime handle and release it in their destructor, so a
+// reader or writer is move-only and closes itself at scope exit. Reads and
+// writes go through a 64 KiB buffer: one system call per buffer, not per line.
+
+// Reads a file one record at a time. A record ends at the delimiter (newline
+// by default), which is not part of it; a '\r' before a newline is dropped too.
+// A last record without a delimiter is still returned.
+//
+//     var lines = LineReader("data.txt");
+//     while (lines.next()) {
+//         print(lines.line());
+//     }
+pub struct LineReader {
+    handle: u64;
+    delim: i32;
+}
+
+fun new LineReader(path: string) {
+    self.handle = __file_reader_open(path);
+    self.delim = 10;
+}
+
+// Records separated by the byte `delim` instead of newlines
+fun new LineReader.split(path: string, delim: i32) {
+    self.handle = __file_reader_open(path);
+    self.delim = delim;
+}
+
+fun delete LineReader() {
+    __file_reader_close(self.handle);
+}
+
+// Advance to the next record. False at end of file.
+fun LineReader.next(): bool {
+    return __file_reader_next(self.handle, self.delim);
+}
+
+// The current record
+fun LineReader.line(): string {
+    return __file_reader_record(self.handle);
+}
+
+// Writes strings to a file through a buffer. Nothing reaches the file until
+// the buffer fills, flush() is called or the writer is dropped.
+pub struct FileWriter {
+    handle: u64;
+}
+
+// Create or truncate `path`
+fun new FileWriter(path: string) {
+    self.handle = __file_writer_open(path, false);
+}
+
+// Write after the existing contents of `path`
+fun new FileWriter.append(path: string) {
+    self.handle = __file_writer_open(path, true);
+}
+
+fun delete FileWriter() {
+    __file_writer_close(self.handle);
+}
+
+fun FileWriter.write(s: string) {
+    __file_writer_write(self.handle, s);
+}
+
+fun FileWriter.write_line(s: string) {
+    __file_writer_write(self.handle, s);
+    __file_writer_write(self.handle, "\n");
+}
+
+// Hand everything buffered so far to the OS
+fun FileWriter.flush() {
+    __file_writer_flush(self.handle);
+}
+)roxy";
+
+static const BundledModule k_bundled_modules[] = {
+    {"sched", k_sched_source, sizeof(k_sched_source) - 1},
+    {"io", k_io_source, sizeof(k_io_source) - 1},
+};
+
+const BundledModule* find_bundled_module(StringView name) {
+    for (const BundledModule& module : k_bundled_modules) {
+        if (name == module.name)
+            return &module;
+    }
+    return nullptr;
+}
+
+} // namespace rx
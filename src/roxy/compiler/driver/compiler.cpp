@@ -1,4 +1,5 @@
 #include "roxy/compiler/driver/compiler.hpp"
+#include "roxy/compiler/driver/bundled_modules.hpp"
 #include "roxy/compiler/codegen/lowering.hpp"
 #include "roxy/compiler/ir/coroutine_lowering.hpp"
 #include "roxy/compiler/ir/ir_builder.hpp"
@@ -8,6 +9,7 @@
 #include "roxy/compiler/parse/parser.hpp"
 #include "roxy/compiler/sema/semantic.hpp"
 #include "roxy/core/trace.hpp"
+#include "roxy/core/tsl/robin_set.h"
 #include "roxy/core/unique_ptr.hpp"
 #include "roxy/shared/lexer.hpp"
 #include "roxy/vm/binding/registry.hpp"
@@ -16,6 +18,10 @@
 #include <chrono>
 #include <cstring>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 namespace rx {
 
 // Monotonic nanosecond timestamp for phase timing (see CompileTimings).
@@ -23,6 +29,23 @@ static inline u64 now_ns() {
     return static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
 }
 
+// The process's peak resident set size in bytes, or 0 where we don't read it
+// (Windows would need psapi for PeakWorkingSetSize).
+static u64 peak_rss_bytes() {
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return static_cast<u64>(usage.ru_maxrss); // bytes on macOS
+#else
+    return static_cast<u64>(usage.ru_maxrss) * 1024; // KiB on Linux and the BSDs
+#endif
+#endif
+}
+
 Compiler::Compiler(BumpAllocator& allocator)
     : m_allocator(allocator), m_type_env(allocator), m_module_registry(allocator),
       m_builtin_registry(new NativeRegistry(allocator, m_type_env.types())) {
@@ -49,6 +72,63 @@ void Compiler::add_source(StringView module_name, const char* source, u32 length
     m_module_registry.register_script_module(module_name);
 }
 
+void Compiler::save_prelude() {
+    // Run the builtin registrations analyze() would otherwise perform lazily
+    // for the first module, so they land below the checkpoint.
+    SymbolTable symbols(m_allocator);
+    SemanticAnalyzer analyzer(m_allocator, m_type_env, m_module_registry, symbols);
+    analyzer.register_builtin_types();
+
+    m_type_env.save_checkpoint();
+    m_module_registry.save_checkpoint();
+    m_prelude_mark = m_allocator.mark();
+}
+
+// IR nodes are arena-placed but their Vectors are not; run the destructors so a
+// rewound arena doesn't strand that heap memory.
+static void destroy_ir_function(IRFunction* func) {
+    for (IRBlock* block : func->blocks) {
+        block->~IRBlock();
+    }
+    func->~IRFunction();
+}
+
+void Compiler::restore_prelude() {
+    // The linked module's functions are a superset of the per-module ones.
+    bool linked = m_linked_ir != nullptr;
+    if (linked) {
+        for (IRFunction* func : m_linked_ir->functions) {
+            destroy_ir_function(func);
+        }
+        m_linked_ir->~IRModule();
+        m_linked_ir = nullptr;
+    }
+    for (ModuleState& state : m_module_states) {
+        if (state.ir_module) {
+            if (!linked) {
+                for (IRFunction* func : state.ir_module->functions) {
+                    destroy_ir_function(func);
+                }
+            }
+            state.ir_module->~IRModule();
+        }
+        if (state.symbols) {
+            state.symbols->release_scopes();
+            delete state.symbols;
+        }
+    }
+    m_module_states.clear();
+    m_sources.clear();
+    m_compile_order.clear();
+    m_errors.clear();
+    m_combined_registry.reset();
+    m_timings = CompileTimings{};
+
+    m_type_env.restore_checkpoint();
+    m_module_registry.restore_checkpoint();
+    m_allocator.rewind(m_prelude_mark);
+}
+
 BCModule* Compiler::compile() {
     // Build combined registry with all native functions from all registries
     m_combined_registry = make_unique<NativeRegistry>(m_allocator, m_type_env.types());
@@ -60,33 +140,42 @@ BCModule* Compiler::compile() {
     m_module_states.resize(m_sources.size());
 
     m_timings = CompileTimings{};
+    MemorySample compile_memory = sample_memory();
     u64 compile_start = now_ns();
 
     // Phase 1: Parse all modules
+    MemorySample m0 = compile_memory;
     u64 t0 = now_ns();
     bool ok = parse_all();
     m_timings.parse_ns = now_ns() - t0;
+    record_memory(m0, m_timings.memory.parse);
     if (!ok)
         return nullptr;
 
     // Phase 2: Topologically sort by imports
+    m0 = sample_memory();
     t0 = now_ns();
     ok = topological_sort();
     m_timings.topo_ns = now_ns() - t0;
+    record_memory(m0, m_timings.memory.topo);
     if (!ok)
         return nullptr;
 
     // Phase 3: Semantic analysis (in topological order)
+    m0 = sample_memory();
     t0 = now_ns();
     ok = analyze_all();
     m_timings.sema_ns = now_ns() - t0;
+    record_memory(m0, m_timings.memory.sema);
     if (!ok)
         return nullptr;
 
     // Phase 4: Build IR for all modules
+    m0 = sample_memory();
     t0 = now_ns();
     ok = build_ir_all();
     m_timings.ir_build_ns = now_ns() - t0;
+    record_memory(m0, m_timings.memory.ir_build);
     if (!ok)
         return nullptr;
 
@@ -94,6 +183,7 @@ BCModule* Compiler::compile() {
     BCModule* module = link_modules();
 
     m_timings.total_ns = now_ns() - compile_start;
+    record_memory(compile_memory, m_timings.memory.total);
     return module;
 }
 
@@ -115,10 +205,19 @@ bool Compiler::parse_all() {
 
         m_module_states[i].program = program;
 
-        // Collect imports from the program
+        // Collect imports from the program. An import no added source or
+        // native registry provides may name a bundled module: add it, and
+        // this loop parses it in turn.
         for (auto* decl : program->declarations) {
             if (decl && decl->kind == AstKind::DeclImport) {
-                m_module_states[i].imports.push_back(decl->import_decl.module_path);
+                StringView path = decl->import_decl.module_path;
+                m_module_states[i].imports.push_back(path);
+                if (!m_module_registry.find_module(path)) {
+                    if (const BundledModule* bundled = find_bundled_module(path)) {
+                        add_source(bundled->name, bundled->source, bundled->length);
+                        m_module_states.resize(m_sources.size());
+                    }
+                }
             }
         }
     }
@@ -383,8 +482,10 @@ BCModule* Compiler::link_modules() {
     // For now, merge all IR modules and build a single bytecode module
     // This is a simplified linker that combines functions from all modules
 
-    // Create merged IR module
-    IRModule merged_ir;
+    // Create merged IR module. It outlives the link so linked_ir_module() can
+    // hand it to the C backend.
+    m_linked_ir = m_allocator.emplace<IRModule>();
+    IRModule& merged_ir = *m_linked_ir;
     merged_ir.name = "linked";
 
     // Collect all functions and module globals. Each module's globals occupy a
@@ -396,6 +497,7 @@ BCModule* Compiler::link_modules() {
     // `__module_init`/`__module_shutdown` names — only one runs; cross-module
     // globals are a documented limitation. Single-module globals are exact.)
     u32 global_base = 0;
+    tsl::robin_set<Type*> seen_types;
     for (u32 idx : m_compile_order) {
         IRModule* ir_mod = m_module_states[idx].ir_module;
         if (global_base > 0 && ir_mod->global_slot_count > 0) {
@@ -418,15 +520,27 @@ BCModule* Compiler::link_modules() {
             merged_ir.globals.push_back(merged_g);
         }
         global_base += ir_mod->global_slot_count;
+        // Types are interned in the shared TypeEnv, so a type two modules both
+        // use is one pointer; the bytecode path ignores these lists.
+        for (Type* type : ir_mod->struct_types) {
+            if (seen_types.insert(type).second)
+                merged_ir.struct_types.push_back(type);
+        }
+        for (Type* type : ir_mod->enum_types) {
+            if (seen_types.insert(type).second)
+                merged_ir.enum_types.push_back(type);
+        }
     }
     merged_ir.global_slot_count = global_base;
 
     // Coroutine lowering pass: transform coroutine functions into init/resume/done
     {
         ROXY_ZONE("coro-lower");
+        MemorySample m0 = sample_memory();
         u64 t0 = now_ns();
         coroutine_lower(&merged_ir, m_allocator, m_type_env);
         m_timings.coro_lower_ns = now_ns() - t0;
+        record_memory(m0, m_timings.memory.coro_lower);
     }
 
     // Phase 2 IR optimizations: copy propagation + DCE. Runs after coroutine
@@ -434,9 +548,19 @@ BCModule* Compiler::link_modules() {
     // validation so the validator checks the post-optimization IR.
     {
         ROXY_ZONE("ir-optimize");
+        MemorySample m0 = sample_memory();
         u64 t0 = now_ns();
         optimize_module(&merged_ir, m_allocator);
         m_timings.ir_optimize_ns = now_ns() - t0;
+        record_memory(m0, m_timings.memory.ir_optimize);
+    }
+    if (m_track_memory) {
+        CompileMemory& memory = m_timings.memory;
+        for (IRFunction* func : merged_ir.functions) {
+            memory.values_by_id_bytes += sizeof(IRInst*) * func->values_by_id.capacity();
+            if (func->next_value_id > memory.max_value_ids)
+                memory.max_value_ids = func->next_value_id;
+        }
     }
 
     // Validate merged IR before lowering. The validator only checks
@@ -447,10 +571,12 @@ BCModule* Compiler::link_modules() {
 #ifndef NDEBUG
     {
         ROXY_ZONE("ir-validate");
+        MemorySample m0 = sample_memory();
         u64 t0 = now_ns();
         IRValidator validator;
         bool valid = validator.validate(&merged_ir);
         m_timings.ir_validate_ns = now_ns() - t0;
+        record_memory(m0, m_timings.memory.ir_validate);
         if (!valid) {
             add_error_fmt("IR validation failed: {}", validator.error());
             return nullptr;
@@ -467,9 +593,13 @@ BCModule* Compiler::link_modules() {
     BCModule* module;
     {
         ROXY_ZONE("bc-lower");
+        MemorySample m0 = sample_memory();
         u64 t0 = now_ns();
         module = bc_builder.build(&merged_ir);
         m_timings.bc_lower_ns = now_ns() - t0;
+        record_memory(m0, m_timings.memory.bc_lower);
+        if (m_track_memory)
+            m_timings.memory.bc_side_table_bytes = bc_builder.side_table_bytes();
     }
 
     if (!module) {
@@ -482,12 +612,43 @@ BCModule* Compiler::link_modules() {
         return nullptr;
     }
 
+    for (const auto& func : module->functions) {
+        if (func->spilled_values == 0)
+            continue;
+        m_timings.spilled_values += func->spilled_values;
+        m_timings.spill_ops += func->spill_ops;
+        m_timings.spills.push_back({func->name, func->spilled_values, func->spill_ops});
+    }
+
     // Apply native functions from combined registry
     m_combined_registry->apply_to_module(module);
 
     return module;
 }
 
+Compiler::MemorySample Compiler::sample_memory() const {
+    MemorySample sample;
+    if (!m_track_memory)
+        return sample;
+    sample.arena_bytes = m_allocator.bytes_used();
+    sample.arena_chunks = m_allocator.chunk_count();
+    sample.vector_reallocs = g_vector_growth.reallocs;
+    sample.vector_bytes_moved = g_vector_growth.bytes_moved;
+    sample.peak_rss_bytes = peak_rss_bytes();
+    return sample;
+}
+
+void Compiler::record_memory(const MemorySample& start, PhaseMemory& out) const {
+    if (!m_track_memory)
+        return;
+    MemorySample end = sample_memory();
+    out.arena_bytes = end.arena_bytes - start.arena_bytes;
+    out.arena_chunks = end.arena_chunks - start.arena_chunks;
+    out.vector_reallocs = end.vector_reallocs - start.vector_reallocs;
+    out.vector_bytes_moved = end.vector_bytes_moved - start.vector_bytes_moved;
+    out.peak_rss_bytes = end.peak_rss_bytes - start.peak_rss_bytes;
+}
+
 void Compiler::add_error(const char* message) {
     // Copy message to allocator
     u32 len = static_cast<u32>(strlen(message));
@@ -0,0 +1,21 @@
+#include "roxy/compiler/driver/compiler_session.hpp"
+
+namespace rx {
+
+CompilerSession::CompilerSession(u64 arena_capacity)
+    : m_allocator(arena_capacity), m_compiler(m_allocator) {
+    m_compiler.save_prelude();
+}
+
+void CompilerSession::add_native_registry(StringView module_name, NativeRegistry* registry) {
+    m_compiler.restore_prelude();
+    m_compiler.add_native_registry(module_name, registry);
+    m_compiler.save_prelude();
+}
+
+Compiler& CompilerSession::begin_compile() {
+    m_compiler.restore_prelude();
+    return m_compiler;
+}
+
+} // namespace rx
@@ -56,6 +56,22 @@ ModuleInfo* ModuleRegistry::register_script_module(StringView name) {
     return module;
 }
 
+void ModuleRegistry::restore_checkpoint() {
+    // Match by module, not by name: a module registered after the checkpoint is
+    // named by its compile's source list, which may already be gone. The
+    // checkpoint holds only the few prelude modules, so a scan is enough.
+    for (const auto& [name, module] : m_modules) {
+        bool in_checkpoint = false;
+        for (const auto& [checkpoint_name, checkpoint_module] : m_checkpoint_modules) {
+            in_checkpoint = in_checkpoint || checkpoint_module == module;
+        }
+        if (!in_checkpoint) {
+            module->~ModuleInfo(); // arena-allocated; releases the exports Vector
+        }
+    }
+    m_modules = m_checkpoint_modules;
+}
+
 void ModuleRegistry::add_export(ModuleInfo* module, StringView name, ExportKind kind, Type* type,
                                 bool is_pub, u32 index, Decl* decl) {
     ModuleExport exp;
@@ -288,6 +288,9 @@ generate_coro_destructor(BumpAllocator& allocator, Type* struct_type, StringView
     // Process fields in reverse order (LIFO, like C++ member destruction).
     // Skip the three reserved header fields __resume_idx, __state, __yield_val
     // (indices 0, 1, 2) — only params/promoted locals own resources.
+    // Until a field needs cleanup the destructor only returns; the VM then
+    // skips calling it when an erased Coro is dropped.
+    struct_type->struct_info.coro_dtor_is_noop = true;
     const auto& fields = struct_type->struct_info.fields;
     for (i32 i = static_cast<i32>(fields.size()) - 1; i >= 3; i--) {
         const FieldInfo& field = fields[i];
@@ -321,6 +324,7 @@ generate_coro_destructor(BumpAllocator& allocator, Type* struct_type, StringView
         // owning a `uniq` was never destroyed at all.
         if (!is_catch_field && !member_needs_drop(field.type))
             continue;
+        struct_type->struct_info.coro_dtor_is_noop = false;
 
         // A `ref` field is a counted borrow (ref param acquired at init, or ref
         // local acquired mid-body); release it here (RefDec the borrowed pointer,
@@ -456,6 +460,8 @@ static void remap_inst_values(const tsl::robin_map<u32, ValueId>& value_map, IRI
         case IROp::ConstD:
         case IROp::ConstString:
         case IROp::StackAlloc:
+        case IROp::GlobalAddr: // global_data/func_index overlay `unary`: no operands
+        case IROp::FuncIndex:
         case IROp::BlockArg:
             break;
         case IROp::GetField:
@@ -1259,6 +1265,7 @@ static void lower_coroutine(IRFunction* original, IRModule* module, BumpAllocato
     struct_type->struct_info.when_clauses = Span<WhenClauseInfo>();
     struct_type->struct_info.implemented_traits = Span<TraitImplRecord>();
     struct_type->struct_info.parent = nullptr;
+    struct_type->struct_info.is_coro_state = true;
     derive_struct_move_only(struct_type->struct_info);
 
     type_env.register_named_type(struct_name, struct_type);
@@ -586,6 +586,14 @@ void IRBuilder::collect_backend_types(Program* program) {
     // Collect monomorphized generic struct instances
     for_each_concrete_struct_instance(
         [&](auto* instance) { m_module->struct_types.push_back(instance->concrete_type); });
+
+    // The builtin SIMD vector types are plain structs to the C backend (their
+    // typedef, and any user struct or List holding one, needs the definition).
+    // Appended last so user struct TYPEIDs keep their declaration order.
+    for (StringView name : {"f32x4"_sv, "f64x2"_sv, "i32x4"_sv}) {
+        if (Type* simd_type = m_type_env.named_type_by_name(name))
+            m_module->struct_types.push_back(simd_type);
+    }
 }
 
 void IRBuilder::begin_ir_function(StringView name, bool is_pub, u32 source_line) {
@@ -1041,9 +1049,9 @@ IRFunction* IRBuilder::build_cleanup_wrapper(Type* noncopyable_type, u32 wrapper
     m_current_func->params.push_back(param);
     m_current_func->param_is_ptr.push_back(false);
 
-    // Create entry block with the parameter as a block arg
+    // The parameter is a function param only, like every other function's: as
+    // an entry-block arg too, the C backend read an undeclared `block0_arg0`.
     set_current_block(create_block("entry"_sv));
-    m_current_block->params.push_back(param);
 
     ValueId param_val = param.value;
 
@@ -1171,14 +1179,14 @@ void IRBuilder::emit_throw_builtin_exception(StringView exc_type_name) {
     finish_block_unreachable();
 }
 
-void IRBuilder::emit_list_bounds_check(ValueId list_val, ValueId index_val) {
+void IRBuilder::emit_list_bounds_check(ValueId list_val, ValueId index_val, Type* list_type) {
     Type* i32_type = m_types.i32_type();
     Type* bool_type = m_types.bool_type();
 
-    StringView len_name = "List$$len"_sv;
+    StringView len_name = list_len_native(list_type);
     i32 len_idx = m_registry.get_index(len_name);
     if (len_idx < 0) {
-        report_error("Internal error: List$$len native missing");
+        report_error("Internal error: length native missing");
         return;
     }
     ValueId len =
@@ -1285,7 +1293,7 @@ IRFunction* IRBuilder::build_container_to_string(Type* container_type, StringVie
 
     if (container_type->is_list()) {
         Type* elem_type = container_type->list_info.element_type;
-        StringView len_name = "List$$len"_sv;
+        StringView len_name = list_len_native(container_type);
         i32 len_idx = m_registry.get_index(len_name);
         assert(len_idx >= 0);
 
@@ -1335,7 +1343,7 @@ IRFunction* IRBuilder::build_container_to_string(Type* container_type, StringVie
         finish_block_goto(elem_block->id, alloc_span(sep_args));
 
         set_current_block(elem_block);
-        ValueId elem = emit_index_get(self_val, i_param, ContainerKind::List, elem_type);
+        ValueId elem = emit_index_get(self_val, i_param, list_container_kind(container_type), elem_type);
         ValueId acc_elem = fold_part(acc1_param, elem, elem_type);
         ValueId i_next = emit_binary(IROp::AddI, i_param, one, i32_type);
         Vector<BlockArgPair> back_args;
@@ -1509,7 +1517,11 @@ void IRBuilder::begin_function_body(bool skip_hidden_return) {
     set_current_block(entry);
 
     // Initialize local variable scopes and ownership tracking
-    m_local_scopes.clear_keep_capacity();
+    m_local_slot_index.clear();
+    m_local_slot_names.clear_keep_capacity();
+    m_local_slots.clear_keep_capacity();
+    m_scope_bindings.clear_keep_capacity();
+    m_scope_marks.clear_keep_capacity();
     m_ownership.reset();
     m_next_temp_id = 0;
     push_scope();
@@ -1535,7 +1547,7 @@ void IRBuilder::begin_function_body(bool skip_hidden_return) {
         // double-free the caller's value. `m_param_is_ptr` is exactly the set of
         // inout/out params, so skip tracking when it contains `bp.name`.
         if (param_owns_its_value(bp.type) && !m_param_is_ptr.count(bp.name)) {
-            u32 scope_depth = static_cast<u32>(m_local_scopes.size());
+            u32 scope_depth = current_scope_depth();
             BlockId current_block_id = m_current_block ? m_current_block->id : BlockId::invalid();
             m_ownership.track(
                 {bp.name, bp.type, scope_depth, false, false, current_block_id, bp.value});
@@ -1577,8 +1589,8 @@ void IRBuilder::end_function_body() {
     // Record cleanup info for exception-path cleanup before removing owned locals.
     // This is needed for functions that don't have try/catch but may have exceptions
     // propagate through them (cross-frame unwinding).
-    if (!m_local_scopes.empty()) {
-        u32 depth = static_cast<u32>(m_local_scopes.size());
+    if (!m_scope_marks.empty()) {
+        u32 depth = current_scope_depth();
         record_scope_cleanup_records(depth);
         BlockId end_block = current_or_last_block_id();
 
@@ -1600,7 +1612,7 @@ void IRBuilder::end_function_body() {
         }
 
         m_ownership.pop_to_depth(depth);
-        m_local_scopes.pop_back();
+        unbind_innermost_scope();
     }
 
     // Append deferred call-site receiver-borrow records last, so they sort after
@@ -9,6 +9,7 @@
 #include "roxy/compiler/support/operator_traits.hpp"
 #include "roxy/compiler/types/generics.hpp"
 #include "roxy/vm/binding/registry.hpp"
+#include "roxy/vm/list.hpp"
 #include "roxy/vm/map.hpp"
 
 #include "ir_builder_internal.hpp"
@@ -346,6 +347,119 @@ ValueId IRBuilder::emit_index_addr(ValueId container, ValueId index, ContainerKi
     return ValueId::invalid();
 }
 
+// Bucket-level map iteration (MapIterNext / MapIterKey / MapIterValue): the
+// map is the container, the bucket index the index. Map only.
+ValueId IRBuilder::emit_map_iter(IROp op, ValueId map, ValueId index, Type* result_type) {
+    IRInst* inst = emit_inst(op, result_type);
+    if (inst) {
+        inst->index_data.container = map;
+        inst->index_data.index = index;
+        inst->index_data.value = ValueId::invalid();
+        inst->index_data.kind = ContainerKind::Map;
+        return inst->result;
+    }
+    return ValueId::invalid();
+}
+
+ValueId IRBuilder::emit_simd(IROp op, SimdOp simd_op, SimdKind kind, Type* result_type,
+                             ValueId a, ValueId b, ValueId c, u8 imm) {
+    IRInst* inst = emit_inst(op, result_type);
+    if (inst) {
+        inst->simd.op = simd_op;
+        inst->simd.kind = kind;
+        inst->simd.imm = imm;
+        inst->simd.a = a;
+        inst->simd.b = b;
+        inst->simd.c = c;
+        return inst->result;
+    }
+    return ValueId::invalid();
+}
+
+// Builtin SIMD vector methods. Every name here was registered by
+// register_builtin_simd_types; operators and compound assignments arrive under
+// their trait-method names (`a + b` is "add", `a += b` is "add_assign" with the
+// suffix already stripped). Lane masks and scalar results take their type from
+// the caller's result_type, so one table serves all three vector kinds.
+ValueId IRBuilder::gen_simd_method(Type* simd_type, StringView name, ValueId self,
+                                   Span<ValueId> args, Span<CallArg> arg_exprs,
+                                   Type* result_type) {
+    SimdKind kind = simd_kind_of(simd_type);
+    ValueId arg0 = args.size() > 0 ? args[0] : ValueId::invalid();
+
+    struct Lanewise {
+        const char* name;
+        SimdOp op;
+        bool swap; // cmp_gt / cmp_ge are cmp_lt / cmp_le with the operands swapped
+    };
+    static const Lanewise lanewise[] = {
+        {"add", SimdOp::Add, false},       {"sub", SimdOp::Sub, false},
+        {"mul", SimdOp::Mul, false},       {"div", SimdOp::Div, false},
+        {"min", SimdOp::Min, false},       {"max", SimdOp::Max, false},
+        {"bit_and", SimdOp::And, false},   {"bit_or", SimdOp::Or, false},
+        {"bit_xor", SimdOp::Xor, false},   {"cmp_eq", SimdOp::CmpEq, false},
+        {"cmp_ne", SimdOp::CmpNe, false},  {"cmp_lt", SimdOp::CmpLt, false},
+        {"cmp_le", SimdOp::CmpLe, false},  {"cmp_gt", SimdOp::CmpLt, true},
+        {"cmp_ge", SimdOp::CmpLe, true},   {"scale", SimdOp::Scale, false},
+        {"dot", SimdOp::Dot, false},       {"eq", SimdOp::Eq, false},
+        {"ne", SimdOp::Ne, false},         {"neg", SimdOp::Neg, false},
+        {"abs", SimdOp::Abs, false},       {"sqrt", SimdOp::Sqrt, false},
+        {"hsum", SimdOp::Hsum, false},
+    };
+    for (const Lanewise& entry : lanewise) {
+        if (name != StringView(entry.name))
+            continue;
+        if (entry.swap)
+            return emit_simd(IROp::Simd, entry.op, kind, result_type, arg0, self);
+        return emit_simd(IROp::Simd, entry.op, kind, result_type, self, arg0);
+    }
+
+    if (name == "select"_sv) {
+        // self.select(mask, other): mask bits set take self.
+        return emit_simd(IROp::Simd, SimdOp::Select, kind, result_type, self, args[1], arg0);
+    }
+    if (name == "shuffle"_sv) {
+        // Sema checked the selectors are in-range integer literals.
+        u8 imm = 0;
+        for (u32 i = 0; i < arg_exprs.size(); i++) {
+            imm |= static_cast<u8>((arg_exprs[i].expr->literal.int_value & 3) << (2 * i));
+        }
+        return emit_simd(IROp::Simd, SimdOp::Shuffle, kind, result_type, self,
+                         ValueId::invalid(), ValueId::invalid(), imm);
+    }
+    if (name == "to_i32x4"_sv || name == "to_f32x4"_sv) {
+        return emit_simd(IROp::Simd, SimdOp::Convert, kind, result_type, self);
+    }
+    if (name == "store"_sv) {
+        return emit_simd(IROp::SimdStore, SimdOp::Store, kind, m_types.void_type(), self, arg0,
+                         args[1]);
+    }
+
+    report_error("Internal error: unknown SIMD method");
+    return ValueId::invalid();
+}
+
+// f32x4(x, y, z, w) builds the lanes in place like a struct literal;
+// splat / load are single Simd instructions.
+ValueId IRBuilder::gen_simd_constructor(Type* simd_type, CallExpr& call_expr) {
+    SimdKind kind = simd_kind_of(simd_type);
+    Span<ValueId> args = lower_simple_args(call_expr.arguments);
+    if (call_expr.constructor_name == "splat"_sv) {
+        return emit_simd(IROp::Simd, SimdOp::Splat, kind, simd_type, args[0]);
+    }
+    if (call_expr.constructor_name == "load"_sv) {
+        return emit_simd(IROp::Simd, SimdOp::Load, kind, simd_type, args[0], args[1]);
+    }
+
+    ValueId obj = emit_stack_alloc(simd_type->struct_info.slot_count, simd_type);
+    Span<FieldInfo> lanes = simd_type->struct_info.fields;
+    for (u32 i = 0; i < lanes.size() && i < args.size(); i++) {
+        emit_set_field(obj, lanes[i].name, lanes[i].slot_offset, lanes[i].slot_count, args[i],
+                       lanes[i].type);
+    }
+    return obj;
+}
+
 // Nullable map find: dst = value-slot pointer (as i64), or 0 if the key is
 // absent. Map only. The result is a raw pointer, so the caller branches on
 // `== 0` and either throws or dereferences it.
@@ -507,6 +621,38 @@ void IRBuilder::emit_str_release(ValueId ptr) {
         inst->unary = ptr;
 }
 
+// The roxy_list_order a sort / binary_search over `elem_type` runs with. Sema
+// admits only these element kinds, so the fallback is never reached.
+static i64 list_order_for(Type* elem_type) {
+    switch (elem_type ? elem_type->kind : TypeKind::Error) {
+        case TypeKind::I32:
+            return ROXY_LIST_ORDER_I32;
+        case TypeKind::U32:
+            return ROXY_LIST_ORDER_U32;
+        case TypeKind::I64:
+            return ROXY_LIST_ORDER_I64;
+        case TypeKind::U64:
+            return ROXY_LIST_ORDER_U64;
+        case TypeKind::F32:
+            return ROXY_LIST_ORDER_F32;
+        case TypeKind::F64:
+            return ROXY_LIST_ORDER_F64;
+        case TypeKind::String:
+            return ROXY_LIST_ORDER_STRING;
+        case TypeKind::I8:
+            return ROXY_LIST_ORDER_I8;
+        case TypeKind::U8:
+        case TypeKind::Bool:
+            return ROXY_LIST_ORDER_U8;
+        case TypeKind::I16:
+            return ROXY_LIST_ORDER_I16;
+        case TypeKind::U16:
+            return ROXY_LIST_ORDER_U16;
+        default:
+            return ROXY_LIST_ORDER_I32;
+    }
+}
+
 // Whether the compiler is responsible for a map value's counts.
 //
 // A `ref` value is counted by the *runtime* — the map header's `value_is_ref`
@@ -645,42 +791,29 @@ bool IRBuilder::emit_map_value_walk(ValueId map_obj, Type* value_type, StringVie
     return true;
 }
 
-// A container the program has just been handed a *second* owner of — the
-// `List<V>` from `m.values()`, the duplicate from `.copy()` — shares its
-// elements with the original. Both will release on destroy, so the new one has
-// to acquire: without it the second release spends a count nobody took, and the
-// element dies while the surviving container still points at it.
-//
-// `ref` elements are excluded (counted by the runtime), and move-only elements
-// by `member_needs_retain`, since a container of those is deep-copied.
-void IRBuilder::emit_list_elements_retain(ValueId list_val, Type* list_type) {
-    if (!list_type || !list_type->is_list() || !m_current_block)
-        return;
-    Type* elem_type = list_type->list_info.element_type;
-    if (counted_by_runtime(elem_type) || !member_needs_retain(elem_type))
-        return;
-
+template <typename OnElem>
+bool IRBuilder::emit_list_element_walk(ValueId list_val, Type* elem_type, ValueId start,
+                                       StringView tag, OnElem&& on_elem) {
     StringView len_name = "List$$len"_sv;
     i32 len_idx = m_registry.get_index(len_name);
     if (len_idx < 0)
-        return;
+        return false;
 
     Type* i32_type = m_types.i32_type();
     ValueId len =
         emit_call_native(len_name, alloc_span({list_val}), i32_type, static_cast<u32>(len_idx));
 
-    // for (i = 0; i < len; i++) retain(list[i]);
+    // for (i = start; i < len; i++) on_elem(list[i]);
     // `i` is the header's one block param; `len` is used by dominance.
-    IRBlock* header = create_block("lstretain");
-    IRBlock* body = create_block("lstretainbody");
-    IRBlock* exit_block = create_block("lstretainend");
+    IRBlock* header = create_block(tag);
+    IRBlock* body = create_block(tag);
+    IRBlock* exit_block = create_block(tag);
 
-    ValueId zero = emit_const_int(0, i32_type);
     ValueId idx_param = m_current_func->new_value();
-    header->params.push_back({idx_param, i32_type, "__lstretain_idx"_sv});
+    header->params.push_back({idx_param, i32_type, "__lstwalk_idx"_sv});
 
     Vector<BlockArgPair> init_args;
-    init_args.push_back({zero});
+    init_args.push_back({start});
     finish_block_goto(header->id, alloc_span(init_args));
 
     set_current_block(header);
@@ -689,10 +822,9 @@ void IRBuilder::emit_list_elements_retain(ValueId list_val, Type* list_type) {
 
     set_current_block(body);
     // In range by construction, so no bounds check: a struct element yields its
-    // address, everything else the slot value — which is what emit_value_retain
-    // expects either way.
+    // address, everything else the slot value.
     ValueId elem = emit_index_get(list_val, idx_param, ContainerKind::List, elem_type);
-    emit_value_retain(elem, elem_type);
+    on_elem(elem);
     ValueId one = emit_const_int(1, i32_type);
     ValueId idx_next = emit_binary(IROp::AddI, idx_param, one, i32_type);
     Vector<BlockArgPair> back_args;
@@ -700,6 +832,59 @@ void IRBuilder::emit_list_elements_retain(ValueId list_val, Type* list_type) {
     finish_block_goto(header->id, alloc_span(back_args));
 
     set_current_block(exit_block);
+    return true;
+}
+
+// A container the program has just been handed a *second* owner of — the
+// `List<V>` from `m.values()`, the duplicate from `.copy()` — shares its
+// elements with the original. Both will release on destroy, so the new one has
+// to acquire: without it the second release spends a count nobody took, and the
+// element dies while the surviving container still points at it.
+//
+// `ref` elements are excluded (counted by the runtime), and move-only elements
+// by `member_needs_retain`, since a container of those is deep-copied.
+void IRBuilder::emit_list_elements_retain(ValueId list_val, Type* list_type) {
+    if (!list_type || !list_type->is_list() || !m_current_block)
+        return;
+    Type* elem_type = list_type->list_info.element_type;
+    if (counted_by_runtime(elem_type) || !member_needs_retain(elem_type))
+        return;
+    ValueId zero = emit_const_int(0, m_types.i32_type());
+    emit_list_element_walk(list_val, elem_type, zero, "lstretain"_sv,
+                           [&](ValueId elem) { emit_value_retain(elem, elem_type); });
+}
+
+void IRBuilder::emit_list_truncate_drops(ValueId list_val, Type* list_type, ValueId new_len) {
+    Type* elem_type = list_type->list_info.element_type;
+    if (counted_by_runtime(elem_type) || !member_needs_drop(elem_type) || !m_current_block)
+        return;
+    // A negative length is the runtime's trap to raise; walking from it would
+    // index before the first element, so skip straight to the call.
+    IRBlock* walk = create_block("lsttrunc");
+    IRBlock* done = create_block("lsttruncend");
+    ValueId zero = emit_const_int(0, m_types.i32_type());
+    ValueId negative = emit_binary(IROp::LtI, new_len, zero, m_types.bool_type());
+    finish_block_branch(negative, done->id, walk->id);
+
+    set_current_block(walk);
+    emit_list_element_walk(list_val, elem_type, new_len, "lsttrunc"_sv,
+                           [&](ValueId elem) { emit_delete(elem, elem_type); });
+    finish_block_goto(done->id, {});
+    set_current_block(done);
+}
+
+void IRBuilder::emit_list_fill_ownership(ValueId list_val, Type* list_type, ValueId value_val) {
+    Type* elem_type = list_type->list_info.element_type;
+    if (counted_by_runtime(elem_type) || !member_needs_drop(elem_type) || !m_current_block)
+        return;
+    // Acquire before release in each step: `v` may itself be one of the
+    // elements (`xs.fill(xs[0])`), and must survive its own slot's release.
+    ValueId zero = emit_const_int(0, m_types.i32_type());
+    emit_list_element_walk(list_val, elem_type, zero, "lstfill"_sv, [&](ValueId elem) {
+        if (member_needs_retain(elem_type))
+            emit_value_retain(value_val, elem_type);
+        emit_delete(elem, elem_type);
+    });
 }
 
 void IRBuilder::emit_map_clear_value_cleanup(ValueId map_obj, Type* map_type) {
@@ -1364,6 +1549,11 @@ ValueId IRBuilder::gen_unary_expr(Expr* expr) {
 
     // Check for struct unary operator trait dispatch
     Type* operand_type = unary_expr.operand->resolved_type;
+    if (simd_kind_of(operand_type) != SimdKind::None && unary_expr.op == UnaryOp::Negate) {
+        ValueId operand = gen_expr(unary_expr.operand);
+        return emit_simd(IROp::Simd, SimdOp::Neg, simd_kind_of(operand_type), expr->resolved_type,
+                         operand);
+    }
     if (operand_type && operand_type->is_struct()) {
         StringView method_name = unary_op_to_trait_method(unary_expr.op);
         if (!method_name.empty()) {
@@ -1448,6 +1638,12 @@ ValueId IRBuilder::gen_binary_expr(Expr* expr) {
     // Check for struct operator trait dispatch
     if (left_type && left_type->is_struct()) {
         StringView method_name = binary_op_to_trait_method(binary_expr.op);
+        if (!method_name.empty() && simd_kind_of(left_type) != SimdKind::None) {
+            ValueId left = gen_expr(binary_expr.left);
+            ValueId right = gen_expr(binary_expr.right);
+            return gen_simd_method(left_type, method_name, left, alloc_span({right}), {},
+                                   expr->resolved_type);
+        }
         if (!method_name.empty()) {
             Type* found_in = nullptr;
             const MethodInfo* mi = lookup_method_in_hierarchy(left_type, method_name, &found_in);
@@ -1481,7 +1677,7 @@ ValueId IRBuilder::gen_binary_expr(Expr* expr) {
 
         // Evaluate right side, pass result to merge
         set_current_block(right_block);
-        ValueId right = gen_expr(binary_expr.right);
+        ValueId right = gen_conditional_operand(binary_expr.right);
         Span<BlockArgPair> right_args = alloc_span<BlockArgPair>(1);
         right_args[0] = {right};
         finish_block_goto(merge_block->id, right_args);
@@ -1506,7 +1702,7 @@ ValueId IRBuilder::gen_binary_expr(Expr* expr) {
 
         // Evaluate right side, pass result to merge
         set_current_block(right_block);
-        ValueId right = gen_expr(binary_expr.right);
+        ValueId right = gen_conditional_operand(binary_expr.right);
         Span<BlockArgPair> right_args = alloc_span<BlockArgPair>(1);
         right_args[0] = {right};
         finish_block_goto(merge_block->id, right_args);
@@ -1559,9 +1755,17 @@ ValueId IRBuilder::gen_ternary_expr(Expr* expr) {
 
     finish_block_branch(cond, then_block->id, else_block->id);
 
+    // An arm's temporaries only exist on its own path, so scope them to the arm
+    // — unless the result is itself owned, when the arm's temporary *is* the
+    // result and must outlive it.
+    bool owned_result = result_type && (result_type->kind == TypeKind::String ||
+                                        result_type->kind == TypeKind::Ref ||
+                                        tracked_for_cleanup(result_type));
+
     // Then branch
     set_current_block(then_block);
-    ValueId then_val = gen_expr(ternary_expr.then_expr);
+    ValueId then_val = owned_result ? gen_expr(ternary_expr.then_expr)
+                                    : gen_conditional_operand(ternary_expr.then_expr);
     {
         Vector<BlockArgPair> args;
         args.push_back({then_val});
@@ -1570,7 +1774,8 @@ ValueId IRBuilder::gen_ternary_expr(Expr* expr) {
 
     // Else branch
     set_current_block(else_block);
-    ValueId else_val = gen_expr(ternary_expr.else_expr);
+    ValueId else_val = owned_result ? gen_expr(ternary_expr.else_expr)
+                                    : gen_conditional_operand(ternary_expr.else_expr);
     {
         Vector<BlockArgPair> args;
         args.push_back({else_val});
@@ -1581,6 +1786,13 @@ ValueId IRBuilder::gen_ternary_expr(Expr* expr) {
     return phi;
 }
 
+ValueId IRBuilder::gen_conditional_operand(Expr* expr) {
+    push_scope();
+    ValueId value = gen_expr(expr);
+    pop_scope();
+    return value;
+}
+
 ValueId IRBuilder::emit_call_resolved(StringView name, Span<ValueId> args, Type* result_type) {
     i32 native_idx = m_registry.get_index(name);
     if (native_idx >= 0) {
@@ -1657,17 +1869,27 @@ ValueId IRBuilder::gen_list_constructor(Expr* expr) {
         user_args[i] = gen_expr(call_expr.arguments[i].expr);
     }
 
-    // Step 1: Allocate empty list with element_slot_count and element_is_inline args
+    // Step 1: Allocate empty list with element_slot_count and element_is_inline args.
+    // An Array passes its element byte width and signedness instead.
     StringView alloc_name = list_type->list_info.alloc_native_name;
     Type* elem_type = list_type->list_info.element_type;
-    u32 esc = get_type_slot_count(elem_type);
-    bool is_inline = !elem_type->is_struct();
-    ValueId esc_val = emit_const_int(static_cast<i64>(esc), m_types.i32_type());
-    ValueId inline_val = emit_const_int(is_inline ? 1 : 0, m_types.i32_type());
-    ValueId list_ptr = emit_native(alloc_name, {esc_val, inline_val}, expr->resolved_type);
+    ValueId list_ptr;
+    if (list_type->is_array()) {
+        u32 elem_size = array_element_size(elem_type);
+        bool is_signed = elem_type->is_signed_integer() || elem_type->is_float();
+        ValueId size_val = emit_const_int(static_cast<i64>(elem_size), m_types.i32_type());
+        ValueId signed_val = emit_const_int(is_signed ? 1 : 0, m_types.i32_type());
+        list_ptr = emit_native(alloc_name, {size_val, signed_val}, expr->resolved_type);
+    } else {
+        u32 esc = get_type_slot_count(elem_type);
+        bool is_inline = !elem_type->is_struct();
+        ValueId esc_val = emit_const_int(static_cast<i64>(esc), m_types.i32_type());
+        ValueId inline_val = emit_const_int(is_inline ? 1 : 0, m_types.i32_type());
+        list_ptr = emit_native(alloc_name, {esc_val, inline_val}, expr->resolved_type);
+    }
 
     // Step 2: Call constructor method with [self, user_args...]
-    StringView ctor_name = call_expr.mangled_name; // "List$$new"
+    StringView ctor_name = call_expr.mangled_name; // "List$$new" / "Array$$new"
     i32 ctor_idx = m_registry.get_index(ctor_name);
     Span<ValueId> ctor_args = prepend_self(list_ptr, user_args);
     emit_call_native(ctor_name, ctor_args, m_types.void_type(), static_cast<u32>(ctor_idx));
@@ -2038,6 +2260,12 @@ ValueId IRBuilder::gen_call_member(Expr* expr, const CallLowering& lowered) {
         return emit_call(fn_name, alloc_span({obj}), expr->resolved_type);
     }
 
+    // Builtin SIMD vector method: inline lane op, no call.
+    if (simd_kind_of(struct_type) != SimdKind::None) {
+        return gen_simd_method(struct_type, get_expr.name, obj, args, call_expr.arguments,
+                               expr->resolved_type);
+    }
+
     // Coro method call. Both dispatch dynamically so first-class (erased) Coro<T>
     // values work: a coroutine value is a heap pointer to its state struct whose
     // slot 0 is __resume_idx (the resume function's dispatch index, exactly like a
@@ -2140,6 +2368,25 @@ ValueId IRBuilder::gen_call_member(Expr* expr, const CallLowering& lowered) {
                 emit_map_clear_value_cleanup(obj, struct_type);
             }
         }
+        // List bulk operations. sort / binary_search take the element order as
+        // a trailing hidden constant (the runtime header only knows slot
+        // widths); truncate / fill settle the counts of the elements they
+        // discard or duplicate before the native runs.
+        if (struct_type->is_list()) {
+            Type* elem_type = struct_type->list_info.element_type;
+            if (get_expr.name == "sort"_sv || get_expr.name == "binary_search"_sv) {
+                Span<ValueId> with_order = alloc_span<ValueId>(args.size() + 1);
+                for (u32 i = 0; i < args.size(); i++)
+                    with_order[i] = args[i];
+                with_order[args.size()] =
+                    emit_const_int(list_order_for(elem_type), m_types.i32_type());
+                args = with_order;
+            } else if (get_expr.name == "truncate"_sv && args.size() >= 1) {
+                emit_list_truncate_drops(obj, struct_type, args[0]);
+            } else if (get_expr.name == "fill"_sv && args.size() >= 1) {
+                emit_list_fill_ownership(obj, struct_type, args[0]);
+            }
+        }
         StringView native_name = call_expr.mangled_name;
         i32 native_idx = m_registry.get_index(native_name);
         Span<ValueId> method_args = prepend_self(obj, args);
@@ -2160,6 +2407,11 @@ ValueId IRBuilder::gen_call_member(Expr* expr, const CallLowering& lowered) {
                 emit_map_values_retain(container_result, result_type);
             }
         }
+        // `extend` took `other` by value; the runtime moves its elements out
+        // but leaves the list itself to us. A refused extend (self, pinned,
+        // out of memory) moved nothing, so the same drop releases them all.
+        if (struct_type->is_list() && get_expr.name == "extend"_sv && args.size() >= 1)
+            emit_delete(args[0], struct_type);
         return container_result;
     }
 
@@ -2570,8 +2822,9 @@ ValueId IRBuilder::gen_index_expr(Expr* expr) {
     if (base_type && base_type->is_list()) {
         ValueId obj = gen_expr(index_expr.object);
         ValueId index_val = gen_expr(index_expr.index);
-        emit_list_bounds_check(obj, index_val);
-        return emit_index_get(obj, index_val, ContainerKind::List, expr->resolved_type);
+        emit_list_bounds_check(obj, index_val, base_type);
+        return emit_index_get(obj, index_val, list_container_kind(base_type),
+                              expr->resolved_type);
     }
 
     // Map indexing: single-lookup nullable find; a missing key throws KeyError.
@@ -2739,6 +2992,17 @@ ValueId IRBuilder::gen_compound_assign(Expr* expr, ValueId rhs, bool& handled) {
             StringView method_name(method_name_str, static_cast<u32>(strlen(method_name_str)));
             Type* found_in = nullptr;
             const MethodInfo* mi = lookup_method_in_hierarchy(type, method_name, &found_in);
+            if (mi && found_in && simd_kind_of(type) != SimdKind::None) {
+                // `v op= w` on a vector: compute `v op w`, then write it back in place.
+                ValueId self_ptr = gen_lvalue_addr(assign_expr.target);
+                StringView op_name(method_name.data(), method_name.size() - strlen("_assign"));
+                ValueId combined =
+                    gen_simd_method(type, op_name, self_ptr, alloc_span({rhs}), {}, type);
+                emit_struct_copy(self_ptr, combined, type->struct_info.slot_count, type,
+                                 StructCopyKind::Move);
+                handled = true;
+                return combined;
+            }
             if (mi && found_in) {
                 ValueId self_ptr = gen_lvalue_addr(assign_expr.target);
                 StringView mangled = mangle_method(found_in->struct_info.name, method_name);
@@ -3182,7 +3446,7 @@ ValueId IRBuilder::gen_assign_index(Expr* expr, ValueId value) {
             is_list ? container_type->list_info.element_type : container_type->map_info.value_type;
         bool elem_noncopyable = elem_type && elem_type->noncopyable();
         bool elem_is_ref = elem_type && elem_type->kind == TypeKind::Ref;
-        ContainerKind kind = is_list ? ContainerKind::List : ContainerKind::Map;
+        ContainerKind kind = is_list ? list_container_kind(container_type) : ContainerKind::Map;
 
         ValueId obj = gen_expr(index_expr.object);
         ValueId index_val = gen_expr(index_expr.index);
@@ -3300,6 +3564,10 @@ ValueId IRBuilder::gen_constructor_call(Expr* expr) {
         struct_type = call_expr.callee->get.object->resolved_type;
     }
 
+    if (simd_kind_of(struct_type) != SimdKind::None) {
+        return gen_simd_constructor(struct_type, call_expr);
+    }
+
     // Determine allocation mode and final struct type
     ValueId obj;
     if (call_expr.is_heap) {
@@ -3731,7 +3999,7 @@ ValueId IRBuilder::gen_lvalue_addr(Expr* expr, bool rvalue_ok) {
                 ValueId obj = gen_expr(index_expr.object);
                 ValueId idx = gen_expr(index_expr.index);
                 ContainerKind kind =
-                    base_type->is_list() ? ContainerKind::List : ContainerKind::Map;
+                    base_type->is_list() ? list_container_kind(base_type) : ContainerKind::Map;
                 return emit_index_addr(obj, idx, kind, expr->resolved_type);
             }
             report_error("Internal error: cannot take the address of this index expression");
@@ -17,6 +17,22 @@ inline u32 slot_count_or_1(Type* type) {
     return slot_count == 0 ? 1 : slot_count;
 }
 
+// Lane layout of a builtin SIMD vector value (f32x4 / f64x2 / i32x4), None for
+// every other type. A `ref` to a vector is not itself a vector value.
+inline SimdKind simd_kind_of(Type* type) {
+    return type && type->is_struct() ? type->struct_info.simd_kind : SimdKind::None;
+}
+
+// IndexGet/IndexSet kind and length native of a List-kind type (or a `ref` to
+// one): Array<T> subscripts use the packed-element ops.
+inline ContainerKind list_container_kind(Type* list_type) {
+    return list_type && list_type->base_type()->is_array() ? ContainerKind::Array
+                                                           : ContainerKind::List;
+}
+inline StringView list_len_native(Type* list_type) {
+    return list_type && list_type->base_type()->is_array() ? "Array$$len"_sv : "List$$len"_sv;
+}
+
 // True for types whose value is an owning heap pointer held in a register /
 // slot: `uniq T`, List, Map, Coro, and `fun` closures (a uniq env pointer).
 // They share teardown shape — load the pointer, typed Delete — and their
@@ -1,4 +1,4 @@
-// IRBuilder — ownership and cleanup bookkeeping: local-scope maps, owned-local
+// IRBuilder — ownership and cleanup bookkeeping: the local slot environment, owned-local
 // tracking (consume / move-marking / string retain-release), implicit
 // destruction, field cleanup, and exception-path cleanup records. The tracked
 // state and its keyed lookups live in the OwnershipTracker collaborator
@@ -15,52 +15,51 @@ namespace rx {
 using namespace ir_builder_detail;
 
 void IRBuilder::define_local(StringView name, ValueId value, Type* type, bool is_ptr) {
-    if (m_local_scopes.empty())
+    if (m_scope_marks.empty())
         return;
 
-    // Search for an existing binding in outer scopes and update it
-    // This is necessary for SSA - assignments should update the existing definition
-    // Sound for declarations too: semantic analysis rejects a local shadowing
-    // another local/parameter of the same function (check_no_local_shadowing),
-    // so a declaration can only find an existing binding for a name whose
-    // previous scope has already been popped — never a live outer binding.
-    for (i32 i = static_cast<i32>(m_local_scopes.size()) - 1; i >= 0; i--) {
-        auto it = m_local_scopes[i].find(name);
-        if (it != m_local_scopes[i].end()) {
-            // Update value/type; keep the existing is_ptr — ptr-ness is fixed at
-            // definition (an out/inout param's SSA updates store through the
-            // pointer, they never rebind it to a non-pointer). (§3.7)
-            LocalVar& lv = it.value();
-            lv.value = value;
-            lv.type = type;
-            return;
-        }
+    auto [it, inserted] =
+        m_local_slot_index.try_emplace(name, static_cast<u32>(m_local_slots.size()));
+    if (inserted) {
+        m_local_slot_names.push_back(name);
+        m_local_slots.push_back(LocalVar{ValueId::invalid(), nullptr});
+    }
+    LocalVar& lv = m_local_slots[it->second];
+
+    // A bound slot is an assignment: SSA updates rebind the existing
+    // definition wherever it was declared. Sound for declarations too:
+    // semantic analysis rejects a local shadowing another local/parameter of
+    // the same function (check_no_local_shadowing), so a declaration can only
+    // find its slot unbound — its previous scope has already been popped.
+    if (lv.depth != 0) {
+        // Update value/type; keep the existing is_ptr — ptr-ness is fixed at
+        // definition (an out/inout param's SSA updates store through the
+        // pointer, they never rebind it to a non-pointer). (§3.7)
+        lv.value = value;
+        lv.type = type;
+        return;
     }
 
-    // If no existing binding, add to innermost scope (new variable declaration)
-    m_local_scopes.back()[name] = {value, type, is_ptr};
+    // Unbound: a new declaration in the innermost scope.
+    lv = {value, type, is_ptr, current_scope_depth()};
+    m_scope_bindings.push_back(it->second);
 }
 
 ValueId IRBuilder::lookup_local(StringView name) {
-    // Search from innermost to outermost scope
-    for (i32 i = static_cast<i32>(m_local_scopes.size()) - 1; i >= 0; i--) {
-        auto it = m_local_scopes[i].find(name);
-        if (it != m_local_scopes[i].end()) {
-            return it->second.value;
-        }
-    }
+    if (LocalVar* lv = find_local(name))
+        return lv->value;
     report_error(intern_format("Internal error: undefined variable '{}' in IR generation (fn {})",
                                name, m_current_func ? m_current_func->name : "?"_sv)
                      .data());
     return ValueId::invalid();
 }
 
-void IRBuilder::push_scope() { m_local_scopes.push_back({}); }
+void IRBuilder::push_scope() { m_scope_marks.push_back(static_cast<u32>(m_scope_bindings.size())); }
 
 void IRBuilder::pop_scope() {
-    if (m_local_scopes.empty())
+    if (m_scope_marks.empty())
         return;
-    u32 depth = static_cast<u32>(m_local_scopes.size());
+    u32 depth = current_scope_depth();
 
     // Record cleanup info for exception-path cleanup BEFORE emit_scope_cleanup.
     record_scope_cleanup_records(depth);
@@ -71,7 +70,24 @@ void IRBuilder::pop_scope() {
     // Remove owned local tracking for this scope
     m_ownership.pop_to_depth(depth);
 
-    m_local_scopes.pop_back();
+    unbind_innermost_scope();
+}
+
+void IRBuilder::unbind_innermost_scope() {
+    u32 depth = current_scope_depth();
+    u32 mark = m_scope_marks.pop_back();
+    while (m_scope_bindings.size() > mark) {
+        LocalVar& lv = m_local_slots[m_scope_bindings.pop_back()];
+        if (lv.depth == depth)
+            lv = LocalVar{ValueId::invalid(), nullptr};
+    }
+}
+
+void IRBuilder::collect_live_slots(Vector<u32>& out) const {
+    for (u32 slot = 0; slot < m_local_slots.size(); slot++) {
+        if (m_local_slots[slot].depth != 0)
+            out.push_back(slot);
+    }
 }
 
 BlockId IRBuilder::current_or_last_block_id() const {
@@ -107,6 +123,7 @@ void IRBuilder::record_scope_cleanup_records(u32 depth) {
             continue;
         IRCleanupKind kind = info.kind == OwnedKind::RefBorrow ? IRCleanupKind::RefDec
                              : info.kind == OwnedKind::StrOwn  ? IRCleanupKind::StrRelease
+                             : info.kind == OwnedKind::Pin     ? IRCleanupKind::Unpin
                                                                : IRCleanupKind::Delete;
         IRCleanupInfo record{info.initial_value, info.type, info.start_block, end_block, kind};
         record.from_merge_rebind = info.rebound_at_merge;
@@ -115,14 +132,13 @@ void IRBuilder::record_scope_cleanup_records(u32 depth) {
 }
 
 IRBuilder::LocalVar* IRBuilder::find_local(StringView name) {
-    // Search from innermost to outermost scope
-    for (i32 i = static_cast<i32>(m_local_scopes.size()) - 1; i >= 0; i--) {
-        auto it = m_local_scopes[i].find(name);
-        if (it != m_local_scopes[i].end()) {
-            return &it.value();
-        }
-    }
-    return nullptr;
+    // The returned pointer is into m_local_slots: valid until the next
+    // declaration of a name this function has not seen yet.
+    auto it = m_local_slot_index.find(name);
+    if (it == m_local_slot_index.end())
+        return nullptr;
+    LocalVar& lv = m_local_slots[it->second];
+    return lv.depth != 0 ? &lv : nullptr;
 }
 
 void IRBuilder::track_noncopyable_call_temp(ValueId val, Type* type) {
@@ -137,7 +153,7 @@ void IRBuilder::track_noncopyable_call_temp(ValueId val, Type* type) {
         return;
     StringView temp_name = intern_synthetic_name("__tmp", m_next_temp_id++);
     define_local(temp_name, val, type);
-    u32 scope_depth = static_cast<u32>(m_local_scopes.size());
+    u32 scope_depth = current_scope_depth();
     m_ownership.track({temp_name, type, scope_depth, false, true, m_current_block->id, val});
 }
 
@@ -164,7 +180,7 @@ void IRBuilder::track_string_temp(ValueId val, Type* type) {
         return;
     StringView temp_name = intern_synthetic_name("__str", m_next_temp_id++);
     define_local(temp_name, val, type);
-    u32 scope_depth = static_cast<u32>(m_local_scopes.size());
+    u32 scope_depth = current_scope_depth();
     m_ownership.track({temp_name, type, scope_depth, false, /*is_temporary=*/true,
                        m_current_block->id, val, OwnedKind::StrOwn});
 }
@@ -177,7 +193,7 @@ void IRBuilder::track_ref_call_temp(ValueId val, Type* type) {
         return;
     StringView temp_name = intern_synthetic_name("__ref", m_next_temp_id++);
     define_local(temp_name, val, type);
-    u32 scope_depth = static_cast<u32>(m_local_scopes.size());
+    u32 scope_depth = current_scope_depth();
     m_ownership.track({temp_name, type, scope_depth, false, /*is_temporary=*/true,
                        m_current_block->id, val, OwnedKind::RefBorrow});
     // The scope-exit RefDec names this ValueId; copy propagation folding it back
@@ -328,6 +344,17 @@ void IRBuilder::emit_implicit_destroy(OwnedLocalInfo& info) {
         return;
     }
 
+    // Range-loop pin (gen_for_in_stmt): release the container's pin count. The
+    // Nullify ends the Unpin cleanup record here, as for a ref borrow.
+    if (info.kind == OwnedKind::Pin) {
+        emit_container_unpin(current_value);
+        if (info.initial_value.is_valid()) {
+            emit_nullify(info.initial_value);
+        }
+        info.is_moved = true;
+        return;
+    }
+
     // A caught exception bound to a catch-all (`ExceptionRef`) has no compile-time
     // concrete type, so free it type-erased via a raw object free (void-typed
     // Delete → DEL_OBJ). This reclaims the memory (finding 9a); the caught type's
@@ -98,6 +98,9 @@ void IRBuilder::gen_stmt(Stmt* stmt) {
         case AstKind::StmtFor:
             gen_for_stmt(stmt);
             break;
+        case AstKind::StmtForIn:
+            gen_for_in_stmt(stmt);
+            break;
         case AstKind::StmtReturn:
             gen_return_stmt(stmt);
             break;
@@ -142,10 +145,7 @@ void IRBuilder::gen_block_stmt(Stmt* stmt) {
 
 IRBuilder::ScopeSnapshot IRBuilder::snapshot_scopes(bool with_move_state) {
     ScopeSnapshot snapshot;
-    snapshot.scopes.reserve(m_local_scopes.size());
-    for (auto& scope : m_local_scopes) {
-        snapshot.scopes.push_back(scope);
-    }
+    snapshot.slots = m_local_slots;
     if (with_move_state) {
         snapshot.has_move_state = true;
         m_ownership.snapshot_move_state(snapshot.is_moved);
@@ -154,9 +154,13 @@ IRBuilder::ScopeSnapshot IRBuilder::snapshot_scopes(bool with_move_state) {
 }
 
 void IRBuilder::restore_scopes(const ScopeSnapshot& snapshot, bool restore_move_state) {
-    m_local_scopes.clear_keep_capacity();
-    for (const auto& scope : snapshot.scopes) {
-        m_local_scopes.push_back(scope);
+    // Slots first seen after the snapshot was taken were unbound then.
+    u32 count = snapshot.slots.size();
+    for (u32 slot = 0; slot < count; slot++) {
+        m_local_slots[slot] = snapshot.slots[slot];
+    }
+    for (u32 slot = count; slot < m_local_slots.size(); slot++) {
+        m_local_slots[slot] = LocalVar{ValueId::invalid(), nullptr};
     }
     if (restore_move_state && snapshot.has_move_state) {
         m_ownership.restore_move_state(snapshot.is_moved);
@@ -164,7 +168,11 @@ void IRBuilder::restore_scopes(const ScopeSnapshot& snapshot, bool restore_move_
 }
 
 void IRBuilder::restore_scopes_move(ScopeSnapshot&& snapshot) {
-    m_local_scopes = std::move(snapshot.scopes);
+    u32 count = m_local_slots.size();
+    m_local_slots = std::move(snapshot.slots);
+    while (m_local_slots.size() < count) {
+        m_local_slots.push_back(LocalVar{ValueId::invalid(), nullptr});
+    }
     if (snapshot.has_move_state) {
         m_ownership.restore_move_state(snapshot.is_moved);
     }
@@ -241,6 +249,7 @@ void IRBuilder::rebind_owned_local_to_merge_param(StringView name, ValueId merge
     if (!info->is_moved && info->start_block.is_valid() && info->initial_value.is_valid()) {
         IRCleanupKind kind = info->kind == OwnedKind::RefBorrow ? IRCleanupKind::RefDec
                              : info->kind == OwnedKind::StrOwn  ? IRCleanupKind::StrRelease
+                             : info->kind == OwnedKind::Pin     ? IRCleanupKind::Unpin
                                                                 : IRCleanupKind::Delete;
         IRCleanupInfo ci{info->initial_value, info->type, info->start_block, m_current_block->id,
                          kind};
@@ -677,6 +686,8 @@ void IRBuilder::gen_while_stmt(Stmt* stmt) {
         }
     }
 
+    add_loop_merge_params(exit_block, nullptr, loop_vars);
+
     // 4. Jump to header with initial values
     finish_block_goto(header_block->id, alloc_span(initial_args));
 
@@ -686,12 +697,12 @@ void IRBuilder::gen_while_stmt(Stmt* stmt) {
         define_local(lv.name, lv.header_param, lv.type);
     }
 
-    // 6. Condition and branch
+    // 6. Condition and branch (the exit takes the loop vars like a `break` does)
     ValueId cond = gen_expr(ws.condition);
-    finish_block_branch(cond, body_block->id, exit_block->id);
+    finish_block_branch(cond, body_block->id, exit_block->id, {}, make_loop_args(loop_vars));
 
     // 7. Push loop info for break/continue
-    u32 while_scope_depth = static_cast<u32>(m_local_scopes.size());
+    u32 while_scope_depth = current_scope_depth();
     m_loop_stack.push_back({header_block, exit_block, header_block, loop_vars, while_scope_depth});
 
     // 8. Generate body
@@ -708,10 +719,10 @@ void IRBuilder::gen_while_stmt(Stmt* stmt) {
     Vector<LoopVarInfo> saved_loop_vars = m_loop_stack.back().loop_vars; // copy, not move
     m_loop_stack.pop_back();
 
-    // 10. Exit block - use header params as final values
+    // 10. Exit block - its params are the final values
     set_current_block(exit_block);
     for (const auto& slv : saved_loop_vars) {
-        define_local(slv.name, slv.header_param, slv.type);
+        define_local(slv.name, slv.exit_param, slv.type);
     }
 }
 
@@ -753,6 +764,8 @@ void IRBuilder::gen_for_stmt(Stmt* stmt) {
         }
     }
 
+    add_loop_merge_params(exit_block, incr_block, loop_vars);
+
     // 5. Jump to header with initial values
     finish_block_goto(header_block->id, alloc_span(initial_args));
 
@@ -765,7 +778,8 @@ void IRBuilder::gen_for_stmt(Stmt* stmt) {
     // 7. Condition and branch
     if (fs.condition) {
         ValueId cond = gen_expr(fs.condition);
-        finish_block_branch(cond, body_block->id, exit_block->id);
+        finish_block_branch(cond, body_block->id, exit_block->id, {},
+                            make_loop_args(loop_vars));
     } else {
         // No condition = infinite loop (until break)
         finish_block_goto(body_block->id);
@@ -773,18 +787,21 @@ void IRBuilder::gen_for_stmt(Stmt* stmt) {
 
     // 8. Push loop info for break/continue
     // continue goes to increment block, but we need to pass args to header after increment
-    u32 for_scope_depth = static_cast<u32>(m_local_scopes.size());
+    u32 for_scope_depth = current_scope_depth();
     m_loop_stack.push_back({header_block, exit_block, incr_block, loop_vars, for_scope_depth});
 
     // 9. Generate body
     set_current_block(body_block);
     gen_stmt(fs.body);
     if (m_current_block && m_current_block->terminator.kind == TerminatorKind::None) {
-        finish_block_goto(incr_block->id);
+        finish_block_goto(incr_block->id, make_loop_args(m_loop_stack.back().loop_vars));
     }
 
     // 10. Increment block - generate increment, then jump back to header with args
     set_current_block(incr_block);
+    for (const auto& lv : m_loop_stack.back().loop_vars) {
+        define_local(lv.name, lv.continue_param, lv.type);
+    }
     if (fs.increment) {
         gen_expr(fs.increment);
     }
@@ -797,13 +814,169 @@ void IRBuilder::gen_for_stmt(Stmt* stmt) {
 
     pop_scope();
 
-    // 11. Exit block - use header params as final values
+    // 11. Exit block - its params are the final values
     set_current_block(exit_block);
     for (const auto& slv : saved_loop_vars) {
-        define_local(slv.name, slv.header_param, slv.type);
+        define_local(slv.name, slv.exit_param, slv.type);
+    }
+}
+
+// Bind one range-for element (`for x in list`, `for (k, v) in map`). The
+// element is read in place, so each binding follows gen_var_decl's rules for a
+// non-fresh initializer: a struct is cloned out of the bucket, a `ref` takes
+// its own borrow, a string its own count.
+void IRBuilder::bind_for_in_element(StringView name, ValueId elem, Type* type) {
+    ValueId value = elem;
+    if (type->is_struct()) {
+        u32 slot_count = type->struct_info.slot_count;
+        value = emit_stack_alloc(slot_count, type);
+        emit_struct_copy(value, elem, slot_count, type, StructCopyKind::Clone);
+    }
+    define_local(name, value, type);
+
+    u32 scope_depth = current_scope_depth();
+    BlockId current_block_id = m_current_block ? m_current_block->id : BlockId::invalid();
+    if (tracked_for_cleanup(type)) {
+        m_ownership.track({name, type, scope_depth, false, false, current_block_id, value});
+    } else if (type->kind == TypeKind::Ref) {
+        acquire_ref_borrow(value, nullptr);
+        m_ownership.track({name, type, scope_depth, false, false, current_block_id, value,
+                           OwnedKind::RefBorrow});
+    } else if (type->kind == TypeKind::String) {
+        consume_or_retain_string(value, type, TempAdoption::ByDeclaration);
+        m_ownership.track({name, type, scope_depth, false, false, current_block_id, value,
+                           OwnedKind::StrOwn});
     }
 }
 
+// Range statement. The container is pinned for the whole loop, so its length
+// (List) or bucket capacity (Map) is read once at entry and element storage
+// cannot move underneath the cursor:
+//
+//   pin = copy container; container_pin pin
+//   end = len(pin) | map capacity(pin)
+//   header(cursor, loop vars...):
+//     pos = cursor                  (List)
+//     pos = map_iter_next pin, cursor   (Map: skip empty buckets)
+//     branch pos < end, body, exit
+//   body: bind element(s) at pos; ...; goto inc
+//   inc:  goto header(pos + 1, loop vars...)
+//   exit: container_unpin pin       (scope exit of the pin)
+//
+// The pin is an ownership entry at the loop's own scope depth, so `break`
+// (which cleans only the body scopes) keeps it until the exit, while `return`
+// and exception unwind release it like any other tracked local.
+void IRBuilder::gen_for_in_stmt(Stmt* stmt) {
+    ForInStmt& fs = stmt->for_in_stmt;
+    Type* iter_type = fs.iterable->resolved_type;
+    Type* container_type = iter_type ? iter_type->base_type() : nullptr;
+    if (!container_type || (!container_type->is_list() && !container_type->is_map()) ||
+        !fs.value_type) {
+        return; // Reported by semantic analysis
+    }
+    bool is_map = container_type->is_map();
+    Type* i32_type = m_types.i32_type();
+
+    push_scope();
+
+    // 1. Evaluate and pin the container
+    ValueId container = gen_expr(fs.iterable);
+    ValueId pin = emit_pinned_copy(container, iter_type);
+    emit_container_pin(pin);
+    StringView pin_name = intern_synthetic_name("__pin", m_next_temp_id++);
+    define_local(pin_name, pin, iter_type);
+    // Not a temporary: nothing may adopt the pin by value, it only ever unpins.
+    m_ownership.track({pin_name, iter_type, current_scope_depth(), false, false,
+                       m_current_block ? m_current_block->id : BlockId::invalid(), pin,
+                       OwnedKind::Pin});
+
+    // 2. Loop bound, fixed by the pin
+    ValueId end = is_map ? emit_native("__map_iter_capacity"_sv, {pin}, i32_type)
+                         : emit_native(list_len_native(iter_type), {pin}, i32_type);
+
+    // 3. Collect variables assigned in the loop body
+    Vector<StringView> modified_vars;
+    collect_assigned_vars(fs.body, modified_vars);
+
+    IRBlock* header_block = create_block("forin");
+    IRBlock* body_block = create_block("forinbody");
+    IRBlock* incr_block = create_block("forininc");
+    IRBlock* exit_block = create_block("endforin");
+
+    // 4. Header params: the cursor first, then the modified vars
+    ValueId cursor = m_current_func->new_value();
+    header_block->params.push_back({cursor, i32_type, "__cursor"_sv});
+    Vector<BlockArgPair> initial_args;
+    initial_args.push_back({emit_const_int(0, i32_type)});
+
+    Vector<LoopVarInfo> loop_vars;
+    for (const auto& name : modified_vars) {
+        LocalVar* lv = find_local(name);
+        if (lv && lv->value.is_valid()) {
+            ValueId param = m_current_func->new_value();
+            header_block->params.push_back({param, lv->type, name});
+            loop_vars.push_back({name, lv->type, param, lv->value});
+            initial_args.push_back({lv->value});
+        }
+    }
+    add_loop_merge_params(exit_block, incr_block, loop_vars);
+    finish_block_goto(header_block->id, alloc_span(initial_args));
+
+    // 5. Header: find the next position and test it against the bound
+    set_current_block(header_block);
+    for (const auto& lv : loop_vars) {
+        define_local(lv.name, lv.header_param, lv.type);
+    }
+    ValueId pos = is_map ? emit_map_iter(IROp::MapIterNext, pin, cursor, i32_type) : cursor;
+    ValueId cond = emit_binary(IROp::LtI, pos, end, m_types.bool_type());
+    finish_block_branch(cond, body_block->id, exit_block->id, {}, make_loop_args(loop_vars));
+
+    // 6. Body: bind the element(s) in their own scope, then the user body
+    u32 for_scope_depth = current_scope_depth();
+    m_loop_stack.push_back({header_block, exit_block, incr_block, loop_vars, for_scope_depth});
+
+    set_current_block(body_block);
+    push_scope();
+    if (is_map) {
+        ValueId key = emit_map_iter(IROp::MapIterKey, pin, pos, fs.key_type);
+        bind_for_in_element(fs.key_name, key, fs.key_type);
+        ValueId value = emit_map_iter(IROp::MapIterValue, pin, pos, fs.value_type);
+        bind_for_in_element(fs.value_name, value, fs.value_type);
+    } else {
+        ValueId elem = emit_index_get(pin, pos, list_container_kind(iter_type), fs.value_type);
+        bind_for_in_element(fs.value_name, elem, fs.value_type);
+    }
+    gen_stmt(fs.body);
+    pop_scope();
+    if (m_current_block && m_current_block->terminator.kind == TerminatorKind::None) {
+        finish_block_goto(incr_block->id, make_loop_args(m_loop_stack.back().loop_vars));
+    }
+
+    // 7. Increment: advance past `pos` and loop
+    set_current_block(incr_block);
+    for (const auto& lv : m_loop_stack.back().loop_vars) {
+        define_local(lv.name, lv.continue_param, lv.type);
+    }
+    ValueId next = emit_binary(IROp::AddI, pos, emit_const_int(1, i32_type), i32_type);
+    Vector<BlockArgPair> back_args;
+    back_args.push_back({next});
+    for (const auto& arg : make_loop_args(m_loop_stack.back().loop_vars)) {
+        back_args.push_back(arg);
+    }
+    finish_block_goto(header_block->id, alloc_span(back_args));
+
+    Vector<LoopVarInfo> saved_loop_vars = m_loop_stack.back().loop_vars; // copy, not move
+    m_loop_stack.pop_back();
+
+    // 8. Exit block: its params are the final values; closing the loop scope
+    // here releases the pin on the fall-through and `break` paths alike.
+    set_current_block(exit_block);
+    for (const auto& slv : saved_loop_vars) {
+        define_local(slv.name, slv.exit_param, slv.type);
+    }
+    pop_scope();
+}
+
 void IRBuilder::gen_return_stmt(Stmt* stmt) {
     ReturnStmt& rs = stmt->return_stmt;
 
@@ -970,8 +1143,8 @@ void IRBuilder::gen_break_stmt(Stmt*) {
     // Emit cleanup for scopes inside the loop
     emit_scope_cleanup(loop.scope_depth + 1);
 
-    // Exit block doesn't have parameters - it uses header params
-    finish_block_goto(loop.exit_block->id);
+    // The exit block takes the loop vars as they are here, mid-body
+    finish_block_goto(loop.exit_block->id, make_loop_args(loop.loop_vars));
 }
 
 void IRBuilder::gen_continue_stmt(Stmt*) {
@@ -983,16 +1156,9 @@ void IRBuilder::gen_continue_stmt(Stmt*) {
     // Emit cleanup for scopes inside the loop body
     emit_scope_cleanup(loop.scope_depth + 1);
 
-    // For while loops: continue_block == header_block, needs args
-    // For for loops: continue_block == incr_block, no args needed
-    if (loop.continue_block == loop.header_block) {
-        // While loop - pass current values to header
-        Span<BlockArgPair> args = make_loop_args(loop.loop_vars);
-        finish_block_goto(loop.continue_block->id, args);
-    } else {
-        // For loop - just jump to increment block (no args)
-        finish_block_goto(loop.continue_block->id);
-    }
+    // Both continue targets (a while's header, a for's increment block) take
+    // the loop vars as params
+    finish_block_goto(loop.continue_block->id, make_loop_args(loop.loop_vars));
 }
 
 void IRBuilder::gen_delete_stmt(Stmt* stmt) {
@@ -1326,12 +1492,12 @@ void IRBuilder::gen_yield_stmt(Stmt* stmt) {
     Vector<StringView> live_names;
     Vector<ValueId> live_values;
     Vector<Type*> live_types;
-    for (auto& scope : m_local_scopes) {
-        for (auto& [name, local] : scope) {
-            live_names.push_back(name);
-            live_values.push_back(local.value);
-            live_types.push_back(local.type);
-        }
+    Vector<u32> live_slots;
+    collect_live_slots(live_slots);
+    for (u32 slot : live_slots) {
+        live_names.push_back(m_local_slot_names[slot]);
+        live_values.push_back(m_local_slots[slot].value);
+        live_types.push_back(m_local_slots[slot].type);
     }
 
     // Create a resume block with block parameters for each live local
@@ -1477,7 +1643,7 @@ void IRBuilder::gen_try_stmt(Stmt* stmt) {
         // compile-time concrete type, so it frees the memory type-erased.
         Type* owned_exc_type = clause.resolved_type ? m_types.uniq_type(clause.resolved_type)
                                                     : m_types.exception_ref_type();
-        u32 catch_scope_depth = static_cast<u32>(m_local_scopes.size());
+        u32 catch_scope_depth = current_scope_depth();
         BlockId catch_owned_block = m_current_block ? m_current_block->id : BlockId::invalid();
         m_ownership.track({clause.var_name, owned_exc_type, catch_scope_depth, false, false,
                            catch_owned_block, exc_param.value, OwnedKind::Owned});
@@ -1665,7 +1831,7 @@ void IRBuilder::gen_var_decl(Decl* decl) {
         // that must adopt the temporary, or both would destroy it.
         consume_temp_noncopyable(value, TempAdoption::ByDeclaration);
 
-        u32 scope_depth = static_cast<u32>(m_local_scopes.size());
+        u32 scope_depth = current_scope_depth();
         BlockId current_block_id = m_current_block ? m_current_block->id : BlockId::invalid();
         m_ownership.track(
             {var_decl.name, type, scope_depth, false, false, current_block_id, value});
@@ -1689,7 +1855,7 @@ void IRBuilder::gen_var_decl(Decl* decl) {
         // other source (a uniq / ref identifier, a borrowed subscript, `ref x`)
         // is a fresh borrow alongside the still-live source, so it increments.
         acquire_ref_borrow(value, var_decl.initializer);
-        u32 scope_depth = static_cast<u32>(m_local_scopes.size());
+        u32 scope_depth = current_scope_depth();
         BlockId current_block_id = m_current_block ? m_current_block->id : BlockId::invalid();
         // `ref x` lowers to a Copy of the borrowed pointer, and this local's
         // cleanup keys on that Copy's ValueId — the scope-exit `Nullify` names
@@ -1706,7 +1872,7 @@ void IRBuilder::gen_var_decl(Decl* decl) {
         // fresh producer temp (count transfers) or retain an existing owner, then
         // track as a StrOwn local so it's released on every exit path.
         consume_or_retain_string(value, type, TempAdoption::ByDeclaration);
-        u32 scope_depth = static_cast<u32>(m_local_scopes.size());
+        u32 scope_depth = current_scope_depth();
         BlockId current_block_id = m_current_block ? m_current_block->id : BlockId::invalid();
         m_ownership.track({var_decl.name, type, scope_depth, false, false, current_block_id, value,
                            OwnedKind::StrOwn});
@@ -1750,6 +1916,8 @@ bool IRBuilder::stmt_contains_yield(Stmt* stmt) {
             return stmt_contains_yield(stmt->while_stmt.body);
         case AstKind::StmtFor:
             return stmt_contains_yield(stmt->for_stmt.body);
+        case AstKind::StmtForIn:
+            return stmt_contains_yield(stmt->for_in_stmt.body);
         case AstKind::StmtWhen: {
             WhenStmt& when_stmt = stmt->when_stmt;
             for (auto& when_case : when_stmt.cases) {
@@ -1802,18 +1970,19 @@ bool IRBuilder::stmt_contains_yield(Stmt* stmt) {
 // struct is unaffected either way: promoted variables come from the *yield's*
 // live set, not from loop headers.
 void IRBuilder::collect_live_locals(Vector<StringView>& out) {
-    for (auto& scope : m_local_scopes) {
-        for (auto& [name, local] : scope) {
-            bool already_present = false;
-            for (const auto& existing : out) {
-                if (existing == name) {
-                    already_present = true;
-                    break;
-                }
+    Vector<u32> live_slots;
+    collect_live_slots(live_slots);
+    for (u32 slot : live_slots) {
+        StringView name = m_local_slot_names[slot];
+        bool already_present = false;
+        for (const auto& existing : out) {
+            if (existing == name) {
+                already_present = true;
+                break;
             }
-            if (!already_present)
-                out.push_back(name);
         }
+        if (!already_present)
+            out.push_back(name);
     }
 }
 
@@ -1863,6 +2032,10 @@ void IRBuilder::collect_assigned_vars_impl(Stmt* stmt, Vector<StringView>& out)
             collect_assigned_vars_impl(stmt->for_stmt.body, out);
             collect_assigned_vars_expr_impl(stmt->for_stmt.increment, out);
             break;
+        case AstKind::StmtForIn:
+            collect_assigned_vars_expr_impl(stmt->for_in_stmt.iterable, out);
+            collect_assigned_vars_impl(stmt->for_in_stmt.body, out);
+            break;
         case AstKind::StmtWhen: {
             WhenStmt& ws = stmt->when_stmt;
             for (auto& when_case : ws.cases) {
@@ -1974,6 +2147,18 @@ void IRBuilder::collect_assigned_vars_expr_impl(Expr* expr, Vector<StringView>&
     }
 }
 
+void IRBuilder::add_loop_merge_params(IRBlock* exit_block, IRBlock* incr_block,
+                                      Vector<LoopVarInfo>& loop_vars) {
+    for (auto& lv : loop_vars) {
+        lv.exit_param = m_current_func->new_value();
+        exit_block->params.push_back({lv.exit_param, lv.type, lv.name});
+        if (incr_block) {
+            lv.continue_param = m_current_func->new_value();
+            incr_block->params.push_back({lv.continue_param, lv.type, lv.name});
+        }
+    }
+}
+
 Span<BlockArgPair> IRBuilder::make_loop_args(const Vector<LoopVarInfo>& loop_vars) {
     if (loop_vars.empty())
         return {};
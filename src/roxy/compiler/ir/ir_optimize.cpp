@@ -16,6 +16,7 @@ bool has_side_effect(IROp op) {
         case IROp::StorePtr:
         case IROp::StructCopy:
         case IROp::IndexSet:
+        case IROp::SimdStore:
         // Reference counting
         case IROp::RefInc:
         case IROp::RefDec:
@@ -63,6 +64,24 @@ Vector<u32> compute_use_counts(IRFunction* func) {
     return counts;
 }
 
+// Point every entry of a value substitution table directly at the root of its
+// chain, so a single subst[v] lookup resolves it. Path halving alone is not
+// enough: compressing v5 -> v8 -> v11 -> v13 with halving leaves v5 -> v11,
+// and a one-step rewrite would then name a value (here a merged-away block
+// param) that no longer has a definition.
+static void flatten_substitutions(Vector<u32>& subst) {
+    for (u32 i = 0; i < subst.size(); i++) {
+        u32 root = i;
+        while (subst[root] != root)
+            root = subst[root];
+        for (u32 id = i; subst[id] != root;) {
+            u32 next = subst[id];
+            subst[id] = root;
+            id = next;
+        }
+    }
+}
+
 bool run_dce(IRFunction* func) {
     const u32 N = func->next_value_id;
     Vector<u32> use_counts = compute_use_counts(func);
@@ -186,16 +205,8 @@ bool run_copy_propagation(IRFunction* func) {
         subst[i] = inst->unary.id;
     }
 
-    // Pass 2: path compression with halving.
-    auto find = [&](u32 id) -> u32 {
-        while (subst[id] != id) {
-            subst[id] = subst[subst[id]];
-            id = subst[id];
-        }
-        return id;
-    };
-    for (u32 i = 0; i < N; i++)
-        (void)find(i);
+    // Pass 2: collapse chains (a Copy of a Copy) to their root source.
+    flatten_substitutions(subst);
 
     // Pass 3: rewrite all operands and terminator operands.
     bool changed = false;
@@ -430,18 +441,10 @@ bool run_block_merging(IRFunction* func, PredecessorMap& preds) {
         }
 
         if (!subst.empty()) {
-            // Path-compress so chains (param -> param -> value) collapse.
-            // Dominance makes cycles impossible: each param maps to a value
-            // defined strictly above it.
-            auto find = [&](u32 id) -> u32 {
-                while (subst[id] != id) {
-                    subst[id] = subst[subst[id]];
-                    id = subst[id];
-                }
-                return id;
-            };
-            for (u32 i = 0; i < num_values; i++)
-                (void)find(i);
+            // Collapse chains (param -> param -> value). Dominance makes
+            // cycles impossible: each param maps to a value defined strictly
+            // above it.
+            flatten_substitutions(subst);
 
             auto rewrite = [&](ValueId& v) {
                 if (!v.is_valid() || v.id >= num_values)
@@ -602,16 +605,8 @@ bool run_trivial_block_arg_elim(IRFunction* func, const PredecessorMap& preds) {
     for (const Drop& d : drops)
         subst[d.param_val] = d.common;
 
-    // Path-compress so chains (param -> param -> value) collapse.
-    auto find = [&](u32 id) -> u32 {
-        while (subst[id] != id) {
-            subst[id] = subst[subst[id]];
-            id = subst[id];
-        }
-        return id;
-    };
-    for (u32 i = 0; i < N; i++)
-        (void)find(i);
+    // Collapse chains (param -> param -> value).
+    flatten_substitutions(subst);
 
     // Rewrite operands across the function.
     auto rewrite = [&](ValueId& v) {
@@ -939,16 +934,8 @@ bool run_local_cse(IRFunction* func) {
     for (const Redirect& r : redirects)
         subst[r.from] = r.to;
 
-    // Path-compress to flatten any redirect chains.
-    auto find = [&](u32 id) -> u32 {
-        while (subst[id] != id) {
-            subst[id] = subst[subst[id]];
-            id = subst[id];
-        }
-        return id;
-    };
-    for (u32 i = 0; i < N; i++)
-        (void)find(i);
+    // Flatten any redirect chains.
+    flatten_substitutions(subst);
 
     // Function-wide operand rewrite. Same shape as copy propagation.
     auto rewrite = [&](ValueId& v) {
@@ -465,7 +465,10 @@ bool IRValidator::validate_instruction(IRFunction* func, IRBlock* block, IRInst*
         case IROp::IndexGet:
         case IROp::IndexAddr:
         case IROp::IndexTryAddr:
-        case IROp::IndexSet: {
+        case IROp::IndexSet:
+        case IROp::MapIterNext:
+        case IROp::MapIterKey:
+        case IROp::MapIterValue: {
             if (!value_in_range(inst->index_data.container, next_id)) {
                 report_error_fmt("function '{}' block {}: index op container v{} invalid",
                                  func->name, block->id.id, inst->index_data.container.id);
@@ -484,6 +487,25 @@ bool IRValidator::validate_instruction(IRFunction* func, IRBlock* block, IRInst*
             break;
         }
 
+        // SIMD - operands a/b/c, each optional depending on the lane op
+        case IROp::Simd:
+        case IROp::SimdStore: {
+            ValueId operands[] = {inst->simd.a, inst->simd.b, inst->simd.c};
+            for (ValueId operand : operands) {
+                if (operand.is_valid() && !value_in_range(operand, next_id)) {
+                    report_error_fmt("function '{}' block {}: simd operand v{} invalid",
+                                     func->name, block->id.id, operand.id);
+                    return false;
+                }
+            }
+            if (!inst->simd.a.is_valid()) {
+                report_error_fmt("function '{}' block {}: simd op without operands", func->name,
+                                 block->id.id);
+                return false;
+            }
+            break;
+        }
+
         // Constants, StackAlloc, GlobalAddr, FuncIndex - no operand ValueIds to validate
         case IROp::ConstNull:
         case IROp::ConstBool:
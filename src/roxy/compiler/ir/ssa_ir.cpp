@@ -194,6 +194,16 @@ const char* ir_op_to_string(IROp op) {
             return "container_pin";
         case IROp::ContainerUnpin:
             return "container_unpin";
+        case IROp::MapIterNext:
+            return "map_iter_next";
+        case IROp::MapIterKey:
+            return "map_iter_key";
+        case IROp::MapIterValue:
+            return "map_iter_value";
+        case IROp::Simd:
+            return "simd";
+        case IROp::SimdStore:
+            return "simd_store";
 
         case IROp::BlockArg:
             return "block_arg";
@@ -234,6 +244,92 @@ static void append_string_view(String& out, StringView sv) {
     }
 }
 
+const char* simd_op_to_string(SimdOp op) {
+    switch (op) {
+        case SimdOp::Add:
+            return "add";
+        case SimdOp::Sub:
+            return "sub";
+        case SimdOp::Mul:
+            return "mul";
+        case SimdOp::Div:
+            return "div";
+        case SimdOp::Min:
+            return "min";
+        case SimdOp::Max:
+            return "max";
+        case SimdOp::And:
+            return "and";
+        case SimdOp::Or:
+            return "or";
+        case SimdOp::Xor:
+            return "xor";
+        case SimdOp::CmpEq:
+            return "cmp_eq";
+        case SimdOp::CmpNe:
+            return "cmp_ne";
+        case SimdOp::CmpLt:
+            return "cmp_lt";
+        case SimdOp::CmpLe:
+            return "cmp_le";
+        case SimdOp::Neg:
+            return "neg";
+        case SimdOp::Abs:
+            return "abs";
+        case SimdOp::Sqrt:
+            return "sqrt";
+        case SimdOp::Scale:
+            return "scale";
+        case SimdOp::Splat:
+            return "splat";
+        case SimdOp::Shuffle:
+            return "shuffle";
+        case SimdOp::Select:
+            return "select";
+        case SimdOp::Convert:
+            return "convert";
+        case SimdOp::Hsum:
+            return "hsum";
+        case SimdOp::Dot:
+            return "dot";
+        case SimdOp::Eq:
+            return "eq";
+        case SimdOp::Ne:
+            return "ne";
+        case SimdOp::Load:
+            return "load";
+        case SimdOp::Store:
+            return "store";
+    }
+    return "?";
+}
+
+const char* container_kind_to_string(ContainerKind kind) {
+    switch (kind) {
+        case ContainerKind::List:
+            return "list";
+        case ContainerKind::Array:
+            return "array";
+        case ContainerKind::Map:
+            return "map";
+    }
+    return "?";
+}
+
+const char* simd_kind_to_string(SimdKind kind) {
+    switch (kind) {
+        case SimdKind::F32x4:
+            return "f32x4";
+        case SimdKind::F64x2:
+            return "f64x2";
+        case SimdKind::I32x4:
+            return "i32x4";
+        case SimdKind::None:
+            break;
+    }
+    return "?";
+}
+
 static void append_value_id(String& out, ValueId v) {
     if (!v.is_valid()) {
         append_str(out, "v?");
@@ -552,11 +648,42 @@ void ir_inst_to_string(const IRInst* inst, String& out) {
             append_str(out, "[");
             append_value_id(out, inst->index_data.index);
             append_str(out, "] (");
-            append_str(out, inst->index_data.kind == ContainerKind::List ? "list" : "map");
+            append_str(out, container_kind_to_string(inst->index_data.kind));
             append_str(out, ")");
             break;
         }
 
+        case IROp::MapIterNext:
+        case IROp::MapIterKey:
+        case IROp::MapIterValue:
+            append_str(out, " ");
+            append_value_id(out, inst->index_data.container);
+            append_str(out, ", ");
+            append_value_id(out, inst->index_data.index);
+            break;
+
+        case IROp::Simd:
+        case IROp::SimdStore: {
+            append_str(out, " ");
+            append_str(out, simd_kind_to_string(inst->simd.kind));
+            append_str(out, ".");
+            append_str(out, simd_op_to_string(inst->simd.op));
+            ValueId operands[] = {inst->simd.a, inst->simd.b, inst->simd.c};
+            for (ValueId operand : operands) {
+                if (!operand.is_valid())
+                    continue;
+                append_str(out, " ");
+                append_value_id(out, operand);
+            }
+            if (inst->simd.op == SimdOp::Shuffle) {
+                StaticString<32> tmp;
+                format_to(tmp, " #{}", inst->simd.imm);
+                for (char c : tmp)
+                    out.push_back(c);
+            }
+            break;
+        }
+
         case IROp::IndexSet: {
             append_str(out, " ");
             append_value_id(out, inst->index_data.container);
@@ -565,7 +692,7 @@ void ir_inst_to_string(const IRInst* inst, String& out) {
             append_str(out, "] <- ");
             append_value_id(out, inst->index_data.value);
             append_str(out, " (");
-            append_str(out, inst->index_data.kind == ContainerKind::List ? "list" : "map");
+            append_str(out, container_kind_to_string(inst->index_data.kind));
             append_str(out, ")");
             break;
         }
@@ -817,6 +944,12 @@ void IRFunction::reorder_blocks_rpo() {
     for (u32 i = 0; i < new_block_count; i++) {
         new_blocks.push_back(blocks[rpo_order[i]]);
     }
+    // A dropped block is arena memory nothing reaches again; release the heap
+    // storage of its Vectors, which the arena never frees.
+    for (u32 i = 0; i < num_blocks; i++) {
+        if (!visited[i])
+            blocks[i]->~IRBlock();
+    }
     blocks = static_cast<Vector<IRBlock*>&&>(new_blocks);
 
     // Remap helper
@@ -1212,6 +1212,25 @@ Stmt* Parser::while_statement() {
 Stmt* Parser::for_statement() {
     SourceLocation loc = m_previous.loc;
 
+    // Range form: `for x in list` / `for (k, v) in map`. `in` is a contextual
+    // keyword (matched by text, like `move`/`copy`), so the list form is told
+    // apart by `Identifier in`, and the map form by a trial parse of the
+    // `(k, v) in` prefix — anything else falls back to the C-style clauses.
+    if (check(TokenKind::Identifier)) {
+        return for_in_statement(loc);
+    }
+    if (check(TokenKind::LeftParen)) {
+        SavedState saved = save_state();
+        advance(); // '('
+        bool is_range = match(TokenKind::Identifier) && match(TokenKind::Comma) &&
+                        match(TokenKind::Identifier) && match(TokenKind::RightParen) &&
+                        check(TokenKind::Identifier) && m_current.text() == "in"_sv;
+        restore_state(saved);
+        if (is_range) {
+            return for_in_statement(loc);
+        }
+    }
+
     consume(TokenKind::LeftParen, "expected '(' after 'for'");
     if (m_has_error)
         return nullptr;
@@ -1272,6 +1291,59 @@ Stmt* Parser::for_statement() {
     return stmt;
 }
 
+Stmt* Parser::for_in_statement(SourceLocation loc) {
+    StringView key_name;
+    StringView value_name;
+    if (match(TokenKind::LeftParen)) {
+        key_name = consume(TokenKind::Identifier, "expected key name in 'for (k, v) in'").text();
+        if (m_has_error)
+            return nullptr;
+        consume(TokenKind::Comma, "expected ',' after key name");
+        if (m_has_error)
+            return nullptr;
+        value_name =
+            consume(TokenKind::Identifier, "expected value name in 'for (k, v) in'").text();
+        if (m_has_error)
+            return nullptr;
+        consume(TokenKind::RightParen, "expected ')' after value name");
+        if (m_has_error)
+            return nullptr;
+    } else {
+        value_name = consume(TokenKind::Identifier, "expected loop variable after 'for'").text();
+        if (m_has_error)
+            return nullptr;
+    }
+
+    if (!(check(TokenKind::Identifier) && m_current.text() == "in"_sv)) {
+        report_error("expected 'in' after for loop variable");
+        return nullptr;
+    }
+    advance(); // 'in'
+
+    // Suppress struct literal parsing so that "for x in items { ... }" doesn't
+    // try to parse "items { ... }" as a struct literal.
+    m_suppress_struct_literal = true;
+    Expr* iterable = expression();
+    m_suppress_struct_literal = false;
+    if (m_has_error)
+        return nullptr;
+
+    Stmt* body = statement();
+    if (m_has_error)
+        return nullptr;
+
+    Stmt* stmt = alloc<Stmt>();
+    stmt->kind = AstKind::StmtForIn;
+    stmt->loc = loc;
+    stmt->for_in_stmt.key_name = key_name;
+    stmt->for_in_stmt.value_name = value_name;
+    stmt->for_in_stmt.iterable = iterable;
+    stmt->for_in_stmt.body = body;
+    stmt->for_in_stmt.key_type = nullptr;
+    stmt->for_in_stmt.value_type = nullptr;
+    return stmt;
+}
+
 Stmt* Parser::return_statement() {
     SourceLocation loc = m_previous.loc;
 
@@ -424,8 +424,9 @@ bool GenericCallResolver::unify_type_expr(TypeExpr* pattern, Type* concrete,
         return false;
     }
 
-    // List<T> pattern against List type
-    if (pattern->name == "List" && pattern->type_args.size() == 1 && concrete->is_list()) {
+    // List<T> / Array<T> pattern against the matching List type
+    if (pattern->type_args.size() == 1 && concrete->is_list() &&
+        pattern->name == (concrete->is_array() ? "Array" : "List")) {
         return unify_type_expr(pattern->type_args[0], concrete->list_info.element_type, type_params,
                                bindings);
     }
@@ -62,6 +62,8 @@ static bool stmt_contains_yield(Stmt* stmt) {
         case AstKind::StmtFor:
             return decl_contains_yield(stmt->for_stmt.initializer) ||
                    stmt_contains_yield(stmt->for_stmt.body);
+        case AstKind::StmtForIn:
+            return stmt_contains_yield(stmt->for_in_stmt.body);
         case AstKind::StmtWhen: {
             for (const WhenCase& c : stmt->when_stmt.cases) {
                 for (Decl* d : c.body) {
@@ -121,6 +123,7 @@ static bool stmt_has_direct_break(Stmt* stmt) {
         // Nested loops capture their own `break` — do not descend.
         case AstKind::StmtWhile:
         case AstKind::StmtFor:
+        case AstKind::StmtForIn:
             return false;
         case AstKind::StmtBlock:
             for (Decl* d : stmt->block.declarations) {
@@ -257,6 +260,7 @@ void SemanticAnalyzer::run_declaration_passes(Program* program) {
     // Pass 1.7a: Register builtin exception types (KeyError, IndexError) — after
     // the Exception trait exists, since they implement it.
     register_builtin_exception_types();
+    register_builtin_simd_types();
 
     // Pass 1.8: Register built-in operator trait methods for primitive types
     m_traits.register_primitive_operator_methods();
@@ -268,6 +272,13 @@ void SemanticAnalyzer::run_declaration_passes(Program* program) {
     resolve_type_members(program);
 }
 
+void SemanticAnalyzer::register_builtin_types() {
+    m_traits.register_builtin_traits();
+    register_builtin_exception_types();
+    register_builtin_simd_types();
+    m_traits.register_primitive_operator_methods();
+}
+
 void SemanticAnalyzer::run_body_analysis(Program* program) {
     m_program = program;
     analyze_function_bodies(program);
@@ -1510,6 +1521,21 @@ Type* SemanticAnalyzer::resolve_type_expr(TypeExpr* type_expr) {
             populate_list_methods(base_type);
         }
 
+        // Check for built-in Array<T> type
+        if (!base_type && type_expr->name == "Array") {
+            if (type_expr->type_args.size() != 1) {
+                error(type_expr->loc, "Array requires exactly 1 type argument");
+                return m_types.error_type();
+            }
+            Type* elem = resolve_type_expr(type_expr->type_args[0]);
+            if (elem->is_error())
+                return m_types.error_type();
+            if (!check_array_element_type(type_expr->loc, elem))
+                return m_types.error_type();
+            base_type = m_types.array_type(elem);
+            populate_list_methods(base_type);
+        }
+
         // Check for built-in Coro<T> type
         if (!base_type && type_expr->name == "Coro") {
             if (type_expr->type_args.size() != 1) {
@@ -2197,6 +2223,9 @@ void SemanticAnalyzer::analyze_stmt(Stmt* stmt) {
         case AstKind::StmtFor:
             analyze_for_stmt(stmt);
             break;
+        case AstKind::StmtForIn:
+            analyze_for_in_stmt(stmt);
+            break;
         case AstKind::StmtReturn:
             analyze_return_stmt(stmt);
             break;
@@ -2390,6 +2419,105 @@ void SemanticAnalyzer::analyze_for_stmt(Stmt* stmt) {
     m_symbols.pop_scope();
 }
 
+// Declare one range-loop binding in the current scope. The binding views the
+// element the way `c[i]` does — the `borrowed` transform turns an owning
+// `uniq T` into `ref T` — and the kinds that transform leaves owning (inline
+// move-only structs, nested containers, coroutines, closures) are rejected:
+// binding one would take ownership out of a container that keeps it.
+bool SemanticAnalyzer::declare_for_in_binding(StringView name, Type* elem_type,
+                                              SourceLocation loc, Type*& out_type) {
+    out_type = m_types.borrowed(elem_type);
+    if (out_type->noncopyable()) {
+        auto type_str = m_checker.type_string(elem_type);
+        error_fmt(loc,
+                  "cannot bind '{}' to an element of move-only type '{}' in a for-in loop; "
+                  "iterate by index instead",
+                  name, type_str.data());
+        out_type = m_types.error_type();
+    }
+    if (m_symbols.lookup_local(name)) {
+        error_fmt(loc, "redefinition of '{}'", name);
+        return false;
+    }
+    if (!m_context.check_no_local_shadowing(name, loc)) {
+        return false;
+    }
+    m_symbols.define(SymbolKind::Variable, name, out_type, loc);
+    return true;
+}
+
+void SemanticAnalyzer::analyze_for_in_stmt(Stmt* stmt) {
+    ForInStmt& fs = stmt->for_in_stmt;
+    bool is_map_form = !fs.key_name.empty();
+
+    Type* iter_type = analyze_expr(fs.iterable);
+    Type* container = nullptr;
+    if (iter_type && !iter_type->is_error()) {
+        // The container itself or a `ref` to it; a `weak` handle has to be
+        // upgraded first, like any other use.
+        Type* t = iter_type->kind == TypeKind::Ref ? iter_type->inner_type() : iter_type;
+        if (t->is_list() || t->is_map()) {
+            container = t;
+        } else {
+            auto type_str = m_checker.type_string(iter_type);
+            error_fmt(fs.iterable->loc, "cannot iterate over a value of type '{}'; expected a "
+                                        "List or a Map", type_str.data());
+        }
+    }
+    if (container && container->is_list() && is_map_form) {
+        error(stmt->loc, "'for (k, v) in' needs a Map; iterate a List with 'for x in list'");
+        container = nullptr;
+    } else if (container && container->is_map() && !is_map_form) {
+        error(stmt->loc, "iterating a Map binds a key and a value: 'for (k, v) in map'");
+        container = nullptr;
+    }
+
+    // The container stays pinned while the loop runs (see IRBuilder::gen_for_in_stmt);
+    // a pin held across a suspension would outlive a coroutine dropped mid-loop.
+    if (m_function_context.in_coroutine && stmt_contains_yield(fs.body)) {
+        error(stmt->loc, "'yield' inside a for-in loop is not supported; iterate by index instead");
+    }
+
+    // One scope for the bindings, a loop scope inside it for the body (the
+    // bindings are re-bound on every iteration, never assigned across one).
+    m_symbols.push_scope(ScopeKind::Block);
+
+    Type* elem_error = m_types.error_type();
+    if (is_map_form) {
+        Type* key = container ? container->map_info.key_type : elem_error;
+        Type* value = container ? container->map_info.value_type : elem_error;
+        if (declare_for_in_binding(fs.key_name, key, stmt->loc, fs.key_type)) {
+            declare_for_in_binding(fs.value_name, value, stmt->loc, fs.value_type);
+        }
+    } else {
+        Type* elem = container ? container->list_info.element_type : elem_error;
+        declare_for_in_binding(fs.value_name, elem, stmt->loc, fs.value_type);
+    }
+
+    MoveStateSnapshot pre_loop_states = m_lifetimes.save_move_states();
+
+    // The loop body may execute zero times — see note in analyze_while_stmt.
+    bool pre_loop_terminates = m_lifetimes.branch_terminates();
+
+    m_symbols.push_loop_scope();
+    analyze_stmt(fs.body);
+    m_lifetimes.check_scope_exit_uniq_destructors(m_symbols.current_scope(), stmt->loc);
+    m_symbols.pop_scope();
+
+    m_lifetimes.set_branch_terminates(pre_loop_terminates);
+
+    MoveStateSnapshot post_body_states = m_lifetimes.save_move_states();
+
+    m_lifetimes.check_loop_cross_iteration_moves(fs.body, pre_loop_states, post_body_states,
+                                                 stmt->loc);
+
+    // After loop: merge pre-loop with post-body (loop may execute 0 times)
+    m_lifetimes.restore_move_states(pre_loop_states);
+    m_lifetimes.merge_move_states(post_body_states, pre_loop_states);
+
+    m_symbols.pop_scope();
+}
+
 void SemanticAnalyzer::analyze_return_stmt(Stmt* stmt) {
     ReturnStmt& rs = stmt->return_stmt;
 
@@ -2946,6 +3074,36 @@ bool SemanticAnalyzer::type_implements_printable(Type* type) {
     return m_types.implements_trait(type, m_type_env.printable_type());
 }
 
+bool SemanticAnalyzer::check_list_method_element(SourceLocation loc, Type* list_type,
+                                                 StringView method) {
+    Type* elem = list_type->list_info.element_type;
+    // A template body's element is a type parameter; the per-instantiation
+    // re-analysis checks the concrete type.
+    if (!elem || elem->is_error() || elem->is_type_param())
+        return true;
+    if (method == "sort"_sv || method == "binary_search"_sv) {
+        bool ordered = elem->is_integer() || elem->is_float() || elem->kind == TypeKind::Bool ||
+                       elem->kind == TypeKind::String;
+        if (!ordered) {
+            error_fmt(loc,
+                      "List.{} requires an integer, float, bool or string element, "
+                      "but '{}' has no built-in order; use sort_by with a comparator instead",
+                      method, m_checker.type_string(elem).data());
+            return false;
+        }
+    } else if (method == "fill"_sv && elem->noncopyable()) {
+        error_fmt(loc, "List.fill requires a copyable element type, but '{}' is move-only",
+                  m_checker.type_string(elem).data());
+        return false;
+    } else if (method == "sort_by"_sv && m_types.borrowed(elem)->noncopyable()) {
+        error_fmt(loc,
+                  "List.sort_by cannot pass '{}' elements to a comparator; they are move-only",
+                  m_checker.type_string(elem).data());
+        return false;
+    }
+    return true;
+}
+
 Type* SemanticAnalyzer::default_literal_type(Type* type) {
     if (!type)
         return type;
@@ -3243,6 +3401,13 @@ void SemanticAnalyzer::retype_out_inout_index_arg(CallArg& arg, Type*& arg_type)
     Type* cont = arg.expr->index.object->resolved_type;
     Type* base = cont ? cont->base_type() : nullptr;
     Type* elem = nullptr;
+    if (base && base->is_array()) {
+        // Array elements are packed below slot width, so there is no slot
+        // to lend out; the VM's element-address path is slot-based.
+        error(arg.expr->loc, "an Array element can't be passed as 'inout'/'out'; "
+                             "copy it into a local and store it back");
+        return;
+    }
     if (base && base->is_list())
         elem = base->list_info.element_type;
     else if (base && base->is_map())
@@ -3430,39 +3595,51 @@ void SemanticAnalyzer::populate_container_methods(const char* registry_name, Spa
 void SemanticAnalyzer::populate_list_methods(Type* type) {
     assert(type && type->is_list());
     Type* type_args[] = {type->list_info.element_type};
-    populate_container_methods("List", Span<Type*>(type_args, 1), type, type->list_info.methods,
-                               type->list_info.alloc_native_name, type->list_info.copy_native_name);
+    populate_container_methods(type->is_array() ? "Array" : "List", Span<Type*>(type_args, 1),
+                               type, type->list_info.methods, type->list_info.alloc_native_name,
+                               type->list_info.copy_native_name);
+}
+
+bool SemanticAnalyzer::check_array_element_type(SourceLocation loc, Type* elem) {
+    if (array_element_size(elem) != 0)
+        return true;
+    error_fmt(loc, "Array element type must be bool or a numeric primitive, not '{}'",
+              m_checker.type_string(elem).data());
+    return false;
 }
 
-Type* SemanticAnalyzer::analyze_list_constructor_call(Expr* expr, CallExpr& ce) {
+Type* SemanticAnalyzer::analyze_list_constructor_call(Expr* expr, CallExpr& ce, bool is_array) {
+    const char* name = is_array ? "Array" : "List";
     if (ce.type_args.size() != 1) {
-        error(expr->loc, "List requires exactly 1 type argument");
+        error_fmt(expr->loc, "{} requires exactly 1 type argument", name);
         return m_types.error_type();
     }
     Type* elem_type = resolve_type_expr(ce.type_args[0]);
     if (elem_type->is_error())
         return m_types.error_type();
+    if (is_array && !check_array_element_type(expr->loc, elem_type))
+        return m_types.error_type();
 
-    Type* list_type = m_types.list_type(elem_type);
+    Type* list_type = is_array ? m_types.array_type(elem_type) : m_types.list_type(elem_type);
     populate_list_methods(list_type);
 
     NativeRegistry* registry = get_builtin_registry();
     if (!registry) {
-        error(expr->loc, "no native registry available for List constructor");
+        error_fmt(expr->loc, "no native registry available for {} constructor", name);
         return m_types.error_type();
     }
 
     Type* type_args[] = {elem_type};
     ResolvedConstructor ctor = registry->instantiate_generic_constructor(
-        "List", Span<Type*>(type_args, 1), m_allocator, m_types);
+        name, Span<Type*>(type_args, 1), m_allocator, m_types);
 
     if (ctor.native_name.empty()) {
-        error(expr->loc, "List has no registered constructor");
+        error_fmt(expr->loc, "{} has no registered constructor", name);
         return m_types.error_type();
     }
 
     if (ce.arguments.size() < ctor.min_args || ce.arguments.size() > ctor.param_types.size()) {
-        error_fmt(expr->loc, "List constructor expects {} to {} argument(s) but got {}",
+        error_fmt(expr->loc, "{} constructor expects {} to {} argument(s) but got {}", name,
                   ctor.min_args, ctor.param_types.size(), ce.arguments.size());
         return m_types.error_type();
     }
@@ -3535,6 +3712,127 @@ void SemanticAnalyzer::register_builtin_exception_types() {
     make_exception_type("IndexError"_sv);
 }
 
+void SemanticAnalyzer::register_builtin_simd_types() {
+    // Guard: the TypeEnv persists across modules, so register only once.
+    if (m_type_env.named_type_by_name("f32x4"_sv))
+        return;
+
+    // Each vector is a decl-less 16-byte struct whose lanes are its fields
+    // (x/y/z/w, or x/y for f64x2), so field access, copies, parameters and List
+    // elements all take the ordinary struct paths. What makes it SIMD is the
+    // simd_kind tag: every method, operator and constructor below is intercepted
+    // by the IR builder and lowered to IROp::Simd instead of a call.
+    struct SimdShape {
+        StringView name;
+        SimdKind kind;
+        Type* lane;
+        u32 lanes;
+    };
+    SimdShape shapes[] = {
+        {"f32x4"_sv, SimdKind::F32x4, m_types.f32_type(), 4},
+        {"f64x2"_sv, SimdKind::F64x2, m_types.f64_type(), 2},
+        {"i32x4"_sv, SimdKind::I32x4, m_types.i32_type(), 4},
+    };
+    static const StringView lane_names[] = {"x"_sv, "y"_sv, "z"_sv, "w"_sv};
+
+    Type* types[3];
+    for (u32 t = 0; t < 3; t++) {
+        const SimdShape& shape = shapes[t];
+        Type* type = m_types.struct_type(shape.name, /*decl*/ nullptr, /*module_name*/ StringView());
+        u32 lane_slots = 4 / shape.lanes;
+        Vector<FieldInfo> fields;
+        for (u32 i = 0; i < shape.lanes; i++) {
+            fields.push_back(FieldInfo{lane_names[i], shape.lane, /*is_pub*/ true, i,
+                                       i * lane_slots, lane_slots});
+        }
+        type->struct_info.fields = m_allocator.alloc_span(fields);
+        type->struct_info.slot_count = 4;
+        type->struct_info.members_resolved = true;
+        type->struct_info.simd_kind = shape.kind;
+        derive_struct_move_only(type->struct_info); // primitive lanes: copyable
+        types[t] = type;
+    }
+    Type* mask_type = types[2];
+
+    auto span_of = [&](std::initializer_list<Type*> list) {
+        Vector<Type*> v;
+        for (Type* t : list)
+            v.push_back(t);
+        return m_allocator.alloc_span(v);
+    };
+
+    for (u32 t = 0; t < 3; t++) {
+        const SimdShape& shape = shapes[t];
+        Type* self = types[t];
+        Type* lane = shape.lane;
+        bool is_float = shape.kind != SimdKind::I32x4;
+        Type* bool_type = m_types.bool_type();
+        Span<Type*> none;
+        Span<Type*> one_self = span_of({self});
+        Span<Type*> list_at =
+            span_of({m_types.ref_type(m_types.list_type(lane)), m_types.i32_type()});
+
+        // Self(x, y[, z, w]), Self.splat(v), Self.load(xs, i)
+        Vector<Type*> lane_params;
+        for (u32 i = 0; i < shape.lanes; i++)
+            lane_params.push_back(lane);
+        Vector<ConstructorInfo> ctors;
+        ctors.push_back(ConstructorInfo{StringView(), m_allocator.alloc_span(lane_params), nullptr});
+        ctors.push_back(ConstructorInfo{"splat"_sv, span_of({lane}), nullptr});
+        ctors.push_back(ConstructorInfo{"load"_sv, list_at, nullptr});
+        self->struct_info.constructors = m_allocator.alloc_span(ctors);
+
+        Vector<MethodInfo> methods;
+        // Lane-wise arithmetic; the trait-method names make `+ - * / -x` (and
+        // `& | ^` on i32x4) resolve like any operator-overloading struct.
+        const char* binary[] = {"add", "sub", "mul", "min", "max"};
+        for (const char* name : binary)
+            methods.push_back(make_method(StringView(name), one_self, self));
+        const char* assign[] = {"add_assign", "sub_assign", "mul_assign"};
+        for (const char* name : assign)
+            methods.push_back(make_method(StringView(name), one_self, m_types.void_type()));
+        methods.push_back(make_method("neg"_sv, none, self));
+        methods.push_back(make_method("abs"_sv, none, self));
+        if (is_float) {
+            methods.push_back(make_method("div"_sv, one_self, self));
+            methods.push_back(make_method("div_assign"_sv, one_self, m_types.void_type()));
+            methods.push_back(make_method("sqrt"_sv, none, self));
+            methods.push_back(make_method("scale"_sv, span_of({lane}), self));
+        } else {
+            const char* bitwise[] = {"bit_and", "bit_or", "bit_xor"};
+            for (const char* name : bitwise)
+                methods.push_back(make_method(StringView(name), one_self, self));
+        }
+
+        // Lane masks (all ones / all zeros per lane) for select().
+        const char* compares[] = {"cmp_eq", "cmp_ne", "cmp_lt", "cmp_le", "cmp_gt", "cmp_ge"};
+        for (const char* name : compares)
+            methods.push_back(make_method(StringView(name), one_self, mask_type));
+        methods.push_back(make_method("select"_sv, span_of({mask_type, self}), self));
+
+        // shuffle(i, j[, k, l]): lane selectors, checked to be in-range literals.
+        Vector<Type*> shuffle_params;
+        for (u32 i = 0; i < shape.lanes; i++)
+            shuffle_params.push_back(m_types.i32_type());
+        methods.push_back(
+            make_method("shuffle"_sv, m_allocator.alloc_span(shuffle_params), self));
+
+        methods.push_back(make_method("hsum"_sv, none, lane));
+        methods.push_back(make_method("dot"_sv, one_self, lane));
+        // Whole-vector equality backs `==` / `!=`; there is no ordering.
+        methods.push_back(make_method("eq"_sv, one_self, bool_type));
+        methods.push_back(make_method("ne"_sv, one_self, bool_type));
+        methods.push_back(make_method("store"_sv, list_at, m_types.void_type()));
+        if (shape.kind == SimdKind::F32x4)
+            methods.push_back(make_method("to_i32x4"_sv, none, types[2]));
+        if (shape.kind == SimdKind::I32x4)
+            methods.push_back(make_method("to_f32x4"_sv, none, types[0]));
+        self->struct_info.methods = m_allocator.alloc_span(methods);
+
+        m_type_env.register_named_type(shape.name, self);
+    }
+}
+
 void SemanticAnalyzer::populate_map_methods(Type* type) {
     assert(type && type->is_map());
     Type* type_args[] = {type->map_info.key_type, type->map_info.value_type};
@@ -3798,6 +4096,23 @@ Type* SemanticAnalyzer::analyze_struct_method_call(Expr* expr, CallExpr& ce, Get
     Span<Param> params = method_decl ? method_decl->params : Span<Param>();
     check_call_args(ce.arguments, mi->param_types, params, expr->loc);
 
+    // A SIMD shuffle compiles to an immediate lane pattern, so its selectors
+    // must be integer literals naming an existing lane.
+    if (found_in_type->struct_info.simd_kind != SimdKind::None && ge.name == "shuffle"_sv) {
+        u32 lanes = mi->param_types.size();
+        for (u32 i = 0; i < ce.arguments.size(); i++) {
+            Expr* lane = ce.arguments[i].expr;
+            bool is_lane_literal = lane->kind == AstKind::ExprLiteral &&
+                                   lane->literal.literal_kind == LiteralKind::I32 &&
+                                   lane->literal.int_value >= 0 &&
+                                   lane->literal.int_value < static_cast<i64>(lanes);
+            if (!is_lane_literal) {
+                error_fmt(lane->loc, "shuffle lane must be an integer literal in 0..{}",
+                          lanes - 1);
+            }
+        }
+    }
+
     // Set callee's resolved_type to a function type for IR builder
     ce.callee->resolved_type = build_method_function_type(found_in_type, mi);
 
@@ -4152,6 +4467,13 @@ Type* SemanticAnalyzer::analyze_regular_fun_call(Expr* expr, CallExpr& ce) {
     }
 
     check_call_args(ce.arguments, fti.param_types, params, expr->loc);
+    // A native's signature is resolved by the registry, which never populates
+    // container methods; do it here so `map_file(p).len()` type-checks.
+    Type* ret = fti.return_type ? fti.return_type->base_type() : nullptr;
+    if (ret && ret->is_list())
+        populate_list_methods(ret);
+    else if (ret && ret->is_map())
+        populate_map_methods(ret);
     return fti.return_type;
 }
 
@@ -4177,8 +4499,8 @@ Type* SemanticAnalyzer::analyze_call_expr(Expr* expr) {
         if (m_type_env.generics().is_generic_fun(func_name)) {
             return m_generic_calls.analyze_generic_fun_call(expr, call_expr, func_name);
         }
-        if (func_name == "List") {
-            return analyze_list_constructor_call(expr, call_expr);
+        if (func_name == "List" || func_name == "Array") {
+            return analyze_list_constructor_call(expr, call_expr, func_name == "Array");
         }
         if (func_name == "Map") {
             return analyze_map_constructor_call(expr, call_expr);
@@ -4246,6 +4568,8 @@ Type* SemanticAnalyzer::analyze_call_expr(Expr* expr) {
                                   m_checker.type_string(base_type).data());
                         return m_types.error_type();
                     }
+                    if (!check_list_method_element(expr->loc, base_type, mi->name))
+                        return m_types.error_type();
                     return analyze_builtin_method_call(expr, call_expr, get_expr, obj_type, mi);
                 }
                 error_fmt(expr->loc, "List has no method '{}'", get_expr.name);
@@ -4433,6 +4757,13 @@ Type* SemanticAnalyzer::analyze_constructor_call(Expr* expr, Type* struct_type,
         return m_types.error_type();
     }
 
+    // SIMD vectors have no heap constructor (the IR builder builds them in place).
+    if (is_heap && struct_type_info.simd_kind != SimdKind::None) {
+        error_fmt(expr->loc, "'{}' is a value type and cannot be heap-allocated",
+                  struct_type_info.name);
+        return m_types.error_type();
+    }
+
     // Determine result type based on is_heap flag
     // uniq Type() -> uniq<Type>
     // Type() -> Type (value type, stack-allocated)
@@ -146,8 +146,8 @@ StringView mangle_type_name(BumpAllocator& alloc, Type* type) {
             return StringView(buf, total_len);
         }
         case TypeKind::List: {
-            // List$<elem>
-            StringView prefix = "List";
+            // List$<elem> / Array$<elem>
+            StringView prefix = type->list_info.is_array ? "Array" : "List";
             StringView elem = mangle_type_name(alloc, type->list_info.element_type);
             u32 total_len = prefix.size() + 1 + elem.size();
             char* buf = reinterpret_cast<char*>(alloc.alloc_bytes(total_len + 1, 1));
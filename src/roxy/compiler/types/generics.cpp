@@ -23,6 +23,28 @@ Type* TypeSubstitution::lookup(StringView name) const {
 GenericInstantiator::GenericInstantiator(BumpAllocator& allocator, TypeCache& types)
     : m_allocator(allocator), m_types(types) {}
 
+void GenericInstantiator::clear() {
+    for (GenericStructInstance* inst : m_all_struct_instances) {
+        inst->~GenericStructInstance();
+    }
+    m_generic_funs.clear();
+    m_fun_template_modules.clear();
+    m_generic_structs.clear();
+    m_struct_template_modules.clear();
+    m_generic_struct_methods.clear();
+    m_generic_struct_constructors.clear();
+    m_generic_struct_destructors.clear();
+    m_all_fun_instances.clear();
+    m_all_struct_instances.clear();
+    m_pending_funs.clear();
+    m_pending_structs.clear();
+    m_cross_module_funs.clear();
+    m_fun_instance_cache.clear();
+    m_struct_instance_cache.clear();
+    m_fun_bounds.clear();
+    m_struct_bounds.clear();
+}
+
 void GenericInstantiator::register_generic_fun(StringView name, Decl* decl,
                                                StringView module_name) {
     m_generic_funs[name] = decl;
@@ -484,7 +506,7 @@ TypeExpr* GenericInstantiator::type_to_type_expr(Type* type, SourceLocation loc)
             break;
 
         case TypeKind::List: {
-            result->name = "List";
+            result->name = type->list_info.is_array ? "Array" : "List";
             TypeExpr** args = reinterpret_cast<TypeExpr**>(
                 m_allocator.alloc_bytes(sizeof(TypeExpr*), alignof(TypeExpr*)));
             args[0] = type_to_type_expr(type->list_info.element_type, loc);
@@ -776,6 +798,12 @@ Stmt* GenericInstantiator::clone_stmt(Stmt* stmt, const TypeSubstitution& subst)
             s->for_stmt.increment = clone_expr(stmt->for_stmt.increment, subst);
             s->for_stmt.body = clone_stmt(stmt->for_stmt.body, subst);
             break;
+        case AstKind::StmtForIn:
+            s->for_in_stmt.iterable = clone_expr(stmt->for_in_stmt.iterable, subst);
+            s->for_in_stmt.body = clone_stmt(stmt->for_in_stmt.body, subst);
+            s->for_in_stmt.key_type = nullptr;
+            s->for_in_stmt.value_type = nullptr;
+            break;
         case AstKind::StmtReturn:
             s->return_stmt.value = clone_expr(stmt->return_stmt.value, subst);
             break;
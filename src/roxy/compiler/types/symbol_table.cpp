@@ -9,6 +9,13 @@ SymbolTable::SymbolTable(BumpAllocator& allocator)
     m_current = m_global;
 }
 
+void SymbolTable::release_scopes() {
+    for (Scope* scope = m_current; scope; scope = scope->parent) {
+        scope->symbols = Vector<Symbol*>();
+    }
+    m_current = m_global = nullptr;
+}
+
 Scope* SymbolTable::create_scope(ScopeKind kind) {
     Scope* scope = m_allocator.emplace<Scope>();
     scope->kind = kind;
@@ -60,6 +67,9 @@ void SymbolTable::pop_scope() {
                 m_lookup_cache.erase(sym->name);
             }
         }
+        // The Scope itself stays in the arena (symbols keep pointing at it as
+        // their defining_scope), but nothing reads its symbol list again.
+        symbols = Vector<Symbol*>();
         m_current = m_current->parent;
     }
 }
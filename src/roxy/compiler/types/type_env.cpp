@@ -34,4 +34,44 @@ Type* TypeEnv::type_by_name(StringView name) {
     return named_type_by_name(name);
 }
 
+void TypeEnv::save_checkpoint() {
+    // The builtin trait pointers (m_printable_type, ...) are set once while the
+    // prelude is built and never change afterwards, so they need no snapshot.
+    m_types.save_checkpoint();
+    m_checkpoint_named_types = m_named_types;
+    m_checkpoint_trait_types = m_trait_types;
+
+    Vector<Type*> types;
+    m_types.collect_types(types);
+    for (const auto& [name, type] : m_named_types) {
+        types.push_back(type);
+    }
+    for (const auto& [name, type] : m_trait_types) {
+        types.push_back(type);
+    }
+    m_checkpoint_types.clear();
+    for (Type* type : types) {
+        TypeSnapshot snapshot{type, *type, {}};
+        if (type->kind == TypeKind::Trait) {
+            for (const TraitMethodInfo& method : type->trait_info.methods) {
+                snapshot.trait_methods.push_back(method);
+            }
+        }
+        m_checkpoint_types.push_back(std::move(snapshot));
+    }
+}
+
+void TypeEnv::restore_checkpoint() {
+    m_types.restore_checkpoint();
+    m_named_types = m_checkpoint_named_types;
+    m_trait_types = m_checkpoint_trait_types;
+    for (const TypeSnapshot& snapshot : m_checkpoint_types) {
+        *snapshot.type = snapshot.contents;
+        for (u32 i = 0; i < snapshot.trait_methods.size(); i++) {
+            snapshot.type->trait_info.methods[i] = snapshot.trait_methods[i];
+        }
+    }
+    m_generics.clear();
+}
+
 } // namespace rx
@@ -243,6 +243,7 @@ u64 TypeHash::operator()(const Type* t) const {
         case TypeKind::List:
             // Hash based on element type pointer
             hash ^= reinterpret_cast<u64>(t->list_info.element_type) * 31;
+            hash ^= t->list_info.is_array ? 0x9e3779b97f4a7c15ULL : 0;
             break;
 
         case TypeKind::Map:
@@ -303,7 +304,8 @@ bool TypeEqual::operator()(const Type* a, const Type* b) const {
 
     switch (a->kind) {
         case TypeKind::List:
-            return a->list_info.element_type == b->list_info.element_type;
+            return a->list_info.element_type == b->list_info.element_type &&
+                   a->list_info.is_array == b->list_info.is_array;
 
         case TypeKind::Map:
             return a->map_info.key_type == b->map_info.key_type &&
@@ -368,6 +370,23 @@ TypeCache::TypeCache(BumpAllocator& allocator) : m_allocator(allocator) {
     m_exception_ref = create_primitive(TypeKind::ExceptionRef);
 }
 
+void TypeCache::save_checkpoint() { m_checkpoint_interned = m_interned; }
+
+void TypeCache::restore_checkpoint() { m_interned = m_checkpoint_interned; }
+
+void TypeCache::collect_types(Vector<Type*>& out) const {
+    Type* primitives[] = {m_void,   m_bool, m_i8,    m_i16,  m_i32,         m_i64,
+                          m_u8,     m_u16,  m_u32,   m_u64,  m_f32,         m_f64,
+                          m_string, m_nil,  m_error, m_self, m_int_literal, m_float_literal,
+                          m_exception_ref};
+    for (Type* type : primitives) {
+        out.push_back(type);
+    }
+    for (const auto& [key, type] : m_interned) {
+        out.push_back(type);
+    }
+}
+
 Type* TypeCache::create_primitive(TypeKind kind) {
     Type* type = m_allocator.emplace<Type>();
     type->kind = kind;
@@ -389,6 +408,18 @@ Type* TypeCache::list_type(Type* element_type) {
     type->list_info.element_type = element_type;
     type->list_info.methods = Span<MethodInfo>();
     type->list_info.alloc_native_name = StringView(nullptr, 0);
+    type->list_info.is_array = false;
+
+    return intern_type(type);
+}
+
+Type* TypeCache::array_type(Type* element_type) {
+    Type* type = m_allocator.emplace<Type>();
+    type->kind = TypeKind::List;
+    type->list_info.element_type = element_type;
+    type->list_info.methods = Span<MethodInfo>();
+    type->list_info.alloc_native_name = StringView(nullptr, 0);
+    type->list_info.is_array = true;
 
     return intern_type(type);
 }
@@ -873,6 +904,30 @@ u32 get_type_slot_count(Type* type) {
     }
 }
 
+u32 array_element_size(Type* type) {
+    if (!type)
+        return 0;
+    switch (type->kind) {
+        case TypeKind::Bool:
+        case TypeKind::I8:
+        case TypeKind::U8:
+            return 1;
+        case TypeKind::I16:
+        case TypeKind::U16:
+            return 2;
+        case TypeKind::I32:
+        case TypeKind::U32:
+        case TypeKind::F32:
+            return 4;
+        case TypeKind::I64:
+        case TypeKind::U64:
+        case TypeKind::F64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
 const char* type_kind_to_string(TypeKind kind) {
     switch (kind) {
         case TypeKind::Void:
@@ -981,7 +1036,7 @@ void type_to_string(const Type* type, String& out) {
             break;
 
         case TypeKind::List:
-            append_string(out, "List<");
+            append_string(out, type->list_info.is_array ? "Array<" : "List<");
             type_to_string(type->list_info.element_type, out);
             append_string(out, ">");
             break;
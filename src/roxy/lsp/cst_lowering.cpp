@@ -660,6 +660,8 @@ Stmt* CstLowering::lower_stmt(SyntaxNode* node) {
             return lower_while_stmt(node);
         case SyntaxKind::NodeForStmt:
             return lower_for_stmt(node);
+        case SyntaxKind::NodeForInStmt:
+            return lower_for_in_stmt(node);
         case SyntaxKind::NodeReturnStmt:
             return lower_return_stmt(node);
         case SyntaxKind::NodeWhenStmt:
@@ -830,6 +832,52 @@ Stmt* CstLowering::lower_for_stmt(SyntaxNode* node) {
     return stmt;
 }
 
+Stmt* CstLowering::lower_for_in_stmt(SyntaxNode* node) {
+    Stmt* stmt = alloc<Stmt>();
+    stmt->kind = AstKind::StmtForIn;
+    stmt->loc = make_loc(node);
+    stmt->for_in_stmt.key_name = StringView();
+    stmt->for_in_stmt.value_name = StringView();
+    stmt->for_in_stmt.iterable = nullptr;
+    stmt->for_in_stmt.body = nullptr;
+    stmt->for_in_stmt.key_type = nullptr;
+    stmt->for_in_stmt.value_type = nullptr;
+
+    // For-in CST: 'for', binding(s), 'in', iterable, body. The bindings and
+    // the contextual 'in' are all Identifier tokens: `x in` or `k , v ) in`.
+    SyntaxNode* names[3] = {nullptr, nullptr, nullptr};
+    u32 name_count = 0;
+    u32 part_index = 0;
+    for (u32 i = 0; i < node->children.size(); i++) {
+        SyntaxNode* child = node->children[i];
+        if (child->kind == SyntaxKind::TokenIdentifier) {
+            if (name_count < 3)
+                names[name_count++] = child;
+            continue;
+        }
+        if (child->kind == SyntaxKind::TokenKwFor || child->kind == SyntaxKind::TokenLeftParen ||
+            child->kind == SyntaxKind::TokenComma || child->kind == SyntaxKind::TokenRightParen)
+            continue;
+
+        if (part_index == 0) {
+            stmt->for_in_stmt.iterable = lower_expr(child);
+            part_index++;
+        } else if (part_index == 1) {
+            stmt->for_in_stmt.body = lower_stmt(child);
+            part_index++;
+        }
+    }
+
+    if (name_count == 3) {
+        stmt->for_in_stmt.key_name = names[0]->token.text();
+        stmt->for_in_stmt.value_name = names[1]->token.text();
+    } else if (name_count >= 1) {
+        stmt->for_in_stmt.value_name = names[0]->token.text();
+    }
+
+    return stmt;
+}
+
 Stmt* CstLowering::lower_return_stmt(SyntaxNode* node) {
     Stmt* stmt = alloc<Stmt>();
     stmt->kind = AstKind::StmtReturn;
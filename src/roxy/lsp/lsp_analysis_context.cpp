@@ -177,7 +177,7 @@ String LspAnalysisContext::type_to_string(Type* type) {
         }
 
         case TypeKind::List: {
-            String result("List<");
+            String result(type->list_info.is_array ? "Array<" : "List<");
             String elem = type_to_string(type->list_info.element_type);
             result.append(elem.data(), elem.size());
             result.push_back('>');
@@ -299,6 +299,15 @@ static void collect_vars_from_stmt(Stmt* stmt, tsl::robin_map<String, Type*>& ou
             }
             collect_vars_from_stmt(stmt->for_stmt.body, out);
             break;
+        case AstKind::StmtForIn:
+            if (!stmt->for_in_stmt.key_name.empty() && stmt->for_in_stmt.key_type) {
+                out[String(stmt->for_in_stmt.key_name)] = stmt->for_in_stmt.key_type;
+            }
+            if (!stmt->for_in_stmt.value_name.empty() && stmt->for_in_stmt.value_type) {
+                out[String(stmt->for_in_stmt.value_name)] = stmt->for_in_stmt.value_type;
+            }
+            collect_vars_from_stmt(stmt->for_in_stmt.body, out);
+            break;
         case AstKind::StmtTry:
             collect_vars_from_stmt(stmt->try_stmt.try_body, out);
             for (u32 i = 0; i < stmt->try_stmt.catches.size(); i++) {
@@ -401,6 +410,15 @@ static void collect_names_from_stmt(Stmt* stmt, tsl::robin_set<String>& out) {
             }
             collect_names_from_stmt(stmt->for_stmt.body, out);
             break;
+        case AstKind::StmtForIn:
+            if (!stmt->for_in_stmt.key_name.empty()) {
+                out.insert(String(stmt->for_in_stmt.key_name));
+            }
+            if (!stmt->for_in_stmt.value_name.empty()) {
+                out.insert(String(stmt->for_in_stmt.value_name));
+            }
+            collect_names_from_stmt(stmt->for_in_stmt.body, out);
+            break;
         case AstKind::StmtTry:
             collect_names_from_stmt(stmt->try_stmt.try_body, out);
             for (u32 i = 0; i < stmt->try_stmt.catches.size(); i++) {
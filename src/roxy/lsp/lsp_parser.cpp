@@ -1022,7 +1022,23 @@ SyntaxNode* LspParser::parse_while_stmt() {
 }
 
 SyntaxNode* LspParser::parse_for_stmt() {
-    // 'for' already consumed
+    // 'for' already consumed. Same lookahead as the compiler parser: the range
+    // forms start with `Identifier in` or `(Identifier, Identifier) in`.
+    if (check(TokenKind::Identifier)) {
+        return parse_for_in_stmt();
+    }
+    if (check(TokenKind::LeftParen)) {
+        SavedState saved = save_state();
+        advance(); // '('
+        bool is_range = match(TokenKind::Identifier) && match(TokenKind::Comma) &&
+                        match(TokenKind::Identifier) && match(TokenKind::RightParen) &&
+                        check(TokenKind::Identifier) && m_current.text() == "in"_sv;
+        restore_state(saved);
+        if (is_range) {
+            return parse_for_in_stmt();
+        }
+    }
+
     auto builder = begin_node(SyntaxKind::NodeForStmt);
     builder.children.push_back(make_token_node(m_previous)); // 'for'
 
@@ -1064,6 +1080,49 @@ SyntaxNode* LspParser::parse_for_stmt() {
     return finish_node(builder);
 }
 
+SyntaxNode* LspParser::parse_for_in_stmt() {
+    // 'for' already consumed; the caller has checked the binding shape
+    auto builder = begin_node(SyntaxKind::NodeForInStmt);
+    builder.children.push_back(make_token_node(m_previous)); // 'for'
+
+    if (match(TokenKind::LeftParen)) {
+        builder.children.push_back(make_token_node(m_previous)); // '('
+        Token key = consume_or_synthetic(TokenKind::Identifier, "expected key name");
+        builder.children.push_back(make_token_node(key));
+        Token comma = consume_or_synthetic(TokenKind::Comma, "expected ',' after key name");
+        builder.children.push_back(make_token_node(comma));
+        Token value = consume_or_synthetic(TokenKind::Identifier, "expected value name");
+        builder.children.push_back(make_token_node(value));
+        Token rparen =
+            consume_or_synthetic(TokenKind::RightParen, "expected ')' after value name");
+        builder.children.push_back(make_token_node(rparen));
+    } else {
+        Token element =
+            consume_or_synthetic(TokenKind::Identifier, "expected loop variable after 'for'");
+        builder.children.push_back(make_token_node(element));
+    }
+
+    // `in` is contextual: an Identifier token spelled "in"
+    if (check(TokenKind::Identifier) && m_current.text() == "in"_sv) {
+        advance();
+        builder.children.push_back(make_token_node(m_previous)); // 'in'
+    } else {
+        add_diagnostic(TextRange{m_current.loc.offset, m_current.loc.offset + m_current.length},
+                       "expected 'in' after for loop variable");
+    }
+
+    // `for x in items { ... }` must not read `items { ... }` as a struct literal
+    m_suppress_struct_literal = true;
+    SyntaxNode* iterable = parse_expression();
+    m_suppress_struct_literal = false;
+    builder.children.push_back(iterable);
+
+    SyntaxNode* body = parse_statement();
+    builder.children.push_back(body);
+
+    return finish_node(builder);
+}
+
 SyntaxNode* LspParser::parse_return_stmt() {
     // 'return' already consumed
     auto builder = begin_node(SyntaxKind::NodeReturnStmt);
@@ -1,16 +1,26 @@
 #include "roxy/rt/roxy_rt.h"
 #include "roxy/rt/slab_allocator.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <charconv>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <new>
 
 #define XXH_INLINE_ALL
 #include "roxy/core/xxhash.h"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // ===== Runtime Context =====
 
 // Thread-local pointer to the currently-active context. Each native VM thread
@@ -29,12 +39,38 @@ void roxy_ctx_init(roxy_ctx* ctx) {
     ctx->string_intern = nullptr;
     ctx->exception_state = nullptr;
     ctx->user_data = nullptr;
+    ctx->output_sink = nullptr;
+    ctx->output_userdata = nullptr;
+    ctx->output_buf = nullptr;
+    ctx->output_len = 0;
+    ctx->pool_count = 0;
+    ctx->pools = nullptr;
+}
+
+// Free every object parked in `pool` through `alloc`.
+static void pool_drain(roxy_free_pool* pool, roxy_allocator* alloc) {
+    while (void* data = pool->head) {
+        pool->head = *static_cast<void**>(data);
+        alloc->free(alloc->userdata, roxy_get_header(data));
+    }
+    pool->count = 0;
 }
 
 void roxy_ctx_destroy(roxy_ctx* ctx) {
-    // No owned state to release yet. Defined so the lifecycle pairs with
-    // `roxy_ctx_init` and embedder/host code can call it unconditionally.
-    (void)ctx;
+    if (!ctx)
+        return;
+    roxy_ctx_flush_output(ctx);
+    free(ctx->output_buf);
+    ctx->output_buf = nullptr;
+    // Parked objects came from this context's allocator, which need not be the
+    // active one here.
+    roxy_allocator* alloc = ctx->allocator ? ctx->allocator : &roxy_malloc_allocator;
+    for (uint32_t i = 0; i < ctx->pool_count; i++) {
+        pool_drain(&ctx->pools[i], alloc);
+    }
+    free(ctx->pools);
+    ctx->pools = nullptr;
+    ctx->pool_count = 0;
 }
 
 void roxy_set_ctx(roxy_ctx* ctx) { tls_current_ctx = ctx; }
@@ -292,6 +328,57 @@ roxy_object_header* roxy_get_header(void* data) {
                                                  sizeof(roxy_object_header));
 }
 
+// ===== Free Pools =====
+
+void* roxy_pool_alloc(uint32_t data_size, uint32_t type_id) {
+    roxy_ctx* ctx = roxy_get_ctx();
+    if (!ctx || type_id >= ctx->pool_count || !ctx->pools[type_id].head)
+        return roxy_alloc(data_size, type_id);
+    roxy_free_pool* pool = &ctx->pools[type_id];
+    void* data = pool->head;
+    pool->head = *static_cast<void**>(data);
+    pool->count--;
+    // Reset on reuse: the header is still this type's with no borrows, so only
+    // the generation needs restamping.
+    roxy_get_header(data)->weak_generation = roxy_random_generation();
+    memset(data, 0, data_size);
+    return data;
+}
+
+void roxy_pool_free(void* data) {
+    if (!data)
+        return;
+    auto* header = roxy_get_header(data);
+    roxy_ctx* ctx = roxy_get_ctx();
+    if (!ctx || header->ref_count != 0) {
+        roxy_free(data); // Nowhere to park, or borrowed: roxy_free refuses and reports it
+        return;
+    }
+    uint32_t type_id = header->type_id;
+    if (type_id >= ctx->pool_count) {
+        // First park of this type: grow the table to cover it.
+        void* grown = realloc(ctx->pools, (type_id + 1) * sizeof(roxy_free_pool));
+        if (!grown) {
+            roxy_free(data);
+            return;
+        }
+        ctx->pools = static_cast<roxy_free_pool*>(grown);
+        for (uint32_t i = ctx->pool_count; i <= type_id; i++) {
+            ctx->pools[i] = roxy_free_pool{nullptr, 0, ROXY_FREE_POOL_CAPACITY};
+        }
+        ctx->pool_count = type_id + 1;
+    }
+    roxy_free_pool* pool = &ctx->pools[type_id];
+    if (pool->count >= pool->capacity) {
+        roxy_free(data);
+        return;
+    }
+    header->weak_generation = 0;
+    *static_cast<void**>(data) = pool->head;
+    pool->head = data;
+    pool->count++;
+}
+
 // ===== Reference Counting =====
 
 void roxy_ref_inc(void* data) {
@@ -368,6 +455,50 @@ void roxy_string_release(void* s) {
         roxy_free(s);
 }
 
+// The cached 32-bit form of a full XXH3_64 string hash: the low bits, moved
+// off the "not computed yet" sentinel.
+static inline uint32_t string_hash_fold(uint64_t full) {
+    uint32_t h = static_cast<uint32_t>(full);
+    return h == ROXY_STR_HASH_UNSET ? 1u : h;
+}
+
+// A string's hash, computed on first use and cached in the header. Most
+// temporaries are never hashed, so none of them pay for the pass up front.
+static inline uint32_t string_cached_hash(void* s) {
+    auto* hdr = string_hdr(s);
+    if (hdr->hash == ROXY_STR_HASH_UNSET)
+        hdr->hash = string_hash_fold(XXH3_64bits(roxy_string_chars(s), hdr->length));
+    return hdr->hash;
+}
+
+// NUL-terminate a string whose bytes are in place. The hash is left unset
+// until something asks for it (string_cached_hash).
+static void string_seal(void* s) {
+    auto* hdr = string_hdr(s);
+    char* chars = reinterpret_cast<char*>(static_cast<uint8_t*>(s) + sizeof(roxy_string_header));
+    // In bounds by construction: the allocation is header + length + 1, and the
+    // allocators reject a length that would wrap that sum. The checker is
+    // taint-based and flags the index regardless.
+    // NOLINTNEXTLINE(clang-analyzer-security.ArrayBound)
+    chars[hdr->length] = '\0';
+    hdr->hash = ROXY_STR_HASH_UNSET;
+}
+
+// An owned (count 1) string of `length` bytes for the caller to write in place
+// through roxy_string_chars, then string_seal. Lets a producer that knows its
+// size up front skip the temp buffer roxy_string_new_owned would copy from.
+static void* string_alloc_uninit(uint32_t length) {
+    const uint32_t header_size = static_cast<uint32_t>(sizeof(roxy_string_header));
+    if (length > UINT32_MAX - header_size - 1)
+        return nullptr;
+    void* s = roxy_alloc(header_size + length + 1, ROXY_TYPEID_STRING);
+    if (!s)
+        return nullptr;
+    roxy_get_header(s)->ref_count = 1u;
+    string_hdr(s)->length = length;
+    return s;
+}
+
 // Shared allocation core for both string constructors. `immortal` selects the
 // literal (interned, IMMORTAL) vs dynamic (fresh, owned, count 1) policy.
 static void* roxy_string_alloc_impl(const char* data, uint32_t length, bool immortal) {
@@ -377,8 +508,10 @@ static void* roxy_string_alloc_impl(const char* data, uint32_t length, bool immo
     // intern entry (finding 9b).
     roxy_ctx* ctx = roxy_get_ctx();
     void* intern = immortal && ctx ? ctx->string_intern : nullptr;
+    uint64_t intern_hash = 0;
     if (intern && data && length > 0) {
-        if (void* existing = roxy_string_intern_lookup(intern, data, length)) {
+        intern_hash = XXH3_64bits(data, length);
+        if (void* existing = roxy_string_intern_lookup(intern, data, length, intern_hash)) {
             return existing; // already immortal
         }
     }
@@ -398,29 +531,19 @@ static void* roxy_string_alloc_impl(const char* data, uint32_t length, bool immo
 
     // roxy_alloc zero-inits ref_count; set the owner count / immortal sentinel.
     roxy_get_header(s)->ref_count = immortal ? ROXY_STR_IMMORTAL : 1u;
+    string_hdr(s)->length = length;
 
-    auto* hdr = string_hdr(s);
-    hdr->length = length;
-
-    char* chars =
-        reinterpret_cast<char*>(reinterpret_cast<uint8_t*>(s) + sizeof(roxy_string_header));
+    char* chars = roxy_string_chars(s);
     if (length > 0) {
         memcpy(chars, data, length);
     }
-    // In bounds by construction: the allocation is header + length + 1, and the
-    // overflow guard above rejects a length that would wrap that sum. The
-    // checker is taint-based and flags the index regardless.
-    // NOLINTNEXTLINE(clang-analyzer-security.ArrayBound)
-    chars[length] = '\0';
-
-    // Cache a 32-bit hash over the character bytes so `Map<string, V>`
-    // lookups (and `roxy_string_hash`) don't walk the string on every op.
-    // Low 32 bits of XXH3_64 — matches the VM's vm/string.cpp behaviour.
-    hdr->hash = static_cast<uint32_t>(XXH3_64bits(chars, length));
+    string_seal(s);
 
     // Register the new literal in the intern table. The key's char range
-    // is the object's own chars (stable for the object's lifetime).
+    // is the object's own chars (stable for the object's lifetime). The probe
+    // already hashed the bytes, so the literal starts with its hash cached.
     if (intern && data && length > 0) {
+        string_hdr(s)->hash = string_hash_fold(intern_hash);
         roxy_string_intern_insert(intern, chars, length, s);
     }
     return s;
@@ -440,23 +563,122 @@ char* roxy_string_chars(void* s) {
 
 int32_t roxy_string_len(void* s) { return static_cast<int32_t>(string_hdr(s)->length); }
 
+// ===== Output channel =====
+
+static void output_emit(roxy_ctx* ctx, const char* data, uint32_t length) {
+    if (length == 0)
+        return;
+    if (ctx && ctx->output_sink)
+        ctx->output_sink(ctx->output_userdata, data, length);
+    else
+        fwrite(data, 1, length, stdout);
+}
+
+void roxy_ctx_flush_output(roxy_ctx* ctx) {
+    if (!ctx || ctx->output_len == 0)
+        return;
+    uint32_t length = ctx->output_len;
+    ctx->output_len = 0; // before the sink, so a sink that prints can't recurse into it
+    output_emit(ctx, ctx->output_buf, length);
+    if (!ctx->output_sink)
+        fflush(stdout);
+}
+
+void roxy_ctx_set_output_sink(roxy_ctx* ctx, roxy_output_sink sink, void* userdata) {
+    if (!ctx)
+        return;
+    roxy_ctx_flush_output(ctx);
+    ctx->output_sink = sink;
+    ctx->output_userdata = userdata;
+}
+
+void roxy_output_write(const char* data, uint32_t length) {
+    roxy_ctx* ctx = roxy_get_ctx();
+    if (!ctx) {
+        fwrite(data, 1, length, stdout);
+        return;
+    }
+    if (!ctx->output_buf) {
+        ctx->output_buf = static_cast<char*>(malloc(ROXY_OUTPUT_BUFFER_SIZE));
+        if (!ctx->output_buf) {
+            output_emit(ctx, data, length);
+            return;
+        }
+    }
+    if (ctx->output_len + length > ROXY_OUTPUT_BUFFER_SIZE) {
+        roxy_ctx_flush_output(ctx);
+        if (length > ROXY_OUTPUT_BUFFER_SIZE) {
+            output_emit(ctx, data, length);
+            return;
+        }
+    }
+    memcpy(ctx->output_buf + ctx->output_len, data, length);
+    ctx->output_len += length;
+}
+
+void roxy_output_flush(void) { roxy_ctx_flush_output(roxy_get_ctx()); }
+
+// Decimal digits of `v`, written backwards ending at `end`. Returns the first
+// digit. Two digits per division; `end` needs 20 bytes in front of it.
+static char* format_u64(char* end, uint64_t v) {
+    static const char k_pairs[] = "00010203040506070809101112131415161718192021222324"
+                                  "25262728293031323334353637383940414243444546474849"
+                                  "50515253545556575859606162636465666768697071727374"
+                                  "75767778798081828384858687888990919293949596979899";
+    char* p = end;
+    while (v >= 100) {
+        uint32_t pair = static_cast<uint32_t>(v % 100) * 2;
+        v /= 100;
+        *--p = k_pairs[pair + 1];
+        *--p = k_pairs[pair];
+    }
+    if (v >= 10) {
+        *--p = k_pairs[v * 2 + 1];
+        *--p = k_pairs[v * 2];
+    } else {
+        *--p = static_cast<char>('0' + v);
+    }
+    return p;
+}
+
+static void print_u64_line(uint64_t v, bool negative) {
+    char buf[24];
+    buf[23] = '\n';
+    char* p = format_u64(buf + 23, v);
+    if (negative)
+        *--p = '-';
+    roxy_output_write(p, static_cast<uint32_t>(buf + 24 - p));
+}
+
+static void print_i64_line(int64_t v) {
+    // Negate in unsigned so INT64_MIN doesn't overflow.
+    uint64_t magnitude = v < 0 ? 0 - static_cast<uint64_t>(v) : static_cast<uint64_t>(v);
+    print_u64_line(magnitude, v < 0);
+}
+
 void roxy_print(void* s) {
     if (!s) {
-        printf("nil\n");
+        roxy_output_write("nil\n", 4);
         return;
     }
-    printf("%s\n", roxy_string_chars(s));
+    roxy_output_write(roxy_string_chars(s), string_hdr(s)->length);
+    roxy_output_write("\n", 1);
 }
 
 // Per-type print overloads — formats match the roxy_*_to_string functions so
 // print(x) and print(f"{x}") produce identical output.
-void roxy_print_bool(bool v) { printf("%s\n", v ? "true" : "false"); }
-void roxy_print_i32(int32_t v) { printf("%d\n", v); }
-void roxy_print_i64(int64_t v) { printf("%lld\n", (long long)v); }
-void roxy_print_u32(uint32_t v) { printf("%u\n", v); }
-void roxy_print_u64(uint64_t v) { printf("%llu\n", (unsigned long long)v); }
-void roxy_print_f32(float v) { printf("%g\n", (double)v); }
-void roxy_print_f64(double v) { printf("%g\n", v); }
+void roxy_print_bool(bool v) { roxy_output_write(v ? "true\n" : "false\n", v ? 5 : 6); }
+void roxy_print_i32(int32_t v) { print_i64_line(v); }
+void roxy_print_i64(int64_t v) { print_i64_line(v); }
+void roxy_print_u32(uint32_t v) { print_u64_line(v, false); }
+void roxy_print_u64(uint64_t v) { print_u64_line(v, false); }
+void roxy_print_f32(float v) { roxy_print_f64(static_cast<double>(v)); }
+void roxy_print_f64(double v) {
+    char buf[40];
+    char* end = std::to_chars(buf, buf + sizeof(buf) - 1, v, std::chars_format::general, 6).ptr;
+    *end++ = '\n';
+    roxy_output_write(buf, static_cast<uint32_t>(end - buf));
+}
 
 void* roxy_string_concat(void* a, void* b) {
     uint32_t len_a = string_hdr(a)->length;
@@ -467,22 +689,15 @@ void* roxy_string_concat(void* a, void* b) {
     if (total > UINT32_MAX)
         return nullptr;
 
-    // Build the concatenated bytes in a temp buffer so `roxy_string_from_literal`
-    // can dedup against the intern table. Short cases use the stack; longer
-    // ones take a one-shot malloc.
-    char stack_buf[256];
-    char* buf = (total < sizeof(stack_buf)) ? stack_buf : static_cast<char*>(malloc(total + 1));
-    if (!buf)
+    // Dynamic strings aren't interned, so both halves go straight into the
+    // result's own bytes.
+    void* result = string_alloc_uninit(static_cast<uint32_t>(total));
+    if (!result)
         return nullptr;
-
-    memcpy(buf, roxy_string_chars(a), len_a);
-    memcpy(buf + len_a, roxy_string_chars(b), len_b);
-    buf[total] = '\0';
-
-    void* result = roxy_string_new_owned(buf, static_cast<uint32_t>(total));
-
-    if (buf != stack_buf)
-        free(buf);
+    char* chars = roxy_string_chars(result);
+    memcpy(chars, roxy_string_chars(a), len_a);
+    memcpy(chars + len_a, roxy_string_chars(b), len_b);
+    string_seal(result);
     return result;
 }
 
@@ -493,6 +708,12 @@ bool roxy_string_eq(void* a, void* b) {
     uint32_t len_b = string_hdr(b)->length;
     if (len_a != len_b)
         return false;
+    // Two hashes already cached (map keys, interned literals) that differ
+    // settle it without touching the bytes. Never computes one.
+    uint32_t hash_a = string_hdr(a)->hash;
+    uint32_t hash_b = string_hdr(b)->hash;
+    if (hash_a != ROXY_STR_HASH_UNSET && hash_b != ROXY_STR_HASH_UNSET && hash_a != hash_b)
+        return false;
     return memcmp(roxy_string_chars(a), roxy_string_chars(b), len_a) == 0;
 }
 
@@ -521,7 +742,65 @@ void* roxy_string_substr(void* s, int32_t start, int32_t len) {
 
 double roxy_string_to_f64(void* s) {
     assert(s && "str_to_f64: null string");
-    return strtod(roxy_string_chars(s), nullptr);
+    // Lenient like the strtod it replaces (hex floats aside): leading whitespace
+    // and trailing text are ignored and no number at all reads as 0.
+    const char* p = roxy_string_chars(s);
+    const char* end = p + string_hdr(s)->length;
+    while (p < end && (*p == ' ' || (*p >= '\t' && *p <= '\r')))
+        p++;
+    if (p < end && *p == '+')
+        p++;
+    double val = 0.0;
+    auto res = std::from_chars(p, end, val);
+    if (res.ec == std::errc::result_out_of_range)
+        return strtod(p, nullptr); // +-inf or a denormal/zero, as strtod gives
+    return res.ec == std::errc() ? val : 0.0;
+}
+
+// Strict parse of the whole string: an optional sign, then digits (or a float
+// literal for F). No whitespace, nothing after the number.
+template <typename T>
+static bool parse_whole(void* s, T* out) {
+    const char* p = roxy_string_chars(s);
+    const char* end = p + string_hdr(s)->length;
+    // from_chars takes '-' but not '+'; a second sign must still fail.
+    if (p < end && *p == '+' && p + 1 < end && p[1] != '-')
+        p++;
+    auto res = std::from_chars(p, end, *out);
+    return res.ec == std::errc() && res.ptr == end && p != end;
+}
+
+int64_t roxy_string_to_i64(void* s) {
+    int64_t val = 0;
+    if (!parse_whole(s, &val)) {
+        roxy_runtime_error_set("str_to_i64: not an integer in range");
+        return 0;
+    }
+    return val;
+}
+
+int32_t roxy_string_to_i32(void* s) {
+    int32_t val = 0;
+    if (!parse_whole(s, &val)) {
+        roxy_runtime_error_set("str_to_i32: not an integer in range");
+        return 0;
+    }
+    return val;
+}
+
+int64_t roxy_string_to_i64_or(void* s, int64_t fallback) {
+    int64_t val = 0;
+    return parse_whole(s, &val) ? val : fallback;
+}
+
+int32_t roxy_string_to_i32_or(void* s, int32_t fallback) {
+    int32_t val = 0;
+    return parse_whole(s, &val) ? val : fallback;
+}
+
+double roxy_string_to_f64_or(void* s, double fallback) {
+    double val = 0.0;
+    return parse_whole(s, &val) ? val : fallback;
 }
 
 void* roxy_string_from_code(int32_t code) {
@@ -529,6 +808,212 @@ void* roxy_string_from_code(int32_t code) {
     return roxy_string_new_owned(&ch, 1);
 }
 
+// ===== Search, split and join =====
+
+// First occurrence of needle[0, needle_len) in hay[0, hay_len), or null. memchr
+// (SIMD in every libc we ship against) skips to each candidate first byte, so
+// only those positions pay for the memcmp of the rest.
+static const char* string_search(const char* hay, uint32_t hay_len, const char* needle,
+                                 uint32_t needle_len) {
+    if (needle_len == 0)
+        return hay;
+    if (needle_len > hay_len)
+        return nullptr;
+    const char* last = hay + (hay_len - needle_len);
+    const char* p = hay;
+    while (p <= last) {
+        p = static_cast<const char*>(memchr(p, needle[0], static_cast<size_t>(last - p) + 1));
+        if (!p)
+            return nullptr;
+        if (memcmp(p + 1, needle + 1, needle_len - 1) == 0)
+            return p;
+        p++;
+    }
+    return nullptr;
+}
+
+static bool is_ascii_space(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+int32_t roxy_string_find(void* s, void* needle, int32_t start) {
+    assert(s && needle && "str_find: null string");
+    uint32_t len = string_hdr(s)->length;
+    if (start < 0) {
+        roxy_runtime_error_set("str_find: negative start");
+        return -1;
+    }
+    if (static_cast<uint32_t>(start) > len)
+        return -1;
+    const char* chars = roxy_string_chars(s);
+    const char* hit = string_search(chars + start, len - static_cast<uint32_t>(start),
+                                    roxy_string_chars(needle), string_hdr(needle)->length);
+    return hit ? static_cast<int32_t>(hit - chars) : -1;
+}
+
+int32_t roxy_string_find_char(void* s, int32_t code, int32_t start) {
+    assert(s && "str_find_char: null string");
+    uint32_t len = string_hdr(s)->length;
+    if (start < 0) {
+        roxy_runtime_error_set("str_find_char: negative start");
+        return -1;
+    }
+    if (code < 0 || code > 255) {
+        roxy_runtime_error_set("str_find_char: code outside 0..255");
+        return -1;
+    }
+    if (static_cast<uint32_t>(start) >= len)
+        return -1;
+    const char* chars = roxy_string_chars(s);
+    const void* hit = memchr(chars + start, static_cast<unsigned char>(code),
+                             len - static_cast<uint32_t>(start));
+    return hit ? static_cast<int32_t>(static_cast<const char*>(hit) - chars) : -1;
+}
+
+bool roxy_string_starts_with(void* s, void* prefix) {
+    assert(s && prefix && "str_starts_with: null string");
+    uint32_t n = string_hdr(prefix)->length;
+    return n <= string_hdr(s)->length &&
+           memcmp(roxy_string_chars(s), roxy_string_chars(prefix), n) == 0;
+}
+
+bool roxy_string_ends_with(void* s, void* suffix) {
+    assert(s && suffix && "str_ends_with: null string");
+    uint32_t len = string_hdr(s)->length;
+    uint32_t n = string_hdr(suffix)->length;
+    return n <= len && memcmp(roxy_string_chars(s) + (len - n), roxy_string_chars(suffix), n) == 0;
+}
+
+void* roxy_string_trim(void* s) {
+    assert(s && "str_trim: null string");
+    const char* begin = roxy_string_chars(s);
+    const char* end = begin + string_hdr(s)->length;
+    const char* first = begin;
+    while (first < end && is_ascii_space(*first))
+        first++;
+    while (end > first && is_ascii_space(end[-1]))
+        end--;
+    if (first == begin && end == begin + string_hdr(s)->length) {
+        // Nothing to strip: hand back another owner of the same string.
+        roxy_string_retain(s);
+        return s;
+    }
+    return roxy_string_new_owned(first, static_cast<uint32_t>(end - first));
+}
+
+void* roxy_string_replace(void* s, void* target, void* replacement) {
+    assert(s && target && replacement && "str_replace: null string");
+    const char* chars = roxy_string_chars(s);
+    uint32_t len = string_hdr(s)->length;
+    const char* pat = roxy_string_chars(target);
+    uint32_t pat_len = string_hdr(target)->length;
+    const char* rep = roxy_string_chars(replacement);
+    uint32_t rep_len = string_hdr(replacement)->length;
+    if (pat_len == 0) {
+        roxy_runtime_error_set("str_replace: empty pattern");
+        roxy_string_retain(s);
+        return s;
+    }
+
+    // Count first so the result is sized and allocated once.
+    uint64_t count = 0;
+    for (const char* p = string_search(chars, len, pat, pat_len); p;
+         p = string_search(p + pat_len, len - static_cast<uint32_t>(p + pat_len - chars), pat,
+                           pat_len))
+        count++;
+    if (count == 0) {
+        roxy_string_retain(s);
+        return s;
+    }
+    uint64_t total = len + count * rep_len - count * pat_len;
+    if (total > INT32_MAX) {
+        roxy_runtime_error_set("str_replace: result too long");
+        roxy_string_retain(s);
+        return s;
+    }
+    void* result = string_alloc_uninit(static_cast<uint32_t>(total));
+    if (!result)
+        return nullptr;
+    char* out = roxy_string_chars(result);
+    const char* rest = chars;
+    const char* end = chars + len;
+    for (const char* p = string_search(rest, len, pat, pat_len); p;
+         p = string_search(rest, static_cast<uint32_t>(end - rest), pat, pat_len)) {
+        memcpy(out, rest, static_cast<size_t>(p - rest));
+        out += p - rest;
+        memcpy(out, rep, rep_len);
+        out += rep_len;
+        rest = p + pat_len;
+    }
+    memcpy(out, rest, static_cast<size_t>(end - rest));
+    string_seal(result);
+    return result;
+}
+
+void* roxy_string_split(void* s, void* sep) {
+    assert(s && sep && "str_split: null string");
+    void* list = roxy_list_alloc(2, 1);
+    if (!list)
+        return nullptr;
+    roxy_list_init(list, 0);
+    const char* rest = roxy_string_chars(s);
+    const char* end = rest + string_hdr(s)->length;
+    const char* pat = roxy_string_chars(sep);
+    uint32_t pat_len = string_hdr(sep)->length;
+    if (pat_len == 0) {
+        roxy_runtime_error_set("str_split: empty separator");
+        return list;
+    }
+    for (;;) {
+        const char* p = string_search(rest, static_cast<uint32_t>(end - rest), pat, pat_len);
+        const char* piece_end = p ? p : end;
+        void* piece = roxy_string_new_owned(rest, static_cast<uint32_t>(piece_end - rest));
+        roxy_list_push(list, &piece);
+        if (!p)
+            break;
+        rest = p + pat_len;
+    }
+    return list;
+}
+
+void* roxy_string_join(void* parts, void* sep) {
+    assert(parts && sep && "str_join: null argument");
+    auto* hdr = static_cast<roxy_list_header*>(parts);
+    uint32_t count = hdr->length;
+    uint32_t sep_len = string_hdr(sep)->length;
+    auto part_at = [hdr](uint32_t i) {
+        void* part;
+        memcpy(&part, roxy_list_get(hdr, static_cast<int32_t>(i)), sizeof(part));
+        return part;
+    };
+
+    // Size the result up front: one allocation, then each part copied once.
+    uint64_t total = count > 0 ? static_cast<uint64_t>(count - 1) * sep_len : 0;
+    for (uint32_t i = 0; i < count; i++) {
+        void* part = part_at(i);
+        total += part ? string_hdr(part)->length : 0;
+    }
+    if (total > INT32_MAX) {
+        roxy_runtime_error_set("str_join: result too long");
+        return roxy_string_new_owned("", 0);
+    }
+    void* result = string_alloc_uninit(static_cast<uint32_t>(total));
+    if (!result)
+        return nullptr;
+    char* out = roxy_string_chars(result);
+    for (uint32_t i = 0; i < count; i++) {
+        if (i > 0) {
+            memcpy(out, roxy_string_chars(sep), sep_len);
+            out += sep_len;
+        }
+        void* part = part_at(i);
+        if (part) {
+            memcpy(out, roxy_string_chars(part), string_hdr(part)->length);
+            out += string_hdr(part)->length;
+        }
+    }
+    string_seal(result);
+    return result;
+}
+
 double roxy_clock(void) {
     auto now = std::chrono::high_resolution_clock::now();
     return std::chrono::duration<double>(now.time_since_epoch()).count();
@@ -559,40 +1044,69 @@ void* roxy_bool_to_string(bool val) {
     return val ? roxy_string_from_literal("true", 4) : roxy_string_from_literal("false", 5);
 }
 
-void* roxy_i32_to_string(int32_t val) {
-    char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%d", val);
-    return roxy_string_new_owned(buf, static_cast<uint32_t>(len));
+static uint32_t decimal_digits(uint64_t v) {
+    uint32_t n = 1;
+    for (; v >= 10000; v /= 10000)
+        n += 4;
+    return n + (v >= 10) + (v >= 100) + (v >= 1000);
 }
 
-void* roxy_i64_to_string(int64_t val) {
-    char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(val));
-    return roxy_string_new_owned(buf, static_cast<uint32_t>(len));
+// Integers are sized first, then written backwards straight into the result.
+static void* integer_to_string(uint64_t magnitude, bool negative) {
+    uint32_t length = decimal_digits(magnitude) + (negative ? 1 : 0);
+    void* s = string_alloc_uninit(length);
+    if (!s)
+        return nullptr;
+    char* chars = roxy_string_chars(s);
+    format_u64(chars + length, magnitude);
+    if (negative)
+        chars[0] = '-';
+    string_seal(s);
+    return s;
+}
+
+static void* signed_to_string(int64_t val) {
+    return integer_to_string(val < 0 ? 0 - static_cast<uint64_t>(val) : static_cast<uint64_t>(val),
+                             val < 0);
 }
 
-void* roxy_u32_to_string(uint32_t val) {
+void* roxy_i32_to_string(int32_t val) { return signed_to_string(val); }
+void* roxy_i64_to_string(int64_t val) { return signed_to_string(val); }
+void* roxy_u32_to_string(uint32_t val) { return integer_to_string(val, false); }
+void* roxy_u64_to_string(uint64_t val) { return integer_to_string(val, false); }
+
+// `%g` output (six significant digits) via to_chars: no format-string parse and
+// no locale.
+static void* general_to_string(double val) {
     char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%u", val);
-    return roxy_string_new_owned(buf, static_cast<uint32_t>(len));
+    auto res = std::to_chars(buf, buf + sizeof(buf), val, std::chars_format::general, 6);
+    return roxy_string_new_owned(buf, static_cast<uint32_t>(res.ptr - buf));
 }
 
-void* roxy_u64_to_string(uint64_t val) {
+void* roxy_f32_to_string(float val) { return general_to_string(static_cast<double>(val)); }
+void* roxy_f64_to_string(double val) { return general_to_string(val); }
+
+void* roxy_f64_fmt(double val) {
     char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(val));
-    return roxy_string_new_owned(buf, static_cast<uint32_t>(len));
+    auto res = std::to_chars(buf, buf + sizeof(buf), val);
+    return roxy_string_new_owned(buf, static_cast<uint32_t>(res.ptr - buf));
 }
 
-void* roxy_f32_to_string(float val) {
-    char buf[48];
-    int len = snprintf(buf, sizeof(buf), "%g", static_cast<double>(val));
-    return roxy_string_new_owned(buf, static_cast<uint32_t>(len));
+void* roxy_f32_fmt(float val) {
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), val);
+    return roxy_string_new_owned(buf, static_cast<uint32_t>(res.ptr - buf));
 }
 
-void* roxy_f64_to_string(double val) {
-    char buf[48];
-    int len = snprintf(buf, sizeof(buf), "%g", val);
-    return roxy_string_new_owned(buf, static_cast<uint32_t>(len));
+void* roxy_f64_fmt_fixed(double val, int32_t decimals) {
+    if (decimals < 0 || decimals > ROXY_FMT_MAX_DECIMALS) {
+        roxy_runtime_error_set("fmt_fixed: decimals must be between 0 and 20");
+        return roxy_string_from_literal("", 0);
+    }
+    // Largest case: 309 integer digits of DBL_MAX, sign, point, 20 decimals.
+    char buf[352];
+    auto res = std::to_chars(buf, buf + sizeof(buf), val, std::chars_format::fixed, decimals);
+    return roxy_string_new_owned(buf, static_cast<uint32_t>(res.ptr - buf));
 }
 
 void* roxy_string_to_string(void* val) {
@@ -625,7 +1139,8 @@ void roxy_list_unpin(void* self) {
 static inline bool list_mutation_blocked(const roxy_list_header* hdr) {
     if (hdr->borrow_count != 0) {
         roxy_runtime_error_set(
-            "cannot structurally mutate a List while an element of it is borrowed (inout/out)");
+            "cannot structurally mutate a List "
+            "while an element of it is borrowed (inout/out or for-in)");
         return true;
     }
     return false;
@@ -665,7 +1180,7 @@ void roxy_list_delete(void* self) {
     // pointer points into) — refuse it while pinned, keeping the buffer alive.
     if (hdr->borrow_count != 0) {
         roxy_runtime_error_set(
-            "cannot delete a List while an element of it is borrowed (inout/out)");
+            "cannot delete a List while an element of it is borrowed (inout/out or for-in)");
         return;
     }
     free(hdr->elements);
@@ -782,6 +1297,745 @@ void roxy_list_mark_ref_elements(void* self) {
         static_cast<roxy_list_header*>(self)->element_is_ref = 1;
 }
 
+// ===== List Bulk Operations =====
+
+// Order-specific "a before b" for roxy_list_sort / roxy_list_binary_search.
+// NaN orders after every number so the relation stays a strict weak order.
+template <typename F>
+static inline bool list_float_less(F a, F b) {
+    return a < b || (a == a && b != b);
+}
+
+static inline bool list_string_less(void* a, void* b) {
+    int32_t la = roxy_string_len(a);
+    int32_t lb = roxy_string_len(b);
+    int cmp = memcmp(roxy_string_chars(a), roxy_string_chars(b),
+                     static_cast<size_t>(la < lb ? la : lb));
+    return cmp < 0 || (cmp == 0 && la < lb);
+}
+
+// Sort `n` contiguous elements of a primitive type. Floats get NaNs
+// partitioned to the tail first so the hot loop compares with a plain `<`.
+template <typename T>
+static void list_sort_typed(T* first, uint32_t n) {
+    std::sort(first, first + n);
+}
+
+template <typename F>
+static void list_sort_float(F* first, uint32_t n) {
+    F* numbers_end = std::partition(first, first + n, [](F v) { return v == v; });
+    std::sort(first, numbers_end);
+}
+
+// A narrow element (i8/u8/i16/u16/bool) fills one 32-bit slot; only its low
+// bytes are the value, so compare those and leave the slot bits untouched.
+template <typename T>
+static inline bool list_narrow_less(uint32_t a, uint32_t b) {
+    return static_cast<T>(a) < static_cast<T>(b);
+}
+
+template <typename T>
+static void list_sort_narrow(uint32_t* first, uint32_t n) {
+    std::sort(first, first + n, list_narrow_less<T>);
+}
+
+void roxy_list_sort(void* self, int32_t order) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    uint32_t n = hdr->length;
+    if (n < 2)
+        return;
+    // In place: a borrowed element pointer stays valid (it may see a different
+    // value, as it would after a set), so sorting is allowed while pinned.
+    switch (static_cast<roxy_list_order>(order)) {
+        case ROXY_LIST_ORDER_I32:
+            list_sort_typed(reinterpret_cast<int32_t*>(hdr->elements), n);
+            return;
+        case ROXY_LIST_ORDER_U32:
+            list_sort_typed(reinterpret_cast<uint32_t*>(hdr->elements), n);
+            return;
+        case ROXY_LIST_ORDER_I64:
+            list_sort_typed(reinterpret_cast<int64_t*>(hdr->elements), n);
+            return;
+        case ROXY_LIST_ORDER_U64:
+            list_sort_typed(reinterpret_cast<uint64_t*>(hdr->elements), n);
+            return;
+        case ROXY_LIST_ORDER_F32:
+            list_sort_float(reinterpret_cast<float*>(hdr->elements), n);
+            return;
+        case ROXY_LIST_ORDER_F64:
+            list_sort_float(reinterpret_cast<double*>(hdr->elements), n);
+            return;
+        case ROXY_LIST_ORDER_STRING: {
+            void** first = reinterpret_cast<void**>(hdr->elements);
+            std::sort(first, first + n, list_string_less);
+            return;
+        }
+        case ROXY_LIST_ORDER_I8:
+            list_sort_narrow<int8_t>(hdr->elements, n);
+            return;
+        case ROXY_LIST_ORDER_U8:
+            list_sort_narrow<uint8_t>(hdr->elements, n);
+            return;
+        case ROXY_LIST_ORDER_I16:
+            list_sort_narrow<int16_t>(hdr->elements, n);
+            return;
+        case ROXY_LIST_ORDER_U16:
+            list_sort_narrow<uint16_t>(hdr->elements, n);
+            return;
+    }
+}
+
+// Index of the first element not ordered before *value_src.
+template <typename T, typename Less>
+static uint32_t list_lower_bound(const T* first, uint32_t n, T value, Less less) {
+    return static_cast<uint32_t>(std::lower_bound(first, first + n, value, less) - first);
+}
+
+template <typename T, typename Less>
+static int32_t list_search_typed(const uint32_t* elements, uint32_t n, const void* value_src,
+                                 Less less) {
+    T value;
+    memcpy(&value, value_src, sizeof(T));
+    const T* first = reinterpret_cast<const T*>(elements);
+    uint32_t i = list_lower_bound(first, n, value, less);
+    if (i < n && !less(value, first[i]))
+        return static_cast<int32_t>(i);
+    return -static_cast<int32_t>(i) - 1;
+}
+
+// Narrow orders: the probe value is read at its own width (the C backend
+// passes a T temp), the elements as whole slots.
+template <typename T>
+static int32_t list_search_narrow(const uint32_t* elements, uint32_t n, const void* value_src) {
+    T narrow;
+    memcpy(&narrow, value_src, sizeof(T));
+    uint32_t value = static_cast<uint32_t>(narrow);
+    uint32_t i = list_lower_bound(elements, n, value, list_narrow_less<T>);
+    if (i < n && !list_narrow_less<T>(value, elements[i]))
+        return static_cast<int32_t>(i);
+    return -static_cast<int32_t>(i) - 1;
+}
+
+int32_t roxy_list_binary_search(void* self, const void* value_src, int32_t order) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    uint32_t n = hdr->length;
+    const uint32_t* e = hdr->elements;
+    switch (static_cast<roxy_list_order>(order)) {
+        case ROXY_LIST_ORDER_I32:
+            return list_search_typed<int32_t>(e, n, value_src, std::less<int32_t>());
+        case ROXY_LIST_ORDER_U32:
+            return list_search_typed<uint32_t>(e, n, value_src, std::less<uint32_t>());
+        case ROXY_LIST_ORDER_I64:
+            return list_search_typed<int64_t>(e, n, value_src, std::less<int64_t>());
+        case ROXY_LIST_ORDER_U64:
+            return list_search_typed<uint64_t>(e, n, value_src, std::less<uint64_t>());
+        case ROXY_LIST_ORDER_F32:
+            return list_search_typed<float>(e, n, value_src, list_float_less<float>);
+        case ROXY_LIST_ORDER_F64:
+            return list_search_typed<double>(e, n, value_src, list_float_less<double>);
+        case ROXY_LIST_ORDER_STRING:
+            return list_search_typed<void*>(e, n, value_src, list_string_less);
+        case ROXY_LIST_ORDER_I8:
+            return list_search_narrow<int8_t>(e, n, value_src);
+        case ROXY_LIST_ORDER_U8:
+            return list_search_narrow<uint8_t>(e, n, value_src);
+        case ROXY_LIST_ORDER_I16:
+            return list_search_narrow<int16_t>(e, n, value_src);
+        case ROXY_LIST_ORDER_U16:
+            return list_search_narrow<uint16_t>(e, n, value_src);
+    }
+    return -1;
+}
+
+// Stable bottom-up merge sort of an index permutation. Written out rather than
+// std::stable_sort because the comparator is user code: an inconsistent one
+// (or one whose VM call failed and now answers false) must produce *some*
+// permutation, never an out-of-bounds probe.
+static void list_sort_indices(uint32_t* idx, uint32_t* scratch, uint32_t n,
+                              const roxy_list_header* hdr, roxy_list_less_fn less, void* ctx) {
+    auto elem = [hdr](uint32_t i) -> const void* {
+        return hdr->elements + static_cast<size_t>(i) * hdr->element_slot_count;
+    };
+    // Insertion-sort short runs; the bounds never depend on the comparator.
+    const uint32_t run = 16;
+    for (uint32_t lo = 0; lo < n; lo += run) {
+        uint32_t hi = lo + run < n ? lo + run : n;
+        for (uint32_t i = lo + 1; i < hi; i++) {
+            for (uint32_t j = i; j > lo && less(ctx, elem(idx[j]), elem(idx[j - 1])); j--) {
+                uint32_t t = idx[j];
+                idx[j] = idx[j - 1];
+                idx[j - 1] = t;
+            }
+        }
+    }
+    uint32_t* src = idx;
+    uint32_t* dst = scratch;
+    for (uint32_t width = run; width < n; width *= 2) {
+        for (uint32_t lo = 0; lo < n; lo += 2 * width) {
+            uint32_t mid = lo + width < n ? lo + width : n;
+            uint32_t hi = lo + 2 * width < n ? lo + 2 * width : n;
+            uint32_t a = lo, b = mid, k = lo;
+            // Take from the right run only when strictly before: stable.
+            while (a < mid && b < hi)
+                dst[k++] = less(ctx, elem(src[b]), elem(src[a])) ? src[b++] : src[a++];
+            while (a < mid)
+                dst[k++] = src[a++];
+            while (b < hi)
+                dst[k++] = src[b++];
+        }
+        uint32_t* t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != idx)
+        memcpy(idx, src, sizeof(uint32_t) * n);
+}
+
+void roxy_list_sort_by(void* self, roxy_list_less_fn less, void* ctx) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    uint32_t n = hdr->length;
+    if (n < 2 || !less)
+        return;
+    uint32_t esc = hdr->element_slot_count;
+    auto* idx = static_cast<uint32_t*>(malloc(sizeof(uint32_t) * n * 2));
+    auto* moved = static_cast<uint32_t*>(malloc(sizeof(uint32_t) * esc * n));
+    if (!idx || !moved) {
+        free(idx);
+        free(moved);
+        return;
+    }
+    for (uint32_t i = 0; i < n; i++)
+        idx[i] = i;
+    // The comparator runs user code that can see this list: pin it so a push
+    // or pop from inside the callback is refused instead of freeing the buffer
+    // the sort is reading.
+    hdr->borrow_count++;
+    list_sort_indices(idx, idx + n, n, hdr, less, ctx);
+    hdr->borrow_count--;
+    for (uint32_t i = 0; i < n; i++)
+        memcpy(moved + static_cast<size_t>(i) * esc, list_element_ptr(hdr, idx[i]),
+               sizeof(uint32_t) * esc);
+    memcpy(hdr->elements, moved, sizeof(uint32_t) * esc * n);
+    free(moved);
+    free(idx);
+}
+
+// Grow the element buffer to hold at least `min_cap` elements (doubling, like
+// push). Returns false on allocation failure, leaving the list untouched.
+static bool list_grow(roxy_list_header* hdr, uint32_t min_cap) {
+    if (min_cap <= hdr->capacity)
+        return true;
+    uint32_t new_cap = hdr->capacity == 0 ? 8 : hdr->capacity;
+    while (new_cap < min_cap)
+        new_cap *= 2;
+    uint32_t esc = hdr->element_slot_count;
+    auto* new_elements = static_cast<uint32_t*>(malloc(sizeof(uint32_t) * esc * new_cap));
+    if (!new_elements)
+        return false;
+    if (hdr->elements) {
+        memcpy(new_elements, hdr->elements, sizeof(uint32_t) * esc * hdr->length);
+        free(hdr->elements);
+    }
+    hdr->elements = new_elements;
+    hdr->capacity = new_cap;
+    return true;
+}
+
+void roxy_list_extend(void* self, void* other) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    if (!other)
+        return;
+    if (other == self) {
+        roxy_runtime_error_set("cannot extend a List with itself");
+        return;
+    }
+    if (list_mutation_blocked(hdr))
+        return;
+    auto* src = static_cast<roxy_list_header*>(other);
+    if (src->length > 0) {
+        if (!list_grow(hdr, hdr->length + src->length))
+            return;
+        memcpy(list_element_ptr(hdr, hdr->length), src->elements,
+               sizeof(uint32_t) * hdr->element_slot_count * src->length);
+        hdr->length += src->length;
+    }
+    // The elements (and the counts they carry) now belong to `self`; leave
+    // `other` empty for the caller's drop.
+    free(src->elements);
+    src->elements = nullptr;
+    src->length = 0;
+    src->capacity = 0;
+}
+
+void roxy_list_fill(void* self, const void* value_src) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    uint32_t esc = hdr->element_slot_count;
+    for (uint32_t i = 0; i < hdr->length; i++) {
+        uint32_t* slot = list_element_ptr(hdr, i);
+        if (hdr->element_is_ref) {
+            // Inc before dec: the old element may be the value being written.
+            roxy_ref_inc(list_ref_element(static_cast<const uint32_t*>(value_src)));
+            roxy_ref_dec(list_ref_element(slot));
+        }
+        memcpy(slot, value_src, sizeof(uint32_t) * esc);
+    }
+}
+
+void roxy_list_truncate(void* self, int32_t length) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    if (length < 0) {
+        roxy_runtime_error_set("List truncate length cannot be negative");
+        return;
+    }
+    if (static_cast<uint32_t>(length) >= hdr->length)
+        return;
+    if (list_mutation_blocked(hdr))
+        return;
+    if (hdr->element_is_ref) {
+        for (uint32_t i = static_cast<uint32_t>(length); i < hdr->length; i++)
+            roxy_ref_dec(list_ref_element(list_element_ptr(hdr, i)));
+    }
+    hdr->length = static_cast<uint32_t>(length);
+}
+
+void roxy_list_reserve(void* self, int32_t capacity) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    if (capacity <= 0 || static_cast<uint32_t>(capacity) <= hdr->capacity)
+        return;
+    if (list_mutation_blocked(hdr))
+        return;
+    list_grow(hdr, static_cast<uint32_t>(capacity));
+}
+
+void roxy_list_swap(void* self, int32_t i, int32_t j) {
+    auto* hdr = static_cast<roxy_list_header*>(self);
+    if (i < 0 || j < 0 || static_cast<uint32_t>(i) >= hdr->length ||
+        static_cast<uint32_t>(j) >= hdr->length) {
+        roxy_runtime_error_set("List swap index out of bounds");
+        return;
+    }
+    if (i == j)
+        return;
+    uint32_t* a = list_element_ptr(hdr, static_cast<uint32_t>(i));
+    uint32_t* b = list_element_ptr(hdr, static_cast<uint32_t>(j));
+    for (uint32_t s = 0; s < hdr->element_slot_count; s++) {
+        uint32_t t = a[s];
+        a[s] = b[s];
+        b[s] = t;
+    }
+}
+
+// ===== Array Operations =====
+
+// The shared List paths (roxy_container_pin, roxy_list_len, the VM's List drop)
+// read an Array through roxy_list_header.
+static_assert(offsetof(roxy_array_header, length) == offsetof(roxy_list_header, length) &&
+                  offsetof(roxy_array_header, capacity) == offsetof(roxy_list_header, capacity) &&
+                  offsetof(roxy_array_header, borrow_count) ==
+                      offsetof(roxy_list_header, borrow_count) &&
+                  offsetof(roxy_array_header, data) == offsetof(roxy_list_header, elements) &&
+                  sizeof(roxy_array_header) == sizeof(roxy_list_header),
+              "roxy_array_header must stay layout-compatible with roxy_list_header");
+
+static inline uint8_t* array_element_ptr(const roxy_array_header* hdr, uint32_t index) {
+    return hdr->data + static_cast<size_t>(index) * hdr->element_size;
+}
+
+// Give back the element buffer: a file mapping is unmapped, anything else freed.
+static void array_release_data(roxy_array_header* hdr) {
+#if !defined(_WIN32)
+    if (hdr->is_mapped) {
+        munmap(hdr->data, static_cast<size_t>(hdr->length) * hdr->element_size);
+        hdr->is_mapped = 0;
+        return;
+    }
+#endif
+    free(hdr->data);
+}
+
+// Replace the buffer with `length` elements, keeping the first min(old, new)
+// and zeroing the rest. Returns false (array untouched) on allocation failure.
+static bool array_realloc(roxy_array_header* hdr, uint32_t length) {
+    size_t bytes = static_cast<size_t>(length) * hdr->element_size;
+    uint8_t* data = nullptr;
+    if (length > 0) {
+        data = static_cast<uint8_t*>(calloc(length, hdr->element_size));
+        if (!data) {
+            roxy_runtime_error_set("Array allocation failed");
+            return false;
+        }
+        size_t keep = static_cast<size_t>(hdr->length) * hdr->element_size;
+        if (hdr->data)
+            memcpy(data, hdr->data, keep < bytes ? keep : bytes);
+    }
+    array_release_data(hdr);
+    hdr->data = data;
+    hdr->length = length;
+    hdr->capacity = length;
+    return true;
+}
+
+void* roxy_array_alloc(int32_t element_size, int32_t element_is_signed) {
+    void* data = roxy_alloc(sizeof(roxy_array_header), ROXY_TYPEID_LIST);
+    if (!data)
+        return nullptr;
+    auto* hdr = static_cast<roxy_array_header*>(data);
+    hdr->element_size = element_size > 0 ? static_cast<uint32_t>(element_size) : 1u;
+    hdr->element_is_signed = element_is_signed != 0 ? 1 : 0;
+    return data;
+}
+
+void roxy_array_init(void* self, int32_t length) {
+    auto* hdr = static_cast<roxy_array_header*>(self);
+    if (length < 0) {
+        roxy_runtime_error_set("Array length cannot be negative");
+        return;
+    }
+    array_realloc(hdr, static_cast<uint32_t>(length));
+}
+
+void roxy_array_delete(void* self) {
+    auto* hdr = static_cast<roxy_array_header*>(self);
+    if (hdr->borrow_count != 0) {
+        roxy_runtime_error_set(
+            "cannot delete an Array while an element of it is borrowed (for-in)");
+        return;
+    }
+    array_release_data(hdr);
+    hdr->data = nullptr;
+    hdr->length = 0;
+    hdr->capacity = 0;
+}
+
+int32_t roxy_array_len(void* self) {
+    return static_cast<int32_t>(static_cast<roxy_array_header*>(self)->length);
+}
+
+void* roxy_array_get(void* self, int32_t index) { return roxy_array_elem(self, index); }
+
+void roxy_array_set(void* self, int32_t index, const void* value_src) {
+    auto* hdr = static_cast<roxy_array_header*>(self);
+    memcpy(roxy_array_elem(self, index), value_src, hdr->element_size);
+}
+
+void* roxy_array_copy(void* src) {
+    if (!src)
+        return nullptr;
+    auto* src_hdr = static_cast<roxy_array_header*>(src);
+    return roxy_array_slice(src, 0, static_cast<int32_t>(src_hdr->length));
+}
+
+void roxy_array_fill(void* self, const void* value_src) {
+    auto* hdr = static_cast<roxy_array_header*>(self);
+    if (hdr->length == 0)
+        return;
+    // Doubling memcpy: one element, then 1, 2, 4, ... already-filled elements.
+    size_t total = static_cast<size_t>(hdr->length) * hdr->element_size;
+    memcpy(hdr->data, value_src, hdr->element_size);
+    for (size_t done = hdr->element_size; done < total; done *= 2)
+        memcpy(hdr->data + done, hdr->data, done < total - done ? done : total - done);
+}
+
+void* roxy_array_slice(void* self, int32_t start, int32_t end) {
+    auto* hdr = static_cast<roxy_array_header*>(self);
+    void* dst = roxy_array_alloc(static_cast<int32_t>(hdr->element_size), hdr->element_is_signed);
+    if (!dst)
+        return nullptr;
+    if (start < 0 || end < start || static_cast<uint32_t>(end) > hdr->length) {
+        roxy_runtime_error_set("Array slice range out of bounds");
+        return dst;
+    }
+    auto* dst_hdr = static_cast<roxy_array_header*>(dst);
+    uint32_t length = static_cast<uint32_t>(end - start);
+    if (length > 0 && array_realloc(dst_hdr, length))
+        memcpy(dst_hdr->data, array_element_ptr(hdr, static_cast<uint32_t>(start)),
+               static_cast<size_t>(length) * hdr->element_size);
+    return dst;
+}
+
+void roxy_array_copy_from(void* self, int32_t dst_start, void* src, int32_t src_start,
+                          int32_t count) {
+    auto* hdr = static_cast<roxy_array_header*>(self);
+    auto* src_hdr = static_cast<roxy_array_header*>(src);
+    if (!src_hdr || src_hdr->element_size != hdr->element_size) {
+        roxy_runtime_error_set("Array copy_from: element sizes differ");
+        return;
+    }
+    // 64-bit sums: start + count can't wrap past the length check.
+    if (dst_start < 0 || src_start < 0 || count < 0 ||
+        static_cast<uint64_t>(dst_start) + static_cast<uint64_t>(count) > hdr->length ||
+        static_cast<uint64_t>(src_start) + static_cast<uint64_t>(count) > src_hdr->length) {
+        roxy_runtime_error_set("Array copy_from range out of bounds");
+        return;
+    }
+    if (count > 0)
+        memmove(array_element_ptr(hdr, static_cast<uint32_t>(dst_start)),
+                array_element_ptr(src_hdr, static_cast<uint32_t>(src_start)),
+                static_cast<size_t>(count) * hdr->element_size);
+}
+
+void roxy_array_resize(void* self, int32_t length) {
+    auto* hdr = static_cast<roxy_array_header*>(self);
+    if (length < 0) {
+        roxy_runtime_error_set("Array length cannot be negative");
+        return;
+    }
+    if (static_cast<uint32_t>(length) == hdr->length)
+        return;
+    if (hdr->borrow_count != 0) {
+        roxy_runtime_error_set(
+            "cannot resize an Array while an element of it is borrowed (for-in)");
+        return;
+    }
+    array_realloc(hdr, static_cast<uint32_t>(length));
+}
+
+// ===== File I/O =====
+
+void* roxy_map_file(void* path) {
+    void* arr = roxy_array_alloc(1, 0);
+    if (!arr || !path)
+        return arr;
+    auto* hdr = static_cast<roxy_array_header*>(arr);
+    const char* name = roxy_string_chars(path);
+#if !defined(_WIN32)
+    int fd = open(name, O_RDONLY);
+    if (fd < 0) {
+        roxy_runtime_error_set("map_file: could not open file");
+        return arr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 0 || st.st_size > INT32_MAX) {
+        close(fd);
+        roxy_runtime_error_set("map_file: file size unavailable or over 2 GiB");
+        return arr;
+    }
+    if (st.st_size > 0) {
+        // MAP_PRIVATE: element stores copy the touched page, never the file.
+        void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            hdr->data = static_cast<uint8_t*>(mapped);
+            hdr->length = static_cast<uint32_t>(st.st_size);
+            hdr->capacity = hdr->length;
+            hdr->is_mapped = 1;
+        } else {
+            roxy_runtime_error_set("map_file: mmap failed");
+        }
+    }
+    close(fd);
+#else
+    // No mapping here: one read straight into the array's buffer.
+    FILE* file = fopen(name, "rb");
+    if (!file) {
+        roxy_runtime_error_set("map_file: could not open file");
+        return arr;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < 0 || size > INT32_MAX) {
+        fclose(file);
+        roxy_runtime_error_set("map_file: file size unavailable or over 2 GiB");
+        return arr;
+    }
+    if (size > 0 && array_realloc(hdr, static_cast<uint32_t>(size)))
+        hdr->length = hdr->capacity =
+            static_cast<uint32_t>(fread(hdr->data, 1, static_cast<size_t>(size), file));
+    fclose(file);
+#endif
+    return arr;
+}
+
+void* roxy_bytes_to_string(void* bytes, int32_t start, int32_t end) {
+    auto* hdr = static_cast<roxy_array_header*>(bytes);
+    if (!hdr || start < 0 || end < start || static_cast<uint32_t>(end) > hdr->length) {
+        roxy_runtime_error_set("bytes_to_string: range out of bounds");
+        return roxy_string_from_literal("", 0);
+    }
+    return roxy_string_new_owned(reinterpret_cast<const char*>(hdr->data) + start,
+                                 static_cast<uint32_t>(end - start));
+}
+
+static constexpr size_t k_file_buffer_size = 64 * 1024;
+
+struct roxy_file_reader {
+    FILE* file;
+    char* buf; // k_file_buffer_size bytes; [pos, end) not yet consumed
+    size_t pos;
+    size_t end;
+    char* record; // current record, grown to the longest seen
+    size_t record_len;
+    size_t record_cap;
+};
+
+static bool reader_append(roxy_file_reader* r, const char* bytes, size_t n) {
+    if (r->record_len + n > r->record_cap) {
+        size_t cap = r->record_cap ? r->record_cap : 256;
+        while (cap < r->record_len + n)
+            cap *= 2;
+        char* grown = static_cast<char*>(realloc(r->record, cap));
+        if (!grown) {
+            roxy_runtime_error_set("file reader: allocation failed");
+            return false;
+        }
+        r->record = grown;
+        r->record_cap = cap;
+    }
+    memcpy(r->record + r->record_len, bytes, n);
+    r->record_len += n;
+    return true;
+}
+
+uint64_t roxy_file_reader_open(void* path) {
+    FILE* file = path ? fopen(roxy_string_chars(path), "rb") : nullptr;
+    if (!file) {
+        roxy_runtime_error_set("file reader: could not open file");
+        return 0;
+    }
+    auto* r = static_cast<roxy_file_reader*>(calloc(1, sizeof(roxy_file_reader)));
+    char* buf = static_cast<char*>(malloc(k_file_buffer_size));
+    if (!r || !buf) {
+        free(r);
+        free(buf);
+        fclose(file);
+        roxy_runtime_error_set("file reader: allocation failed");
+        return 0;
+    }
+    r->file = file;
+    r->buf = buf;
+    return reinterpret_cast<uint64_t>(r);
+}
+
+bool roxy_file_reader_next(uint64_t reader, int32_t delim) {
+    auto* r = reinterpret_cast<roxy_file_reader*>(reader);
+    if (!r) {
+        roxy_runtime_error_set("file reader: reader is closed");
+        return false;
+    }
+    r->record_len = 0;
+    bool any = false;
+    for (;;) {
+        if (r->pos == r->end) {
+            r->pos = 0;
+            r->end = fread(r->buf, 1, k_file_buffer_size, r->file);
+            if (r->end == 0)
+                return any; // an unterminated last record still counts
+        }
+        any = true;
+        const char* start = r->buf + r->pos;
+        size_t avail = r->end - r->pos;
+        auto* hit = static_cast<const char*>(memchr(start, delim & 0xFF, avail));
+        size_t take = hit ? static_cast<size_t>(hit - start) : avail;
+        if (!reader_append(r, start, take))
+            return false;
+        r->pos += hit ? take + 1 : take;
+        if (hit)
+            break;
+    }
+    if (delim == '\n' && r->record_len > 0 && r->record[r->record_len - 1] == '\r')
+        r->record_len--;
+    return true;
+}
+
+void* roxy_file_reader_record(uint64_t reader) {
+    auto* r = reinterpret_cast<roxy_file_reader*>(reader);
+    if (!r) {
+        roxy_runtime_error_set("file reader: reader is closed");
+        return roxy_string_from_literal("", 0);
+    }
+    return roxy_string_new_owned(r->record ? r->record : "",
+                                 static_cast<uint32_t>(r->record_len));
+}
+
+void roxy_file_reader_close(uint64_t reader) {
+    auto* r = reinterpret_cast<roxy_file_reader*>(reader);
+    if (!r)
+        return;
+    fclose(r->file);
+    free(r->buf);
+    free(r->record);
+    free(r);
+}
+
+struct roxy_file_writer {
+    FILE* file;
+    char* buf; // k_file_buffer_size bytes, [0, len) pending
+    size_t len;
+};
+
+static bool writer_drain(roxy_file_writer* w) {
+    if (w->len > 0 && fwrite(w->buf, 1, w->len, w->file) != w->len) {
+        w->len = 0;
+        roxy_runtime_error_set("file writer: write failed");
+        return false;
+    }
+    w->len = 0;
+    return true;
+}
+
+uint64_t roxy_file_writer_open(void* path, bool append) {
+    FILE* file = path ? fopen(roxy_string_chars(path), append ? "ab" : "wb") : nullptr;
+    if (!file) {
+        roxy_runtime_error_set("file writer: could not open file");
+        return 0;
+    }
+    auto* w = static_cast<roxy_file_writer*>(calloc(1, sizeof(roxy_file_writer)));
+    char* buf = static_cast<char*>(malloc(k_file_buffer_size));
+    if (!w || !buf) {
+        free(w);
+        free(buf);
+        fclose(file);
+        roxy_runtime_error_set("file writer: allocation failed");
+        return 0;
+    }
+    // Our buffer batches the writes, so stdio's would only add a copy.
+    setvbuf(file, nullptr, _IONBF, 0);
+    w->file = file;
+    w->buf = buf;
+    return reinterpret_cast<uint64_t>(w);
+}
+
+void roxy_file_writer_write(uint64_t writer, void* s) {
+    auto* w = reinterpret_cast<roxy_file_writer*>(writer);
+    if (!w) {
+        roxy_runtime_error_set("file writer: writer is closed");
+        return;
+    }
+    const char* chars = roxy_string_chars(s);
+    size_t n = roxy_string_len(s);
+    if (w->len + n > k_file_buffer_size && !writer_drain(w))
+        return;
+    if (n >= k_file_buffer_size) {
+        // Larger than the buffer: write it through.
+        if (fwrite(chars, 1, n, w->file) != n)
+            roxy_runtime_error_set("file writer: write failed");
+        return;
+    }
+    memcpy(w->buf + w->len, chars, n);
+    w->len += n;
+}
+
+void roxy_file_writer_flush(uint64_t writer) {
+    auto* w = reinterpret_cast<roxy_file_writer*>(writer);
+    if (!w) {
+        roxy_runtime_error_set("file writer: writer is closed");
+        return;
+    }
+    if (writer_drain(w))
+        fflush(w->file);
+}
+
+void roxy_file_writer_close(uint64_t writer) {
+    auto* w = reinterpret_cast<roxy_file_writer*>(writer);
+    if (!w)
+        return;
+    writer_drain(w);
+    fclose(w->file);
+    free(w->buf);
+    free(w);
+}
+
 // ===== Hash Functions =====
 
 static uint64_t hash_splitmix64(uint64_t x) {
@@ -793,15 +2047,6 @@ static uint64_t hash_splitmix64(uint64_t x) {
     return x;
 }
 
-static uint64_t hash_fnv1a(const char* data, uint32_t length) {
-    uint64_t h = 14695981039346656037ULL;
-    for (uint32_t i = 0; i < length; i++) {
-        h ^= static_cast<uint64_t>(static_cast<uint8_t>(data[i]));
-        h *= 1099511628211ULL;
-    }
-    return h;
-}
-
 uint64_t roxy_bool_hash(bool val) { return hash_splitmix64(val ? 1u : 0u); }
 
 uint64_t roxy_i8_hash(int8_t val) { return hash_splitmix64(static_cast<uint64_t>(val)); }
@@ -839,9 +2084,10 @@ uint64_t roxy_f64_hash(double val) {
 uint64_t roxy_string_hash(void* val) {
     if (!val)
         return 0;
-    // Read the cached low-32 hash. The high bits are filled with 0; the
-    // map's probe mask only uses the low 32 bits anyway (capacity is u32).
-    return static_cast<uint64_t>(string_hdr(val)->hash);
+    // The cached low-32 hash, computed here on first use. The high bits are
+    // filled with 0; the map's probe mask only uses the low 32 bits anyway
+    // (capacity is u32).
+    return static_cast<uint64_t>(string_cached_hash(val));
 }
 
 // ===== Map Operations =====
@@ -864,7 +2110,8 @@ void roxy_map_unpin(void* self) {
 static inline bool map_mutation_blocked(const roxy_map_header* hdr) {
     if (hdr->borrow_count != 0) {
         roxy_runtime_error_set(
-            "cannot structurally mutate a Map while a value of it is borrowed (inout/out)");
+            "cannot structurally mutate a Map "
+            "while a value of it is borrowed (inout/out or for-in)");
         return true;
     }
     return false;
@@ -878,8 +2125,36 @@ static inline uint64_t read_packed_u64(const uint32_t* key_src) {
     return packed;
 }
 
+// A struct key without a user Hash/Eq is plain data: its identity is its u32
+// slots, so it hashes and compares them as words. One- and two-slot keys
+// (entity ids, packed coordinates) are a single splitmix64 round and a single
+// integer compare; wider keys go through XXH3, which takes 16-byte lanes where
+// a byte loop would take one. `slots` is fixed per map, so the branches are
+// perfectly predicted.
+static inline uint64_t hash_struct_slots(const uint32_t* key_src, uint32_t slots) {
+    switch (slots) {
+        case 1:
+            return hash_splitmix64(key_src[0]);
+        case 2:
+            return hash_splitmix64(read_packed_u64(key_src));
+        default:
+            return XXH3_64bits(key_src, static_cast<size_t>(slots) * 4);
+    }
+}
+
+static inline bool struct_slots_equal(const uint32_t* a, const uint32_t* b, uint32_t slots) {
+    switch (slots) {
+        case 1:
+            return a[0] == b[0];
+        case 2:
+            return read_packed_u64(a) == read_packed_u64(b);
+        default:
+            return memcmp(a, b, static_cast<size_t>(slots) * 4) == 0;
+    }
+}
+
 // Internal: hash a key based on key_kind. For Struct keys, dispatches through
-// the user-provided hash_fn if set; otherwise falls back to bytewise FNV-1a.
+// the user-provided hash_fn if set; otherwise hashes the key's slots.
 static uint64_t map_hash_key(const uint32_t* key_src, const roxy_map_header* hdr) {
     // Cast to the enum so -Wswitch flags a newly-added key kind here. The
     // trailing return still handles an out-of-range tag from bad data.
@@ -909,22 +2184,20 @@ static uint64_t map_hash_key(const uint32_t* key_src, const roxy_map_header* hdr
             void* str = reinterpret_cast<void*>(ptr_bits);
             if (!str)
                 return 0;
-            // Read the cached hash from the string header — same field the
-            // VM-side `Map<string,V>` lookup at vm/map.cpp:84 uses.
-            return static_cast<uint64_t>(string_hdr(str)->hash);
+            // The header's cached hash, filled on the first probe that needs it.
+            return static_cast<uint64_t>(string_cached_hash(str));
         }
         case ROXY_MAP_KEY_STRUCT:
             if (hdr->hash_fn) {
                 return hdr->hash_fn(key_src);
             }
-            return hash_fnv1a(reinterpret_cast<const char*>(key_src),
-                              static_cast<uint32_t>(hdr->key_slot_count) * 4);
+            return hash_struct_slots(key_src, hdr->key_slot_count);
     }
     return hash_splitmix64(read_packed_u64(key_src));
 }
 
 // Internal: compare two keys for equality. For Struct keys, dispatches through
-// the user-provided eq_fn if set; otherwise falls back to bytewise memcmp.
+// the user-provided eq_fn if set; otherwise compares the key's slots.
 // Note: in the C backend the user's `K__eq(K* self, K* other)` C signature
 // already takes both args as pointers (Roxy's `other: K` lowers to `K*` in
 // the C output via the existing struct-by-pointer convention) — no calling-
@@ -956,7 +2229,7 @@ static bool map_keys_equal(const uint32_t* a, const uint32_t* b, const roxy_map_
             if (hdr->eq_fn) {
                 return hdr->eq_fn(a, b);
             }
-            return memcmp(a, b, static_cast<size_t>(hdr->key_slot_count) * 4) == 0;
+            return struct_slots_equal(a, b, hdr->key_slot_count);
     }
     return read_packed_u64(a) == read_packed_u64(b);
 }
@@ -1129,7 +2402,9 @@ void roxy_map_init(void* self, int32_t key_kind, int32_t capacity) {
 void roxy_map_delete(void* self) {
     auto* hdr = map_hdr(self);
     if (hdr->borrow_count != 0) {
-        roxy_runtime_error_set("cannot delete a Map while a value of it is borrowed (inout/out)");
+        roxy_runtime_error_set(
+            "cannot delete a Map "
+            "while a value of it is borrowed (inout/out or for-in)");
         return;
     }
     map_free_buckets(hdr);
@@ -1249,8 +2524,6 @@ void* roxy_map_get_or(void* self, const void* key_src, const void* default_src)
 
 void roxy_map_insert(void* self, const void* key_src, const void* value_src) {
     auto* hdr = map_hdr(self);
-    if (map_mutation_blocked(hdr))
-        return; // covers map[k]=v (roxy_map_index_mut)
     uint8_t vsc = hdr->value_slot_count;
     auto* k = static_cast<const uint32_t*>(key_src);
     auto* v = static_cast<const uint32_t*>(value_src);
@@ -1281,7 +2554,13 @@ void roxy_map_insert(void* self, const void* key_src, const void* value_src) {
         }
     }
 
-    // New key — grow if needed (80% load factor)
+    // New key. Overwriting an existing key above moves no storage, so it stays
+    // allowed while the map is pinned (`for (k, v) in m { m[k] = ... }`); adding
+    // one may rehash, so it is refused. Covers map[k]=v (roxy_map_index_mut).
+    if (map_mutation_blocked(hdr))
+        return;
+
+    // Grow if needed (80% load factor)
     if (hdr->capacity == 0 || (hdr->length + 1) > hdr->capacity * 4 / 5) {
         map_grow(hdr);
     }
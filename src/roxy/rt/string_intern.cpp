@@ -1,14 +1,25 @@
 #include "roxy/rt/string_intern.hpp"
 #include "roxy/rt/roxy_rt.h"
 
+#define XXH_INLINE_ALL
+#include "roxy/core/xxhash.h"
+
+namespace rx {
+
+size_t StringInternHash::operator()(StringView key) const noexcept {
+    return static_cast<size_t>(XXH3_64bits(key.data(), key.size()));
+}
+
+} // namespace rx
+
 extern "C" {
 
-void* roxy_string_intern_lookup(void* table, const char* chars, uint32_t length) {
+void* roxy_string_intern_lookup(void* table, const char* chars, uint32_t length, uint64_t hash) {
     if (!table || !chars || length == 0)
         return nullptr;
     auto* t = static_cast<rx::StringInternTable*>(table);
     rx::StringView key(chars, length);
-    auto it = t->table.find(key);
+    auto it = t->table.find(key, static_cast<size_t>(hash));
     if (it == t->table.end())
         return nullptr;
     return it->second;
@@ -147,6 +147,23 @@ Type* NativeRegistry::resolve_type_expr(TypeExpr* expr, Span<StringView> type_pa
     if (!expr)
         return types.void_type();
 
+    // Function type: `fun(A, B) -> R`, e.g. a comparator parameter.
+    if (expr->kind == TypeExprKind::Function) {
+        Vector<Type*> params;
+        for (TypeExpr* param_expr : expr->type_args) {
+            params.push_back(resolve_type_expr(param_expr, type_param_names, type_args, types));
+        }
+        Type* ret = expr->return_type
+                        ? resolve_type_expr(expr->return_type, type_param_names, type_args, types)
+                        : types.void_type();
+        Type* fn = types.function_type(Span<Type*>(params.data(), static_cast<u32>(params.size())),
+                                       ret);
+        // A native only ever borrows a closure it is handed (`ref fun`).
+        if (expr->ref_kind == RefKind::Ref)
+            fn = types.ref_type(fn);
+        return fn;
+    }
+
     StringView name = expr->name;
     Type* result = types.error_type();
 
@@ -167,11 +184,15 @@ Type* NativeRegistry::resolve_type_expr(TypeExpr* expr, Span<StringView> type_pa
         if (primitive) {
             result = primitive;
         } else if (expr->type_args.size() > 0) {
-            // Generic type application: List<T>, Map<K, V>
+            // Generic type application: List<T>, Array<T>, Map<K, V>
             if (name == "List"_sv && expr->type_args.size() == 1) {
                 Type* elem =
                     resolve_type_expr(expr->type_args[0], type_param_names, type_args, types);
                 result = types.list_type(elem);
+            } else if (name == "Array"_sv && expr->type_args.size() == 1) {
+                Type* elem =
+                    resolve_type_expr(expr->type_args[0], type_param_names, type_args, types);
+                result = types.array_type(elem);
             } else if (name == "Map"_sv && expr->type_args.size() == 2) {
                 Type* key =
                     resolve_type_expr(expr->type_args[0], type_param_names, type_args, types);
@@ -182,6 +203,12 @@ Type* NativeRegistry::resolve_type_expr(TypeExpr* expr, Span<StringView> type_pa
         }
     }
 
+    // `ref T` in a native signature: the native borrows the argument (a source
+    // container it reads but does not consume).
+    if (expr->ref_kind == RefKind::Ref && result && !result->is_error()) {
+        result = types.ref_type(result);
+    }
+
     // `borrowed T` in a native signature (e.g. `index(idx: i32): borrowed T`):
     // demote the resolved type to a borrow once T is known (uniq T -> ref T,
     // fun -> ref fun, everything else unchanged).
@@ -191,6 +191,16 @@ const char* opcode_to_string(Opcode op) {
             return "INDEX_GET_MAP";
         case Opcode::INDEX_SET_MAP:
             return "INDEX_SET_MAP";
+        case Opcode::INDEX_FIELD_GET_LIST:
+            return "INDEX_FIELD_GET_LIST";
+        case Opcode::INDEX_FIELD_SET_LIST:
+            return "INDEX_FIELD_SET_LIST";
+        case Opcode::ITER_NEXT_MAP:
+            return "ITER_NEXT_MAP";
+        case Opcode::ITER_KEY_MAP:
+            return "ITER_KEY_MAP";
+        case Opcode::ITER_VALUE_MAP:
+            return "ITER_VALUE_MAP";
 
         // Field Access
         case Opcode::GET_FIELD:
@@ -245,6 +255,10 @@ const char* opcode_to_string(Opcode op) {
             return "WEAK_CHECK";
         case Opcode::WEAK_CREATE:
             return "WEAK_CREATE";
+        case Opcode::STR_RETAIN:
+            return "STR_RETAIN";
+        case Opcode::STR_RELEASE:
+            return "STR_RELEASE";
 
         // RK (register-or-constant) variants
         case Opcode::ADD_I_RK:
@@ -323,6 +337,36 @@ const char* opcode_to_string(Opcode op) {
         case Opcode::ASSERT_HEAP:
             return "ASSERT_HEAP";
 
+        // SIMD
+        case Opcode::VEC_F32X4:
+            return "VEC_F32X4";
+        case Opcode::VEC_F64X2:
+            return "VEC_F64X2";
+        case Opcode::VEC_I32X4:
+            return "VEC_I32X4";
+
+        // Array element access
+        case Opcode::INDEX_GET_ARR_I8:
+            return "INDEX_GET_ARR_I8";
+        case Opcode::INDEX_GET_ARR_U8:
+            return "INDEX_GET_ARR_U8";
+        case Opcode::INDEX_GET_ARR_I16:
+            return "INDEX_GET_ARR_I16";
+        case Opcode::INDEX_GET_ARR_U16:
+            return "INDEX_GET_ARR_U16";
+        case Opcode::INDEX_GET_ARR_32:
+            return "INDEX_GET_ARR_32";
+        case Opcode::INDEX_GET_ARR_64:
+            return "INDEX_GET_ARR_64";
+        case Opcode::INDEX_SET_ARR_8:
+            return "INDEX_SET_ARR_8";
+        case Opcode::INDEX_SET_ARR_16:
+            return "INDEX_SET_ARR_16";
+        case Opcode::INDEX_SET_ARR_32:
+            return "INDEX_SET_ARR_32";
+        case Opcode::INDEX_SET_ARR_64:
+            return "INDEX_SET_ARR_64";
+
         // Debug/Error
         case Opcode::TRAP:
             return "TRAP";
@@ -331,11 +375,27 @@ const char* opcode_to_string(Opcode op) {
         case Opcode::HALT:
             return "HALT";
 
+        // Superinstructions
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND)                                             \
+    case Opcode::NAME:                                                                             \
+        return #NAME;
+#include "roxy/vm/superinstructions.def"
+
         default:
             return "UNKNOWN";
     }
 }
 
+const char* vec_op_to_string(VecOp op) {
+    static const char* const names[] = {
+        "add",   "sub",    "mul",   "div",    "min",     "max",     "and",  "or",   "xor",
+        "cmp_eq", "cmp_ne", "cmp_lt", "cmp_le", "neg",     "abs",     "sqrt", "scale", "splat",
+        "shuffle", "select", "convert", "hsum", "dot",     "eq",      "ne",   "load", "store",
+    };
+    u32 index = static_cast<u32>(op);
+    return index < sizeof(names) / sizeof(names[0]) ? names[index] : "?";
+}
+
 u32 disassemble_instruction(u32 instr, u32 next_word, u32 offset, String& out) {
     Opcode op = decode_opcode(instr);
     u8 a = decode_a(instr);
@@ -355,12 +415,16 @@ u32 disassemble_instruction(u32 instr, u32 next_word, u32 offset, String& out) {
     buf.format("{:04}: {:<12} ", offset, opcode_to_string(op));
     append(buf.c_str());
 
-    switch (op) {
+    // A superinstruction carries its first op's operands; the second op is
+    // the next instruction and disassembles on its own.
+    switch (superinstruction_first_op(op)) {
         // Format: dst
         case Opcode::LOAD_NULL:
         case Opcode::LOAD_TRUE:
         case Opcode::LOAD_FALSE:
         case Opcode::RET_VOID:
+        case Opcode::STR_RETAIN:
+        case Opcode::STR_RELEASE:
             buf.format("R{}", a);
             break;
 
@@ -534,9 +598,9 @@ u32 disassemble_instruction(u32 instr, u32 next_word, u32 offset, String& out) {
             words_consumed = 2;
             break;
 
-        // Format: dst, closure_reg, arg_count (word 1) + reserved (word 2)
+        // Format: dst, closure_reg, arg_count (word 1) + inline-cache slot (word 2)
         case Opcode::CALL_INDIRECT:
-            buf.format("R{}, closure=R{}, {} args", a, b, c);
+            buf.format("R{}, closure=R{}, {} args, ic[{}]", a, b, c, next_word);
             words_consumed = 2;
             break;
 
@@ -548,15 +612,37 @@ u32 disassemble_instruction(u32 instr, u32 next_word, u32 offset, String& out) {
         // Format: dst, obj, index/key
         case Opcode::INDEX_GET_LIST:
         case Opcode::INDEX_GET_MAP:
+        case Opcode::ITER_NEXT_MAP:
+        case Opcode::ITER_KEY_MAP:
+        case Opcode::ITER_VALUE_MAP:
+        case Opcode::INDEX_GET_ARR_I8:
+        case Opcode::INDEX_GET_ARR_U8:
+        case Opcode::INDEX_GET_ARR_I16:
+        case Opcode::INDEX_GET_ARR_U16:
+        case Opcode::INDEX_GET_ARR_32:
+        case Opcode::INDEX_GET_ARR_64:
             buf.format("R{}, R{}, R{}", a, b, c);
             break;
 
         // Format: obj, index/key, value
         case Opcode::INDEX_SET_LIST:
         case Opcode::INDEX_SET_MAP:
+        case Opcode::INDEX_SET_ARR_8:
+        case Opcode::INDEX_SET_ARR_16:
+        case Opcode::INDEX_SET_ARR_32:
+        case Opcode::INDEX_SET_ARR_64:
             buf.format("R{}, R{}, R{}", a, b, c);
             break;
 
+        // Format: [dst/list, list/index, index/value] + [slot_offset, slot_count]
+        // (2-word instruction)
+        case Opcode::INDEX_FIELD_GET_LIST:
+        case Opcode::INDEX_FIELD_SET_LIST:
+            buf.format("R{}, R{}, R{}, slots={}, offset={}", a, b, c,
+                       decode_field_slot_count(next_word), decode_field_offset(next_word));
+            words_consumed = 2;
+            break;
+
         // Format: [base, value, slot_count] + [slot_offset] (2-word instruction)
         case Opcode::GET_FIELD:
         case Opcode::SET_FIELD: {
@@ -576,6 +662,15 @@ u32 disassemble_instruction(u32 instr, u32 next_word, u32 offset, String& out) {
             buf.format("R{}, stack[{}]", a, imm);
             break;
 
+        // Format: [dst, a, b] + [vec_op, c, stack slot] (2-word instruction)
+        case Opcode::VEC_F32X4:
+        case Opcode::VEC_F64X2:
+        case Opcode::VEC_I32X4:
+            buf.format("{} R{}, R{}, R{}, c={}, stack[{}]", vec_op_to_string(decode_vec_op(next_word)),
+                       a, b, c, decode_vec_c(next_word), decode_vec_slot(next_word));
+            words_consumed = 2;
+            break;
+
         // Format: [dst, src, 0] + [slot_offset] (2-word instruction)
         case Opcode::GET_FIELD_ADDR: {
             u16 slot_offset = static_cast<u16>(next_word);
@@ -617,10 +712,10 @@ u32 disassemble_instruction(u32 instr, u32 next_word, u32 offset, String& out) {
             buf.format("R{}, R{}", a, (u32)(a + 1));
             break;
 
-        // Format: reg, slot_offset (spill/reload)
+        // Format: reg, wide reg (spill/reload)
         case Opcode::SPILL_REG:
         case Opcode::RELOAD_REG:
-            buf.format("R{}, stack[{}]", a, imm);
+            buf.format("R{}, R{}", a, imm);
             break;
 
         case Opcode::NOP:
@@ -11,9 +11,13 @@
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <type_traits>
 
 #if ROXY_PROFILE_BYTECODE
+#include "roxy/core/static_string.hpp"
+
 #include <algorithm>
+#include <cstdlib>
 #if defined(__x86_64__) || defined(_M_X64)
 #include <x86intrin.h>
 #endif
@@ -29,6 +33,47 @@ namespace rx {
 static u64 g_bc_op_count[256] = {};
 static u64 g_bc_op_cycles[256] = {};
 
+// Opcode n-grams over the dynamic instruction stream — the input for choosing
+// superinstructions (superinstructions.def). A superinstruction is recorded as
+// its first op, so the counts describe the unfused stream whatever the current
+// table is. Bigrams are a dense 256x256 matrix; trigrams go into a small
+// open-addressed table (a real program touches a few thousand at most), and
+// any that do not fit are counted in g_bc_trigram_dropped.
+static u64 g_bc_bigram[256][256] = {};
+
+static constexpr u32 BC_TRIGRAM_CAPACITY = 1u << 14;
+static u32 g_bc_trigram_keys[BC_TRIGRAM_CAPACITY] = {}; // (a << 16 | b << 8 | c) + 1; 0 = empty
+static u64 g_bc_trigram_counts[BC_TRIGRAM_CAPACITY] = {};
+static u64 g_bc_trigram_dropped = 0;
+
+static inline void bc_profile_ngram(u8* history, u8 op) {
+    u8 base = static_cast<u8>(superinstruction_first_op(static_cast<Opcode>(op)));
+    g_bc_bigram[history[1]][base] += 1;
+
+    u32 key = ((static_cast<u32>(history[0]) << 16) | (static_cast<u32>(history[1]) << 8) | base);
+    key += 1;
+    u32 slot = (key * 0x9E3779B1u) & (BC_TRIGRAM_CAPACITY - 1);
+    for (u32 probe = 0;; probe++) {
+        if (probe == BC_TRIGRAM_CAPACITY) {
+            g_bc_trigram_dropped += 1;
+            break;
+        }
+        if (g_bc_trigram_keys[slot] == key) {
+            g_bc_trigram_counts[slot] += 1;
+            break;
+        }
+        if (g_bc_trigram_keys[slot] == 0) {
+            g_bc_trigram_keys[slot] = key;
+            g_bc_trigram_counts[slot] = 1;
+            break;
+        }
+        slot = (slot + 1) & (BC_TRIGRAM_CAPACITY - 1);
+    }
+
+    history[0] = history[1];
+    history[1] = base;
+}
+
 static inline u64 bc_read_cycles() {
 #if defined(__x86_64__) || defined(_M_X64)
     return __rdtsc();
@@ -45,7 +90,110 @@ void bc_profile_reset() {
     for (int i = 0; i < 256; i++) {
         g_bc_op_count[i] = 0;
         g_bc_op_cycles[i] = 0;
+        for (int j = 0; j < 256; j++)
+            g_bc_bigram[i][j] = 0;
+    }
+    for (u32 i = 0; i < BC_TRIGRAM_CAPACITY; i++) {
+        g_bc_trigram_keys[i] = 0;
+        g_bc_trigram_counts[i] = 0;
+    }
+    g_bc_trigram_dropped = 0;
+}
+
+// Top n-grams, human-readable, after the per-opcode table. NOP (0xFE) is the
+// history sentinel at interpret() entry, so n-grams containing it are skipped.
+static void bc_profile_dump_ngrams(FILE* out, u64 total_count) {
+    struct Gram {
+        u8 ops[3];
+        u64 count;
+    };
+    constexpr u8 SENTINEL = static_cast<u8>(Opcode::NOP);
+    constexpr int TOP = 20;
+
+    Vector<Gram> grams;
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            if (g_bc_bigram[i][j] == 0 || i == SENTINEL || j == SENTINEL)
+                continue;
+            grams.push_back(Gram{{static_cast<u8>(i), static_cast<u8>(j), 0}, g_bc_bigram[i][j]});
+        }
+    }
+    std::sort(grams.begin(), grams.end(),
+              [](const Gram& a, const Gram& b) { return a.count > b.count; });
+    fprintf(out, "\n%-44s %14s %8s\n", "Opcode pair", "Count", "%Ops");
+    for (int i = 0; i < TOP && i < static_cast<int>(grams.size()); i++) {
+        StaticString<64> name;
+        name.format("{} -> {}", opcode_to_string(static_cast<Opcode>(grams[i].ops[0])),
+                    opcode_to_string(static_cast<Opcode>(grams[i].ops[1])));
+        fprintf(out, "%-44s %14llu %7.2f%%\n", name.c_str(), (unsigned long long)grams[i].count,
+                100.0 * static_cast<double>(grams[i].count) / static_cast<double>(total_count));
+    }
+
+    grams.clear();
+    for (u32 i = 0; i < BC_TRIGRAM_CAPACITY; i++) {
+        if (g_bc_trigram_keys[i] == 0)
+            continue;
+        u32 key = g_bc_trigram_keys[i] - 1;
+        Gram g{{static_cast<u8>(key >> 16), static_cast<u8>(key >> 8), static_cast<u8>(key)},
+               g_bc_trigram_counts[i]};
+        if (g.ops[0] == SENTINEL || g.ops[1] == SENTINEL || g.ops[2] == SENTINEL)
+            continue;
+        grams.push_back(g);
+    }
+    std::sort(grams.begin(), grams.end(),
+              [](const Gram& a, const Gram& b) { return a.count > b.count; });
+    fprintf(out, "\n%-64s %14s %8s\n", "Opcode triple", "Count", "%Ops");
+    for (int i = 0; i < TOP && i < static_cast<int>(grams.size()); i++) {
+        StaticString<96> name;
+        name.format("{} -> {} -> {}", opcode_to_string(static_cast<Opcode>(grams[i].ops[0])),
+                    opcode_to_string(static_cast<Opcode>(grams[i].ops[1])),
+                    opcode_to_string(static_cast<Opcode>(grams[i].ops[2])));
+        fprintf(out, "%-64s %14llu %7.2f%%\n", name.c_str(), (unsigned long long)grams[i].count,
+                100.0 * static_cast<double>(grams[i].count) / static_cast<double>(total_count));
+    }
+    if (g_bc_trigram_dropped > 0)
+        fprintf(out, "(%llu trigrams dropped: table full)\n",
+                (unsigned long long)g_bc_trigram_dropped);
+}
+
+// Machine-readable n-gram counts for benchmarks/gen_superinstructions.py,
+// appended to the file named by ROXY_BC_PROFILE_NGRAMS (if set) so several
+// runs accumulate into one input. One record per line:
+//   bigram <OP> <OP> <count>
+//   trigram <OP> <OP> <OP> <count>
+static void bc_profile_write_ngrams() {
+    const char* path = getenv("ROXY_BC_PROFILE_NGRAMS");
+    if (!path || !*path)
+        return;
+    FILE* f = fopen(path, "a");
+    if (!f) {
+        fprintf(stderr, "bc_profile: cannot open %s\n", path);
+        return;
+    }
+    constexpr u8 SENTINEL = static_cast<u8>(Opcode::NOP);
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            if (g_bc_bigram[i][j] == 0 || i == SENTINEL || j == SENTINEL)
+                continue;
+            fprintf(f, "bigram %s %s %llu\n", opcode_to_string(static_cast<Opcode>(i)),
+                    opcode_to_string(static_cast<Opcode>(j)),
+                    (unsigned long long)g_bc_bigram[i][j]);
+        }
+    }
+    for (u32 i = 0; i < BC_TRIGRAM_CAPACITY; i++) {
+        if (g_bc_trigram_keys[i] == 0)
+            continue;
+        u32 key = g_bc_trigram_keys[i] - 1;
+        u8 a = static_cast<u8>(key >> 16);
+        u8 b = static_cast<u8>(key >> 8);
+        u8 c = static_cast<u8>(key);
+        if (a == SENTINEL || b == SENTINEL || c == SENTINEL)
+            continue;
+        fprintf(f, "trigram %s %s %s %llu\n", opcode_to_string(static_cast<Opcode>(a)),
+                opcode_to_string(static_cast<Opcode>(b)), opcode_to_string(static_cast<Opcode>(c)),
+                (unsigned long long)g_bc_trigram_counts[i]);
     }
+    fclose(f);
 }
 
 void bc_profile_dump(FILE* out) {
@@ -89,6 +237,9 @@ void bc_profile_dump(FILE* out) {
         fprintf(out, "%-22s %14llu %16llu %12.3f %7.2f%%\n", name,
                 (unsigned long long)rows[i].count, (unsigned long long)rows[i].cycles, avg, pct);
     }
+
+    bc_profile_dump_ngrams(out, total_count);
+    bc_profile_write_ngrams();
 }
 #else
 void bc_profile_reset() {}
@@ -145,6 +296,372 @@ inline f32 rk_const_f32(const BCFunction* func, u8 idx) {
     return v;
 }
 
+// Load one map bucket entry (key or value) into registers, in INDEX_GET_MAP's
+// format: a one-slot inline entry sign-extends, a wider inline one packs into
+// (slots + 1) / 2 registers, and a struct entry yields a pointer to its slots.
+static inline void load_map_entry(u64* regs, u8 a, const u32* src, u32 slot_count,
+                                  bool is_inline) {
+    if (!is_inline) {
+        regs[a] = reinterpret_cast<u64>(src);
+    } else if (slot_count == 1) {
+        regs[a] = static_cast<u64>(static_cast<i64>(static_cast<i32>(src[0])));
+    } else {
+        u32 reg_count = (slot_count + 1) / 2;
+        for (u32 i = 0; i < reg_count; i++) {
+            regs[a + i] = 0;
+        }
+        memcpy(&regs[a], src, sizeof(u32) * slot_count);
+    }
+}
+
+// ── Array<T> element access (INDEX_GET_ARR_* / INDEX_SET_ARR_*) ──
+//
+// An Array shares the List header, but `elements` holds packed elements of the
+// header's element_slot_count bytes. T is the load/store type: a signed T
+// sign-extends into the register, an unsigned one zero-extends. Stores keep the
+// low sizeof(T) bytes of the register.
+
+static inline u8* array_checked_element(RoxyVM* vm, void* arr, u64 idx) {
+    if (!arr) {
+        vm->error = "array index: null array reference";
+        return nullptr;
+    }
+    ListHeader* header = get_list_header(arr);
+    if (idx >= header->length) {
+        vm->error = "Array index out of bounds";
+        return nullptr;
+    }
+    return reinterpret_cast<u8*>(header->elements) + idx * header->element_slot_count;
+}
+
+template <typename T> static inline bool array_get(RoxyVM* vm, u64* regs, u32 instr) {
+    u8* elem = array_checked_element(vm, reg_as_ptr(regs[decode_b(instr)]), regs[decode_c(instr)]);
+    if (!elem)
+        return false;
+    T value;
+    memcpy(&value, elem, sizeof(T));
+    if constexpr (std::is_signed_v<T>) {
+        regs[decode_a(instr)] = static_cast<u64>(static_cast<i64>(value));
+    } else {
+        regs[decode_a(instr)] = static_cast<u64>(value);
+    }
+    return true;
+}
+
+template <typename T> static inline bool array_set(RoxyVM* vm, u64* regs, u32 instr) {
+    u8* elem = array_checked_element(vm, reg_as_ptr(regs[decode_a(instr)]), regs[decode_b(instr)]);
+    if (!elem)
+        return false;
+    T value = static_cast<T>(regs[decode_c(instr)]);
+    memcpy(elem, &value, sizeof(T));
+    return true;
+}
+
+// ── Builtin SIMD vectors (VEC_F32X4 / VEC_F64X2 / VEC_I32X4) ──
+//
+// Portable lane loops over one 16-byte vector layout — the host compiler is
+// free to vectorize them; the C backend emits real vector code. Every operand
+// is copied in before the result is written, so a result temp may alias an
+// operand (`v = v + w` in a loop reuses the instruction's temp).
+
+template <typename T> static inline T vec_lane_from_reg(u64 r) {
+    if constexpr (std::is_same_v<T, f32>) {
+        return reg_as_f32(r);
+    } else if constexpr (std::is_same_v<T, f64>) {
+        return reg_as_f64(r);
+    } else {
+        return static_cast<T>(r);
+    }
+}
+
+template <typename T> static inline u64 vec_lane_to_reg(T v) {
+    if constexpr (std::is_same_v<T, f32>) {
+        return reg_from_f32(v);
+    } else if constexpr (std::is_same_v<T, f64>) {
+        return reg_from_f64(v);
+    } else {
+        return reg_from_i64(static_cast<i64>(v));
+    }
+}
+
+// i32 lanes wrap like the scalar i32 ops: the arithmetic runs on u32.
+template <typename T> static inline T vec_wrap_add(T x, T y) {
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(static_cast<u32>(x) + static_cast<u32>(y));
+    } else {
+        return x + y;
+    }
+}
+template <typename T> static inline T vec_wrap_sub(T x, T y) {
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(static_cast<u32>(x) - static_cast<u32>(y));
+    } else {
+        return x - y;
+    }
+}
+template <typename T> static inline T vec_wrap_mul(T x, T y) {
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(static_cast<u32>(x) * static_cast<u32>(y));
+    } else {
+        return x * y;
+    }
+}
+
+// f32 -> i32 lane conversion: truncates toward zero, saturating out-of-range
+// lanes and mapping NaN to 0 (matches roxy_f32x4_convert in roxy_rt.h).
+static inline i32 vec_f32_to_i32(f32 v) {
+    if (v != v)
+        return 0;
+    if (v >= 2147483648.0f)
+        return INT32_MAX;
+    if (v <= -2147483648.0f)
+        return INT32_MIN;
+    return static_cast<i32>(v);
+}
+
+template <typename T, u32 N>
+static bool exec_vec(RoxyVM* vm, u64* regs, u32* frame_stack, u32 instr, u32 word) {
+    using Bits = std::conditional_t<sizeof(T) == 8, u64, u32>;
+    static_assert(sizeof(T) * N == 16, "SIMD vectors are 16 bytes");
+    u8 dst = decode_a(instr);
+    u8 a = decode_b(instr);
+    u8 b = decode_c(instr);
+    u8 c = decode_vec_c(word);
+    VecOp op = decode_vec_op(word);
+
+    // List element range [index, index + N) — Load reads it, Store writes it.
+    auto list_lanes = [&](u8 list_reg, u8 index_reg) -> u32* {
+        void* list_ptr = reg_as_ptr(regs[list_reg]);
+        i64 index = reg_as_i64(regs[index_reg]);
+        ListHeader* header = get_list_header(list_ptr);
+        if (index < 0 || static_cast<u64>(index) + N > header->length) {
+            vm->error = "List index out of bounds";
+            return nullptr;
+        }
+        return header->elements + index * (sizeof(T) / sizeof(u32));
+    };
+
+    // Lane-wise arithmetic is the hot path (nbody's inner loop is all Add/Sub/
+    // Scale), so it skips the staging switches below and writes the slot directly.
+    if (op <= VecOp::Mul || op == VecOp::Scale) {
+        T x[N], y[N];
+        memcpy(x, reg_as_ptr(regs[a]), 16);
+        if (op == VecOp::Scale) {
+            T s = vec_lane_from_reg<T>(regs[b]);
+            for (u32 i = 0; i < N; i++)
+                y[i] = s;
+        } else {
+            memcpy(y, reg_as_ptr(regs[b]), 16);
+        }
+        T r[N];
+        for (u32 i = 0; i < N; i++) {
+            r[i] = op == VecOp::Add   ? vec_wrap_add(x[i], y[i])
+                   : op == VecOp::Sub ? vec_wrap_sub(x[i], y[i])
+                                      : vec_wrap_mul(x[i], y[i]);
+        }
+        u32* out = frame_stack + decode_vec_slot(word);
+        memcpy(out, r, 16);
+        regs[dst] = reg_from_ptr(out);
+        return true;
+    }
+
+    if (op == VecOp::Store) {
+        u32* lanes = list_lanes(a, b);
+        if (!lanes)
+            return false;
+        memcpy(lanes, reg_as_ptr(regs[dst]), 16);
+        return true;
+    }
+
+    T x[N] = {};
+    T y[N] = {};
+    T r[N] = {};
+    Bits* rbits = reinterpret_cast<Bits*>(r);
+    switch (op) {
+        case VecOp::Splat:
+        case VecOp::Load:
+            break;
+        default:
+            memcpy(x, reg_as_ptr(regs[a]), 16);
+            break;
+    }
+    switch (op) {
+        case VecOp::Add:
+        case VecOp::Sub:
+        case VecOp::Mul:
+        case VecOp::Div:
+        case VecOp::Min:
+        case VecOp::Max:
+        case VecOp::And:
+        case VecOp::Or:
+        case VecOp::Xor:
+        case VecOp::CmpEq:
+        case VecOp::CmpNe:
+        case VecOp::CmpLt:
+        case VecOp::CmpLe:
+        case VecOp::Select:
+        case VecOp::Dot:
+        case VecOp::Eq:
+        case VecOp::Ne:
+            memcpy(y, reg_as_ptr(regs[b]), 16);
+            break;
+        default:
+            break;
+    }
+
+    switch (op) {
+        case VecOp::Add:
+            for (u32 i = 0; i < N; i++)
+                r[i] = vec_wrap_add(x[i], y[i]);
+            break;
+        case VecOp::Sub:
+            for (u32 i = 0; i < N; i++)
+                r[i] = vec_wrap_sub(x[i], y[i]);
+            break;
+        case VecOp::Mul:
+            for (u32 i = 0; i < N; i++)
+                r[i] = vec_wrap_mul(x[i], y[i]);
+            break;
+        case VecOp::Div:
+            if constexpr (std::is_floating_point_v<T>) {
+                for (u32 i = 0; i < N; i++)
+                    r[i] = x[i] / y[i];
+            }
+            break;
+        case VecOp::Min:
+            for (u32 i = 0; i < N; i++)
+                r[i] = x[i] < y[i] ? x[i] : y[i];
+            break;
+        case VecOp::Max:
+            for (u32 i = 0; i < N; i++)
+                r[i] = x[i] > y[i] ? x[i] : y[i];
+            break;
+        case VecOp::And:
+        case VecOp::Or:
+        case VecOp::Xor: {
+            Bits xb[N], yb[N];
+            memcpy(xb, x, 16);
+            memcpy(yb, y, 16);
+            for (u32 i = 0; i < N; i++) {
+                rbits[i] = op == VecOp::And  ? (xb[i] & yb[i])
+                           : op == VecOp::Or ? (xb[i] | yb[i])
+                                             : (xb[i] ^ yb[i]);
+            }
+            break;
+        }
+        case VecOp::CmpEq:
+        case VecOp::CmpNe:
+        case VecOp::CmpLt:
+        case VecOp::CmpLe:
+            for (u32 i = 0; i < N; i++) {
+                bool set = op == VecOp::CmpEq   ? x[i] == y[i]
+                           : op == VecOp::CmpNe ? x[i] != y[i]
+                           : op == VecOp::CmpLt ? x[i] < y[i]
+                                                : x[i] <= y[i];
+                rbits[i] = set ? ~Bits(0) : Bits(0);
+            }
+            break;
+        case VecOp::Neg:
+            for (u32 i = 0; i < N; i++) {
+                if constexpr (std::is_floating_point_v<T>) {
+                    r[i] = -x[i];
+                } else {
+                    r[i] = vec_wrap_sub(T(0), x[i]);
+                }
+            }
+            break;
+        case VecOp::Abs:
+            for (u32 i = 0; i < N; i++) {
+                if constexpr (std::is_floating_point_v<T>) {
+                    r[i] = std::fabs(x[i]);
+                } else {
+                    r[i] = x[i] < 0 ? vec_wrap_sub(T(0), x[i]) : x[i];
+                }
+            }
+            break;
+        case VecOp::Sqrt:
+            if constexpr (std::is_floating_point_v<T>) {
+                for (u32 i = 0; i < N; i++)
+                    r[i] = std::sqrt(x[i]);
+            }
+            break;
+        case VecOp::Scale: {
+            T s = vec_lane_from_reg<T>(regs[b]);
+            for (u32 i = 0; i < N; i++)
+                r[i] = vec_wrap_mul(x[i], s);
+            break;
+        }
+        case VecOp::Splat: {
+            T s = vec_lane_from_reg<T>(regs[a]);
+            for (u32 i = 0; i < N; i++)
+                r[i] = s;
+            break;
+        }
+        case VecOp::Shuffle:
+            for (u32 i = 0; i < N; i++)
+                r[i] = x[(c >> (2 * i)) & 3];
+            break;
+        case VecOp::Select: {
+            // Bitwise over the raw 16 bytes, so one mask layout serves every kind.
+            u32 xw[4], yw[4], mw[4], rw[4];
+            memcpy(xw, x, 16);
+            memcpy(yw, y, 16);
+            memcpy(mw, reg_as_ptr(regs[c]), 16);
+            for (u32 i = 0; i < 4; i++)
+                rw[i] = (xw[i] & mw[i]) | (yw[i] & ~mw[i]);
+            memcpy(r, rw, 16);
+            break;
+        }
+        case VecOp::Convert:
+            // The opcode names the source layout: f32x4 -> i32x4 or i32x4 -> f32x4.
+            if constexpr (std::is_same_v<T, f32>) {
+                i32 out[4];
+                for (u32 i = 0; i < 4; i++)
+                    out[i] = vec_f32_to_i32(x[i]);
+                memcpy(r, out, 16);
+            } else if constexpr (std::is_same_v<T, i32>) {
+                f32 out[4];
+                for (u32 i = 0; i < 4; i++)
+                    out[i] = static_cast<f32>(x[i]);
+                memcpy(r, out, 16);
+            }
+            break;
+        case VecOp::Hsum:
+        case VecOp::Dot: {
+            if (op == VecOp::Dot) {
+                for (u32 i = 0; i < N; i++)
+                    x[i] = vec_wrap_mul(x[i], y[i]);
+            }
+            T sum = N == 4 ? vec_wrap_add(vec_wrap_add(x[0], x[1]), vec_wrap_add(x[2], x[3 % N]))
+                           : vec_wrap_add(x[0], x[1]);
+            regs[dst] = vec_lane_to_reg(sum);
+            return true;
+        }
+        case VecOp::Eq:
+        case VecOp::Ne: {
+            bool equal = true;
+            for (u32 i = 0; i < N; i++)
+                equal = equal && x[i] == y[i];
+            regs[dst] = reg_from_bool(op == VecOp::Eq ? equal : !equal);
+            return true;
+        }
+        case VecOp::Load: {
+            u32* lanes = list_lanes(a, b);
+            if (!lanes)
+                return false;
+            memcpy(r, lanes, 16);
+            break;
+        }
+        case VecOp::Store:
+            return true;
+    }
+
+    u32* out = frame_stack + decode_vec_slot(word);
+    memcpy(out, r, 16);
+    regs[dst] = reg_from_ptr(out);
+    return true;
+}
+
 // Helper to load constant from constant pool into a u64 register
 static u64 load_constant(RoxyVM* vm, const BCFunction* func, u16 index) {
     if (index >= func->constants.size()) {
@@ -174,51 +691,58 @@ static u64 load_constant(RoxyVM* vm, const BCFunction* func, u16 index) {
     }
 }
 
-// Generic re-entrant function call from native code. Pushes a frame for the
-// target function with the given arg registers, runs the interpreter until
-// that frame returns, and recovers the return value via the slot RET writes
-// when stop_depth fires (see the OP(RET) handler).
+// Generic re-entrant function call from native code. Resolves `func_idx` and
+// hands off to call_resolved_function.
 //
 // Returns the function's return value as a u64. For void-returning functions
 // the result is undefined (caller should ignore it).
 //
-// Used by Map's struct-key Hash/Eq dispatch to invoke user-defined `hash()`
-// / `eq()` methods from inside `map_hash_key` / `map_keys_equal`.
+// Used by List.sort_by's comparator trampoline; the map Hash/Eq trampolines
+// resolve their callees once per map op and call call_resolved_function.
 u64 call_user_function(RoxyVM* vm, u32 func_idx, const u64* args, u32 argc) {
     if (func_idx >= vm->function_count)
         return 0;
     const BCFunction* fn = vm->function_ptrs[func_idx];
     if (!fn)
         return 0;
-    if (vm->call_stack_size >= vm->call_stack_capacity)
-        return 0;
+    return call_resolved_function(vm, fn, args, argc);
+}
 
+// The nested-dispatch entry: the frame setup of OP(CALL) followed by a nested
+// interpret that stops when the frame returns. Like OP(CALL) it zeroes the
+// register window only in debug builds (SSA writes every register before
+// reading it), so a probe into a user `K::eq` costs a frame push, the
+// argument copy and the callee's own instructions. The result is recovered
+// from the slot RET writes when stop_depth fires (see the OP(RET) handler).
+u64 call_resolved_function(RoxyVM* vm, const BCFunction* fn, const u64* args, u32 argc) {
+    if (vm->call_stack_size >= vm->call_stack_capacity) {
+        vm->error = "call stack overflow in user function callback";
+        return 0;
+    }
     u32 saved_register_top = vm->register_top;
     if (saved_register_top + fn->register_count > vm->register_file_size) {
         vm->error = "register file overflow in user function callback";
         return 0;
     }
-    vm->register_top += fn->register_count;
-
-    u64* call_regs = &vm->register_file[saved_register_top];
-    // Zero the window so unwritten args read as 0 (defensive).
-    memset(call_regs, 0, fn->register_count * sizeof(u64));
-    for (u32 i = 0; i < argc; i++) {
-        call_regs[i] = args[i];
-    }
-
     u32 saved_local_stack_top = vm->local_stack_top;
-    u32 local_stack_base = vm->local_stack_top;
+    u32 local_stack_base = (saved_local_stack_top + 3) & ~3u;
     if (local_stack_base + fn->local_stack_slots > vm->local_stack_size) {
-        vm->register_top = saved_register_top;
         vm->error = "local stack overflow in user function callback";
         return 0;
     }
-    vm->local_stack_top += fn->local_stack_slots;
+    vm->register_top += fn->register_count;
+    vm->local_stack_top = local_stack_base + fn->local_stack_slots;
+
+    u64* call_regs = &vm->register_file[saved_register_top];
+    memcpy(call_regs, args, argc * sizeof(u64));
+#ifndef NDEBUG
+    for (u32 i = argc; i < fn->register_count; i++)
+        call_regs[i] = 0;
+#endif
 
     u32 saved_depth = vm->call_stack_size;
     vm->call_stack[vm->call_stack_size++] =
-        CallFrame(fn, fn->code.data(), call_regs, 0, local_stack_base);
+        CallFrame(fn, vm_entry_pc(vm, fn), call_regs, 0, local_stack_base);
 
     interpret(vm, saved_depth);
 
@@ -267,7 +791,7 @@ static void call_cleanup_destructor(RoxyVM* vm, u16 func_idx, void* obj_ptr) {
     // Push call frame
     u32 saved_depth = vm->call_stack_size;
     vm->call_stack[vm->call_stack_size++] =
-        CallFrame(dtor_func, dtor_func->code.data(), dtor_regs, 0, local_stack_base);
+        CallFrame(dtor_func, vm_entry_pc(vm, dtor_func), dtor_regs, 0, local_stack_base);
 
     // Run the destructor via nested interpretation
     interpret(vm, saved_depth);
@@ -333,7 +857,9 @@ static void delete_value(RoxyVM* vm, void* ptr, const BCDeleteDesc& desc, const
             // buffer so the borrowed pointer can't dangle (lifetimes.md "Container element
             // lvalues").
             if (header->borrow_count != 0) {
-                vm->error = "cannot delete a List while an element of it is borrowed (inout/out)";
+                vm->error =
+                    "cannot delete a List "
+                    "while an element of it is borrowed (inout/out or for-in)";
                 return;
             }
             if (header->elements && desc.container.elem_desc_idx != 0xFFFF) {
@@ -349,10 +875,21 @@ static void delete_value(RoxyVM* vm, void* ptr, const BCDeleteDesc& desc, const
             break;
         }
 
+        case BCDeleteDesc::Array: { // packed primitives: release the (possibly mapped) buffer
+            if (get_list_header(ptr)->borrow_count != 0) {
+                vm->error = "cannot delete an Array while an element of it is borrowed (for-in)";
+                return;
+            }
+            roxy_array_delete(ptr);
+            break;
+        }
+
         case BCDeleteDesc::Map: { // iterate occupied buckets, recurse, free bucket buffers
             MapHeader* header = get_map_header(ptr);
             if (header->borrow_count != 0) {
-                vm->error = "cannot delete a Map while a value of it is borrowed (inout/out)";
+                vm->error =
+                    "cannot delete a Map "
+                    "while a value of it is borrowed (inout/out or for-in)";
                 return;
             }
             if (header->capacity > 0 && header->distances) {
@@ -570,23 +1107,33 @@ static void execute_cleanup(RoxyVM* vm, const BCFunction* func, u32 throw_pc, u3
 #define OP(name) op_##name:
 #if ROXY_PROFILE_BYTECODE
 // Profiling DISPATCH: attribute (now - prev_tsc) to whichever opcode just
-// finished, then load + dispatch the next one. `bc_prev_op` and `bc_prev_tsc`
-// are local-scope variables initialized at interpret() entry.
+// finished, then load + dispatch the next one. `bc_prev_op`, `bc_prev_tsc` and
+// `bc_history` are local-scope variables initialized at interpret() entry.
+// Threaded or not, the profiler dispatches through the table.
 #define DISPATCH()                                                                                 \
     do {                                                                                           \
         u64 _now = bc_read_cycles();                                                               \
         g_bc_op_cycles[bc_prev_op] += _now - bc_prev_tsc;                                          \
         g_bc_op_count[bc_prev_op] += 1;                                                            \
-        instr = *pc++;                                                                             \
+        instr = static_cast<u32>(*pc++);                                                           \
         bc_prev_op = static_cast<u8>(instr >> 24);                                                 \
+        bc_profile_ngram(bc_history, bc_prev_op);                                                  \
         bc_prev_tsc = _now;                                                                        \
         goto* dispatch_table[instr >> 24];                                                         \
     } while (0)
 #else
+// Threaded: one 64-bit load yields both the instruction word and its handler's
+// offset from `threaded_base` (see build_threaded_code) — no table lookup.
 #define DISPATCH()                                                                                 \
     do {                                                                                           \
-        instr = *pc++;                                                                             \
-        goto* dispatch_table[instr >> 24];                                                         \
+        if constexpr (Threaded) {                                                                  \
+            u64 _slot = *pc++;                                                                     \
+            instr = static_cast<u32>(_slot);                                                       \
+            goto* (threaded_base + static_cast<i32>(_slot >> 32));                                 \
+        } else {                                                                                   \
+            instr = static_cast<u32>(*pc++);                                                       \
+            goto* dispatch_table[instr >> 24];                                                     \
+        }                                                                                          \
     } while (0)
 #endif
 #else
@@ -594,28 +1141,56 @@ static void execute_cleanup(RoxyVM* vm, const BCFunction* func, u32 throw_pc, u3
 #define DISPATCH() break
 #endif
 
-bool interpret(RoxyVM* vm, u32 stop_depth) {
-    if (vm->call_stack_empty()) {
-        vm->error = "No call frame";
-        return false;
-    }
+// Frame PC <-> the loop's `pc`. CallFrame stores a `const u32*`; in the
+// threaded loop it actually points into BCFunction::threaded_code.
+#define LOAD_FRAME_PC() (pc = reinterpret_cast<const CodeWord*>(frame->pc))
+#define SAVE_FRAME_PC() (frame->pc = reinterpret_cast<const u32*>(pc))
+
+// Tail of a superinstruction: run the pair's second op. With computed goto
+// that is a direct jump into its handler — the dispatch-table load and the
+// indirect branch are what the fusion saves. The profiler and the switch
+// fallback take a normal dispatch instead, so every op is still counted (and
+// the switch needs no label to jump to).
+#if RX_USE_COMPUTED_GOTO && !ROXY_PROFILE_BYTECODE
+#define SUPER_DISPATCH(second)                                                                     \
+    do {                                                                                           \
+        instr = static_cast<u32>(*pc++);                                                           \
+        goto op_##second;                                                                          \
+    } while (0)
+#else
+#define SUPER_DISPATCH(second) DISPATCH()
+#endif
 
-    // Cache current frame
-    CallFrame* frame = &vm->call_stack_back();
-    const BCFunction* func = frame->func;
-    const u32* pc = frame->pc;
-    u64* regs = frame->registers;
+// Per-opcode handler offsets of the threaded loop from its base label,
+// exported by a one-time interpret_loop<true>(nullptr, 0) call — a label's
+// address can only be taken inside the function that defines it.
+static i32 g_threaded_offsets[256];
 
-    u32 instr;
+// Code start for a frame running `callee` in this loop's mode.
+template <bool Threaded> static inline const u32* entry_pc(const BCFunction* callee) {
+    if constexpr (Threaded) {
+        return reinterpret_cast<const u32*>(callee->threaded_code.data());
+    } else {
+        return callee->code.data();
+    }
+}
 
-#if ROXY_PROFILE_BYTECODE
-    // Profiler bookkeeping: which opcode is currently "in flight" and the
-    // cycle counter reading taken when it began executing. NOP (0xFE) is
-    // used as a no-op sentinel for the very first DISPATCH and absorbs the
-    // small slice of time spent setting up the dispatch table.
-    u8 bc_prev_op = 0xFE;
-    u64 bc_prev_tsc = bc_read_cycles();
-#endif
+// Word index of a frame PC within `func` — the unit of handler/cleanup PCs.
+template <bool Threaded> static inline u32 pc_offset(const BCFunction* func, const u32* frame_pc) {
+    if constexpr (Threaded) {
+        return static_cast<u32>(reinterpret_cast<const u64*>(frame_pc) -
+                                func->threaded_code.data());
+    } else {
+        return static_cast<u32>(frame_pc - func->code.data());
+    }
+}
+
+// The dispatch loop, instantiated twice: over the packed u32 code with the
+// opcode table, and (computed goto only) over BCFunction::threaded_code. Both
+// streams have the same word indices, so jump offsets and handler/cleanup PCs
+// are shared; the only differences are DISPATCH and the `pc` element type.
+template <bool Threaded> static bool interpret_loop(RoxyVM* vm, u32 stop_depth) {
+    using CodeWord = std::conditional_t<Threaded, u64, u32>;
 
 #if RX_USE_COMPUTED_GOTO
     // 256-entry dispatch table, one per possible opcode byte value.
@@ -748,23 +1323,10 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         [0x6E] = &&op_DEFAULT,
         [0x6F] = &&op_DEFAULT,
 
-        // 0x70-0x7F: Unused
-        [0x70] = &&op_DEFAULT,
-        [0x71] = &&op_DEFAULT,
-        [0x72] = &&op_DEFAULT,
-        [0x73] = &&op_DEFAULT,
-        [0x74] = &&op_DEFAULT,
-        [0x75] = &&op_DEFAULT,
-        [0x76] = &&op_DEFAULT,
-        [0x77] = &&op_DEFAULT,
-        [0x78] = &&op_DEFAULT,
-        [0x79] = &&op_DEFAULT,
-        [0x7A] = &&op_DEFAULT,
-        [0x7B] = &&op_DEFAULT,
-        [0x7C] = &&op_DEFAULT,
-        [0x7D] = &&op_DEFAULT,
-        [0x7E] = &&op_DEFAULT,
-        [0x7F] = &&op_DEFAULT,
+        // 0x70-0x7F: Superinstructions (superinstructions.def)
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND) [byte] = &&op_##NAME,
+#define RX_SUPERINSTRUCTION_UNUSED(byte) [byte] = &&op_DEFAULT,
+#include "roxy/vm/superinstructions.def"
 
         // 0x80-0x8F: Type Conversions
         [0x80] = &&op_I_TO_F64,
@@ -886,37 +1448,76 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         [0xE8] = &&op_STR_RETAIN,
         [0xE9] = &&op_STR_RELEASE,
         [0xEA] = &&op_INDEX_TRYADDR_MAP,
-        [0xEB] = &&op_DEFAULT,
-        [0xEC] = &&op_DEFAULT,
-        [0xED] = &&op_DEFAULT,
-        [0xEE] = &&op_DEFAULT,
-        [0xEF] = &&op_DEFAULT,
+        [0xEB] = &&op_INDEX_FIELD_GET_LIST,
+        [0xEC] = &&op_INDEX_FIELD_SET_LIST,
+        [0xED] = &&op_ITER_NEXT_MAP,
+        [0xEE] = &&op_ITER_KEY_MAP,
+        [0xEF] = &&op_ITER_VALUE_MAP,
 
         // 0xF0-0xFF: Debug/Error
         [0xF0] = &&op_TRAP,
-        [0xF1] = &&op_DEFAULT,
-        [0xF2] = &&op_DEFAULT,
-        [0xF3] = &&op_DEFAULT,
-        [0xF4] = &&op_DEFAULT,
-        [0xF5] = &&op_DEFAULT,
-        [0xF6] = &&op_DEFAULT,
-        [0xF7] = &&op_DEFAULT,
-        [0xF8] = &&op_DEFAULT,
-        [0xF9] = &&op_DEFAULT,
-        [0xFA] = &&op_DEFAULT,
-        [0xFB] = &&op_DEFAULT,
-        [0xFC] = &&op_DEFAULT,
-        [0xFD] = &&op_DEFAULT,
+        [0xF1] = &&op_VEC_F32X4,
+        [0xF2] = &&op_VEC_F64X2,
+        [0xF3] = &&op_VEC_I32X4,
+        [0xF4] = &&op_INDEX_GET_ARR_I8,
+        [0xF5] = &&op_INDEX_GET_ARR_U8,
+        [0xF6] = &&op_INDEX_GET_ARR_I16,
+        [0xF7] = &&op_INDEX_GET_ARR_U16,
+        [0xF8] = &&op_INDEX_GET_ARR_32,
+        [0xF9] = &&op_INDEX_GET_ARR_64,
+        [0xFA] = &&op_INDEX_SET_ARR_8,
+        [0xFB] = &&op_INDEX_SET_ARR_16,
+        [0xFC] = &&op_INDEX_SET_ARR_32,
+        [0xFD] = &&op_INDEX_SET_ARR_64,
         [0xFE] = &&op_NOP,
         [0xFF] = &&op_HALT,
     };
 
+    [[maybe_unused]] const char* threaded_base = static_cast<const char*>(&&op_DEFAULT);
+    if constexpr (Threaded) {
+        if (!vm) {
+            // Label export for build_threaded_code (see g_threaded_offsets).
+            for (u32 i = 0; i < 256; i++) {
+                i64 offset = static_cast<const char*>(dispatch_table[i]) - threaded_base;
+                assert(offset >= INT32_MIN && offset <= INT32_MAX);
+                g_threaded_offsets[i] = static_cast<i32>(offset);
+            }
+            return true;
+        }
+    }
+#endif
+
+    if (vm->call_stack_empty()) {
+        vm->error = "No call frame";
+        return false;
+    }
+
+    // Cache current frame
+    CallFrame* frame = &vm->call_stack_back();
+    const BCFunction* func = frame->func;
+    const CodeWord* pc = reinterpret_cast<const CodeWord*>(frame->pc);
+    u64* regs = frame->registers;
+
+    u32 instr;
+
+#if ROXY_PROFILE_BYTECODE
+    // Profiler bookkeeping: which opcode is currently "in flight" and the
+    // cycle counter reading taken when it began executing. NOP (0xFE) is
+    // used as a no-op sentinel for the very first DISPATCH and absorbs the
+    // small slice of time spent setting up the dispatch table.
+    u8 bc_prev_op = 0xFE;
+    u64 bc_prev_tsc = bc_read_cycles();
+    // The two ops before the one being dispatched, for n-gram counting.
+    u8 bc_history[2] = {0xFE, 0xFE};
+#endif
+
+#if RX_USE_COMPUTED_GOTO
     // Initial dispatch
     DISPATCH();
 #else
     // Main dispatch loop (switch-based fallback)
     for (;;) {
-        instr = *pc++;
+        instr = static_cast<u32>(*pc++);
         switch (decode_opcode(instr)) {
 #endif
 
@@ -937,38 +1538,50 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         DISPATCH();
     }
 
+#define RX_BODY_LOAD_INT                                                                           \
+    regs[decode_a(instr)] = reg_from_i64(static_cast<i16>(decode_imm16(instr)))
     OP(LOAD_INT) {
-        regs[decode_a(instr)] = reg_from_i64(static_cast<i16>(decode_imm16(instr)));
+        RX_BODY_LOAD_INT;
         DISPATCH();
     }
 
+#define RX_BODY_LOAD_CONST                                                                         \
+    regs[decode_a(instr)] = load_constant(vm, func, decode_imm16(instr))
     OP(LOAD_CONST) {
-        regs[decode_a(instr)] = load_constant(vm, func, decode_imm16(instr));
+        RX_BODY_LOAD_CONST;
         DISPATCH();
     }
 
+#define RX_BODY_MOV                                                                                \
+    regs[decode_a(instr)] = regs[decode_b(instr)]
     OP(MOV) {
-        regs[decode_a(instr)] = regs[decode_b(instr)];
+        RX_BODY_MOV;
         DISPATCH();
     }
 
     // ── Integer Arithmetic ──
 
+#define RX_BODY_ADD_I                                                                              \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_i64(reg_as_i64(regs[decode_b(instr)]) + reg_as_i64(regs[decode_c(instr)]))
     OP(ADD_I) {
-        regs[decode_a(instr)] =
-            reg_from_i64(reg_as_i64(regs[decode_b(instr)]) + reg_as_i64(regs[decode_c(instr)]));
+        RX_BODY_ADD_I;
         DISPATCH();
     }
 
+#define RX_BODY_SUB_I                                                                              \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_i64(reg_as_i64(regs[decode_b(instr)]) - reg_as_i64(regs[decode_c(instr)]))
     OP(SUB_I) {
-        regs[decode_a(instr)] =
-            reg_from_i64(reg_as_i64(regs[decode_b(instr)]) - reg_as_i64(regs[decode_c(instr)]));
+        RX_BODY_SUB_I;
         DISPATCH();
     }
 
+#define RX_BODY_MUL_I                                                                              \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_i64(reg_as_i64(regs[decode_b(instr)]) * reg_as_i64(regs[decode_c(instr)]))
     OP(MUL_I) {
-        regs[decode_a(instr)] =
-            reg_from_i64(reg_as_i64(regs[decode_b(instr)]) * reg_as_i64(regs[decode_c(instr)]));
+        RX_BODY_MUL_I;
         DISPATCH();
     }
 
@@ -1051,21 +1664,27 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
     // ── f64 Arithmetic ──
 
+#define RX_BODY_ADD_D                                                                              \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_f64(reg_as_f64(regs[decode_b(instr)]) + reg_as_f64(regs[decode_c(instr)]))
     OP(ADD_D) {
-        regs[decode_a(instr)] =
-            reg_from_f64(reg_as_f64(regs[decode_b(instr)]) + reg_as_f64(regs[decode_c(instr)]));
+        RX_BODY_ADD_D;
         DISPATCH();
     }
 
+#define RX_BODY_SUB_D                                                                              \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_f64(reg_as_f64(regs[decode_b(instr)]) - reg_as_f64(regs[decode_c(instr)]))
     OP(SUB_D) {
-        regs[decode_a(instr)] =
-            reg_from_f64(reg_as_f64(regs[decode_b(instr)]) - reg_as_f64(regs[decode_c(instr)]));
+        RX_BODY_SUB_D;
         DISPATCH();
     }
 
+#define RX_BODY_MUL_D                                                                              \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_f64(reg_as_f64(regs[decode_b(instr)]) * reg_as_f64(regs[decode_c(instr)]))
     OP(MUL_D) {
-        regs[decode_a(instr)] =
-            reg_from_f64(reg_as_f64(regs[decode_b(instr)]) * reg_as_f64(regs[decode_c(instr)]));
+        RX_BODY_MUL_D;
         DISPATCH();
     }
 
@@ -1259,21 +1878,27 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
     // when the RHS is a compile-time constant. Lowering canonicalizes commutative
     // ops so the constant lands on the RHS.
 
+#define RX_BODY_ADD_I_RK                                                                           \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_i64(reg_as_i64(regs[decode_b(instr)]) + rk_const_i64(func, decode_c(instr)))
     OP(ADD_I_RK) {
-        regs[decode_a(instr)] =
-            reg_from_i64(reg_as_i64(regs[decode_b(instr)]) + rk_const_i64(func, decode_c(instr)));
+        RX_BODY_ADD_I_RK;
         DISPATCH();
     }
 
+#define RX_BODY_SUB_I_RK                                                                           \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_i64(reg_as_i64(regs[decode_b(instr)]) - rk_const_i64(func, decode_c(instr)))
     OP(SUB_I_RK) {
-        regs[decode_a(instr)] =
-            reg_from_i64(reg_as_i64(regs[decode_b(instr)]) - rk_const_i64(func, decode_c(instr)));
+        RX_BODY_SUB_I_RK;
         DISPATCH();
     }
 
+#define RX_BODY_MUL_I_RK                                                                           \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_i64(reg_as_i64(regs[decode_b(instr)]) * rk_const_i64(func, decode_c(instr)))
     OP(MUL_I_RK) {
-        regs[decode_a(instr)] =
-            reg_from_i64(reg_as_i64(regs[decode_b(instr)]) * rk_const_i64(func, decode_c(instr)));
+        RX_BODY_MUL_I_RK;
         DISPATCH();
     }
 
@@ -1295,21 +1920,27 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         DISPATCH();
     }
 
+#define RX_BODY_ADD_D_RK                                                                           \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_f64(reg_as_f64(regs[decode_b(instr)]) + rk_const_f64(func, decode_c(instr)))
     OP(ADD_D_RK) {
-        regs[decode_a(instr)] =
-            reg_from_f64(reg_as_f64(regs[decode_b(instr)]) + rk_const_f64(func, decode_c(instr)));
+        RX_BODY_ADD_D_RK;
         DISPATCH();
     }
 
+#define RX_BODY_SUB_D_RK                                                                           \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_f64(reg_as_f64(regs[decode_b(instr)]) - rk_const_f64(func, decode_c(instr)))
     OP(SUB_D_RK) {
-        regs[decode_a(instr)] =
-            reg_from_f64(reg_as_f64(regs[decode_b(instr)]) - rk_const_f64(func, decode_c(instr)));
+        RX_BODY_SUB_D_RK;
         DISPATCH();
     }
 
+#define RX_BODY_MUL_D_RK                                                                           \
+    regs[decode_a(instr)] =                                                                        \
+        reg_from_f64(reg_as_f64(regs[decode_b(instr)]) * rk_const_f64(func, decode_c(instr)))
     OP(MUL_D_RK) {
-        regs[decode_a(instr)] =
-            reg_from_f64(reg_as_f64(regs[decode_b(instr)]) * rk_const_f64(func, decode_c(instr)));
+        RX_BODY_MUL_D_RK;
         DISPATCH();
     }
 
@@ -1403,8 +2034,10 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
     // ── Type Conversions ──
 
+#define RX_BODY_I_TO_F64                                                                           \
+    regs[decode_a(instr)] = reg_from_f64(static_cast<f64>(reg_as_i64(regs[decode_b(instr)])))
     OP(I_TO_F64) {
-        regs[decode_a(instr)] = reg_from_f64(static_cast<f64>(reg_as_i64(regs[decode_b(instr)])));
+        RX_BODY_I_TO_F64;
         DISPATCH();
     }
 
@@ -1675,7 +2308,7 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
         frame = &vm->call_stack_back();
         func = frame->func;
-        pc = frame->pc;
+        LOAD_FRAME_PC();
         regs = frame->registers;
 
         regs[return_reg] = result;
@@ -1702,7 +2335,7 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
         frame = &vm->call_stack_back();
         func = frame->func;
-        pc = frame->pc;
+        LOAD_FRAME_PC();
         regs = frame->registers;
         DISPATCH();
     }
@@ -1729,7 +2362,7 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
             return false;
         }
 
-        frame->pc = pc;
+        SAVE_FRAME_PC();
 
         u64* callee_regs = &vm->register_file[vm->register_top];
         vm->register_top += callee->register_count;
@@ -1752,11 +2385,11 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         vm->local_stack_top = local_stack_base + callee->local_stack_slots;
 
         vm->call_stack[vm->call_stack_size++] =
-            CallFrame(callee, callee->code.data(), callee_regs, dst, local_stack_base);
+            CallFrame(callee, entry_pc<Threaded>(callee), callee_regs, dst, local_stack_base);
 
         frame = &vm->call_stack_back();
         func = frame->func;
-        pc = frame->pc;
+        LOAD_FRAME_PC();
         regs = frame->registers;
         DISPATCH();
     }
@@ -1795,12 +2428,16 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
     // that, dispatch to the resolved function, place the env pointer at the
     // callee's first register (the synthesized lifted function takes
     // `__env: ref EnvStruct` as its first param), and copy explicit args after.
+    //
+    // The second word is this site's inline-cache slot (see IndirectCallCache).
+    // A hit reuses the cached frame layout; only a miss validates the index and
+    // reads the callee's BCFunction.
     OP(CALL_INDIRECT) {
         u8 dst = decode_a(instr);
         u8 closure_reg = decode_b(instr);
         // arg_count: explicit args (does not include the env pointer prepended below)
-        u32 reserved = *pc++; // future inline-cache slot
-        (void)reserved;
+        u32 ic_slot = *pc++;
+        assert(ic_slot < vm->indirect_call_cache_count);
 
         void* env_ptr = reg_as_ptr(regs[closure_reg]);
         if (!env_ptr) {
@@ -1808,14 +2445,26 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
             return false;
         }
         u32 func_idx = *reinterpret_cast<const u32*>(env_ptr);
-        if (func_idx >= vm->function_count) {
-            vm->error = "indirect call: invalid function index in closure";
-            return false;
-        }
-        const BCFunction* callee = vm->function_ptrs[func_idx];
-        u8 first_arg = dst + callee->ret_reg_count;
-
-        if (vm->register_top + callee->register_count > vm->register_file_size) {
+        IndirectCallCache& ic = vm->indirect_call_caches[ic_slot];
+        if (ic.func_idx != func_idx) {
+            if (func_idx >= vm->function_count) {
+                vm->error = "indirect call: invalid function index in closure";
+                return false;
+            }
+            const BCFunction* target = vm->function_ptrs[func_idx];
+            ic.func_idx = func_idx;
+            ic.register_count = target->register_count;
+            ic.local_stack_slots = target->local_stack_slots;
+            ic.explicit_param_regs =
+                (target->param_register_count > 0) ? target->param_register_count - 1 : 0;
+            ic.ret_reg_count = target->ret_reg_count;
+            ic.callee = target;
+            ic.code = entry_pc<Threaded>(target);
+            ic.miss_count++;
+        }
+        u8 first_arg = static_cast<u8>(dst + ic.ret_reg_count);
+
+        if (vm->register_top + ic.register_count > vm->register_file_size) {
             vm->error = "Register file overflow";
             return false;
         }
@@ -1824,39 +2473,37 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
             return false;
         }
 
-        frame->pc = pc;
+        SAVE_FRAME_PC();
 
         u64* callee_regs = &vm->register_file[vm->register_top];
-        vm->register_top += callee->register_count;
+        vm->register_top += ic.register_count;
 
         // Place the env pointer at callee_regs[0] (the hidden first param), then
         // copy explicit args from the caller's argument register block.
         callee_regs[0] = reg_from_ptr(env_ptr);
-        u32 explicit_param_regs =
-            (callee->param_register_count > 0) ? callee->param_register_count - 1 : 0;
-        if (explicit_param_regs > 0) {
-            memcpy(&callee_regs[1], &regs[first_arg], explicit_param_regs * sizeof(u64));
+        if (ic.explicit_param_regs > 0) {
+            memcpy(&callee_regs[1], &regs[first_arg], ic.explicit_param_regs * sizeof(u64));
         }
 
 #ifndef NDEBUG
-        for (u32 i = callee->param_register_count; i < callee->register_count; i++) {
+        for (u32 i = ic.explicit_param_regs + 1; i < ic.register_count; i++) {
             callee_regs[i] = 0;
         }
 #endif
 
         u32 local_stack_base = (vm->local_stack_top + 3) & ~3u;
-        if (local_stack_base + callee->local_stack_slots > vm->local_stack_size) {
+        if (local_stack_base + ic.local_stack_slots > vm->local_stack_size) {
             vm->error = "Local stack overflow";
             return false;
         }
-        vm->local_stack_top = local_stack_base + callee->local_stack_slots;
+        vm->local_stack_top = local_stack_base + ic.local_stack_slots;
 
         vm->call_stack[vm->call_stack_size++] =
-            CallFrame(callee, callee->code.data(), callee_regs, dst, local_stack_base);
+            CallFrame(ic.callee, ic.code, callee_regs, dst, local_stack_base);
 
         frame = &vm->call_stack_back();
         func = frame->func;
-        pc = frame->pc;
+        LOAD_FRAME_PC();
         regs = frame->registers;
         DISPATCH();
     }
@@ -1878,48 +2525,52 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
     // ── Container Indexing ──
 
+    // A 1-slot (<= 32-bit) integer element is sign-extended to fill the 64-bit
+    // register — see the matching comment on GET_FIELD for the invariant.
+    // Without this, `lst[0]` on a List<i32> holding -1 loads 0x00000000FFFFFFFF,
+    // which compares as +4294967295.
+    //
+    // Wider than one register: elements are packed 32-bit slots but registers
+    // are 64-bit, so the value spans (slots + 1) / 2 of them — the
+    // slots->registers rule lowering.cpp uses. `weak T` is the case that
+    // matters (4 slots = {pointer, generation}); packing it into regs[a] alone
+    // would both overrun a single u64 and drop the generation, so the following
+    // WEAK_CHECK would read a garbage generation and trap as dangling.
+#define RX_BODY_INDEX_GET_LIST                                                                     \
+    do {                                                                                           \
+        u8 a = decode_a(instr);                                                                    \
+        u8 b = decode_b(instr);                                                                    \
+        void* lst_ptr = reg_as_ptr(regs[b]);                                                       \
+        if (!lst_ptr) {                                                                            \
+            vm->error = "list index: null list reference";                                         \
+            return false;                                                                          \
+        }                                                                                          \
+        u64 idx = regs[decode_c(instr)];                                                           \
+        ListHeader* header = get_list_header(lst_ptr);                                             \
+        if (idx >= header->length) {                                                               \
+            vm->error = "List index out of bounds";                                                \
+            return false;                                                                          \
+        }                                                                                          \
+        if (header->element_is_inline) {                                                           \
+            u32* elem = header->elements + idx * header->element_slot_count;                       \
+            if (header->element_slot_count == 1) {                                                 \
+                regs[a] = static_cast<u64>(static_cast<i64>(static_cast<i32>(elem[0])));           \
+            } else if (header->element_slot_count == 2) {                                          \
+                regs[a] = static_cast<u64>(elem[0]) | (static_cast<u64>(elem[1]) << 32);           \
+            } else {                                                                               \
+                u32 slot_count = header->element_slot_count;                                       \
+                u32 reg_count = (slot_count + 1) / 2;                                              \
+                for (u32 i = 0; i < reg_count; i++) {                                              \
+                    regs[a + i] = 0;                                                               \
+                }                                                                                  \
+                memcpy(&regs[a], elem, sizeof(u32) * slot_count);                                  \
+            }                                                                                      \
+        } else {                                                                                   \
+            regs[a] = reinterpret_cast<u64>(list_element_ptr(header, static_cast<u32>(idx)));      \
+        }                                                                                          \
+    } while (0)
     OP(INDEX_GET_LIST) {
-        u8 a = decode_a(instr);
-        u8 b = decode_b(instr);
-        void* lst_ptr = reg_as_ptr(regs[b]);
-        if (!lst_ptr) {
-            vm->error = "list index: null list reference";
-            return false;
-        }
-        u64 idx = regs[decode_c(instr)];
-        ListHeader* header = get_list_header(lst_ptr);
-        if (idx >= header->length) {
-            vm->error = "List index out of bounds";
-            return false;
-        }
-        if (header->element_is_inline) {
-            u32* elem = header->elements + idx * header->element_slot_count;
-            if (header->element_slot_count == 1) {
-                // Sign-extend 1-slot (≤ 32-bit) integer element to fill the
-                // 64-bit register — see the matching comment in GET_FIELD for
-                // the invariant. Without this, `lst[0]` on a List<i32> holding
-                // -1 loads 0x00000000FFFFFFFF, which compares as +4294967295.
-                regs[a] = static_cast<u64>(static_cast<i64>(static_cast<i32>(elem[0])));
-            } else if (header->element_slot_count == 2) {
-                regs[a] = static_cast<u64>(elem[0]) | (static_cast<u64>(elem[1]) << 32);
-            } else {
-                // Wider than one register: elements are packed 32-bit slots but
-                // registers are 64-bit, so the value spans (slots + 1) / 2 of
-                // them — the slots->registers rule lowering.cpp uses. `weak T`
-                // is the case that matters (4 slots = {pointer, generation});
-                // packing it into regs[a] alone would both overrun a single u64
-                // and drop the generation, so the following WEAK_CHECK would
-                // read a garbage generation and trap as dangling.
-                u32 slot_count = header->element_slot_count;
-                u32 reg_count = (slot_count + 1) / 2;
-                for (u32 i = 0; i < reg_count; i++) {
-                    regs[a + i] = 0;
-                }
-                memcpy(&regs[a], elem, sizeof(u32) * slot_count);
-            }
-        } else {
-            regs[a] = reinterpret_cast<u64>(list_element_ptr(header, static_cast<u32>(idx)));
-        }
+        RX_BODY_INDEX_GET_LIST;
         DISPATCH();
     }
 
@@ -1956,6 +2607,135 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         DISPATCH();
     }
 
+    // ── Array element access (see array_get / array_set) ──
+    OP(INDEX_GET_ARR_I8) {
+        if (!array_get<i8>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_GET_ARR_U8) {
+        if (!array_get<u8>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_GET_ARR_I16) {
+        if (!array_get<i16>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_GET_ARR_U16) {
+        if (!array_get<u16>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_GET_ARR_32) {
+        if (!array_get<i32>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_GET_ARR_64) {
+        if (!array_get<u64>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_SET_ARR_8) {
+        if (!array_set<u8>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_SET_ARR_16) {
+        if (!array_set<u16>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_SET_ARR_32) {
+        if (!array_set<u32>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    OP(INDEX_SET_ARR_64) {
+        if (!array_set<u64>(vm, regs, instr))
+            return false;
+        DISPATCH();
+    }
+
+    // `list[index].field` on a struct-element list: the INDEX_GET_LIST element
+    // address and the GET_FIELD / SET_FIELD load or store in one dispatch. The
+    // field address is elements + index * element_slot_count + slot_offset,
+    // which holds for inline and out-of-line elements alike.
+    OP(INDEX_FIELD_GET_LIST) {
+        u8 a = decode_a(instr);
+        u32 field_word = *pc++;
+        void* lst_ptr = reg_as_ptr(regs[decode_b(instr)]);
+        if (!lst_ptr) {
+            vm->error = "list index: null list reference";
+            return false;
+        }
+        u64 idx = regs[decode_c(instr)];
+        ListHeader* header = get_list_header(lst_ptr);
+        if (idx >= header->length) {
+            vm->error = "List index out of bounds";
+            return false;
+        }
+        u8 slot_count = decode_field_slot_count(field_word);
+        u32* field =
+            list_element_ptr(header, static_cast<u32>(idx)) + decode_field_offset(field_word);
+        if (slot_count == 1) {
+            regs[a] = static_cast<u64>(static_cast<i64>(static_cast<i32>(*field)));
+        } else if (slot_count == 2) {
+            regs[a] = static_cast<u64>(field[0]) | (static_cast<u64>(field[1]) << 32);
+        } else {
+            regs[a] = static_cast<u64>(field[0]) | (static_cast<u64>(field[1]) << 32);
+            regs[a + 1] = (slot_count >= 4)
+                              ? (static_cast<u64>(field[2]) | (static_cast<u64>(field[3]) << 32))
+                              : static_cast<u64>(field[2]);
+        }
+        DISPATCH();
+    }
+
+    OP(INDEX_FIELD_SET_LIST) {
+        u32 field_word = *pc++;
+        void* lst_ptr = reg_as_ptr(regs[decode_a(instr)]);
+        if (!lst_ptr) {
+            vm->error = "list index_mut: null list reference";
+            return false;
+        }
+        u64 idx = regs[decode_b(instr)];
+        ListHeader* header = get_list_header(lst_ptr);
+        if (idx >= header->length) {
+            vm->error = "List index out of bounds";
+            return false;
+        }
+        u8 c = decode_c(instr);
+        u8 slot_count = decode_field_slot_count(field_word);
+        u32* field =
+            list_element_ptr(header, static_cast<u32>(idx)) + decode_field_offset(field_word);
+        u64 val = regs[c];
+        if (slot_count == 1) {
+            *field = static_cast<u32>(val);
+        } else if (slot_count == 2) {
+            field[0] = static_cast<u32>(val);
+            field[1] = static_cast<u32>(val >> 32);
+        } else {
+            field[0] = static_cast<u32>(val);
+            field[1] = static_cast<u32>(val >> 32);
+            u64 val2 = regs[c + 1];
+            field[2] = static_cast<u32>(val2);
+            if (slot_count >= 4)
+                field[3] = static_cast<u32>(val2 >> 32);
+        }
+        DISPATCH();
+    }
+
     OP(INDEX_GET_MAP) {
         u8 a = decode_a(instr);
         void* map_ptr = reg_as_ptr(regs[decode_b(instr)]);
@@ -2089,12 +2869,46 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         DISPATCH();
     }
 
+    // ── Range-for map iteration (map pinned by the loop, so no null check and
+    // the capacity cannot change under the cursor) ──
+
+    OP(ITER_NEXT_MAP) {
+        const MapHeader* header = get_map_header(reg_as_ptr(regs[decode_b(instr)]));
+        u32 i = static_cast<u32>(regs[decode_c(instr)]);
+        u32 cap = header->capacity;
+        while (i < cap && header->distances[i] == 0) {
+            i++;
+        }
+        regs[decode_a(instr)] = static_cast<u64>(i);
+        DISPATCH();
+    }
+
+    OP(ITER_KEY_MAP) {
+        const MapHeader* header = get_map_header(reg_as_ptr(regs[decode_b(instr)]));
+        size_t idx = static_cast<u32>(regs[decode_c(instr)]);
+        load_map_entry(regs, decode_a(instr), header->keys + idx * header->key_slot_count,
+                       header->key_slot_count, header->key_is_inline);
+        DISPATCH();
+    }
+
+    OP(ITER_VALUE_MAP) {
+        const MapHeader* header = get_map_header(reg_as_ptr(regs[decode_b(instr)]));
+        size_t idx = static_cast<u32>(regs[decode_c(instr)]);
+        load_map_entry(regs, decode_a(instr), header->values + idx * header->value_slot_count,
+                       header->value_slot_count, header->value_is_inline);
+        DISPATCH();
+    }
+
     // ── Stack Address ──
 
+#define RX_BODY_STACK_ADDR                                                                         \
+    do {                                                                                           \
+        u16 slot_offset = decode_imm16(instr);                                                     \
+        u32* addr = vm->local_stack.get() + frame->local_stack_base + slot_offset;                 \
+        regs[decode_a(instr)] = reg_from_ptr(addr);                                                \
+    } while (0)
     OP(STACK_ADDR) {
-        u16 slot_offset = decode_imm16(instr);
-        u32* addr = vm->local_stack.get() + frame->local_stack_base + slot_offset;
-        regs[decode_a(instr)] = reg_from_ptr(addr);
+        RX_BODY_STACK_ADDR;
         DISPATCH();
     }
 
@@ -2107,44 +2921,48 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
     // ── Field Access ──
 
+    // Sign-extend a 32-bit field to fill the 64-bit register. All integer ops
+    // read registers via reg_as_i64 (which treats them as sign-extended i64),
+    // and LOAD_INT/arithmetic already leave signed 32-bit values in
+    // sign-extended form. Zero-extending here breaks that invariant for
+    // negative i32 fields: `-1` round-trips through SET_FIELD(32) as 0xFFFFFFFF
+    // in memory, and the prior zero-extending load produced 0x00000000FFFFFFFF,
+    // which compares as +4294967295 rather than -1. Loads of u8/u16 fields
+    // don't carry values above 2^31 (their max is < 2^32) and narrowing casts
+    // normalize via TRUNC_U when unsigned semantics are required.
+#define RX_BODY_GET_FIELD                                                                          \
+    do {                                                                                           \
+        u8 a = decode_a(instr);                                                                    \
+        u8 b = decode_b(instr);                                                                    \
+        u8 slot_count = decode_c(instr);                                                           \
+        u16 slot_offset = static_cast<u16>(*pc++);                                                 \
+        u32* base = reinterpret_cast<u32*>(reg_as_ptr(regs[b]));                                   \
+        u32* field = base + slot_offset;                                                           \
+        if (slot_count == 1) {                                                                     \
+            regs[a] = static_cast<u64>(static_cast<i64>(static_cast<i32>(*field)));                \
+        } else if (slot_count == 2) {                                                              \
+            regs[a] = static_cast<u64>(field[0]) | (static_cast<u64>(field[1]) << 32);             \
+        } else {                                                                                   \
+            regs[a] = static_cast<u64>(field[0]) | (static_cast<u64>(field[1]) << 32);             \
+            regs[a + 1] = (slot_count >= 4)                                                        \
+                              ? (static_cast<u64>(field[2]) | (static_cast<u64>(field[3]) << 32))  \
+                              : static_cast<u64>(field[2]);                                        \
+        }                                                                                          \
+    } while (0)
     OP(GET_FIELD) {
-        u8 a = decode_a(instr);
-        u8 b = decode_b(instr);
-        u8 slot_count = decode_c(instr);
-        u16 slot_offset = static_cast<u16>(*pc++);
-
-        u32* base = reinterpret_cast<u32*>(reg_as_ptr(regs[b]));
-        u32* field = base + slot_offset;
-
-        if (slot_count == 1) {
-            // Sign-extend a 32-bit field to fill the 64-bit register. All
-            // integer ops read registers via reg_as_i64 (which treats them
-            // as sign-extended i64), and LOAD_INT/arithmetic already leave
-            // signed 32-bit values in sign-extended form. Zero-extending
-            // here breaks that invariant for negative i32 fields: `-1`
-            // round-trips through SET_FIELD(32) as 0xFFFFFFFF in memory,
-            // and the prior zero-extending load produced 0x00000000FFFFFFFF,
-            // which compares as +4294967295 rather than -1. Loads of u8/u16
-            // fields don't carry values above 2^31 (their max is < 2^32)
-            // and narrowing casts normalize via TRUNC_U when unsigned
-            // semantics are required.
-            regs[a] = static_cast<u64>(static_cast<i64>(static_cast<i32>(*field)));
-        } else if (slot_count == 2) {
-            regs[a] = static_cast<u64>(field[0]) | (static_cast<u64>(field[1]) << 32);
-        } else {
-            regs[a] = static_cast<u64>(field[0]) | (static_cast<u64>(field[1]) << 32);
-            regs[a + 1] = (slot_count >= 4)
-                              ? (static_cast<u64>(field[2]) | (static_cast<u64>(field[3]) << 32))
-                              : static_cast<u64>(field[2]);
-        }
+        RX_BODY_GET_FIELD;
         DISPATCH();
     }
 
+#define RX_BODY_GET_FIELD_ADDR                                                                     \
+    do {                                                                                           \
+        u16 slot_offset = static_cast<u16>(*pc++);                                                 \
+        u32* base = reinterpret_cast<u32*>(reg_as_ptr(regs[decode_b(instr)]));                     \
+        u32* field_addr = base + slot_offset;                                                      \
+        regs[decode_a(instr)] = reg_from_ptr(field_addr);                                          \
+    } while (0)
     OP(GET_FIELD_ADDR) {
-        u16 slot_offset = static_cast<u16>(*pc++);
-        u32* base = reinterpret_cast<u32*>(reg_as_ptr(regs[decode_b(instr)]));
-        u32* field_addr = base + slot_offset;
-        regs[decode_a(instr)] = reg_from_ptr(field_addr);
+        RX_BODY_GET_FIELD_ADDR;
         DISPATCH();
     }
 
@@ -2298,7 +3116,7 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
         frame = &vm->call_stack_back();
         func = frame->func;
-        pc = frame->pc;
+        LOAD_FRAME_PC();
         regs = frame->registers;
 
         for (u8 r = 0; r < reg_count; r++) {
@@ -2333,7 +3151,7 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
         frame = &vm->call_stack_back();
         func = frame->func;
-        pc = frame->pc;
+        LOAD_FRAME_PC();
         regs = frame->registers;
 
         regs[return_reg] = ret_vals[0];
@@ -2343,20 +3161,15 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
     // ── Spill/Reload ──
 
+    // Registers 256 and up exist only in the frame: every other handler's
+    // 8-bit operands stop at 255, so spilled values move through these.
     OP(SPILL_REG) {
-        u8 a = decode_a(instr);
-        u16 slot_offset = decode_imm16(instr);
-        u32* addr = vm->local_stack.get() + frame->local_stack_base + slot_offset;
-        u64 val = regs[a];
-        addr[0] = static_cast<u32>(val);
-        addr[1] = static_cast<u32>(val >> 32);
+        regs[decode_imm16(instr)] = regs[decode_a(instr)];
         DISPATCH();
     }
 
     OP(RELOAD_REG) {
-        u16 slot_offset = decode_imm16(instr);
-        u32* addr = vm->local_stack.get() + frame->local_stack_base + slot_offset;
-        regs[decode_a(instr)] = static_cast<u64>(addr[0]) | (static_cast<u64>(addr[1]) << 32);
+        regs[decode_a(instr)] = regs[decode_imm16(instr)];
         DISPATCH();
     }
 
@@ -2376,7 +3189,11 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
             return false;
         }
 
-        void* data = object_alloc(vm, type_id, type_info->size);
+        // Coroutine state structs come from their free pool when it has one
+        void* data = type_id < vm->state_pools.size() && vm->state_pools[type_id].head
+                         ? object_alloc_pooled(vm, &vm->state_pools[type_id], type_id,
+                                               type_info->size)
+                         : object_alloc(vm, type_id, type_info->size);
         if (data == nullptr) {
             vm->error = "Memory allocation failed";
             return false;
@@ -2512,10 +3329,10 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         vm->in_flight_exception = exception_ptr;
         vm->in_flight_exception_type_id = exception_type_id;
 
-        frame->pc = pc;
+        SAVE_FRAME_PC();
 
         while (true) {
-            u32 current_pc = static_cast<u32>(frame->pc - func->code.data());
+            u32 current_pc = pc_offset<Threaded>(func, frame->pc);
 
             bool handler_found = false;
             for (const auto& handler : func->exception_handlers) {
@@ -2540,7 +3357,8 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
                         vm->in_flight_exception = nullptr;
                         regs[handler.exception_reg] = reg_from_ptr(exception_ptr);
-                        pc = func->code.data() + handler.handler_pc;
+                        pc = reinterpret_cast<const CodeWord*>(entry_pc<Threaded>(func)) +
+                             handler.handler_pc;
                         handler_found = true;
                         break;
                     }
@@ -2589,6 +3407,32 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
         DISPATCH();
     }
 
+    // ── SIMD vectors (see exec_vec) ──
+
+    OP(VEC_F32X4) {
+        u32 word = static_cast<u32>(*pc++);
+        if (!exec_vec<f32, 4>(vm, regs, vm->local_stack.get() + frame->local_stack_base, instr,
+                              word))
+            return false;
+        DISPATCH();
+    }
+
+    OP(VEC_F64X2) {
+        u32 word = static_cast<u32>(*pc++);
+        if (!exec_vec<f64, 2>(vm, regs, vm->local_stack.get() + frame->local_stack_base, instr,
+                              word))
+            return false;
+        DISPATCH();
+    }
+
+    OP(VEC_I32X4) {
+        u32 word = static_cast<u32>(*pc++);
+        if (!exec_vec<i32, 4>(vm, regs, vm->local_stack.get() + frame->local_stack_base, instr,
+                              word))
+            return false;
+        DISPATCH();
+    }
+
     // ── Debug/Error ──
 
     OP(NOP) { DISPATCH(); }
@@ -2600,6 +3444,16 @@ bool interpret(RoxyVM* vm, u32 stop_depth) {
 
     OP(HALT) { return true; }
 
+    // ── Superinstructions ──
+    // FIRST's body, then straight into SECOND (see superinstructions.def).
+
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND)                                             \
+    OP(NAME) {                                                                                     \
+        RX_BODY_##FIRST;                                                                           \
+        SUPER_DISPATCH(SECOND);                                                                    \
+    }
+#include "roxy/vm/superinstructions.def"
+
 #if RX_USE_COMPUTED_GOTO
 op_DEFAULT:
     vm->error = "Unknown opcode";
@@ -2617,5 +3471,43 @@ op_DEFAULT:
 
 #undef OP
 #undef DISPATCH
+#undef SUPER_DISPATCH
+#undef LOAD_FRAME_PC
+#undef SAVE_FRAME_PC
+
+bool interpret(RoxyVM* vm, u32 stop_depth) {
+#if RX_USE_COMPUTED_GOTO
+    if (vm->threaded_dispatch) {
+        return interpret_loop<true>(vm, stop_depth);
+    }
+#endif
+    return interpret_loop<false>(vm, stop_depth);
+}
+
+bool interpreter_supports_threaded_dispatch() { return RX_USE_COMPUTED_GOTO != 0; }
+
+void build_threaded_code(BCFunction* func) {
+#if RX_USE_COMPUTED_GOTO
+    // Magic static: the export runs once even with VMs loading on several threads.
+    static const bool offsets_ready = interpret_loop<true>(nullptr, 0);
+    (void)offsets_ready;
+    const Vector<u32>& code = func->code;
+    Vector<u64>& threaded = func->threaded_code;
+    threaded.clear();
+    threaded.reserve(code.size());
+    for (u32 i = 0; i < code.size(); i++) {
+        u32 word = code[i];
+        Opcode op = decode_opcode(word);
+        u32 offset = static_cast<u32>(g_threaded_offsets[static_cast<u8>(op)]);
+        threaded.push_back((static_cast<u64>(offset) << 32) | word);
+        // Operand words are never dispatched; copy them as-is.
+        if (is_two_word_instruction(op) && i + 1 < code.size()) {
+            threaded.push_back(code[++i]);
+        }
+    }
+#else
+    (void)func;
+#endif
+}
 
 } // namespace rx
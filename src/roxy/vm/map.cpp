@@ -31,28 +31,41 @@ u32 get_map_type_id() { return g_map_type_id; }
 // VM-side map ops are now thin wrappers around the unified `roxy_map_*`
 // runtime. Custom user-defined Hash/Eq dispatch (Struct keys with `impl Hash`
 // / `impl Eq`) routes through a thread-local dispatch frame: each public
-// VM op pushes a `MapDispatchFrame` carrying `(vm, hash_fn_idx, eq_fn_idx,
+// VM op pushes a `MapDispatchFrame` carrying `(vm, hash_fn, eq_fn,
 // key_slot_count)` before calling into `roxy_map_*`, and pops on return.
 // The hash/eq trampolines installed in `MapHeader.hash_fn`/`eq_fn` read the
-// top of the stack and re-enter the interpreter via `call_user_function`.
+// top of the stack and re-enter the interpreter via `call_resolved_function`.
 
 namespace {
 
 // RAII guard around `map_dispatch_push`/`pop`. Looks up the bytecode
 // dispatch indices in the per-VM side-table (`vm->map_dispatch`) since the
-// unified MapHeader no longer stores them.
+// unified MapHeader no longer stores them, and resolves them to functions
+// once for the whole op rather than once per probe. A map without
+// trampolines (every primitive key, and struct keys with no user Hash/Eq)
+// never reads a frame, so it skips both the side-table lookup and the push.
 struct MapDispatchScope {
     MapDispatchScope(RoxyVM* vm, void* map_ptr) {
-        MapDispatchInfo info = map_dispatch_lookup(vm, map_ptr);
         const MapHeader* header = get_map_header(map_ptr);
+        if (!header->hash_fn && !header->eq_fn)
+            return;
+        MapDispatchInfo info = map_dispatch_lookup(vm, map_ptr);
         MapDispatchFrame f;
         f.vm = vm;
-        f.hash_fn_idx = info.hash_fn_idx;
-        f.eq_fn_idx = info.eq_fn_idx;
+        f.hash_fn = resolve(vm, info.hash_fn_idx);
+        f.eq_fn = resolve(vm, info.eq_fn_idx);
         f.key_slot_count = header->key_slot_count;
         map_dispatch_push(f);
+        pushed = true;
+    }
+    ~MapDispatchScope() {
+        if (pushed)
+            map_dispatch_pop();
+    }
+    static const BCFunction* resolve(RoxyVM* vm, u32 func_idx) {
+        return func_idx < vm->function_count ? vm->function_ptrs[func_idx] : nullptr;
     }
-    ~MapDispatchScope() { map_dispatch_pop(); }
+    bool pushed = false;
     MapDispatchScope(const MapDispatchScope&) = delete;
     MapDispatchScope& operator=(const MapDispatchScope&) = delete;
 };
@@ -24,10 +24,10 @@ extern "C" uint64_t vm_hash_trampoline(const void* key_src) {
     if (g_dispatch_stack.empty())
         return 0;
     const MapDispatchFrame& f = g_dispatch_stack.back();
-    if (f.hash_fn_idx == UINT32_MAX)
+    if (!f.hash_fn)
         return 0;
     u64 args[1] = {reinterpret_cast<u64>(key_src)};
-    return call_user_function(f.vm, f.hash_fn_idx, args, 1);
+    return call_resolved_function(f.vm, f.hash_fn, args, 1);
 }
 
 extern "C" bool vm_eq_trampoline(const void* a_void, const void* b_void) {
@@ -37,7 +37,7 @@ extern "C" bool vm_eq_trampoline(const void* a_void, const void* b_void) {
         return false;
     }
     const MapDispatchFrame& f = g_dispatch_stack.back();
-    if (f.eq_fn_idx == UINT32_MAX)
+    if (!f.eq_fn)
         return false;
 
     // Roxy's calling convention for `K::eq(self: ref K, other: K)`:
@@ -68,7 +68,7 @@ extern "C" bool vm_eq_trampoline(const void* a_void, const void* b_void) {
         args[1] = reinterpret_cast<u64>(b);
         argc = 2;
     }
-    return call_user_function(f.vm, f.eq_fn_idx, args, argc) != 0;
+    return call_resolved_function(f.vm, f.eq_fn, args, argc) != 0;
 }
 
 roxy_map_hash_fn map_dispatch_hash_trampoline() { return &vm_hash_trampoline; }
@@ -1,5 +1,6 @@
 #include "roxy/vm/natives.hpp"
 #include "roxy/vm/binding/registry.hpp"
+#include "roxy/vm/interpreter.hpp"
 #include "roxy/vm/list.hpp"
 #include "roxy/vm/map.hpp"
 #include "roxy/vm/string.hpp"
@@ -204,6 +205,8 @@ static void native_list_pop(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
 }
 
 // Native function: print(s: string)
+// All print overloads append to the roxy_rt output buffer (see roxy_rt.h,
+// "Output channel"), shared with AOT code.
 static void native_print(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     if (argc < 1) {
         vm->error = "print requires 1 argument";
@@ -214,44 +217,44 @@ static void native_print(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     void* str = reinterpret_cast<void*>(regs[first_arg]);
 
     if (str) {
-        printf("%s\n", string_chars(str));
+        roxy_print(str);
     } else {
-        printf("(null)\n");
+        roxy_output_write("(null)\n", 7);
     }
 
     regs[dst] = 0;
 }
 
-// Per-type print overloads — direct printf, no string round-trip. Formats
-// match the corresponding $$to_string natives so `print(x)` and
-// `print(f"{x}")` produce identical output.
+// Per-type print overloads — formatted straight into the buffer, no string
+// round-trip. Formats match the corresponding $$to_string natives so
+// `print(x)` and `print(f"{x}")` produce identical output.
 static void native_print_bool(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    printf("%s\n", regs[first_arg] != 0 ? "true" : "false");
+    roxy_print_bool(regs[first_arg] != 0);
     regs[dst] = 0;
 }
 
 static void native_print_i32(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    printf("%d\n", static_cast<i32>(regs[first_arg]));
+    roxy_print_i32(static_cast<i32>(regs[first_arg]));
     regs[dst] = 0;
 }
 
 static void native_print_i64(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    printf("%lld\n", (long long)static_cast<i64>(regs[first_arg]));
+    roxy_print_i64(static_cast<i64>(regs[first_arg]));
     regs[dst] = 0;
 }
 
 static void native_print_u32(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    printf("%u\n", static_cast<u32>(regs[first_arg]));
+    roxy_print_u32(static_cast<u32>(regs[first_arg]));
     regs[dst] = 0;
 }
 
 static void native_print_u64(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    printf("%llu\n", (unsigned long long)regs[first_arg]);
+    roxy_print_u64(regs[first_arg]);
     regs[dst] = 0;
 }
 
@@ -259,7 +262,7 @@ static void native_print_f32(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
     f32 val;
     memcpy(&val, &regs[first_arg], sizeof(f32));
-    printf("%g\n", (double)val);
+    roxy_print_f32(val);
     regs[dst] = 0;
 }
 
@@ -267,7 +270,15 @@ static void native_print_f64(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
     f64 val;
     memcpy(&val, &regs[first_arg], sizeof(f64));
-    printf("%g\n", val);
+    roxy_print_f64(val);
+    regs[dst] = 0;
+}
+
+// Native function: flush()
+// Hand buffered print output to the sink now (e.g. before a long computation).
+static void native_flush(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    roxy_ctx_flush_output(&vm->ctx);
     regs[dst] = 0;
 }
 
@@ -352,47 +363,33 @@ static void native_bool_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     regs[dst] = reinterpret_cast<u64>(result);
 }
 
+// Numeric $$to_string natives share the roxy_rt conversions with AOT code:
+// integers are sized and written straight into the string, floats go through
+// to_chars. The result is a dynamic string: owned (count 1), freed on release
+// (finding 9b).
+
 // Native function: i32$$to_string(val: i32) -> string
 static void native_i32_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    i32 val = static_cast<i32>(regs[first_arg]);
-    char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%d", val);
-    // Dynamic string: owned (count 1), freed on release (finding 9b).
-    void* result = roxy_string_new_owned(buf, static_cast<u32>(len));
-    regs[dst] = reinterpret_cast<u64>(result);
+    regs[dst] = reinterpret_cast<u64>(roxy_i32_to_string(static_cast<i32>(regs[first_arg])));
 }
 
 // Native function: i64$$to_string(val: i64) -> string
 static void native_i64_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    i64 val = static_cast<i64>(regs[first_arg]);
-    char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%lld", (long long)val);
-    // Dynamic string: owned (count 1), freed on release (finding 9b).
-    void* result = roxy_string_new_owned(buf, static_cast<u32>(len));
-    regs[dst] = reinterpret_cast<u64>(result);
+    regs[dst] = reinterpret_cast<u64>(roxy_i64_to_string(static_cast<i64>(regs[first_arg])));
 }
 
 // Native function: u32$$to_string(val: u32) -> string
 static void native_u32_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    u32 val = static_cast<u32>(regs[first_arg]);
-    char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%u", val);
-    void* result = roxy_string_new_owned(buf, static_cast<u32>(len));
-    regs[dst] = reinterpret_cast<u64>(result);
+    regs[dst] = reinterpret_cast<u64>(roxy_u32_to_string(static_cast<u32>(regs[first_arg])));
 }
 
 // Native function: u64$$to_string(val: u64) -> string
 static void native_u64_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
-    u64 val = regs[first_arg];
-    char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%llu", (unsigned long long)val);
-    // Dynamic string: owned (count 1), freed on release (finding 9b).
-    void* result = roxy_string_new_owned(buf, static_cast<u32>(len));
-    regs[dst] = reinterpret_cast<u64>(result);
+    regs[dst] = reinterpret_cast<u64>(roxy_u64_to_string(regs[first_arg]));
 }
 
 // Native function: f32$$to_string(val: f32) -> string
@@ -400,11 +397,7 @@ static void native_f32_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
     f32 val;
     memcpy(&val, &regs[first_arg], sizeof(f32));
-    char buf[64];
-    int len = snprintf(buf, sizeof(buf), "%g", (double)val);
-    // Dynamic string: owned (count 1), freed on release (finding 9b).
-    void* result = roxy_string_new_owned(buf, static_cast<u32>(len));
-    regs[dst] = reinterpret_cast<u64>(result);
+    regs[dst] = reinterpret_cast<u64>(roxy_f32_to_string(val));
 }
 
 // Native function: f64$$to_string(val: f64) -> string
@@ -412,11 +405,7 @@ static void native_f64_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
     f64 val;
     memcpy(&val, &regs[first_arg], sizeof(f64));
-    char buf[64];
-    int len = snprintf(buf, sizeof(buf), "%g", val);
-    // Dynamic string: owned (count 1), freed on release (finding 9b).
-    void* result = roxy_string_new_owned(buf, static_cast<u32>(len));
-    regs[dst] = reinterpret_cast<u64>(result);
+    regs[dst] = reinterpret_cast<u64>(roxy_f64_to_string(val));
 }
 
 // Native function: string$$to_string(val: string) -> string (identity)
@@ -572,6 +561,355 @@ static void native_list_index_mut(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     regs[dst] = 0;
 }
 
+// ===== List bulk operations =====
+//
+// Thin wrappers over the shared roxy_list_* runtime (roxy_rt.cpp), so the VM
+// and AOT code sort, search and resize through the same code. A refused
+// mutation (the list is pinned) raises the runtime trap, which CALL_NATIVE
+// turns into vm->error.
+
+// Address of a value argument in the element's byte layout: inline elements
+// sit in the register itself, struct elements arrive as a pointer.
+static inline const void* list_value_arg(const ListHeader* header, u64* regs, u8 reg) {
+    if (header->element_is_inline)
+        return &regs[reg];
+    return reinterpret_cast<const void*>(regs[reg]);
+}
+
+// Native function: list sort(order) — `order` is the hidden roxy_list_order
+// the compiler appends from the element type.
+static void native_list_sort(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!lst_ptr || argc < 2) {
+        vm->error = "list sort: null list reference";
+        return;
+    }
+    roxy_list_sort(lst_ptr, static_cast<i32>(regs[first_arg + 1]));
+    regs[dst] = 0;
+}
+
+// Per-call state for the sort_by comparator trampoline: which VM, which
+// closure, and how an element is laid out in argument registers.
+struct ListSortByFrame {
+    RoxyVM* vm;
+    void* env;
+    u32 func_idx;
+    u32 slot_count;
+    bool element_is_inline;
+};
+
+// Pack one element into argument registers per the struct-arg ABI (mirrors
+// vm_eq_trampoline): up to 4 slots travel by value in (slots + 1) / 2
+// registers, a wider struct as a pointer.
+static u32 sort_by_pack_arg(const ListSortByFrame& f, const void* elem, u64* out) {
+    if (!f.element_is_inline && f.slot_count > 4) {
+        out[0] = reinterpret_cast<u64>(elem);
+        return 1;
+    }
+    u32 reg_count = (f.slot_count + 1) / 2;
+    for (u32 i = 0; i < reg_count; i++)
+        out[i] = 0;
+    memcpy(out, elem, sizeof(u32) * f.slot_count);
+    return reg_count;
+}
+
+static bool vm_sort_by_trampoline(void* ctx, const void* a, const void* b) {
+    const ListSortByFrame& f = *static_cast<const ListSortByFrame*>(ctx);
+    // Once the comparator has failed the VM is unwinding: answer "not before"
+    // for the rest of the sort, which keeps the permutation well-defined.
+    if (f.vm->error)
+        return false;
+    u64 args[5];
+    args[0] = reinterpret_cast<u64>(f.env);
+    u32 argc = 1;
+    argc += sort_by_pack_arg(f, a, &args[argc]);
+    argc += sort_by_pack_arg(f, b, &args[argc]);
+    return call_user_function(f.vm, f.func_idx, args, argc) != 0;
+}
+
+// Native function: list sort_by(less: ref fun(T, T) -> bool)
+static void native_list_sort_by(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    void* env = reinterpret_cast<void*>(regs[first_arg + 1]);
+    if (!lst_ptr || argc < 2) {
+        vm->error = "list sort_by: null list reference";
+        return;
+    }
+    if (!env) {
+        vm->error = "list sort_by: null comparator";
+        return;
+    }
+    ListHeader* header = get_list_header(lst_ptr);
+    ListSortByFrame frame{vm, env, *static_cast<const u32*>(env), header->element_slot_count,
+                          header->element_is_inline != 0};
+    roxy_list_sort_by(lst_ptr, &vm_sort_by_trampoline, &frame);
+    regs[dst] = 0;
+}
+
+// Native function: list binary_search(val: T, order) -> i32
+static void native_list_binary_search(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!lst_ptr || argc < 3) {
+        vm->error = "list binary_search: null list reference";
+        return;
+    }
+    const void* val = list_value_arg(get_list_header(lst_ptr), regs, first_arg + 1);
+    i32 index = roxy_list_binary_search(lst_ptr, val, static_cast<i32>(regs[first_arg + 2]));
+    regs[dst] = static_cast<u64>(static_cast<i64>(index));
+}
+
+// Native function: list extend(other: List<T>) — empties `other`; the caller drops it.
+static void native_list_extend(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!lst_ptr || argc < 2) {
+        vm->error = "list extend: null list reference";
+        return;
+    }
+    roxy_list_extend(lst_ptr, reinterpret_cast<void*>(regs[first_arg + 1]));
+    regs[dst] = 0;
+}
+
+// Native function: list fill(val: T)
+static void native_list_fill(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!lst_ptr || argc < 2) {
+        vm->error = "list fill: null list reference";
+        return;
+    }
+    roxy_list_fill(lst_ptr, list_value_arg(get_list_header(lst_ptr), regs, first_arg + 1));
+    regs[dst] = 0;
+}
+
+// Native function: list truncate(len: i32)
+static void native_list_truncate(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!lst_ptr || argc < 2) {
+        vm->error = "list truncate: null list reference";
+        return;
+    }
+    roxy_list_truncate(lst_ptr, static_cast<i32>(regs[first_arg + 1]));
+    regs[dst] = 0;
+}
+
+// Native function: list reserve(cap: i32)
+static void native_list_reserve(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!lst_ptr || argc < 2) {
+        vm->error = "list reserve: null list reference";
+        return;
+    }
+    i64 capacity = static_cast<i32>(regs[first_arg + 1]);
+    if (capacity > MAX_COLLECTION_CAPACITY) {
+        vm->error = "list capacity too large (max 1000000)";
+        return;
+    }
+    roxy_list_reserve(lst_ptr, static_cast<i32>(capacity));
+    regs[dst] = 0;
+}
+
+// Native function: list swap(i: i32, j: i32)
+static void native_list_swap(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* lst_ptr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!lst_ptr || argc < 3) {
+        vm->error = "list swap: null list reference";
+        return;
+    }
+    roxy_list_swap(lst_ptr, static_cast<i32>(regs[first_arg + 1]),
+                   static_cast<i32>(regs[first_arg + 2]));
+    regs[dst] = 0;
+}
+
+// ===== Array<T> native functions =====
+//
+// Array shares the roxy_array_* runtime with AOT code. Elements are primitives
+// packed at their natural width; a value argument is the low element_size
+// bytes of its register, and a read widens back into the register the way the
+// INDEX_GET_ARR_* opcodes do.
+
+// Allocates an empty array. argc >= 1: element_size; argc >= 2: element_is_signed.
+static void native_array_alloc(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    i32 element_size = (argc >= 1) ? static_cast<i32>(regs[first_arg]) : 8;
+    i32 element_is_signed = (argc >= 2) ? static_cast<i32>(regs[first_arg + 1] != 0) : 1;
+    void* arr = roxy_array_alloc(element_size, element_is_signed);
+    if (!arr) {
+        vm->error = "failed to allocate array";
+        return;
+    }
+    regs[dst] = reinterpret_cast<u64>(arr);
+}
+
+// Constructor method. Receives self + optional length.
+static void native_array_init(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!arr) {
+        vm->error = "array init: null self";
+        return;
+    }
+    if (argc >= 2)
+        roxy_array_init(arr, static_cast<i32>(regs[first_arg + 1]));
+    regs[dst] = 0;
+}
+
+// Destructor method. Receives self, frees the element buffer.
+static void native_array_delete(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    if (arr)
+        roxy_array_delete(arr);
+    regs[dst] = 0;
+}
+
+// Native function: array_copy(src: Array<T>) -> Array<T> (deep copy)
+static void native_array_copy(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* src = reinterpret_cast<void*>(regs[first_arg]);
+    if (!src) {
+        vm->error = "array_copy: null source";
+        return;
+    }
+    void* copy = roxy_array_copy(src);
+    if (!copy) {
+        vm->error = "array_copy: allocation failed";
+        return;
+    }
+    regs[dst] = reinterpret_cast<u64>(copy);
+}
+
+static void native_array_len(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!arr) {
+        vm->error = "array len: null array reference";
+        return;
+    }
+    regs[dst] = static_cast<u64>(roxy_array_len(arr));
+}
+
+// Bounds-checked element address, or nullptr with vm->error set.
+static u8* array_checked_elem(RoxyVM* vm, void* arr, i64 index) {
+    if (!arr) {
+        vm->error = "array index: null array reference";
+        return nullptr;
+    }
+    auto* header = static_cast<roxy_array_header*>(arr);
+    if (index < 0 || static_cast<u64>(index) >= header->length) {
+        vm->error = "Array index out of bounds";
+        return nullptr;
+    }
+    return header->data + static_cast<size_t>(index) * header->element_size;
+}
+
+// Native function: array index (get element by index)
+static void native_array_index(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    u8* elem = array_checked_elem(vm, arr, static_cast<i64>(regs[first_arg + 1]));
+    if (!elem)
+        return;
+    auto* header = static_cast<roxy_array_header*>(arr);
+    bool is_signed = header->element_is_signed != 0;
+    switch (header->element_size) {
+        case 1:
+            regs[dst] = is_signed ? static_cast<u64>(static_cast<i64>(*reinterpret_cast<i8*>(elem)))
+                                  : static_cast<u64>(*elem);
+            break;
+        case 2: {
+            u16 v;
+            memcpy(&v, elem, sizeof(v));
+            regs[dst] = is_signed ? static_cast<u64>(static_cast<i64>(static_cast<i16>(v)))
+                                  : static_cast<u64>(v);
+            break;
+        }
+        case 4: {
+            u32 v;
+            memcpy(&v, elem, sizeof(v));
+            regs[dst] = is_signed ? static_cast<u64>(static_cast<i64>(static_cast<i32>(v)))
+                                  : static_cast<u64>(v);
+            break;
+        }
+        default:
+            memcpy(&regs[dst], elem, sizeof(u64));
+            break;
+    }
+}
+
+// Native function: array index_mut (set element by index)
+static void native_array_index_mut(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    u8* elem = array_checked_elem(vm, arr, static_cast<i64>(regs[first_arg + 1]));
+    if (!elem)
+        return;
+    memcpy(elem, &regs[first_arg + 2], static_cast<roxy_array_header*>(arr)->element_size);
+    regs[dst] = 0;
+}
+
+// Native function: array fill(val: T)
+static void native_array_fill(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!arr || argc < 2) {
+        vm->error = "array fill: null array reference";
+        return;
+    }
+    roxy_array_fill(arr, &regs[first_arg + 1]);
+    regs[dst] = 0;
+}
+
+// Native function: array slice(start: i32, end: i32) -> Array<T>
+static void native_array_slice(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!arr || argc < 3) {
+        vm->error = "array slice: null array reference";
+        return;
+    }
+    void* slice = roxy_array_slice(arr, static_cast<i32>(regs[first_arg + 1]),
+                                   static_cast<i32>(regs[first_arg + 2]));
+    if (!slice) {
+        vm->error = "array slice: allocation failed";
+        return;
+    }
+    regs[dst] = reinterpret_cast<u64>(slice);
+}
+
+// Native function: array copy_from(dst_start, src: ref Array<T>, src_start, count)
+static void native_array_copy_from(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    void* src = reinterpret_cast<void*>(regs[first_arg + 2]);
+    if (!arr || !src || argc < 5) {
+        vm->error = "array copy_from: null array reference";
+        return;
+    }
+    roxy_array_copy_from(arr, static_cast<i32>(regs[first_arg + 1]), src,
+                         static_cast<i32>(regs[first_arg + 3]),
+                         static_cast<i32>(regs[first_arg + 4]));
+    regs[dst] = 0;
+}
+
+// Native function: array resize(len: i32)
+static void native_array_resize(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = reinterpret_cast<void*>(regs[first_arg]);
+    if (!arr || argc < 2) {
+        vm->error = "array resize: null array reference";
+        return;
+    }
+    roxy_array_resize(arr, static_cast<i32>(regs[first_arg + 1]));
+    regs[dst] = 0;
+}
+
 // ===== Map native functions =====
 
 // Determine MapKeyKind from type kind constant passed as i32
@@ -1089,12 +1427,74 @@ static void native_str_to_f64(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
         vm->error = "str_to_f64: null string";
         return;
     }
-    const char* chars = string_chars(str);
-    char* end = nullptr;
-    f64 val = strtod(chars, &end);
+    f64 val = roxy_string_to_f64(str);
+    memcpy(&regs[dst], &val, sizeof(f64));
+}
+
+// Strict number parses and float formatting, shared with AOT code (roxy_rt.h).
+// A failed plain parse raises the runtime trap, which becomes vm->error.
+
+// Native function: str_to_i64(s: string) -> i64
+static void native_str_to_i64(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = static_cast<u64>(roxy_string_to_i64(reinterpret_cast<void*>(regs[first_arg])));
+}
+
+// Native function: str_to_i32(s: string) -> i32
+static void native_str_to_i32(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = static_cast<u64>(
+        static_cast<i64>(roxy_string_to_i32(reinterpret_cast<void*>(regs[first_arg]))));
+}
+
+// Native function: str_to_i64_or(s: string, fallback: i64) -> i64
+static void native_str_to_i64_or(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = static_cast<u64>(roxy_string_to_i64_or(reinterpret_cast<void*>(regs[first_arg]),
+                                                       static_cast<i64>(regs[first_arg + 1])));
+}
+
+// Native function: str_to_i32_or(s: string, fallback: i32) -> i32
+static void native_str_to_i32_or(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = static_cast<u64>(static_cast<i64>(roxy_string_to_i32_or(
+        reinterpret_cast<void*>(regs[first_arg]), static_cast<i32>(regs[first_arg + 1]))));
+}
+
+// Native function: str_to_f64_or(s: string, fallback: f64) -> f64
+static void native_str_to_f64_or(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    f64 fallback;
+    memcpy(&fallback, &regs[first_arg + 1], sizeof(f64));
+    f64 val = roxy_string_to_f64_or(reinterpret_cast<void*>(regs[first_arg]), fallback);
     memcpy(&regs[dst], &val, sizeof(f64));
 }
 
+// Native function: fmt(v: f64) -> string (shortest round-trip)
+static void native_fmt_f64(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    f64 val;
+    memcpy(&val, &regs[first_arg], sizeof(f64));
+    regs[dst] = reinterpret_cast<u64>(roxy_f64_fmt(val));
+}
+
+// Native function: fmt(v: f32) -> string (shortest round-trip)
+static void native_fmt_f32(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    f32 val;
+    memcpy(&val, &regs[first_arg], sizeof(f32));
+    regs[dst] = reinterpret_cast<u64>(roxy_f32_fmt(val));
+}
+
+// Native function: fmt_fixed(v: f64, decimals: i32) -> string
+static void native_fmt_fixed(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    f64 val;
+    memcpy(&val, &regs[first_arg], sizeof(f64));
+    regs[dst] = reinterpret_cast<u64>(
+        roxy_f64_fmt_fixed(val, static_cast<i32>(regs[first_arg + 1])));
+}
+
 // Native function: str_from_code(code: i32) -> string
 // Creates a single-character string from an ASCII code.
 static void native_str_from_code(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
@@ -1110,6 +1510,86 @@ static void native_str_from_code(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     regs[dst] = reinterpret_cast<u64>(result);
 }
 
+// String search, split and join, shared with AOT code (roxy_rt.h). Misuse (a
+// negative start, an empty separator) raises the runtime trap.
+
+// Native function: str_find(s: string, needle: string, start: i32) -> i32
+static void native_str_find(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = static_cast<u64>(roxy_string_find(reinterpret_cast<void*>(regs[first_arg]),
+                                                  reinterpret_cast<void*>(regs[first_arg + 1]),
+                                                  static_cast<i32>(regs[first_arg + 2])));
+}
+
+// Native function: str_find_char(s: string, code: i32, start: i32) -> i32
+static void native_str_find_char(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = static_cast<u64>(roxy_string_find_char(reinterpret_cast<void*>(regs[first_arg]),
+                                                       static_cast<i32>(regs[first_arg + 1]),
+                                                       static_cast<i32>(regs[first_arg + 2])));
+}
+
+// Native function: str_starts_with(s: string, prefix: string) -> bool
+static void native_str_starts_with(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = roxy_string_starts_with(reinterpret_cast<void*>(regs[first_arg]),
+                                        reinterpret_cast<void*>(regs[first_arg + 1]))
+                    ? 1
+                    : 0;
+}
+
+// Native function: str_ends_with(s: string, suffix: string) -> bool
+static void native_str_ends_with(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = roxy_string_ends_with(reinterpret_cast<void*>(regs[first_arg]),
+                                      reinterpret_cast<void*>(regs[first_arg + 1]))
+                    ? 1
+                    : 0;
+}
+
+// Native function: str_trim(s: string) -> string
+static void native_str_trim(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = reinterpret_cast<u64>(roxy_string_trim(reinterpret_cast<void*>(regs[first_arg])));
+}
+
+// Native function: str_replace(s: string, target: string, replacement: string) -> string
+static void native_str_replace(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* result = roxy_string_replace(reinterpret_cast<void*>(regs[first_arg]),
+                                       reinterpret_cast<void*>(regs[first_arg + 1]),
+                                       reinterpret_cast<void*>(regs[first_arg + 2]));
+    if (!result) {
+        vm->error = "str_replace: failed to allocate string";
+        return;
+    }
+    regs[dst] = reinterpret_cast<u64>(result);
+}
+
+// Native function: str_split(s: string, sep: string) -> List<string>
+static void native_str_split(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* list = roxy_string_split(reinterpret_cast<void*>(regs[first_arg]),
+                                   reinterpret_cast<void*>(regs[first_arg + 1]));
+    if (!list) {
+        vm->error = "str_split: failed to allocate list";
+        return;
+    }
+    regs[dst] = reinterpret_cast<u64>(list);
+}
+
+// Native function: str_join(parts: ref List<string>, sep: string) -> string
+static void native_str_join(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* result = roxy_string_join(reinterpret_cast<void*>(regs[first_arg]),
+                                    reinterpret_cast<void*>(regs[first_arg + 1]));
+    if (!result) {
+        vm->error = "str_join: failed to allocate string";
+        return;
+    }
+    regs[dst] = reinterpret_cast<u64>(result);
+}
+
 // Native function: sqrt(x: f64) -> f64
 static void native_sqrt(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     u64* regs = vm->call_stack_back().registers;
@@ -1170,6 +1650,76 @@ static void native_read_file(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
     regs[dst] = reinterpret_cast<u64>(result);
 }
 
+// File views and streams share the roxy_rt runtime with AOT code. Failures are
+// raised with roxy_runtime_error_set, which the interpreter turns into vm->error
+// after the call.
+
+// Native function: map_file(path: string) -> Array<u8>
+// A read-only-backed, copy-on-write mapping of the whole file.
+static void native_map_file(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    void* arr = roxy_map_file(reinterpret_cast<void*>(regs[first_arg]));
+    if (!arr) {
+        vm->error = "map_file: allocation failed";
+        return;
+    }
+    regs[dst] = reinterpret_cast<u64>(arr);
+}
+
+// Native function: bytes_to_string(bytes: ref Array<u8>, start: i32, end: i32) -> string
+static void native_bytes_to_string(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = reinterpret_cast<u64>(roxy_bytes_to_string(reinterpret_cast<void*>(regs[first_arg]),
+                                                           static_cast<i32>(regs[first_arg + 1]),
+                                                           static_cast<i32>(regs[first_arg + 2])));
+}
+
+// Internal handle natives behind the bundled `io` module's LineReader / FileWriter.
+static void native_file_reader_open(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = roxy_file_reader_open(reinterpret_cast<void*>(regs[first_arg]));
+}
+
+static void native_file_reader_next(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = roxy_file_reader_next(regs[first_arg], static_cast<i32>(regs[first_arg + 1])) ? 1 : 0;
+}
+
+static void native_file_reader_record(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = reinterpret_cast<u64>(roxy_file_reader_record(regs[first_arg]));
+}
+
+static void native_file_reader_close(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    roxy_file_reader_close(regs[first_arg]);
+    regs[dst] = 0;
+}
+
+static void native_file_writer_open(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    regs[dst] = roxy_file_writer_open(reinterpret_cast<void*>(regs[first_arg]),
+                                      regs[first_arg + 1] != 0);
+}
+
+static void native_file_writer_write(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    roxy_file_writer_write(regs[first_arg], reinterpret_cast<void*>(regs[first_arg + 1]));
+    regs[dst] = 0;
+}
+
+static void native_file_writer_flush(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    roxy_file_writer_flush(regs[first_arg]);
+    regs[dst] = 0;
+}
+
+static void native_file_writer_close(RoxyVM* vm, u8 dst, u8 argc, u8 first_arg) {
+    u64* regs = vm->call_stack_back().registers;
+    roxy_file_writer_close(regs[first_arg]);
+    regs[dst] = 0;
+}
+
 void register_builtin_natives(NativeRegistry& registry) {
     // List<T> - registered as a generic native type
     registry.register_generic_type("List<T>", "list_alloc", native_list_alloc);
@@ -1187,6 +1737,36 @@ void register_builtin_natives(NativeRegistry& registry) {
     // Explicit deep copy — containers are move-only, so `.copy()` is how you ask
     // for an independent duplicate (lifetimes.md "Applying the model").
     registry.bind_method(native_list_copy, "fun List<T>.copy(): List<T>");
+    // Bulk operations, shared with AOT through roxy_rt. sort / binary_search
+    // take a trailing hidden `order` (roxy_list_order) the IR builder appends
+    // from the element type; sema limits them to orderable elements.
+    registry.bind_method(native_list_sort, "fun List<T>.sort()");
+    registry.bind_method(native_list_sort_by,
+                         "fun List<T>.sort_by(less: ref fun(borrowed T, borrowed T) -> bool)");
+    registry.bind_method(native_list_binary_search, "fun List<T>.binary_search(val: T): i32");
+    registry.bind_method(native_list_extend, "fun List<T>.extend(other: List<T>)");
+    registry.bind_method(native_list_fill, "fun List<T>.fill(val: T)");
+    registry.bind_method(native_list_truncate, "fun List<T>.truncate(len: i32)");
+    registry.bind_method(native_list_reserve, "fun List<T>.reserve(cap: i32)");
+    registry.bind_method(native_list_swap, "fun List<T>.swap(i: i32, j: i32)");
+
+    // Array<T> - dense, fixed-length, elements packed at their natural width.
+    // Subscripts compile to the INDEX_GET_ARR_* / INDEX_SET_ARR_* opcodes;
+    // index / index_mut back the method forms and sema's `[]` lookup.
+    registry.register_generic_type("Array<T>", "array_alloc", native_array_alloc);
+    registry.bind_constructor(native_array_init, "fun Array<T>.new(len: i32)", 0);
+    registry.bind_generic_destructor("Array", native_array_delete);
+    registry.bind_generic_copy_constructor("Array", "array_copy", native_array_copy);
+    registry.bind_method(native_array_len, "fun Array<T>.len(): i32");
+    registry.bind_method(native_array_index, "fun Array<T>.index(idx: i32): T");
+    registry.bind_method(native_array_index_mut, "fun Array<T>.index_mut(idx: i32, val: T)");
+    registry.bind_method(native_array_copy, "fun Array<T>.copy(): Array<T>");
+    registry.bind_method(native_array_fill, "fun Array<T>.fill(val: T)");
+    registry.bind_method(native_array_slice, "fun Array<T>.slice(start: i32, end: i32): Array<T>");
+    registry.bind_method(
+        native_array_copy_from,
+        "fun Array<T>.copy_from(dst_start: i32, src: ref Array<T>, src_start: i32, count: i32)");
+    registry.bind_method(native_array_resize, "fun Array<T>.resize(len: i32)");
 
     // Free functions
     // print is an OVERLOAD SET: one member per Printable primitive kind (the
@@ -1203,6 +1783,7 @@ void register_builtin_natives(NativeRegistry& registry) {
     registry.bind_native_overload(native_print_u64, "fun print(v: u64)", "roxy_print_u64");
     registry.bind_native_overload(native_print_f32, "fun print(v: f32)", "roxy_print_f32");
     registry.bind_native_overload(native_print_f64, "fun print(v: f64)", "roxy_print_f64");
+    registry.bind_native(native_flush, "fun flush()");
 
     // String functions
     registry.bind_native(native_str_concat, "fun str_concat(a: string, b: string): string");
@@ -1213,11 +1794,46 @@ void register_builtin_natives(NativeRegistry& registry) {
     registry.bind_native(native_str_substr,
                          "fun str_substr(s: string, start: i32, len: i32): string");
     registry.bind_native(native_str_to_f64, "fun str_to_f64(s: string): f64");
+    registry.bind_native(native_str_to_i64, "fun str_to_i64(s: string): i64");
+    registry.bind_native(native_str_to_i32, "fun str_to_i32(s: string): i32");
+    registry.bind_native(native_str_to_i64_or, "fun str_to_i64_or(s: string, fallback: i64): i64");
+    registry.bind_native(native_str_to_i32_or, "fun str_to_i32_or(s: string, fallback: i32): i32");
+    registry.bind_native(native_str_to_f64_or, "fun str_to_f64_or(s: string, fallback: f64): f64");
+    registry.bind_native_overload(native_fmt_f64, "fun fmt(v: f64): string", "roxy_f64_fmt");
+    registry.bind_native_overload(native_fmt_f32, "fun fmt(v: f32): string", "roxy_f32_fmt");
+    registry.bind_native(native_fmt_fixed, "fun fmt_fixed(v: f64, decimals: i32): string");
     registry.bind_native(native_str_from_code, "fun str_from_code(code: i32): string");
+    registry.bind_native(native_str_find,
+                         "fun str_find(s: string, needle: string, start: i32): i32");
+    registry.bind_native(native_str_find_char,
+                         "fun str_find_char(s: string, code: i32, start: i32): i32");
+    registry.bind_native(native_str_starts_with,
+                         "fun str_starts_with(s: string, prefix: string): bool");
+    registry.bind_native(native_str_ends_with,
+                         "fun str_ends_with(s: string, suffix: string): bool");
+    registry.bind_native(native_str_trim, "fun str_trim(s: string): string");
+    registry.bind_native(native_str_replace,
+                         "fun str_replace(s: string, target: string, replacement: string): string");
+    registry.bind_native(native_str_split, "fun str_split(s: string, sep: string): List<string>");
+    registry.bind_native(native_str_join,
+                         "fun str_join(parts: ref List<string>, sep: string): string");
 
     // Utility functions
     registry.bind_native(native_clock, "fun clock(): f64");
     registry.bind_native(native_read_file, "fun read_file(path: string): string");
+    registry.bind_native(native_map_file, "fun map_file(path: string): Array<u8>");
+    registry.bind_native(native_bytes_to_string,
+                         "fun bytes_to_string(bytes: ref Array<u8>, start: i32, end: i32): string");
+    registry.bind_native(native_file_reader_open, "fun __file_reader_open(path: string): u64");
+    registry.bind_native(native_file_reader_next,
+                         "fun __file_reader_next(reader: u64, delim: i32): bool");
+    registry.bind_native(native_file_reader_record, "fun __file_reader_record(reader: u64): string");
+    registry.bind_native(native_file_reader_close, "fun __file_reader_close(reader: u64)");
+    registry.bind_native(native_file_writer_open,
+                         "fun __file_writer_open(path: string, append: bool): u64");
+    registry.bind_native(native_file_writer_write, "fun __file_writer_write(writer: u64, s: string)");
+    registry.bind_native(native_file_writer_flush, "fun __file_writer_flush(writer: u64)");
+    registry.bind_native(native_file_writer_close, "fun __file_writer_close(writer: u64)");
 
     // Math functions
     registry.bind_native(native_sqrt, "fun sqrt(x: f64): f64");
@@ -80,6 +80,32 @@ void* object_alloc(RoxyVM* vm, u32 type_id, u32 data_size) {
     return header_data(header);
 }
 
+void* object_alloc_pooled(RoxyVM* vm, roxy_free_pool* pool, u32 type_id, u32 data_size) {
+    void* data = pool->head;
+    if (!data)
+        return object_alloc(vm, type_id, data_size);
+    pool->head = *static_cast<void**>(data);
+    pool->count--;
+
+    // Reset on reuse. The header already carries this type_id and no borrows
+    // (object_free only parks an unborrowed object), so restamp the generation
+    // and clear the state the previous run left behind.
+    u64 generation = vm->allocator->rng.next();
+    get_header_from_data(data)->weak_generation = generation ? generation : 1;
+    memset(data, 0, data_size);
+    return data;
+}
+
+void object_drain_pools(RoxyVM* vm) {
+    for (roxy_free_pool& pool : vm->state_pools) {
+        while (void* data = pool.head) {
+            pool.head = *static_cast<void**>(data);
+            vm->slab_vtable.free(vm->slab_vtable.userdata, get_header_from_data(data));
+        }
+        pool.count = 0;
+    }
+}
+
 bool ref_dec(RoxyVM* vm, void* data) {
     if (data == nullptr)
         return false;
@@ -158,6 +184,19 @@ void object_free(RoxyVM* vm, void* data) {
         type_info->destructor(vm, data);
     }
 
+    // A pooled type parks the object instead. weak_generation 0 makes it read
+    // as dead (weak refs, the double-delete tripwire) until it is reused.
+    if (header->type_id < vm->state_pools.size()) {
+        roxy_free_pool& pool = vm->state_pools[header->type_id];
+        if (pool.count < pool.capacity) {
+            header->weak_generation = 0;
+            *static_cast<void**>(data) = pool.head;
+            pool.head = data;
+            pool.count++;
+            return;
+        }
+    }
+
     // Free via the per-VM `roxy_allocator` vtable — the slab impl tombstones
     // `weak_generation` (zeros the slot) and stays-mapped so weak refs see
     // "dead". Same allocator path used by `roxy_free`.
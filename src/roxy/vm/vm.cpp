@@ -6,6 +6,7 @@
 #include "roxy/vm/object.hpp"
 #include "roxy/vm/string.hpp"
 
+#include <cassert>
 #include <cstdlib>
 #include <cstring>
 #include <new>
@@ -16,8 +17,9 @@ namespace rx {
 RoxyVM::RoxyVM()
     : module(nullptr), register_file_size(0), register_top(0), local_stack_size(0),
       local_stack_top(0), call_stack_size(0), call_stack_capacity(0), function_ptrs(nullptr),
-      function_count(0), running(false), error(nullptr), in_flight_exception(nullptr),
-      in_flight_exception_type_id(0), in_flight_message_fn_idx(UINT32_MAX) {}
+      function_count(0), indirect_call_cache_count(0), threaded_dispatch(false), running(false),
+      error(nullptr), in_flight_exception(nullptr), in_flight_exception_type_id(0),
+      in_flight_message_fn_idx(UINT32_MAX) {}
 
 RoxyVM::~RoxyVM() {
     // Clean up function pointer cache
@@ -124,6 +126,7 @@ bool vm_init(RoxyVM* vm, const VMConfig& config) {
 
     vm->function_ptrs = nullptr;
     vm->function_count = 0;
+    vm->threaded_dispatch = config.threaded_dispatch && interpreter_supports_threaded_dispatch();
 
     return true;
 }
@@ -140,6 +143,9 @@ void vm_destroy(RoxyVM* vm) {
         vm_call(vm, "__module_shutdown"_sv, {});
     }
 
+    // Parked state structs are free as far as the program is concerned
+    object_drain_pools(vm);
+
     // Teardown invariant, taken here and nowhere earlier: globals have just been
     // destroyed and the slabs are still standing, so this is the one moment the
     // census is meaningful. Recorded rather than asserted — vm_destroy runs on
@@ -183,6 +189,9 @@ void vm_destroy(RoxyVM* vm) {
     vm->function_ptrs = nullptr;
     vm->function_count = 0;
 
+    vm->indirect_call_caches.reset();
+    vm->indirect_call_cache_count = 0;
+
     vm->module = nullptr;
     vm->running = false;
     vm->error = nullptr;
@@ -197,6 +206,8 @@ bool vm_load_module(RoxyVM* vm, BCModule* module) {
     // Store the global type IDs so NEW_OBJ can find them
     module->type_ids.clear();
     vm->closure_env_dtors.clear();
+    object_drain_pools(vm);
+    vm->state_pools.clear();
     for (const BCTypeInfo& type_info : module->types) {
         u32 type_id = register_object_type(type_info.name, type_info.size_bytes, nullptr);
         module->type_ids.push_back(type_id);
@@ -206,8 +217,17 @@ bool vm_load_module(RoxyVM* vm, BCModule* module) {
         if (type_info.dtor_func_idx != 0xFFFFFFFF) {
             vm->closure_env_dtors[type_id] = type_info.dtor_func_idx;
         }
+        if (type_info.pooled) {
+            while (vm->state_pools.size() <= type_id)
+                vm->state_pools.push_back(roxy_free_pool{nullptr, 0, 0});
+            vm->state_pools[type_id].capacity = ROXY_FREE_POOL_CAPACITY;
+        }
     }
 
+    // Hash the function names once, so vm_call / vm_resolve (and every other
+    // by-name lookup) stop scanning the function table.
+    module->index_names();
+
     // Build flat function pointer cache
     delete[] vm->function_ptrs;
     vm->function_count = static_cast<u32>(module->functions.size());
@@ -220,6 +240,42 @@ bool vm_load_module(RoxyVM* vm, BCModule* module) {
         vm->function_ptrs[i] = module->functions[i].get();
     }
 
+    // Number the CALL_INDIRECT sites and give each an inline cache. The slot
+    // goes into the instruction's second word (emitted as 0 by lowering);
+    // numbering is deterministic, so reloading the same module rewrites the
+    // same values.
+    u32 indirect_sites = 0;
+    for (u32 fi = 0; fi < vm->function_count; fi++) {
+        Vector<u32>& code = module->functions[fi]->code;
+        for (u32 i = 0; i < code.size(); i++) {
+            Opcode op = decode_opcode(code[i]);
+            if (op == Opcode::CALL_INDIRECT) {
+                code[i + 1] = indirect_sites++;
+            }
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+    }
+    vm->indirect_call_cache_count = indirect_sites;
+    vm->indirect_call_caches.reset();
+    if (indirect_sites > 0) {
+        vm->indirect_call_caches =
+            UniquePtr<IndirectCallCache[]>(new (std::nothrow) IndirectCallCache[indirect_sites]);
+        if (!vm->indirect_call_caches) {
+            vm->indirect_call_cache_count = 0;
+            return false;
+        }
+    }
+
+    // Direct-threaded translation, after the CALL_INDIRECT slots are written
+    // so the copies carry them.
+    if (vm->threaded_dispatch) {
+        for (u32 fi = 0; fi < vm->function_count; fi++) {
+            build_threaded_code(module->functions[fi].get());
+        }
+    }
+
     // Pre-intern every string constant once at load time. Each BCConstant
     // caches the resulting StringObject* so the LOAD_CONST opcode can return
     // it directly — no per-execution hash, no per-execution probe. The
@@ -273,65 +329,67 @@ bool vm_call(RoxyVM* vm, StringView func_name, Span<Value> args) {
     return vm_call_index(vm, static_cast<u32>(func_index), args);
 }
 
-bool vm_call_index(RoxyVM* vm, u32 func_index, Span<Value> args) {
+RoxyFunctionHandle vm_resolve(RoxyVM* vm, StringView func_name) {
+    RoxyFunctionHandle handle;
+    if (vm->module != nullptr) {
+        i32 func_index = vm->module->find_function(func_name);
+        if (func_index >= 0)
+            handle.index = static_cast<u32>(func_index);
+    }
+    return handle;
+}
+
+u64* vm_push_entry_frame(RoxyVM* vm, u32 func_index) {
     if (vm->module == nullptr) {
         vm->error = "No module loaded";
-        return false;
+        return nullptr;
     }
 
     if (func_index >= vm->module->functions.size()) {
         vm->error = "Invalid function index";
-        return false;
+        return nullptr;
     }
 
     const BCFunction* func = vm->module->functions[func_index].get();
 
-    // Check argument count
-    if (args.size() != func->param_count) {
-        vm->error = "Wrong number of arguments";
-        return false;
-    }
-
     // Check register space
     if (vm->register_top + func->register_count > vm->register_file_size) {
         vm->error = "Register file overflow";
-        return false;
-    }
-
-    // Allocate registers for this call
-    u64* registers = &vm->register_file[vm->register_top];
-    vm->register_top += func->register_count;
-
-    // Clear registers (debug only — SSA guarantees write-before-read)
-#ifndef NDEBUG
-    memset(registers, 0, func->register_count * sizeof(u64));
-#endif
-
-    // Copy arguments to registers R0, R1, ...
-    for (u32 i = 0; i < args.size(); i++) {
-        registers[i] = args[i].as_u64();
+        return nullptr;
     }
 
-    // Allocate local stack space for this function (16-byte aligned)
+    // Local stack space for this function (16-byte aligned)
     u32 local_stack_base = (vm->local_stack_top + 3) & ~3u; // Align to 4 slots (16 bytes)
     if (local_stack_base + func->local_stack_slots > vm->local_stack_size) {
         vm->error = "Local stack overflow";
-        return false;
+        return nullptr;
     }
-    vm->local_stack_top = local_stack_base + func->local_stack_slots;
 
     // Guard against overflowing the fixed-size call stack (e.g. an embedder
     // re-entering the VM while frames are still active).
     if (vm->call_stack_size >= vm->call_stack_capacity) {
         vm->error = "Call stack overflow";
-        return false;
+        return nullptr;
     }
 
+    // Allocate registers for this call
+    u64* registers = &vm->register_file[vm->register_top];
+    vm->register_top += func->register_count;
+    vm->local_stack_top = local_stack_base + func->local_stack_slots;
+
+    // Clear registers (debug only — SSA guarantees write-before-read)
+#ifndef NDEBUG
+    memset(registers, 0, func->register_count * sizeof(u64));
+#endif
+
     // Push call frame
     // For top-level call, return_reg is 0 (result goes to R0 of this frame)
     vm->call_stack[vm->call_stack_size++] =
-        CallFrame(func, func->code.data(), registers, 0, local_stack_base);
+        CallFrame(func, vm_entry_pc(vm, func), registers, 0, local_stack_base);
+    return registers;
+}
 
+bool vm_run_entry_frame(RoxyVM* vm) {
     // Activate this VM's context for the duration of the call so native
     // functions and runtime helpers can fetch it via `roxy_get_ctx()`. The
     // RAII guard restores the previous (typically null) context on return.
@@ -342,12 +400,173 @@ bool vm_call_index(RoxyVM* vm, u32 func_index, Span<Value> args) {
     bool success = interpret(vm);
     vm->running = false;
 
+    // Back in the host (or stopped by an error): hand over buffered print output
+    // so it lands before anything the host writes next. A nested entry from a
+    // native leaves it for the outer call.
+    if (!success || vm->call_stack_size == 0)
+        roxy_ctx_flush_output(&vm->ctx);
+
     // If we still have a frame on the stack, it means we returned normally
     // The result should be in registers[0]
 
     return success;
 }
 
+bool vm_call_index(RoxyVM* vm, u32 func_index, Span<Value> args) {
+    if (vm->module != nullptr && func_index < vm->module->functions.size() &&
+        args.size() != vm->module->functions[func_index]->param_count) {
+        vm->error = "Wrong number of arguments";
+        return false;
+    }
+
+    u64* registers = vm_push_entry_frame(vm, func_index);
+    if (!registers)
+        return false;
+
+    // Copy arguments to registers R0, R1, ...
+    for (u32 i = 0; i < args.size(); i++) {
+        registers[i] = args[i].as_u64();
+    }
+
+    return vm_run_entry_frame(vm);
+}
+
+bool vm_call_handle(RoxyVM* vm, RoxyFunctionHandle func, Span<Value> args) {
+    if (!func.valid()) {
+        vm->error = "Function not found";
+        return false;
+    }
+    return vm_call_index(vm, func.index, args);
+}
+
+bool vm_call_handle_regs(RoxyVM* vm, RoxyFunctionHandle func, const u64* arg_regs,
+                         u32 arg_reg_count) {
+    if (!func.valid()) {
+        vm->error = "Function not found";
+        return false;
+    }
+    if (vm->module != nullptr && func.index < vm->module->functions.size() &&
+        arg_reg_count != vm->module->functions[func.index]->param_register_count) {
+        vm->error = "Wrong number of arguments";
+        return false;
+    }
+
+    u64* registers = vm_push_entry_frame(vm, func.index);
+    if (!registers)
+        return false;
+    if (arg_reg_count > 0)
+        memcpy(registers, arg_regs, arg_reg_count * sizeof(u64));
+
+    return vm_run_entry_frame(vm);
+}
+
+u32 vm_call_batch_with(RoxyVM* vm, RoxyFunctionHandle func, u32 count, RoxyBatchArgFn fill,
+                       void* user, u64* results) {
+    ROXY_ZONE("vm.run_batch");
+    if (!func.valid()) {
+        vm->error = "Function not found";
+        return 0;
+    }
+    if (count == 0)
+        return 0;
+
+    // The first push runs every check. A call that returns leaves register_top,
+    // local_stack_top and the call stack exactly where they were before it, so
+    // later calls re-push the same frame without repeating them.
+    [[maybe_unused]] const u32 base_register_top = vm->register_top;
+    [[maybe_unused]] const u32 base_call_depth = vm->call_stack_size;
+    u64* registers = vm_push_entry_frame(vm, func.index);
+    if (!registers)
+        return 0;
+    const CallFrame entry = vm->call_stack_back();
+    const u32 frame_register_top = vm->register_top;
+    const u32 frame_local_stack_top = vm->local_stack_top;
+#ifndef NDEBUG
+    const u32 register_count = entry.func->register_count;
+#endif
+
+    roxy::ScopedContext ctx_guard(&vm->ctx);
+    vm->running = true;
+    u32 completed = 0;
+    for (; completed < count; completed++) {
+        if (completed > 0) {
+#ifndef NDEBUG
+            memset(registers, 0, register_count * sizeof(u64));
+#endif
+            vm->register_top = frame_register_top;
+            vm->local_stack_top = frame_local_stack_top;
+            vm->call_stack[vm->call_stack_size++] = entry;
+        }
+        fill(user, completed, registers);
+        if (!interpret(vm))
+            break;
+        assert(vm->register_top == base_register_top && vm->call_stack_size == base_call_depth);
+        if (results)
+            results[completed] = vm->register_file[0];
+    }
+    vm->running = false;
+    if (completed < count || base_call_depth == 0)
+        roxy_ctx_flush_output(&vm->ctx);
+    return completed;
+}
+
+namespace {
+
+struct BatchRows {
+    const u64* args;
+    u32 stride;
+};
+
+struct BatchColumns {
+    const u64* const* columns;
+    u32 column_count;
+};
+
+} // namespace
+
+u32 vm_call_batch(RoxyVM* vm, RoxyFunctionHandle func, const u64* args, u32 count,
+                  u64* results) {
+    if (!func.valid()) {
+        vm->error = "Function not found";
+        return 0;
+    }
+    if (vm->module == nullptr || func.index >= vm->module->functions.size()) {
+        vm->error = vm->module == nullptr ? "No module loaded" : "Invalid function index";
+        return 0;
+    }
+    BatchRows rows{args, vm->module->functions[func.index]->param_register_count};
+    return vm_call_batch_with(
+        vm, func, count,
+        [](void* user, u32 index, u64* regs) {
+            auto* rows = static_cast<BatchRows*>(user);
+            const u64* row = rows->args + static_cast<size_t>(index) * rows->stride;
+            for (u32 p = 0; p < rows->stride; p++)
+                regs[p] = row[p];
+        },
+        &rows, results);
+}
+
+u32 vm_call_batch_columns(RoxyVM* vm, RoxyFunctionHandle func, const u64* const* arg_columns,
+                          u32 count, u64* results) {
+    if (!func.valid()) {
+        vm->error = "Function not found";
+        return 0;
+    }
+    if (vm->module == nullptr || func.index >= vm->module->functions.size()) {
+        vm->error = vm->module == nullptr ? "No module loaded" : "Invalid function index";
+        return 0;
+    }
+    BatchColumns columns{arg_columns, vm->module->functions[func.index]->param_register_count};
+    return vm_call_batch_with(
+        vm, func, count,
+        [](void* user, u32 index, u64* regs) {
+            auto* columns = static_cast<BatchColumns*>(user);
+            for (u32 p = 0; p < columns->column_count; p++)
+                regs[p] = columns->columns[p][index];
+        },
+        &columns, results);
+}
+
 Value vm_get_result(RoxyVM* vm) {
     // Result is in the first register after all frames have been popped
     if (vm->register_file && vm->register_file_size > 0) {
@@ -356,9 +575,14 @@ Value vm_get_result(RoxyVM* vm) {
     return Value::make_null();
 }
 
+u64 vm_get_result_reg(RoxyVM* vm) {
+    return vm->register_file && vm->register_file_size > 0 ? vm->register_file[0] : 0;
+}
+
 roxy_heap_stats vm_heap_stats(RoxyVM* vm) {
     roxy_heap_stats out = {0, 0, 0};
     if (vm && vm->allocator) {
+        object_drain_pools(vm);
         auto stats = vm->allocator->live_object_stats();
         out.live = stats.live;
         out.immortal = stats.immortal;
@@ -367,6 +591,10 @@ roxy_heap_stats vm_heap_stats(RoxyVM* vm) {
     return out;
 }
 
+void vm_set_output_sink(RoxyVM* vm, roxy_output_sink sink, void* userdata) {
+    roxy_ctx_set_output_sink(&vm->ctx, sink, userdata);
+}
+
 const char* vm_get_error(RoxyVM* vm) { return vm->error; }
 
 void vm_clear_error(RoxyVM* vm) { vm->error = nullptr; }
@@ -381,6 +609,10 @@ void vm_register_native(RoxyVM* vm, StringView name, NativeFunction func, u32 pa
     native.func = func;
     native.param_count = param_count;
     vm->module->native_functions.push_back(native);
+    if (vm->module->names_indexed) {
+        vm->module->native_function_names.emplace(
+            name, static_cast<u32>(vm->module->native_functions.size() - 1));
+    }
 }
 
 } // namespace rx
@@ -192,4 +192,74 @@ TEST_SUITE("E2E Algorithms") {
         CHECK(result.stdout_output == "42\n123\n0\n");
     }
 
+    // ============================================================================
+    // Superinstructions
+    // ============================================================================
+
+    // Exercises the usual superinstruction shapes — list indexing, field loads
+    // feeding arithmetic, constants feeding calls — and checks the formed code
+    // against superinstructions.def: each superinstruction must be followed by
+    // its pair's second op, which stays an ordinary instruction.
+    TEST_CASE("Superinstructions preserve the fused pair") {
+        const char* source = R"(
+        struct Point { x: i32; y: i32; }
+
+        fun weight(p: Point, k: i32): i32 { return p.x * k + p.y; }
+
+        fun main(): i32 {
+            var lst: List<i32> = List<i32>();
+            for (var i: i32 = 0; i < 50; i = i + 1) {
+                lst.push(i * 3 - 20);
+            }
+            var total: i32 = 0;
+            for (var i: i32 = 0; i < lst.len(); i = i + 1) {
+                if (lst[i] < 0) {
+                    total = total - lst[i];
+                } else {
+                    total = total + lst[i];
+                }
+            }
+            var p: Point;
+            p.x = 7;
+            p.y = -2;
+            for (var i: i32 = 0; i < 10; i = i + 1) {
+                p.x = p.x + 1;
+                total = total + weight(p, 3) + p.y;
+            }
+            return total;
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+
+        for (const auto& func : module->functions) {
+            const auto& code = func->code;
+            for (u32 i = 0; i < code.size();) {
+                Opcode op = decode_opcode(code[i]);
+                u32 width = is_two_word_instruction(op) ? 2 : 1;
+                Opcode first = superinstruction_first_op(op);
+                if (first != op) {
+                    REQUIRE(i + width < code.size());
+                    Opcode second = decode_opcode(code[i + width]);
+                    CHECK(find_superinstruction(first, second) == op);
+                    CHECK(superinstruction_first_op(second) == second);
+                }
+                i += width;
+            }
+        }
+
+        RoxyVM vm;
+        vm_init(&vm);
+        REQUIRE(vm_load_module(&vm, module));
+        CHECK(vm_call(&vm, "main", {}));
+        // List: sum of |3i - 20| for i in [0, 50) = 2829. Point loop:
+        // sum over x = 8..17 of (3x - 2) + (-2) = 3 * 125 - 40 = 335.
+        CHECK(vm_get_result(&vm).as_int == 2829 + 335);
+
+        vm_destroy(&vm);
+        delete module;
+    }
+
 } // TEST_SUITE("E2E Algorithms")
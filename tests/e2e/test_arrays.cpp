@@ -0,0 +1,248 @@
+#include "roxy/core/doctest/doctest.h"
+#include "test_e2e_backend.hpp"
+#include "test_helpers.hpp"
+
+using namespace rx;
+
+// ============================================================================
+// Array<T>: dense, fixed-length, natural-width elements
+// ============================================================================
+//
+// An Array stores each element in its own byte width (1, 2, 4 or 8) instead of
+// List's 32-bit slots. Element access is one INDEX_GET_ARR_* / INDEX_SET_ARR_*
+// instruction in the VM and a typed load or store through roxy_array_elem in
+// the C backend; narrow loads must sign- or zero-extend the same way on both.
+
+TEST_SUITE("E2E Arrays") {
+
+    TEST_CASE_TEMPLATE("elements keep their width and signedness", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: Array<i8> = Array<i8>(3);
+            a[0] = i8(-1); a[1] = i8(127); a[2] = i8(a[0] + a[1]);
+            var b: Array<u8> = Array<u8>(2);
+            b[0] = u8(255); b[1] = u8(b[0] + u8(2));
+            var c: Array<i16> = Array<i16>(2);
+            c[0] = i16(-300); c[1] = i16(c[0] * i16(2));
+            var d: Array<u16> = Array<u16>(1);
+            d[0] = u16(65535);
+            var e: Array<u32> = Array<u32>(1);
+            e[0] = u32(4000000000);
+            var f: Array<i64> = Array<i64>(1);
+            f[0] = -9000000000000;
+            print(f"{i32(a[0])} {i32(a[1])} {i32(a[2])} {i32(b[0])} {i32(b[1])} {i32(c[0])} {i32(c[1])}");
+            print(f"{i32(d[0])} {e[0]} {e[0] > u32(3000000000)} {f[0]}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "-1 127 126 255 1 -300 -600\n65535 4000000000 true -9000000000000\n");
+    }
+
+    TEST_CASE_TEMPLATE("float and bool elements", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: Array<f32> = Array<f32>(4);
+            var ys: Array<f64> = Array<f64>(4);
+            var flags: Array<bool> = Array<bool>(4);
+            for (var i: i32 = 0; i < xs.len(); i = i + 1) {
+                xs[i] = f32(i) * 1.5f;
+                ys[i] = f64(i) - 0.25;
+                flags[i] = i % 2 == 0;
+            }
+            var sum: f64 = 0.0;
+            for y in ys {
+                sum = sum + y;
+            }
+            print(f"{xs[3]} {ys[0]} {sum} {flags[0]} {flags[1]}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "4.5 -0.25 5 true false\n");
+    }
+
+    TEST_CASE_TEMPLATE("new arrays are zeroed; fill, resize and slice", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: Array<i32> = Array<i32>(4);
+            print(f"{a.len()} {a[0]} {a[3]}");
+            a.fill(7);
+            a.resize(6);
+            print(f"{a.len()} {a[3]} {a[4]} {a[5]}");
+            for (var i: i32 = 0; i < a.len(); i = i + 1) {
+                a[i] = i * 10;
+            }
+            var s: Array<i32> = a.slice(1, 4);
+            s[0] = -1;
+            print(f"{s.len()} {s[0]} {s[2]} {a[1]}");
+            a.resize(2);
+            print(f"{a.len()} {a[1]}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "4 0 0\n6 7 0 0\n3 -1 30 10\n2 10\n");
+    }
+
+    TEST_CASE_TEMPLATE("copy and copy_from are independent of the source", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: Array<u16> = Array<u16>(5);
+            for (var i: i32 = 0; i < 5; i = i + 1) {
+                a[i] = u16(i + 1);
+            }
+            var b: Array<u16> = a.copy();
+            b[0] = u16(100);
+            var c: Array<u16> = Array<u16>(5);
+            c.copy_from(1, a, 0, 3);
+            a.copy_from(1, a, 0, 4);
+            print(f"{i32(a[0])} {i32(b[0])} {i32(b[4])}");
+            print(f"{i32(c[0])} {i32(c[1])} {i32(c[3])} {i32(c[4])}");
+            print(f"{i32(a[1])} {i32(a[2])} {i32(a[4])}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "1 100 5\n0 1 3 0\n1 2 4\n");
+    }
+
+    TEST_CASE_TEMPLATE("arrays pass through functions and struct fields", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct Image { width: i32; pixels: Array<u8>; }
+
+        fun sum(xs: ref Array<u8>): i32 {
+            var total: i32 = 0;
+            for x in xs {
+                total = total + i32(x);
+            }
+            return total;
+        }
+
+        fun make(n: i32): Array<u8> {
+            var a: Array<u8> = Array<u8>(n);
+            a.fill(u8(200));
+            return a;
+        }
+
+        fun main(): i32 {
+            var img: Image = Image { width = 3, pixels = make(3) };
+            img.pixels[1] = u8(10);
+            var widths: Array<i32> = Array<i32>(2);
+            widths[1] = img.width;
+            print(f"{sum(img.pixels)} {img.pixels.len()} {widths}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "410 3 [0, 3]\n");
+    }
+
+    TEST_CASE("out-of-range array access traps") {
+        const char* bad_get = R"(
+        fun main(): i32 {
+            var a: Array<i16> = Array<i16>(2);
+            return i32(a[2]);
+        }
+    )";
+        const char* bad_set = R"(
+        fun main(): i32 {
+            var a: Array<u8> = Array<u8>(2);
+            a[-1] = u8(1);
+            return 0;
+        }
+    )";
+        const char* bad_slice = R"(
+        fun main(): i32 {
+            var a: Array<i32> = Array<i32>(2);
+            var s: Array<i32> = a.slice(1, 3);
+            return s.len();
+        }
+    )";
+        CHECK(VMBackend::run(bad_get).success == false);
+        CHECK(VMBackend::run(bad_set).success == false);
+        CHECK(VMBackend::run(bad_slice).success == false);
+    }
+
+    TEST_CASE("array element access compiles to width-specific opcodes") {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: Array<i8> = Array<i8>(2);
+            var b: Array<u16> = Array<u16>(2);
+            var c: Array<f64> = Array<f64>(2);
+            a[0] = i8(-3);
+            b[1] = u16(9);
+            c[0] = 1.5;
+            return i32(a[0]) + i32(b[1]) + i32(c[0]);
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+        i32 main_index = module->find_function("main");
+        REQUIRE(main_index >= 0);
+        const BCFunction& func = *module->functions[main_index];
+        u32 gets = 0;
+        u32 sets = 0;
+        u32 list_ops = 0;
+        for (u32 i = 0; i < func.code.size(); i++) {
+            Opcode op = decode_opcode(func.code[i]);
+            gets += op == Opcode::INDEX_GET_ARR_I8 || op == Opcode::INDEX_GET_ARR_U16 ||
+                    op == Opcode::INDEX_GET_ARR_64;
+            sets += op == Opcode::INDEX_SET_ARR_8 || op == Opcode::INDEX_SET_ARR_16 ||
+                    op == Opcode::INDEX_SET_ARR_64;
+            list_ops += op == Opcode::INDEX_GET_LIST || op == Opcode::INDEX_SET_LIST;
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+        CHECK(gets == 3);
+        CHECK(sets == 3);
+        CHECK(list_ops == 0);
+        delete module;
+
+        E2EResult run = VMBackend::run(source);
+        CHECK(run.success);
+        CHECK(run.value == -3 + 9 + 1);
+    }
+
+    TEST_CASE("array misuse is rejected") {
+        const char* string_elems = R"(
+        fun main(): i32 {
+            var a: Array<string> = Array<string>(1);
+            return 0;
+        }
+    )";
+        const char* struct_elems = R"(
+        struct P { x: i32; }
+        fun main(): i32 {
+            var a: Array<P> = Array<P>(1);
+            return 0;
+        }
+    )";
+        const char* inout_elem = R"(
+        fun bump(x: inout i32) { x = x + 1; }
+        fun main(): i32 {
+            var a: Array<i32> = Array<i32>(1);
+            bump(inout a[0]);
+            return a[0];
+        }
+    )";
+        CHECK(VMBackend::run(string_elems).success == false);
+        CHECK(VMBackend::run(struct_elems).success == false);
+        CHECK(VMBackend::run(inout_elem).success == false);
+    }
+}
@@ -1,6 +1,7 @@
 #include "roxy/core/doctest/doctest.h"
 #include "test_e2e_backend.hpp"
 #include "test_helpers.hpp"
+#include "roxy/vm/vm.hpp"
 
 #include <string>
 
@@ -410,6 +411,154 @@ TEST_SUITE("E2E Basics") {
         }
     }
 
+    TEST_CASE("Spill choice keeps loop-used values in registers") {
+        // 300 values are live at once; v_2..v_299 are read once in a straight
+        // sum, then a loop reads only v_0 and v_1. v_0 and v_1 have the
+        // *furthest* last use — exactly what a furthest-end picker evicts,
+        // which puts a RELOAD_REG inside the loop body. The loop-depth-weighted
+        // cost must evict the once-read values instead.
+        // Each v_i chains off the previous one (v_i = i + 1 for seed 1) rather
+        // than adding a literal, so the constant pool stays small.
+        const int count = 300;
+        std::string src = "fun f(seed: i32): i32 {\n    var v_0: i32 = seed;\n";
+        for (int i = 1; i < count; i++) {
+            src += "    var v_" + std::to_string(i) + ": i32 = v_" + std::to_string(i - 1) +
+                   " + seed;\n";
+        }
+        src += "    var acc: i32 = 0;\n";
+        for (int i = count - 1; i >= 2; i--) {
+            src += "    acc = acc + v_" + std::to_string(i) + ";\n";
+        }
+        src += "    for (var i: i32 = 0; i < 100; i = i + 1) {\n";
+        src += "        acc = acc + v_0 * i + v_1;\n";
+        src += "    }\n";
+        src += "    return acc;\n}\n";
+        src += "fun main(): i32 { return f(1); }\n";
+
+        BumpAllocator allocator(65536);
+        BCModule* module = compile(allocator, src.c_str());
+        REQUIRE(module != nullptr);
+        i32 f_index = module->find_function("f");
+        REQUIRE(f_index >= 0);
+        const BCFunction& func = *module->functions[f_index];
+        CHECK(func.spilled_values > 0);
+        CHECK(func.spill_ops > 0);
+        // Spilled values live in wide registers, above the 8-bit window.
+        CHECK(func.register_count > 256);
+        for (u32 i = 0; i < func.code.size(); i++) {
+            Opcode op = decode_opcode(func.code[i]);
+            if (op == Opcode::SPILL_REG || op == Opcode::RELOAD_REG) {
+                CHECK(decode_imm16(func.code[i]) >= 256);
+                CHECK(decode_imm16(func.code[i]) < func.register_count);
+            }
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+
+        // The loop is the code between its backward JMP and that JMP's target.
+        u32 loop_start = 0;
+        u32 loop_end = 0;
+        for (u32 i = 0; i < func.code.size(); i++) {
+            Opcode op = decode_opcode(func.code[i]);
+            if (op == Opcode::JMP && decode_offset(func.code[i]) < 0) {
+                loop_start = static_cast<u32>(static_cast<i32>(i) + 1 +
+                                              decode_offset(func.code[i]));
+                loop_end = i;
+            }
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+        REQUIRE(loop_end > loop_start);
+        for (u32 i = loop_start; i <= loop_end; i++) {
+            Opcode op = decode_opcode(func.code[i]);
+            CHECK(op != Opcode::RELOAD_REG);
+            CHECK(op != Opcode::SPILL_REG);
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+        delete module;
+
+        TestResult result = run_and_capture(src.c_str(), "main");
+        CHECK(result.success);
+        // Sum of v_2..v_299 = 300 * 301 / 2 - 1 - 2; loop: 100 * 2 (v_1) + 4950 (v_0 * i).
+        CHECK(result.value == 45147 + 200 + 4950);
+    }
+
+    TEST_CASE("Threaded dispatch matches table dispatch") {
+        // Recursion (CALL), a closure call (CALL_INDIRECT inline cache), an
+        // exception unwinding two frames (handler PC lookup), and two-word
+        // fused list-of-struct ops all exercise the pre-decoded code stream.
+        const char* source = R"(
+        struct P { x: i32; y: i32; }
+        struct Boom { code: i32; }
+        fun Boom.message(): string for Exception { return "boom"; }
+
+        fun fib(n: i32): i32 {
+            if (n < 2) { return n; }
+            return fib(n - 1) + fib(n - 2);
+        }
+        fun inner(n: i32): i32 {
+            if (n > 3) { throw Boom { code = n }; }
+            return n;
+        }
+        fun outer(n: i32): i32 { return inner(n) + 1; }
+
+        fun main(): i32 {
+            var total: i32 = fib(15);
+            var k: i32 = 3;
+            var add_k = fun(x: i32): i32 => x + k;
+            for (var i: i32 = 0; i < 10; i = i + 1) {
+                total = total + add_k(i);
+            }
+            for (var i: i32 = 0; i < 6; i = i + 1) {
+                try {
+                    total = total + outer(i);
+                } catch (e: Boom) {
+                    total = total + e.code * 100;
+                }
+            }
+            var ps: List<P> = List<P>();
+            for (var i: i32 = 0; i < 4; i = i + 1) {
+                ps.push(P { x = i, y = i * 2 });
+            }
+            for (var i: i32 = 0; i < ps.len(); i = i + 1) {
+                ps[i].y = ps[i].y + ps[i].x;
+                total = total + ps[i].y;
+            }
+            return total;
+        }
+    )";
+
+        i64 results[2] = {};
+        for (int threaded = 0; threaded < 2; threaded++) {
+            BumpAllocator allocator(8192);
+            BCModule* module = compile(allocator, source);
+            REQUIRE(module != nullptr);
+
+            RoxyVM vm;
+            VMConfig config;
+            config.threaded_dispatch = threaded != 0;
+            vm_init(&vm, config);
+            vm_load_module(&vm, module);
+            if (vm.threaded_dispatch) {
+                for (const auto& func : module->functions) {
+                    CHECK(func->threaded_code.size() == func->code.size());
+                }
+            }
+            CHECK(vm_call(&vm, "main", {}));
+            results[threaded] = vm_get_result(&vm).as_int;
+            vm_destroy(&vm);
+            delete module;
+        }
+        // fib(15) = 610; closure: 45 + 30; outer(0..3): 10; throws: 400 + 500;
+        // ps: 3 * (0 + 1 + 2 + 3).
+        CHECK(results[0] == 610 + 75 + 10 + 900 + 18);
+        CHECK(results[1] == results[0]);
+    }
+
     TEST_CASE("function exceeding the i16 branch-offset range is rejected") {
         // A branch spanning more than 32K code words cannot be encoded in the
         // i16 AOFF offset field; the compiler must reject it rather than
@@ -1,4 +1,6 @@
 #include "roxy/core/doctest/doctest.h"
+#include "roxy/core/bump_allocator.hpp"
+#include "roxy/core/json.hpp"
 
 #include <cstdio>
 #include <cstdlib>
@@ -51,39 +53,19 @@ const char* cli_tmpdir() {
 #endif
 }
 
-// Write `source` to a temp .roxy file, run the CLI on it with `extra_args`
-// appended, and report how the process ended.
-CliRun run_cli(const char* source, const char* extra_args) {
+// Run `cmd` through the shell, capture its stdout, and report how it ended.
+CliRun run_command(const char* cmd) {
     CliRun result;
 
-    char src_path[512];
-    snprintf(src_path, sizeof(src_path), "%s/roxy_cli_test.roxy", cli_tmpdir());
-    FILE* f = fopen(src_path, "w");
-    if (!f)
-        return result;
-    fputs(source, f);
-    fclose(f);
-
-    // stdout is captured; stderr stays attached on purpose. Redirecting both
-    // lets an intermediate shell fork and mask a signal death into a 128+signo
-    // exit code — which is exactly the signal we need to see here. (Same
-    // reasoning as the C-backend runner in test_helpers.cpp.)
-    char cmd[1024];
-    snprintf(cmd, sizeof(cmd), "\"%s\" \"%s\"%s%s", ROXY_CLI_PATH, src_path,
-             extra_args && *extra_args ? " " : "", extra_args ? extra_args : "");
-
     FILE* pipe = popen(cmd, "r");
-    if (!pipe) {
-        remove(src_path);
+    if (!pipe)
         return result;
-    }
 
     char buf[1024];
     while (fgets(buf, sizeof(buf), pipe)) {
         result.stdout_output.append(buf);
     }
     int status = pclose(pipe);
-    remove(src_path);
 
 #ifdef _WIN32
     // Abnormal termination (a failed assert/abort -> 0xC0000409, …) lands in the
@@ -105,6 +87,59 @@ CliRun run_cli(const char* source, const char* extra_args) {
     return result;
 }
 
+std::string cli_temp_path(const char* name) {
+    return std::string(cli_tmpdir()) + "/" + name;
+}
+
+bool write_file(const std::string& path, const char* contents) {
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f)
+        return false;
+    fputs(contents, f);
+    fclose(f);
+    return true;
+}
+
+// Write `source` to a temp .roxy file, run the CLI on it with `extra_args`
+// appended, and report how the process ended.
+CliRun run_cli(const char* source, const char* extra_args) {
+    std::string src_path = cli_temp_path("roxy_cli_test.roxy");
+    if (!write_file(src_path, source))
+        return CliRun{};
+
+    // stdout is captured; stderr stays attached on purpose. Redirecting both
+    // lets an intermediate shell fork and mask a signal death into a 128+signo
+    // exit code — which is exactly the signal we need to see here. (Same
+    // reasoning as the C-backend runner in test_helpers.cpp.)
+    char cmd[1024];
+    snprintf(cmd, sizeof(cmd), "\"%s\" \"%s\"%s%s", ROXY_CLI_PATH, src_path.c_str(),
+             extra_args && *extra_args ? " " : "", extra_args ? extra_args : "");
+
+    CliRun result = run_command(cmd);
+    remove(src_path.c_str());
+    return result;
+}
+
+// `ok compile_ms=0.031 exit=3` -> `ok exit=3`, so replies compare exactly.
+std::string strip_compile_times(const std::string& output) {
+    std::string stripped;
+    size_t pos = 0;
+    while (pos < output.size()) {
+        size_t end = output.find('\n', pos);
+        if (end == std::string::npos)
+            end = output.size();
+        std::string line = output.substr(pos, end - pos);
+        if (line.rfind("ok compile_ms=", 0) == 0) {
+            size_t space = line.find(' ', 3);
+            line = space == std::string::npos ? "ok" : "ok" + line.substr(space);
+        }
+        stripped += line;
+        stripped += '\n';
+        pos = end + 1;
+    }
+    return stripped;
+}
+
 } // namespace
 
 TEST_SUITE("E2E CLI") {
@@ -225,6 +260,161 @@ TEST_SUITE("E2E CLI") {
         CHECK(result.stdout_output == "sum=6\n");
     }
 
+    TEST_CASE("--serve answers compile and run requests in order") {
+        // One process, one CompilerSession: the error in the middle must not
+        // leak into the compiles after it, and an unknown request is answered
+        // rather than ending the loop.
+        std::string good_path = cli_temp_path("roxy_cli_serve_good.roxy");
+        std::string bad_path = cli_temp_path("roxy_cli_serve_bad.roxy");
+        std::string requests_path = cli_temp_path("roxy_cli_serve_requests.txt");
+        REQUIRE(write_file(good_path, "fun main(): i32 {\n"
+                                      "    print(\"hi\");\n"
+                                      "    return 3;\n"
+                                      "}\n"));
+        REQUIRE(write_file(bad_path, "fun main(): i32 {\n"
+                                     "    return \"x\";\n"
+                                     "}\n"));
+        std::string requests = "run " + good_path + "\n" + "compile " + bad_path + "\n" +
+                               "bogus\n" + "compile " + good_path + "\n" + "run " + good_path +
+                               "\n";
+        REQUIRE(write_file(requests_path, requests.c_str()));
+
+        char cmd[1024];
+        snprintf(cmd, sizeof(cmd), "\"%s\" --serve < \"%s\"", ROXY_CLI_PATH,
+                 requests_path.c_str());
+        CliRun result = run_command(cmd);
+        remove(good_path.c_str());
+        remove(bad_path.c_str());
+        remove(requests_path.c_str());
+
+        CHECK(result.clean_exit);
+        CHECK(result.exit_code == 0);
+        CHECK(strip_compile_times(result.stdout_output) ==
+              "hi\n"
+              "ok exit=3\n"
+              "error 1\n"
+              "Semantic error in module 'roxy_cli_serve_bad' at line 2: cannot assign 'string' "
+              "to 'i32'\n"
+              "error 1\n"
+              "unknown request: bogus\n"
+              "ok\n"
+              "hi\n"
+              "ok exit=3\n");
+    }
+
+    TEST_CASE("--time=json reports phase memory as parseable JSON") {
+        // CI diffs this object against a baseline, so it must be the only thing
+        // on stdout (--repeat skips running the program) and carry the counters
+        // --time=mem prints: arena growth and Vector reallocations per phase.
+        std::string src_path = cli_temp_path("roxy_cli_time_json.roxy");
+        REQUIRE(write_file(src_path, "struct Point { x: i32; y: i32; }\n"
+                                     "fun main(): i32 {\n"
+                                     "    var points: List<Point> = List<Point>();\n"
+                                     "    points.push(Point { x = 1, y = 2 });\n"
+                                     "    print(f\"{points[0].y}\");\n"
+                                     "    return 0;\n"
+                                     "}\n"));
+        char cmd[1024];
+        snprintf(cmd, sizeof(cmd), "\"%s\" --repeat=2 --time=json \"%s\"", ROXY_CLI_PATH,
+                 src_path.c_str());
+        CliRun result = run_command(cmd);
+        remove(src_path.c_str());
+
+        CHECK(result.clean_exit);
+        CHECK(result.exit_code == 0);
+
+        rx::BumpAllocator allocator(4096);
+        rx::JsonValue root;
+        std::string output = result.stdout_output;
+        REQUIRE(rx::json_parse(output.data(), static_cast<rx::u32>(output.size()), allocator, root));
+        REQUIRE(root.is_object());
+        CHECK(root.find("runs")->as_int() == 2);
+        CHECK(root.find("execute_ms") == nullptr);
+        CHECK(root.find("max_value_ids")->as_int() > 0);
+        CHECK(root.find("bc_side_table_bytes")->as_int() > 0);
+
+        const rx::JsonValue* phases = root.find("phases");
+        REQUIRE(phases);
+        const rx::JsonValue* parse = phases->find("parse");
+        const rx::JsonValue* compile = phases->find("compile");
+        REQUIRE(parse);
+        REQUIRE(compile);
+        CHECK(parse->find("arena_bytes")->as_int() > 0);
+        CHECK(compile->find("arena_bytes")->as_int() >= parse->find("arena_bytes")->as_int());
+        CHECK(compile->find("vector_reallocs")->as_int() > 0);
+        CHECK(compile->find("ms")->as_double() > 0.0);
+    }
+
+    TEST_CASE("--time lists register spills only when something spilled") {
+        std::string small_path = cli_temp_path("roxy_cli_time_small.roxy");
+        std::string spill_path = cli_temp_path("roxy_cli_time_spill.roxy");
+        REQUIRE(write_file(small_path, "fun main(): i32 { return 0; }\n"));
+        // 300 values live at once overflow the 8-bit register window.
+        std::string spill_src = "fun f(seed: i32): i32 {\n    var v_0: i32 = seed;\n";
+        for (int i = 1; i < 300; i++) {
+            spill_src += "    var v_" + std::to_string(i) + ": i32 = v_" +
+                         std::to_string(i - 1) + " + seed;\n";
+        }
+        spill_src += "    var acc: i32 = 0;\n";
+        for (int i = 0; i < 300; i++) {
+            spill_src += "    acc = acc + v_" + std::to_string(i) + ";\n";
+        }
+        spill_src += "    return acc % 100;\n}\n";
+        spill_src += "fun main(): i32 { return f(1); }\n";
+        REQUIRE(write_file(spill_path, spill_src.c_str()));
+
+        char cmd[1024];
+        snprintf(cmd, sizeof(cmd), "\"%s\" --time \"%s\" 2>&1", ROXY_CLI_PATH,
+                 small_path.c_str());
+        CliRun small = run_command(cmd);
+        snprintf(cmd, sizeof(cmd), "\"%s\" --time \"%s\" 2>&1", ROXY_CLI_PATH,
+                 spill_path.c_str());
+        CliRun spill = run_command(cmd);
+        remove(small_path.c_str());
+        remove(spill_path.c_str());
+
+        CHECK(small.exit_code == 0);
+        CHECK(small.stdout_output.find("compile phases") != std::string::npos);
+        CHECK(small.stdout_output.find("register spills") == std::string::npos);
+        CHECK(spill.exit_code == 50); // 300 * 301 / 2 = 45150
+        CHECK(spill.stdout_output.find("register spills") != std::string::npos);
+    }
+
+    TEST_CASE("--emit-c writes the program as C++ instead of running it") {
+        // The driver's functions are module-qualified (`mod::fn`), which is not a
+        // C identifier; the emitter has to mangle them like method names.
+        std::string src_path = cli_temp_path("roxy_cli_emit_c.roxy");
+        std::string out_path = cli_temp_path("roxy_cli_emit_c.cpp");
+        REQUIRE(write_file(src_path, "fun twice(x: i32): i32 { return x * 2; }\n"
+                                     "fun main(): i32 {\n"
+                                     "    print(\"ran\");\n"
+                                     "    return twice(3);\n"
+                                     "}\n"));
+        char cmd[1024];
+        snprintf(cmd, sizeof(cmd), "\"%s\" --emit-c=\"%s\" \"%s\"", ROXY_CLI_PATH,
+                 out_path.c_str(), src_path.c_str());
+        CliRun result = run_command(cmd);
+        remove(src_path.c_str());
+
+        std::string emitted;
+        if (FILE* f = fopen(out_path.c_str(), "r")) {
+            char buf[1024];
+            size_t n;
+            while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+                emitted.append(buf, n);
+            }
+            fclose(f);
+        }
+        remove(out_path.c_str());
+
+        CHECK(result.clean_exit);
+        CHECK(result.exit_code == 0);
+        CHECK(result.stdout_output.empty()); // main() was not run
+        CHECK(emitted.find("int32_t roxy_cli_emit_c__twice(int32_t") != std::string::npos);
+        CHECK(emitted.find("::") == std::string::npos);
+        CHECK(emitted.find("int main(") != std::string::npos);
+    }
+
 } // TEST_SUITE("E2E CLI")
 
 #endif // ROXY_CLI_PATH
@@ -2,6 +2,8 @@
 #include "test_e2e_backend.hpp"
 #include "test_helpers.hpp"
 
+#include "roxy/vm/vm.hpp"
+
 using namespace rx;
 
 // ============================================================================
@@ -1500,4 +1502,76 @@ TEST_SUITE("E2E Closures") {
         }
     }
 
+    TEST_CASE("indirect call inline cache") { // VM-only: inspects the VM's per-site caches
+        // `apply` is one CALL_INDIRECT site fed three closures with different
+        // capture and register layouts in rotation, so its cache misses on
+        // every call. `repeat`'s site only ever sees one closure: one fill,
+        // then hits. Results must be the same either way.
+        const char* source = R"(
+        fun apply(f: ref fun(i32) -> i32, x: i32): i32 {
+            return f(x);
+        }
+        fun repeat(f: ref fun(i32) -> i32, n: i32): i32 {
+            var acc: i32 = 0;
+            for (var i: i32 = 0; i < n; i = i + 1) {
+                acc = acc + f(i);
+            }
+            return acc;
+        }
+        fun main(): i32 {
+            var k: i32 = 5;
+            var a: i32 = 2;
+            var b: i32 = 7;
+            var inc = fun(x: i32): i32 => x + 1;
+            var add = fun(x: i32): i32 => x + k;
+            var lin = fun(x: i32): i32 => a * x + b;
+            var total: i32 = 0;
+            for (var i: i32 = 0; i < 30; i = i + 1) {
+                var r: i32 = i % 3;
+                if (r == 0) { total = total + apply(inc, i); }
+                else if (r == 1) { total = total + apply(add, i); }
+                else { total = total + apply(lin, i); }
+            }
+            return total + repeat(lin, 100);
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+
+        RoxyVM vm;
+        vm_init(&vm);
+        REQUIRE(vm_load_module(&vm, module));
+        REQUIRE(vm.indirect_call_cache_count == 2);
+        CHECK(vm_call(&vm, "main", {}));
+        // inc over i = 0,3..27: 135 + 10; add over 1,4..28: 145 + 50;
+        // lin over 2,5..29: 2 * 155 + 70; repeat: 2 * 4950 + 700.
+        CHECK(vm_get_result(&vm).as_int == 145 + 195 + 380 + 10600);
+
+        u32 apply_misses = 0;
+        u32 repeat_misses = 0;
+        for (const auto& func : module->functions) {
+            for (u32 i = 0; i < func->code.size(); i++) {
+                Opcode op = decode_opcode(func->code[i]);
+                if (op == Opcode::CALL_INDIRECT) {
+                    u32 misses = vm.indirect_call_caches[func->code[i + 1]].miss_count;
+                    if (func->name == "apply") {
+                        apply_misses = misses;
+                    } else if (func->name == "repeat") {
+                        repeat_misses = misses;
+                    }
+                }
+                if (is_two_word_instruction(op)) {
+                    i++;
+                }
+            }
+        }
+        CHECK(apply_misses == 30);
+        CHECK(repeat_misses == 1);
+
+        vm_destroy(&vm);
+        delete module;
+    }
+
 } // TEST_SUITE("E2E Closures")
@@ -1,7 +1,10 @@
+#include "roxy/compiler/driver/bundled_modules.hpp"
 #include "roxy/core/doctest/doctest.h"
 #include "test_e2e_backend.hpp"
 #include "test_helpers.hpp"
 
+#include "roxy/vm/vm.hpp"
+
 #include <string>
 
 using namespace rx;
@@ -2052,6 +2055,175 @@ TEST_SUITE("E2E Coroutines") {
         CHECK(result.value == 6);
     }
 
+    TEST_CASE_TEMPLATE("Coroutine writes a global after a yield", Backend, RX_E2E_BACKENDS) {
+        // A global's slot offset rides in the GlobalAddr instruction's operand
+        // field; state-struct lowering must not remap it like a value id.
+        const char* source = R"(
+        var a: i32 = 0;
+        var b: i32 = 0;
+
+        fun bump(): Coro<i32> {
+            b = b + 1;
+            yield 0;
+            b = b + 10;
+            a = a + 100;
+            yield 1;
+        }
+
+        fun main(): i32 {
+            var c = bump();
+            c.resume();
+            c.resume();
+            c.resume();
+            return a + b;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.value == 111);
+    }
+
+    TEST_CASE_TEMPLATE("sched Scheduler runs tasks by their wait descriptors", Backend,
+                       RX_E2E_BACKENDS) {
+        // The bundled module is plain Roxy; pasted ahead of the program it
+        // compiles as one source on either backend. Long waits come off a heap,
+        // so tasks due on the same tick are not resumed in spawn order.
+        const BundledModule* sched = find_bundled_module("sched");
+        REQUIRE(sched != nullptr);
+        std::string source(sched->source, sched->length);
+        source += R"(
+        fun worker(id: i32): Coro<Wait> {
+            print(f"{id} start");
+            yield next_frame();
+            print(f"{id} frame");
+            yield wait_frames(100);
+            print(f"{id} later");
+            yield sleep(0.5);
+            print(f"{id} slept");
+            yield wait_signal(id % 2);
+            print(f"{id} signalled");
+        }
+
+        fun main(): i32 {
+            var s = Scheduler();
+            for (var id: i32 = 0; id < 3; id = id + 1) {
+                s.spawn(worker(id));
+            }
+            var resumed: i32 = 0;
+            while (s.frame() < 200l) {
+                var ran = s.tick(0.25);
+                if (ran > 0) {
+                    print(f"tick {s.frame() - 1l}: {ran}");
+                }
+                resumed = resumed + ran;
+            }
+            print(f"signal 1 woke {s.signal(1)}");
+            resumed = resumed + s.tick(0.25);
+            print(f"signal 0 woke {s.signal(0)}");
+            resumed = resumed + s.tick(0.25);
+            print(f"resumed {resumed} live {s.len()}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source.c_str());
+        CHECK(result.success);
+        CHECK(result.stdout_output == "0 start\n1 start\n2 start\ntick 0: 3\n"
+                                      "0 frame\n1 frame\n2 frame\ntick 1: 3\n"
+                                      "0 later\n2 later\n1 later\ntick 101: 3\n"
+                                      "0 slept\n1 slept\n2 slept\ntick 103: 3\n"
+                                      "signal 1 woke 1\n1 signalled\n"
+                                      "signal 0 woke 2\n0 signalled\n2 signalled\n"
+                                      "resumed 15 live 0\n");
+    }
+
+    // ---- State struct pooling -----------------------------------------------
+
+    TEST_CASE_TEMPLATE("Recycled coroutine states start fresh", Backend, RX_E2E_BACKENDS) {
+        // Each loop reuses the state the previous iteration freed. A recycled
+        // state must not carry the old `i`, `acc` or list, whether it was
+        // drained, dropped mid-iteration, or dropped through an erased Coro<T>.
+        const char* source = R"(
+        fun count_to(n: i32): Coro<i32> {
+            var i: i32 = 0;
+            while (i < n) { yield i; i = i + 1; }
+        }
+        fun collect(n: i32): Coro<i32> {
+            var seen: List<i32> = List<i32>();
+            var acc: i32 = 0;
+            for (var i: i32 = 0; i < n; i = i + 1) {
+                seen.push(i);
+                acc = acc + i;
+                yield acc + seen.len();
+            }
+        }
+        fun main(): i32 {
+            var total: i32 = 0;
+            for (var round: i32 = 0; round < 40; round = round + 1) {
+                var c = count_to(3);
+                while (true) {
+                    var v = c.resume();
+                    if (c.done()) { break; }
+                    total = total + v;
+                }
+                var partial = collect(4);
+                total = total + partial.resume();   // dropped after one step
+                var erased: List<Coro<i32>> = List<Coro<i32>>();
+                erased.push(collect(2));
+                total = total + erased[0].resume();
+            }
+            return total;
+        }
+    )";
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        // Per round: 0 + 1 + 2, then 1, then 1.
+        CHECK(result.value == 40 * 5);
+    }
+
+    TEST_CASE("A dropped coroutine state is parked and reused") {
+        const char* source = R"(
+        fun count_to(n: i32): Coro<i32> {
+            var i: i32 = 0;
+            while (i < n) { yield i; i = i + 1; }
+        }
+        fun main(): i32 {
+            var total: i32 = 0;
+            for (var round: i32 = 0; round < 100; round = round + 1) {
+                var c = count_to(2);
+                total = total + c.resume() + c.resume();
+            }
+            return total;
+        }
+    )";
+        BumpAllocator allocator(65536);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+
+        RoxyVM vm;
+        vm_init(&vm);
+        REQUIRE(vm_load_module(&vm, module));
+        u32 state_type_id = 0;
+        for (u32 i = 0; i < module->types.size(); i++) {
+            if (module->types[i].name == "__coro_count_to"_sv)
+                state_type_id = module->type_ids[i];
+        }
+        REQUIRE(state_type_id < vm.state_pools.size());
+        const roxy_free_pool& pool = vm.state_pools[state_type_id];
+        CHECK(pool.capacity == ROXY_FREE_POOL_CAPACITY);
+
+        CHECK(vm_call(&vm, "main", {}));
+        CHECK(vm_get_result(&vm).as_int == 100);
+        // 100 generators ran one at a time through a single recycled state
+        CHECK(pool.count == 1);
+        CHECK(vm_heap_stats(&vm).live == 0);
+        CHECK(pool.count == 0);
+
+        vm_destroy(&vm);
+        delete module;
+    }
+
     TEST_CASE("moving a Coro<T> out of a container element is rejected") {
         const char* source = R"(
         fun count(n: i32): Coro<i32> {
@@ -13,9 +13,11 @@
 #include "roxy/vm/interpreter.hpp"
 #include "roxy/vm/natives.hpp"
 #include "roxy/vm/vm.hpp"
+#include "test_helpers.hpp"
 
 #include <cmath>
 #include <cstring>
+#include <string>
 
 using namespace rx;
 
@@ -870,6 +872,59 @@ TEST_SUITE("E2E Interop") {
         CHECK(result.as_int == 200);
     }
 
+    // ============================================================================
+    // RoxyArray<T> Interop Tests
+    // ============================================================================
+
+    // C++ function that scales an array in place through its raw element buffer
+    // and hands it back (moved in, moved out, like list_push_42).
+    RoxyArray<f32> array_scale(RoxyArray<f32> xs, f32 k) {
+        f32* data = xs.elements();
+        for (i32 i = 0; i < xs.len(); i++) {
+            data[i] *= k;
+        }
+        return xs;
+    }
+
+    // C++ function that creates a byte array for Roxy
+    RoxyArray<u8> array_ramp(i32 n) {
+        RoxyArray<u8> bytes = RoxyArray<u8>::alloc(n);
+        for (i32 i = 0; i < n; i++) {
+            bytes[i] = static_cast<u8>(250 + i);
+        }
+        return bytes;
+    }
+
+    TEST_CASE("RoxyArray: C++ mutates the element buffer in place") {
+        const char* source = R"(
+        fun test(): i32 {
+            var xs: Array<f32> = Array<f32>(3);
+            xs[0] = 1.5f; xs[1] = 2.0f; xs[2] = -4.0f;
+            var ys: Array<f32> = array_scale(xs, 2.0f);
+            return i32(ys[0] + ys[1] + ys[2]);
+        }
+    )";
+
+        Value result = compile_and_run_mixed(
+            source, "test", [](NativeRegistry& reg) { reg.bind<array_scale>("array_scale"); });
+        CHECK(result.is_int());
+        CHECK(result.as_int == -1); // 3 + 4 - 8
+    }
+
+    TEST_CASE("RoxyArray: C++ creates an array for Roxy") {
+        const char* source = R"(
+        fun test(): i32 {
+            var bytes: Array<u8> = array_ramp(8);
+            return bytes.len() * 1000 + i32(bytes[1]) + i32(bytes[6]);
+        }
+    )";
+
+        Value result = compile_and_run_mixed(
+            source, "test", [](NativeRegistry& reg) { reg.bind<array_ramp>("array_ramp"); });
+        CHECK(result.is_int());
+        CHECK(result.as_int == 8000 + 251 + 0); // 256 wraps to 0
+    }
+
     // ============================================================================
     // RoxyString Interop Tests
     // ============================================================================
@@ -961,4 +1016,192 @@ TEST_SUITE("E2E Interop") {
         CHECK(result.as_int == 11); // "hello world" is 11 chars
     }
 
+    // ============================================================================
+    // Host -> script: ScriptFunction
+    // ============================================================================
+
+    TEST_CASE("ScriptFunction: typed calls into script") {
+        const char* source = R"(
+        var ticks: i32 = 0;
+        fun scale(x: i32, f: f64): f64 { return f64(x) * f; }
+        fun both(a: bool, b: bool): bool { return a && b; }
+        fun widen(x: i64, y: u8): i64 { return x * 256l + i64(y); }
+        fun shrink(x: f32): f32 { return x / 2.0f; }
+        fun tick() { ticks = ticks + 1; }
+        fun ticks_so_far(): i32 { return ticks; }
+        fun name_len(name: string): i32 { return str_len(name); }
+        )";
+        BumpAllocator allocator(8192);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+        RoxyVM vm;
+        vm_init(&vm);
+        REQUIRE(vm_load_module(&vm, module));
+
+        SUBCASE("scalar arguments and results") {
+            auto scale = ScriptFunction<f64(i32, f64)>::resolve(&vm, "scale");
+            REQUIRE(scale.valid());
+            CHECK(scale(4, 2.5) == 10.0);
+            CHECK(scale(-3, 0.5) == -1.5);
+
+            auto both = ScriptFunction<bool(bool, bool)>::resolve(&vm, "both");
+            CHECK(both(true, true));
+            CHECK(!both(true, false));
+
+            auto widen = ScriptFunction<i64(i64, u8)>::resolve(&vm, "widen");
+            CHECK(widen(-2, 255) == -2 * 256 + 255);
+
+            auto shrink = ScriptFunction<f32(f32)>::resolve(&vm, "shrink");
+            CHECK(shrink(3.0f) == 1.5f);
+        }
+
+        SUBCASE("void functions and state across calls") {
+            auto tick = ScriptFunction<void()>::resolve(&vm, "tick");
+            auto ticks_so_far = ScriptFunction<i32()>::resolve(&vm, "ticks_so_far");
+            REQUIRE(tick.valid());
+            for (int i = 0; i < 100; i++)
+                REQUIRE(tick.call());
+            REQUIRE(ticks_so_far.call());
+            CHECK(ticks_so_far.result() == 100);
+        }
+
+        SUBCASE("string arguments") {
+            roxy::ScopedContext ctx_guard(&vm.ctx);
+            auto name_len = ScriptFunction<i32(RoxyString)>::resolve(&vm, "name_len");
+            RoxyString name = RoxyString::alloc("entity_42");
+            CHECK(name_len(name) == 9);
+        }
+
+        SUBCASE("resolve checks the name and arity") {
+            CHECK(!ScriptFunction<i32()>::resolve(&vm, "missing").valid());
+            CHECK(!ScriptFunction<f64(i32)>::resolve(&vm, "scale").valid());
+            CHECK(!ScriptFunction<f64(i32, f64, i32)>::resolve(&vm, "scale").valid());
+            ScriptFunction<i32()> unresolved;
+            CHECK(!unresolved.call());
+        }
+
+        vm_destroy(&vm);
+        delete module;
+    }
+
+    TEST_CASE("Script output routed to an embedder sink") {
+        const char* source = R"(
+        fun greet(n: i32) {
+            for (var i: i32 = 0; i < n; i = i + 1) {
+                print(f"line {i}");
+            }
+            flush();
+            print(n * 2);
+        }
+        fun fail() {
+            print("before");
+            var xs = List<i32>();
+            print(xs[3]);
+        }
+        )";
+        BumpAllocator allocator(8192);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+        RoxyVM vm;
+        vm_init(&vm);
+        REQUIRE(vm_load_module(&vm, module));
+
+        std::string out;
+        u32 batches = 0;
+        struct Sink {
+            std::string* out;
+            u32* batches;
+        } sink{&out, &batches};
+        vm_set_output_sink(
+            &vm,
+            [](void* user, const char* data, uint32_t length) {
+                auto* s = static_cast<Sink*>(user);
+                s->out->append(data, length);
+                (*s->batches)++;
+            },
+            &sink);
+
+        Value three = Value::make_int(3);
+        REQUIRE(vm_call(&vm, "greet", Span<Value>(&three, 1)));
+        // One batch at flush(), one when the call returned.
+        CHECK(out == "line 0\nline 1\nline 2\n6\n");
+        CHECK(batches == 2);
+
+        out.clear();
+        CHECK(!vm_call(&vm, "fail", {}));
+        CHECK(out == "before\n"); // delivered even though the call failed
+
+        vm_destroy(&vm);
+        delete module;
+    }
+
+    TEST_CASE("Batched calls into script") {
+        const char* source = R"(
+        var calls: i32 = 0;
+        fun update(id: i32, dt: f32): f32 { calls = calls + 1; return f32(id) * dt; }
+        fun div(a: i32, b: i32): i32 { return a / b; }
+        fun touch(id: i32) { calls = calls + id; }
+        fun calls_so_far(): i32 { return calls; }
+        )";
+        BumpAllocator allocator(8192);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+        RoxyVM vm;
+        vm_init(&vm);
+        REQUIRE(vm_load_module(&vm, module));
+
+        SUBCASE("rows and columns of encoded registers") {
+            RoxyFunctionHandle div = vm_resolve(&vm, "div");
+            u64 rows[] = {10, 2, 9, 3, static_cast<u64>(-8), 4};
+            u64 results[3] = {};
+            REQUIRE(vm_call_batch(&vm, div, rows, 3, results) == 3);
+            CHECK(static_cast<i32>(results[0]) == 5);
+            CHECK(static_cast<i32>(results[1]) == 3);
+            CHECK(static_cast<i32>(results[2]) == -2);
+
+            u64 lhs[] = {100, 7}, rhs[] = {10, 7};
+            const u64* columns[] = {lhs, rhs};
+            REQUIRE(vm_call_batch_columns(&vm, div, columns, 2, results) == 2);
+            CHECK(static_cast<i32>(results[0]) == 10);
+            CHECK(static_cast<i32>(results[1]) == 1);
+        }
+
+        SUBCASE("typed structure-of-args batch") {
+            constexpr u32 count = 1000; // spans several result chunks
+            i32 ids[count];
+            f32 dts[count];
+            f32 out[count];
+            for (u32 i = 0; i < count; i++) {
+                ids[i] = static_cast<i32>(i);
+                dts[i] = 0.5f;
+            }
+
+            auto update = ScriptFunction<f32(i32, f32)>::resolve(&vm, "update");
+            REQUIRE(update.call_batch(count, out, ids, dts) == count);
+            CHECK(out[0] == 0.0f);
+            CHECK(out[3] == 1.5f);
+            CHECK(out[count - 1] == 499.5f);
+
+            auto touch = ScriptFunction<void(i32)>::resolve(&vm, "touch");
+            i32 bumps[] = {1, 2, 3};
+            REQUIRE(touch.call_batch(3, nullptr, bumps) == 3);
+            CHECK(ScriptFunction<i32()>::resolve(&vm, "calls_so_far")() == i32(count) + 6);
+        }
+
+        SUBCASE("a failing call stops the batch") {
+            auto div = ScriptFunction<i32(i32, i32)>::resolve(&vm, "div");
+            i32 lhs[] = {6, 6, 6, 6}, rhs[] = {1, 2, 0, 3};
+            i32 out[4] = {};
+            CHECK(div.call_batch(4, out, lhs, rhs) == 2);
+            CHECK(out[0] == 6);
+            CHECK(out[1] == 3);
+            CHECK(strstr(vm_get_error(&vm), "zero") != nullptr);
+
+            CHECK(vm_call_batch(&vm, RoxyFunctionHandle{}, nullptr, 1, nullptr) == 0);
+        }
+
+        vm_destroy(&vm);
+        delete module;
+    }
+
 } // TEST_SUITE("E2E Interop")
@@ -605,4 +605,52 @@ TEST_SUITE("E2E Lifetime Regressions") {
         CHECK(ref_result.success);
         CHECK(ref_result.value == 6);
     }
+
+    // Finding 11 (2026-10-18) — FIXED. Temporaries created in an operand that
+    // only runs on some paths — the right side of `&&`/`||`, a ternary arm —
+    // were tracked at the enclosing scope's depth, so its exit released them on
+    // every path, including the short-circuit one that never wrote their
+    // registers. The release then read whatever the previous call left in the
+    // frame (`scribble` below plants non-pointer bits there) and crashed. Found
+    // by a roxy_gen workload corpus. The operand now gets its own scope, so its
+    // temporaries are released inside the branch that created them.
+    TEST_CASE_TEMPLATE("F11 short-circuit operand temporaries are released on their own path",
+                       Backend, RX_E2E_BACKENDS) {
+        const char* src = R"(
+        fun scribble(): i64 {
+            var a: i64 = 123456789012;
+            var b: i64 = a * 7 + 98765432109;
+            var c: i64 = b * 3 - a;
+            var d: i64 = c + b + a;
+            return d;
+        }
+        fun either(flag: bool, n: i32): bool {
+            return flag || str_eq(f"n {n}", str_concat("a", "b"));
+        }
+        fun both(flag: bool, n: i32): bool {
+            return flag && str_eq(f"n {n}", str_concat("n ", "1"));
+        }
+        fun pick(flag: bool, n: i32): i32 {
+            return flag ? 1 : str_len(str_concat(f"n {n}", "b"));
+        }
+        fun main(): i32 {
+            var total: i32 = 0;
+            for (var i: i32 = 0; i < 3; i = i + 1) {
+                var s = scribble();
+                if (either(true, i)) { total = total + 1; }
+                s = scribble();
+                if (!both(false, i)) { total = total + 2; }
+                s = scribble();
+                total = total + pick(true, i) * 4;
+                if (!either(false, i)) { total = total + 8; }
+                if (both(true, 1)) { total = total + 16; }
+                total = total + pick(false, 5); // str_len("n 5b")
+            }
+            return total;
+        }
+        )";
+        auto result = Backend::run(src);
+        CHECK(result.success);
+        CHECK(result.value == 3 * (1 + 2 + 4 + 8 + 16 + 4));
+    }
 }
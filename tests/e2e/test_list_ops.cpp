@@ -0,0 +1,414 @@
+#include "roxy/core/doctest/doctest.h"
+#include "test_e2e_backend.hpp"
+#include "test_helpers.hpp"
+
+using namespace rx;
+
+// ============================================================================
+// List bulk operations: sort / sort_by / binary_search / extend / fill /
+// truncate / reserve / swap
+// ============================================================================
+//
+// All of them are implemented once in roxy_rt.cpp and reached through the
+// ordinary native-method path on both backends. sort and binary_search carry a
+// hidden element-order argument; sort_by calls a comparator closure back per
+// comparison. The ownership cases (fill / truncate / extend over counted
+// elements) are about the balance at the list's drop as much as the output.
+
+TEST_SUITE("E2E List Ops") {
+
+    TEST_CASE_TEMPLATE("sort orders every primitive element kind", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: List<i32> = List<i32>();
+            a.push(5); a.push(-3); a.push(9); a.push(0); a.push(-3);
+            a.sort();
+
+            var b: List<u64> = List<u64>();
+            b.push(18000000000000000000ul); b.push(7ul); b.push(42ul);
+            b.sort();
+
+            var c: List<f64> = List<f64>();
+            c.push(2.5); c.push(-1.0); c.push(0.0 / 0.0); c.push(1.25);
+            c.sort();
+
+            var d: List<i64> = List<i64>();
+            d.push(3l); d.push(-9000000000l); d.push(1l);
+            d.sort();
+
+            print(f"{a}");
+            print(f"{b}");
+            print(f"{c[0]} {c[1]} {c[2]} {c[3] != c[3]}");
+            print(f"{d}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output ==
+              "[-3, -3, 0, 5, 9]\n[7, 42, 18000000000000000000]\n-1 1.25 2.5 true\n"
+              "[-9000000000, 1, 3]\n");
+    }
+
+    TEST_CASE_TEMPLATE("sort and binary_search over narrow elements", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: List<i8> = List<i8>();
+            a.push(i8(5)); a.push(i8(-128)); a.push(i8(127)); a.push(i8(-1)); a.push(i8(0));
+            a.sort();
+
+            var b: List<u8> = List<u8>();
+            b.push(u8(200)); b.push(u8(3)); b.push(u8(255)); b.push(u8(0));
+            b.sort();
+
+            var c: List<i16> = List<i16>();
+            c.push(i16(-300)); c.push(i16(32767)); c.push(i16(-32768)); c.push(i16(7));
+            c.sort();
+
+            var d: List<u16> = List<u16>();
+            d.push(u16(65535)); d.push(u16(256)); d.push(u16(1));
+            d.sort();
+
+            var e: List<bool> = List<bool>();
+            e.push(true); e.push(false); e.push(true); e.push(false);
+            e.sort();
+
+            print(f"{i32(a[0])} {i32(a[1])} {i32(a[2])} {i32(a[3])} {i32(a[4])}");
+            print(f"{i32(b[0])} {i32(b[1])} {i32(b[2])} {i32(b[3])}");
+            print(f"{i32(c[0])} {i32(c[1])} {i32(c[2])} {i32(c[3])}");
+            print(f"{i32(d[0])} {i32(d[1])} {i32(d[2])}");
+            print(f"{e[0]} {e[1]} {e[2]} {e[3]}");
+            print(f"{a.binary_search(i8(-1))} {a.binary_search(i8(1))} {b.binary_search(u8(255))}");
+            print(f"{c.binary_search(i16(-300))} {d.binary_search(u16(2))} {e.binary_search(true)}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "-128 -1 0 5 127\n0 3 200 255\n"
+                                      "-32768 -300 7 32767\n1 256 65535\n"
+                                      "false false true true\n"
+                                      "1 -4 3\n1 -2 2\n");
+    }
+
+    TEST_CASE_TEMPLATE("sort orders strings bytewise", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var names: List<string> = List<string>();
+            names.push("pear");
+            names.push("apple");
+            names.push("app");
+            names.push("Zebra");
+            names.push("apple" + "s");
+            names.sort();
+            print(f"{names}");
+            print(f"{names.binary_search("apple")} {names.binary_search("banana")}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "[Zebra, app, apple, apples, pear]\n2 -5\n");
+    }
+
+    TEST_CASE_TEMPLATE("binary_search reports a hit or the insertion point", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            for (var i: i32 = 0; i < 10; i = i + 1) { xs.push(i * 10); }
+            var empty: List<f32> = List<f32>();
+            print(f"{xs.binary_search(30)} {xs.binary_search(35)} {xs.binary_search(-1)}");
+            print(f"{xs.binary_search(1000)} {empty.binary_search(1.0f)}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "3 -5 -1\n-11 -1\n");
+    }
+
+    TEST_CASE_TEMPLATE("sort_by calls the comparator closure", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            for (var i: i32 = 0; i < 40; i = i + 1) { xs.push((i * 17) % 40); }
+            var desc = fun(a: i32, b: i32): bool => a > b;
+            xs.sort_by(desc);
+            var ok: bool = true;
+            for (var i: i32 = 1; i < xs.len(); i = i + 1) {
+                if (xs[i - 1] < xs[i]) { ok = false; }
+            }
+            print(f"{ok} {xs[0]} {xs[39]}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "true 39 0\n");
+    }
+
+    TEST_CASE_TEMPLATE("sort_by is stable over struct elements", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct Item { key: i32; tag: i32; }
+        struct Wide { a: i32; b: i32; c: i32; d: i32; e: i32; }
+        fun main(): i32 {
+            var items: List<Item> = List<Item>();
+            for (var i: i32 = 0; i < 30; i = i + 1) { items.push(Item { key = i % 3, tag = i }); }
+            var by_key = fun(a: Item, b: Item): bool => a.key < b.key;
+            items.sort_by(by_key);
+            var ok: bool = true;
+            for (var i: i32 = 1; i < items.len(); i = i + 1) {
+                var p: Item = items[i - 1];
+                var q: Item = items[i];
+                if (p.key > q.key || (p.key == q.key && p.tag > q.tag)) { ok = false; }
+            }
+            print(f"{ok} {items[0].tag} {items[10].tag} {items[29].tag}");
+
+            var ws: List<Wide> = List<Wide>();
+            for (var i: i32 = 0; i < 5; i = i + 1) {
+                ws.push(Wide { a = 0, b = 0, c = 0, d = 0, e = 4 - i });
+            }
+            var by_e = fun(x: Wide, y: Wide): bool => x.e < y.e;
+            ws.sort_by(by_e);
+            print(f"{ws[0].e} {ws[4].e}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "true 0 1 29\n0 4\n");
+    }
+
+    TEST_CASE_TEMPLATE("sort_by over string elements with a capturing comparator", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var words: List<string> = List<string>();
+            words.push("ccc");
+            words.push("a");
+            words.push("bb");
+            words.push("dddd");
+            var longest_first: bool = true;
+            var by_len = fun(a: string, b: string): bool {
+                if (longest_first) { return str_len(a) > str_len(b); }
+                return str_len(a) < str_len(b);
+            };
+            words.sort_by(by_len);
+            print(f"{words}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "[dddd, ccc, bb, a]\n");
+    }
+
+    TEST_CASE_TEMPLATE("extend moves the other list's elements", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<string> = List<string>();
+            xs.push("a");
+            var ys: List<string> = List<string>();
+            for (var i: i32 = 0; i < 20; i = i + 1) { ys.push(f"s{i}"); }
+            xs.extend(ys);
+            var empty: List<string> = List<string>();
+            xs.extend(empty);
+            print(f"{xs.len()} {xs[0]} {xs[1]} {xs[20]}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "21 a s0 s19\n");
+    }
+
+    // A refused extend moved nothing, so the drop that follows the call must
+    // release every element of `other`. The VM stops at the trap; the C
+    // backend records the error and runs on, which is where a leak would show.
+    TEST_CASE("a refused extend still drops the other list") {
+        const char* source = R"(
+        struct Res { id: i32; }
+        fun delete Res() { print(f"drop {self.id}"); }
+        var xs: List<Res> = List<Res>();
+        fun grow(r: inout Res) {
+            var ys: List<Res> = List<Res>();
+            ys.push(Res { id = 2 });
+            ys.push(Res { id = 3 });
+            xs.extend(ys);
+            print(f"after {r.id}");
+        }
+        fun main(): i32 {
+            xs.push(Res { id = 1 });
+            grow(inout xs[0]);
+            return xs.len();
+        }
+    )";
+
+        CBackendResult result = compile_and_run_cpp(source);
+        CHECK(result.compile_success);
+        CHECK(result.run_success);
+        CHECK(result.exit_code == 1);
+        CHECK(result.stdout_output == "drop 2\ndrop 3\nafter 1\ndrop 1\n");
+        CHECK(VMBackend::run(source).success == false);
+    }
+
+    TEST_CASE_TEMPLATE("fill overwrites every element and keeps counts balanced", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct Named { name: string; n: i32; }
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.push(1); xs.push(2); xs.push(3);
+            xs.fill(7);
+
+            var ss: List<string> = List<string>();
+            ss.push("x" + "1"); ss.push("y" + "2"); ss.push("z" + "3");
+            ss.fill(ss[1]);        // the fill value is one of the elements
+
+            var ns: List<Named> = List<Named>();
+            ns.push(Named { name = "a" + "b", n = 1 });
+            ns.push(Named { name = "c" + "d", n = 2 });
+            ns.fill(Named { name = "e" + "f", n = 3 });
+            print(f"{xs} {ss} {ns[0].name} {ns[1].n}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "[7, 7, 7] [y2, y2, y2] ef 3\n");
+    }
+
+    TEST_CASE_TEMPLATE("truncate drops the discarded tail", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct Noisy { id: i32; }
+        fun delete Noisy() { print(f"drop {self.id}"); }
+        fun main(): i32 {
+            var ns: List<Noisy> = List<Noisy>();
+            for (var i: i32 = 0; i < 4; i = i + 1) { ns.push(Noisy { id = i }); }
+            ns.truncate(2);
+            print(f"len {ns.len()}");
+            ns.truncate(10);
+
+            var ss: List<string> = List<string>();
+            ss.push("a" + "b"); ss.push("c" + "d"); ss.push("e" + "f");
+            ss.truncate(1);
+            ss.push("g");
+            print(f"{ss}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "drop 2\ndrop 3\nlen 2\n[ab, g]\ndrop 0\ndrop 1\n");
+    }
+
+    TEST_CASE_TEMPLATE("reserve and swap", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct P { x: i32; y: i32; z: i32; }
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.reserve(100);
+            var cap: i32 = xs.cap();
+            for (var i: i32 = 0; i < 100; i = i + 1) { xs.push(i); }
+            xs.swap(0, 99);
+            var ps: List<P> = List<P>();
+            ps.push(P { x = 1, y = 2, z = 3 });
+            ps.push(P { x = 4, y = 5, z = 6 });
+            ps.swap(0, 1);
+            print(f"{cap >= 100} {xs.cap() == cap} {xs[0]} {xs[99]} {ps[0].z} {ps[1].x}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "true true 99 0 6 1\n");
+    }
+
+    TEST_CASE("growing a List from its own sort_by comparator traps") {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.push(2); xs.push(1);
+            var sneaky = fun(a: i32, b: i32): bool {
+                xs.push(3);
+                return a < b;
+            };
+            xs.sort_by(sneaky);
+            return 0;
+        }
+    )";
+        CHECK(VMBackend::run(source).success == false);
+    }
+
+    TEST_CASE("out-of-range swap and negative truncate trap") {
+        const char* bad_swap = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.push(1);
+            xs.swap(0, 1);
+            return 0;
+        }
+    )";
+        const char* bad_truncate = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.truncate(-1);
+            return 0;
+        }
+    )";
+        CHECK(VMBackend::run(bad_swap).success == false);
+        CHECK(VMBackend::run(bad_truncate).success == false);
+    }
+
+    TEST_CASE("element-type restrictions are rejected") {
+        const char* sort_structs = R"(
+        struct P { x: i32; }
+        fun main(): i32 {
+            var ps: List<P> = List<P>();
+            ps.sort();
+            return 0;
+        }
+    )";
+        const char* search_lists = R"(
+        fun main(): i32 {
+            var xss: List<List<i32>> = List<List<i32>>();
+            xss.sort();
+            return 0;
+        }
+    )";
+        const char* fill_move_only = R"(
+        fun main(): i32 {
+            var xss: List<List<i32>> = List<List<i32>>();
+            xss.fill(List<i32>());
+            return 0;
+        }
+    )";
+        const char* sort_by_move_only = R"(
+        fun main(): i32 {
+            var xss: List<List<i32>> = List<List<i32>>();
+            var f = fun(a: List<i32>, b: List<i32>): bool => false;
+            xss.sort_by(f);
+            return 0;
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        CHECK(compile(allocator, sort_structs) == nullptr);
+        CHECK(compile(allocator, search_lists) == nullptr);
+        CHECK(compile(allocator, fill_move_only) == nullptr);
+        CHECK(compile(allocator, sort_by_move_only) == nullptr);
+    }
+}
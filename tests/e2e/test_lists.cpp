@@ -461,6 +461,61 @@ TEST_SUITE("E2E Lists") {
         CHECK(result.stdout_output == "110\n");
     }
 
+    TEST_CASE("List of struct field access lowers to fused element-field ops") {
+        // `ps[i].f` reads and `ps[i].f = v` writes become a single
+        // INDEX_FIELD_GET_LIST / INDEX_FIELD_SET_LIST instead of
+        // INDEX_GET_LIST + GET_FIELD / SET_FIELD. Mixed field widths cover the
+        // 1-slot sign-extension and 2-slot paths of the fused handlers.
+        const char* source = R"(
+        struct Particle {
+            id: i32;
+            x: f64;
+            dx: i64;
+        }
+
+        fun main(): i32 {
+            var ps: List<Particle> = List<Particle>();
+            for (var i: i32 = 0; i < 4; i = i + 1) {
+                ps.push(Particle { id = 0 - i, x = 0.5, dx = 10 });
+            }
+            for (var i: i32 = 0; i < ps.len(); i = i + 1) {
+                ps[i].x = ps[i].x + 1.0;
+                ps[i].dx = ps[i].dx * i64(ps[i].id);
+            }
+            var neg: i32 = 0;
+            for (var i: i32 = 0; i < ps.len(); i = i + 1) {
+                if (ps[i].id < 0) { neg = neg + 1; }
+            }
+            print(f"{neg} {ps[3].x} {ps[3].dx} {ps[0].dx}");
+            return 0;
+        }
+    )";
+
+        BumpAllocator allocator(8192);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+        i32 main_index = module->find_function("main");
+        REQUIRE(main_index >= 0);
+        const BCFunction& func = *module->functions[main_index];
+        u32 fused_gets = 0;
+        u32 fused_sets = 0;
+        for (u32 i = 0; i < func.code.size(); i++) {
+            Opcode op = decode_opcode(func.code[i]);
+            fused_gets += op == Opcode::INDEX_FIELD_GET_LIST;
+            fused_sets += op == Opcode::INDEX_FIELD_SET_LIST;
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+        CHECK(fused_gets >= 6);
+        CHECK(fused_sets == 2);
+        delete module;
+
+        TestResult result = run_and_capture(source, "main");
+        CHECK(result.success);
+        CHECK(result.stdout_output == "3 1.5 -30 0\n");
+    }
+
     // ============================================================================
     // Sign-extension of 1-slot integer elements (regression: INDEX_GET_LIST on an
     // inline 1-slot element zero-extended to 64 bits, so negative i32s compared
@@ -504,6 +504,49 @@ TEST_SUITE("E2E Maps") {
         CHECK(result.stdout_output == "700\n");
     }
 
+    TEST_CASE_TEMPLATE("Map<Struct, i32>: plain-data keys of every slot width", Backend,
+                       RX_E2E_BACKENDS) {
+        // Keys without a user Hash/Eq hash and compare their slots: one slot
+        // and two slots take the integer paths, wider keys the XXH3/memcmp
+        // path. Enough entries to rehash several times, then removals.
+        const char* source = R"ROXY(
+        struct Handle { id: i32; }
+        struct EntityId { index: i32; generation: i32; }
+        struct Wide { a: i64; b: i32; flag: bool; c: i64; }
+        fun main(): i32 {
+            var h: Map<Handle, i32> = Map<Handle, i32>();
+            var e: Map<EntityId, i32> = Map<EntityId, i32>();
+            var w: Map<Wide, i32> = Map<Wide, i32>();
+            for (var i: i32 = 0; i < 500; i = i + 1) {
+                h.insert(Handle { id = i * 7 }, i);
+                e.insert(EntityId { index = i, generation = i % 3 }, i);
+                w.insert(Wide { a = i64(i) * 100000000000, b = -i, flag = i % 2 == 0, c = i64(i) }, i);
+            }
+            for (var i: i32 = 0; i < 500; i = i + 2) {
+                var gone: bool = e.remove(EntityId { index = i, generation = i % 3 });
+            }
+            var hits: i32 = 0;
+            for (var i: i32 = 0; i < 500; i = i + 1) {
+                hits = hits + h.get(Handle { id = i * 7 });
+                if (e.contains(EntityId { index = i, generation = i % 3 })) {
+                    hits = hits + 1;
+                }
+                if (e.contains(EntityId { index = i, generation = (i + 1) % 3 })) {
+                    hits = hits + 1000000;
+                }
+                hits = hits + w.get(Wide { a = i64(i) * 100000000000, b = -i, flag = i % 2 == 0, c = i64(i) });
+            }
+            var miss: bool = w.contains(Wide { a = 0, b = 0, flag = false, c = 0 });
+            print(f"{h.len()} {e.len()} {w.len()} {hits} {miss}");
+            return 0;
+        }
+    )ROXY";
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        // hits = 2 * (0 + ... + 499) + 250 surviving entity ids.
+        CHECK(result.stdout_output == "500 250 500 249750 false\n");
+    }
+
     // ============================================================================
     // Custom Hash / Eq dispatch for struct keys via runtime callback.
     // The runtime calls the user's `K.hash()` / `K.eq(other)` methods through
@@ -1,4 +1,5 @@
 #include "roxy/compiler/driver/compiler.hpp"
+#include "roxy/compiler/driver/compiler_session.hpp"
 #include "roxy/compiler/types/type_env.hpp"
 #include "roxy/core/bump_allocator.hpp"
 #include "roxy/core/doctest/doctest.h"
@@ -8,7 +9,14 @@
 #include "roxy/vm/natives.hpp"
 #include "roxy/vm/vm.hpp"
 
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
 
 namespace rx {
 
@@ -94,6 +102,44 @@ struct ModuleTestContext {
     }
 };
 
+// The process's resident set size right now, or 0 where unsupported.
+static u64 current_rss_bytes() {
+#ifdef __linux__
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file)
+        return 0;
+    unsigned long pages = 0, resident = 0;
+    int read = fscanf(file, "%lu %lu", &pages, &resident);
+    fclose(file);
+    return read == 2 ? static_cast<u64>(resident) * static_cast<u64>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+
+// Compile `source` as module "main" (plus an optional "genmod" dependency)
+// through `session` and run main(). Returns -999 on a compile error.
+static i64 session_compile_and_run(CompilerSession& session, const char* source,
+                                   const char* genmod_source = nullptr) {
+    Compiler& compiler = session.begin_compile();
+    if (genmod_source) {
+        compiler.add_source("genmod", genmod_source, static_cast<u32>(strlen(genmod_source)));
+    }
+    compiler.add_source("main", source, static_cast<u32>(strlen(source)));
+
+    BCModule* module = compiler.compile();
+    if (!module)
+        return -999;
+
+    RoxyVM vm;
+    vm_init(&vm);
+    vm_load_module(&vm, module);
+    i64 result = vm_call(&vm, "main", {}) ? vm_get_result(&vm).as_int : -995;
+    vm_destroy(&vm);
+    delete module;
+    return result;
+}
+
 TEST_SUITE("E2E Modules") {
 
     TEST_CASE("from import basic native function") {
@@ -571,6 +617,159 @@ TEST_SUITE("E2E Modules") {
         delete module;
     }
 
+    TEST_CASE("Compiler: bundled sched module is imported on demand") {
+        ModuleTestContext ctx;
+        const char* source = R"(
+        from sched import Scheduler, Wait, next_frame, wait_frames, wait_signal;
+
+        var trace: i32 = 0;
+
+        fun note(tag: i32) {
+            trace = trace * 2 + tag % 2;
+        }
+
+        fun worker(tag: i32): Coro<Wait> {
+            note(tag);
+            yield next_frame();
+            note(tag + 10);
+            yield wait_frames(3);
+            note(tag + 20);
+            yield wait_signal(7);
+            note(tag + 30);
+        }
+
+        fun main(): i32 {
+            var s = Scheduler();
+            s.spawn(worker(1));
+            s.spawn(worker(2));
+            var ran: i32 = 0;
+            for (var f: i32 = 0; f < 6; f = f + 1) {
+                ran = ran + s.tick(0.016);
+            }
+            if (s.signal(7) != 2) { return -1; }
+            ran = ran + s.tick(0.016);
+            // Tags 1 2 11 12 21 22 31 32 in that order, 8 resumes, none alive
+            return trace * 1000 + ran * 10 + s.len();
+        }
+    )";
+        CHECK(ctx.compile_and_run(source, true) == 170080); // 0b10101010 = 170
+    }
+
+    TEST_CASE("Compiler: sched keeps tasks spawned or signalled during a tick") {
+        ModuleTestContext ctx;
+        const char* source = R"(
+        from sched import Scheduler, Wait, next_frame, wait_signal;
+
+        var s: Scheduler = Scheduler();
+        var trace: i32 = 0;
+
+        fun note(tag: i32) {
+            trace = trace * 10 + tag;
+        }
+
+        fun child(): Coro<Wait> {
+            note(2);
+            yield next_frame();
+        }
+
+        fun start() {
+            s.spawn(child());
+        }
+
+        fun parent(): Coro<Wait> {
+            start();
+            yield next_frame();
+            note(1);
+        }
+
+        fun waiter(): Coro<Wait> {
+            yield wait_signal(5);
+            note(5);
+        }
+
+        fun wake(): Coro<Wait> {
+            note(3 + s.signal(5));
+            yield next_frame();
+        }
+
+        fun main(): i32 {
+            s.spawn(waiter());
+            s.spawn(parent());
+            s.spawn(wake());
+            var ran: i32 = 0;
+            for (var f: i32 = 0; f < 4; f = f + 1) {
+                ran = ran + s.tick(0.016);
+            }
+            // The child and the woken waiter run on the tick after the one that
+            // queued them: 4 (one woken), then 2 5 1, then nothing left alive.
+            return trace * 100 + ran * 10 + s.len();
+        }
+    )";
+        CHECK(ctx.compile_and_run(source, true) == 425180);
+    }
+
+    TEST_CASE("Compiler: an added module shadows the bundled one") {
+        BumpAllocator allocator(16384);
+        const char* sched_source = R"(
+        pub fun answer(): i32 { return 42; }
+    )";
+        const char* main_source = R"(
+        from sched import answer;
+        fun main(): i32 { return answer(); }
+    )";
+
+        Compiler compiler(allocator);
+        compiler.add_source("sched", sched_source, static_cast<u32>(strlen(sched_source)));
+        compiler.add_source("main", main_source, static_cast<u32>(strlen(main_source)));
+
+        BCModule* module = compiler.compile();
+        REQUIRE(module != nullptr);
+
+        RoxyVM vm;
+        vm_init(&vm);
+        vm_load_module(&vm, module);
+        REQUIRE(vm_call(&vm, "main", {}));
+        CHECK(vm_get_result(&vm).as_int == 42);
+        vm_destroy(&vm);
+        delete module;
+    }
+
+    TEST_CASE("Compiler: bundled io module streams a file") {
+        ModuleTestContext ctx;
+        std::string path = (std::filesystem::temp_directory_path() / "roxy_io_module.txt").string();
+        std::string source = R"(
+        from io import LineReader, FileWriter;
+
+        fun main(): i32 {
+            {
+                var w = FileWriter("@");
+                w.write_line("3");
+                w.write("4\r\n");
+                w.flush();
+            }
+            {
+                var more = FileWriter.append("@");
+                more.write("5,6");
+            }
+            var total: i32 = 0;
+            var lines = LineReader("@");
+            while (lines.next()) {
+                total = total * 10 + str_len(lines.line());
+            }
+            var fields = LineReader.split("@", 44);
+            var count: i32 = 0;
+            while (fields.next()) {
+                count = count + 1;
+            }
+            return total * 10 + count; // line lengths 1 1 3, two comma fields
+        }
+    )";
+        for (size_t at = source.find('@'); at != std::string::npos; at = source.find('@'))
+            source.replace(at, 1, path);
+        CHECK(ctx.compile_and_run(source.c_str(), true) == 1132);
+        std::remove(path.c_str());
+    }
+
     // Note: Cross-module struct visibility tests require struct exports to be implemented.
     // For now, we test same-module visibility which is the most common case.
 
@@ -1350,6 +1549,184 @@ TEST_SUITE("E2E Modules") {
         delete module;
     }
 
+    TEST_CASE("CompilerSession: reloads compile like fresh compilers") {
+        // Each begin_compile() rolls the session back to its prelude. The
+        // programs poke at what a compile leaves behind in shared state: the
+        // trait redeclarations edit the builtin Eq/Ord types in place, generic
+        // instances and container types are interned, and an imported native
+        // module sits in the module registry alongside per-compile modules.
+        // Replaying them in a different order must give the same answers.
+        ModuleTestContext ctx;
+        CompilerSession session;
+        session.add_native_registry("math", &ctx.math_natives);
+
+        const char* traits_source = R"(
+        trait Eq;
+        fun Eq.eq(other: Self): bool;
+
+        trait Ord : Eq;
+        fun Ord.lt(other: Self): bool;
+        fun Ord.le(other: Self): bool {
+            return self.lt(other) || self.eq(other);
+        }
+        fun Ord.gt(other: Self): bool {
+            if (self.lt(other)) return false;
+            if (self.eq(other)) return false;
+            return true;
+        }
+        fun Ord.ge(other: Self): bool {
+            if (self.lt(other)) return false;
+            return true;
+        }
+
+        struct Score {
+            value: i32;
+        }
+
+        fun Score.eq(other: Score): bool for Eq {
+            return self.value == other.value;
+        }
+
+        fun Score.lt(other: Score): bool for Ord {
+            return self.value < other.value;
+        }
+
+        fun main(): i32 {
+            var a: Score = Score { value = 10 };
+            var b: Score = Score { value = 20 };
+            var r: i32 = 0;
+            if (a < b) r = r + 1;
+            if (a <= a) r = r + 10;
+            if (b > a) r = r + 100;
+            return r;
+        }
+    )";
+
+        const char* generics_source = R"(
+        from math import add;
+
+        struct Box<T> {
+            value: T;
+        }
+
+        fun first<T>(items: List<T>): T {
+            return items[0];
+        }
+
+        fun main(): i32 {
+            var boxes: List<Box<i32>> = List<Box<i32>>();
+            boxes.push(Box<i32> { value = 4 });
+            boxes.push(Box<i32> { value = 5 });
+            var counts: Map<string, i32> = Map<string, i32>();
+            counts.insert("a", 30);
+            var nums: List<i32> = List<i32>();
+            nums.push(7);
+            return add(boxes[0].value * boxes[1].value, counts.get("a")) + first<i32>(nums);
+        }
+    )";
+
+        const char* genmod_source = R"(
+        pub struct Score {
+            pub value: i32;
+        }
+
+        pub fun apply_lambda<T>(x: T): T {
+            var f = fun(v: T): T => v;
+            return f(x);
+        }
+    )";
+
+        const char* importer_source = R"(
+        from genmod import Score, apply_lambda;
+
+        fun main(): i32 {
+            var s: Score = Score { value = 40 };
+            return apply_lambda(s.value) + 2;
+        }
+    )";
+
+        const char* broken_source = R"(
+        fun main(): i32 {
+            var x: i32 = "not an int";
+            return x;
+        }
+    )";
+
+        CHECK(session_compile_and_run(session, traits_source) == 111);
+        CHECK(session_compile_and_run(session, generics_source) == 57);
+        CHECK(session_compile_and_run(session, broken_source) == -999);
+        CHECK(session.compiler().has_errors());
+        CHECK(session_compile_and_run(session, importer_source, genmod_source) == 42);
+        CHECK(session_compile_and_run(session, traits_source) == 111);
+        CHECK(session_compile_and_run(session, generics_source) == 57);
+        CHECK(!session.compiler().has_errors());
+    }
+
+    TEST_CASE("CompilerSession: repeated compiles do not grow memory") {
+        // The arena rewinds on begin_compile(), but arena-placed IR and symbol
+        // tables own heap Vectors it never frees. A compile must hand those
+        // back, or a long `roxy --serve` grows by every program it compiles.
+        CompilerSession session;
+
+        const char* source = R"(
+        struct Box<T> {
+            value: T;
+        }
+
+        fun sum(items: List<Box<i32>>): i32 {
+            var total: i32 = 0;
+            for (var i: i32 = 0; i < items.len(); i = i + 1) {
+                if (items[i].value > 2) {
+                    total = total + items[i].value;
+                } else {
+                    continue;
+                }
+            }
+            return total;
+        }
+
+        fun main(): i32 {
+            var boxes: List<Box<i32>> = List<Box<i32>>();
+            for (var i: i32 = 0; i < 6; i = i + 1) {
+                boxes.push(Box<i32> { value = i });
+            }
+            var counts: Map<string, i32> = Map<string, i32>();
+            counts.insert("a", 30);
+            var bias: i32 = counts.get("a");
+            var f = fun(x: i32): i32 => x + bias;
+            return f(sum(boxes));
+        }
+    )";
+
+        auto compile_once = [&]() {
+            Compiler& compiler = session.begin_compile();
+            compiler.set_track_memory(true);
+            compiler.add_source("main", source, static_cast<u32>(strlen(source)));
+            BCModule* module = compiler.compile();
+            REQUIRE(module != nullptr);
+            delete module;
+            return compiler.timings().memory.total.arena_bytes;
+        };
+
+        // Every compile starts from the same arena mark, so it hands out the
+        // same bytes. RSS is sampled once the first compiles (and the test
+        // harness) have sized the heap.
+        u64 arena_bytes = compile_once();
+        u64 rss_before = 0;
+        for (u32 i = 0; i < 320; i++) {
+            CHECK(compile_once() == arena_bytes);
+            if (i == 19) {
+                rss_before = current_rss_bytes();
+            }
+        }
+        u64 rss_after = current_rss_bytes();
+        // A leaked block or scope list per compile would add up to far more
+        // than the allocator's own slack over 300 compiles.
+        if (rss_before != 0) {
+            CHECK(rss_after < rss_before + 128 * 1024);
+        }
+    }
+
 } // namespace rx
 
 } // namespace rx
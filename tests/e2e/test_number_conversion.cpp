@@ -0,0 +1,123 @@
+#include "roxy/core/doctest/doctest.h"
+#include "test_e2e_backend.hpp"
+#include "test_helpers.hpp"
+
+using namespace rx;
+
+// ============================================================================
+// Number <-> string conversion: str_to_i64/i32/f64, fmt, fmt_fixed, to_string
+// ============================================================================
+//
+// Every conversion is a roxy_rt function (std::to_chars / std::from_chars, no
+// snprintf), shared by the VM natives and the C backend, so the outputs must
+// match exactly on both.
+
+TEST_SUITE("E2E Number Conversion") {
+
+    TEST_CASE_TEMPLATE("integers parse strictly over the whole string", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            print(f"{str_to_i64("-9223372036854775808")} {str_to_i64("9223372036854775807")}");
+            print(f"{str_to_i32("+42")} {str_to_i32("-0")} {str_to_i32("2147483647")}");
+            print(f"{str_to_i32_or("2147483648", -1)} {str_to_i32_or("", -2)} {str_to_i32_or(" 1", -3)}");
+            print(f"{str_to_i64_or("12x", 7)} {str_to_i64_or("+-1", 8)} {str_to_i64_or("99999999999999999999", 9)}");
+            return str_to_i32("123");
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.value == 123);
+        CHECK(result.stdout_output == "-9223372036854775808 9223372036854775807\n"
+                                      "42 0 2147483647\n"
+                                      "-1 -2 -3\n"
+                                      "7 8 9\n");
+    }
+
+    TEST_CASE_TEMPLATE("floats parse and fall back", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            print(f"{str_to_f64(" 1.5")} {str_to_f64("+2e3")} {str_to_f64("junk")}");
+            print(f"{str_to_f64_or("-0.25", 0.0)} {str_to_f64_or("1.5x", 2.5)} {str_to_f64_or("", 3.5)}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "1.5 2000 0\n-0.25 2.5 3.5\n");
+    }
+
+    TEST_CASE_TEMPLATE("fmt is the shortest round-trip form", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var big: f64 = 1000000.0 * 1000000.0 * 1000000000.0;
+            print(fmt(0.1 + 0.2));
+            print(f"{fmt(5.0)} {fmt(-0.5)} {fmt(0.1f)} {fmt(1.0 / 3.0)} {fmt(big)}");
+            var back: f64 = str_to_f64(fmt(1.0 / 3.0));
+            print(f"{back == 1.0 / 3.0}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "0.30000000000000004\n"
+                                      "5 -0.5 0.1 0.3333333333333333 1e+21\n"
+                                      "true\n");
+    }
+
+    TEST_CASE_TEMPLATE("fmt_fixed rounds to the requested decimals", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            print(f"{fmt_fixed(3.14159, 2)} {fmt_fixed(2.5, 0)} {fmt_fixed(-1.0, 3)} {fmt_fixed(0.125, 20)}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "3.14 2 -1.000 0.12500000000000000000\n");
+    }
+
+    TEST_CASE_TEMPLATE("to_string covers the integer extremes", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var lo: i64 = -9223372036854775807 - 1;
+            var lo32: i32 = -2147483647 - 1;
+            print(f"{lo} {lo32} {u64(0) - u64(1)} {u32(0) - u32(1)} {0} {-7}");
+            print(f"{0.1 + 0.2} {1.0 / 3.0} {2.5f}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "-9223372036854775808 -2147483648 18446744073709551615 "
+                                      "4294967295 0 -7\n"
+                                      "0.3 0.333333 2.5\n");
+    }
+
+    TEST_CASE("invalid input to a strict parse is a runtime error") {
+        const char* bad_int = R"(
+        fun main(): i32 {
+            return str_to_i32("nope");
+        }
+    )";
+        const char* out_of_range = R"(
+        fun main(): i32 {
+            return i32(str_to_i64("9223372036854775808"));
+        }
+    )";
+        const char* bad_decimals = R"(
+        fun main(): i32 {
+            print(fmt_fixed(1.0, 21));
+            return 0;
+        }
+    )";
+        CHECK(VMBackend::run(bad_int).success == false);
+        CHECK(VMBackend::run(out_of_range).success == false);
+        CHECK(VMBackend::run(bad_decimals).success == false);
+    }
+}
@@ -0,0 +1,333 @@
+#include "roxy/core/doctest/doctest.h"
+#include "test_e2e_backend.hpp"
+#include "test_helpers.hpp"
+
+using namespace rx;
+
+// ============================================================================
+// Range statements: `for x in list` / `for (k, v) in map`
+// ============================================================================
+//
+// The container is pinned for the whole loop (its length / bucket capacity is
+// read once at entry), a List element is an ordinary INDEX_GET_LIST, and a Map
+// walks its bucket array in place via ITER_NEXT_MAP / ITER_KEY_MAP /
+// ITER_VALUE_MAP. The bindings are copies with their own lifetime — a string
+// binding holds its own count, a `ref` binding its own borrow — so most tests
+// below are as much about the balance at the container's drop as about the sum.
+
+TEST_SUITE("E2E Range For") {
+
+    TEST_CASE_TEMPLATE("for-in sums a List", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            for (var i: i32 = 1; i <= 5; i = i + 1) { xs.push(i * 3); }
+            var total: i32 = 0;
+            for x in xs { total = total + x; }
+            var empty: List<i32> = List<i32>();
+            for x in empty { total = total + 1000; }
+            print(f"{total}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "45\n");
+    }
+
+    TEST_CASE_TEMPLATE("for-in over a Map visits every entry once", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var m: Map<i32, i64> = Map<i32, i64>();
+            for (var i: i32 = 0; i < 50; i = i + 1) { m.insert(i, i64(i) * 100l); }
+            m.remove(7);
+            m.remove(31);
+            var keys: i32 = 0;
+            var values: i64 = 0l;
+            var count: i32 = 0;
+            for (k, v) in m {
+                keys = keys + k;
+                values = values + v;
+                count = count + 1;
+            }
+            print(f"{count} {keys} {values}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        // 0..49 minus 7 and 31: 1225 - 38 = 1187.
+        CHECK(result.stdout_output == "48 1187 118700\n");
+    }
+
+    TEST_CASE_TEMPLATE("for-in binds struct elements by copy", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct P { x: i32; y: i32; }
+        fun main(): i32 {
+            var ps: List<P> = List<P>();
+            ps.push(P { x = 1, y = 2 });
+            ps.push(P { x = 3, y = 4 });
+            var total: i32 = 0;
+            for p in ps {
+                p.x = 100;   // the binding is a copy; the element is untouched
+                total = total + p.x * p.y;
+            }
+            print(f"{total} {ps[0].x} {ps[1].x}");
+
+            var byname: Map<P, P> = Map<P, P>();
+            byname.insert(P { x = 1, y = 1 }, P { x = 5, y = 6 });
+            var acc: i32 = 0;
+            for (k, v) in byname { acc = acc + k.x + k.y + v.x * v.y; }
+            print(f"{acc}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "600 1 3\n32\n");
+    }
+
+    TEST_CASE_TEMPLATE("for-in string bindings keep their own count", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var names: List<string> = List<string>();
+            names.push("ab");
+            names.push("cde");
+            var kept: string = "";
+            for s in names { kept = kept + s; }
+            var lens: Map<string, i32> = Map<string, i32>();
+            for s in names { lens.insert(s, str_len(s)); }
+            var total: i32 = 0;
+            for (k, v) in lens { total = total + str_len(k) + v; }
+            print(kept);
+            print(f"{total}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "abcde\n10\n");
+    }
+
+    TEST_CASE_TEMPLATE("break and continue in a for-in loop", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            for (var i: i32 = 0; i < 10; i = i + 1) { xs.push(i); }
+            var total: i32 = 0;
+            for x in xs {
+                if (x % 2 == 0) { continue; }
+                if (x > 6) { break; }
+                total = total + x;
+            }
+            // The pin is released on both exits: the List grows again.
+            xs.push(10);
+            print(f"{total} {xs.len()}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "9 11\n");
+    }
+
+    TEST_CASE_TEMPLATE("return from inside nested for-in loops unpins", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun find_pair(xs: ref List<i32>, want: i32): i32 {
+            for a in xs {
+                for b in xs {
+                    if (a + b == want) { return a * 10 + b; }
+                }
+            }
+            return -1;
+        }
+
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.push(1); xs.push(2); xs.push(5);
+            print(f"{find_pair(xs, 7)} {find_pair(xs, 100)}");
+            xs.push(9);
+            print(f"{find_pair(xs, 18)}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "25 -1\n99\n");
+    }
+
+    TEST_CASE_TEMPLATE("an exception out of a for-in loop unpins", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct Boom { code: i32; }
+        fun Boom.message(): string for Exception { return "boom"; }
+
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.push(1); xs.push(2); xs.push(3);
+            try {
+                for x in xs {
+                    if (x == 2) { throw Boom { code = x }; }
+                }
+            } catch (e: Boom) {
+                print(f"caught {e.code}");
+            }
+            xs.push(4);
+            print(f"{xs}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "caught 2\n[1, 2, 3, 4]\n");
+    }
+
+    TEST_CASE_TEMPLATE("elements can be written while iterating", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.push(1); xs.push(2); xs.push(3);
+            var i: i32 = 0;
+            for x in xs {
+                xs[i] = x * x;
+                i = i + 1;
+            }
+            var m: Map<i32, i32> = Map<i32, i32>();
+            m.insert(1, 1); m.insert(2, 2);
+            for (k, v) in m { m[k] = v + 10; }
+            print(f"{xs} {m[1]} {m[2]}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "[1, 4, 9] 11 12\n");
+    }
+
+    TEST_CASE_TEMPLATE("for-in over ref elements borrows each one", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct Node { v: i32; }
+        fun main(): i32 {
+            var nodes: List<uniq Node> = List<uniq Node>();
+            nodes.push(uniq Node { v = 4 });
+            nodes.push(uniq Node { v = 5 });
+            var total: i32 = 0;
+            for n in nodes { total = total + n.v; }
+            print(f"{total}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "9\n");
+    }
+
+    TEST_CASE("growing a List inside a for-in over it traps") {
+        const char* source = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            xs.push(1); xs.push(2);
+            for x in xs { if (x == 2) { xs.push(3); } }
+            return 0;
+        }
+    )";
+        CHECK(VMBackend::run(source).success == false);
+    }
+
+    TEST_CASE("inserting into a Map inside a for-in over it traps") {
+        const char* source = R"(
+        fun main(): i32 {
+            var m: Map<i32, i32> = Map<i32, i32>();
+            m.insert(1, 1);
+            for (k, v) in m { m.insert(k + 1, v); }
+            return 0;
+        }
+    )";
+        CHECK(VMBackend::run(source).success == false);
+    }
+
+    TEST_CASE("Map iteration uses the inline iteration opcodes") {
+        const char* source = R"(
+        fun main(): i32 {
+            var m: Map<i32, i32> = Map<i32, i32>();
+            m.insert(1, 2);
+            var total: i32 = 0;
+            for (k, v) in m { total = total + k + v; }
+            return total;
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+        i32 main_index = module->find_function("main");
+        REQUIRE(main_index >= 0);
+        const BCFunction& func = *module->functions[main_index];
+        u32 iter_ops = 0;
+        u32 per_step_natives = 0;
+        for (u32 i = 0; i < func.code.size(); i++) {
+            Opcode op = decode_opcode(func.code[i]);
+            iter_ops += op == Opcode::ITER_NEXT_MAP || op == Opcode::ITER_KEY_MAP ||
+                        op == Opcode::ITER_VALUE_MAP;
+            if (op == Opcode::CALL_NATIVE) {
+                StringView name = module->native_functions[func.code[i + 1]].name;
+                per_step_natives += name == "__map_iter_next_occupied"_sv ||
+                                    name == "__map_iter_key_at"_sv ||
+                                    name == "__map_iter_value_at"_sv;
+            }
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+        CHECK(iter_ops == 3);
+        // Only the capacity read at loop entry crosses the native boundary.
+        CHECK(per_step_natives == 0);
+        delete module;
+    }
+
+    TEST_CASE("for-in shape errors are rejected") {
+        const char* list_as_map = R"(
+        fun main(): i32 {
+            var xs: List<i32> = List<i32>();
+            for (k, v) in xs { }
+            return 0;
+        }
+    )";
+        const char* map_as_list = R"(
+        fun main(): i32 {
+            var m: Map<i32, i32> = Map<i32, i32>();
+            for x in m { }
+            return 0;
+        }
+    )";
+        const char* not_a_container = R"(
+        fun main(): i32 {
+            var n: i32 = 3;
+            for x in n { }
+            return 0;
+        }
+    )";
+        const char* move_only_elements = R"(
+        fun main(): i32 {
+            var xs: List<List<i32>> = List<List<i32>>();
+            for inner in xs { }
+            return 0;
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        CHECK(compile(allocator, list_as_map) == nullptr);
+        CHECK(compile(allocator, map_as_list) == nullptr);
+        CHECK(compile(allocator, not_a_container) == nullptr);
+        CHECK(compile(allocator, move_only_elements) == nullptr);
+    }
+}
@@ -0,0 +1,337 @@
+#include "roxy/core/doctest/doctest.h"
+#include "test_e2e_backend.hpp"
+#include "test_helpers.hpp"
+
+using namespace rx;
+
+// ============================================================================
+// Builtin SIMD vectors: f32x4 / f64x2 / i32x4
+// ============================================================================
+//
+// Vectors are 16-byte value structs (x/y/z/w or x/y fields). Every operation is
+// one VEC_* instruction in the VM and one roxy_<kind>_<op> helper in the C
+// backend, so each test runs on both and the outputs must agree bit for bit —
+// including NaN/saturation in the conversions and wrap-around in i32 lanes.
+
+TEST_SUITE("E2E SIMD") {
+
+    TEST_CASE_TEMPLATE("f32x4 arithmetic and field access", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: f32x4 = f32x4(1.0f, 2.0f, 3.0f, 4.0f);
+            var b: f32x4 = f32x4.splat(0.5f);
+            var c: f32x4 = a + b * a - f32x4(1.0f, 1.0f, 1.0f, 1.0f);
+            var d: f32x4 = c / f32x4.splat(2.0f);
+            print(f"{c.x} {c.y} {c.z} {c.w}");
+            print(f"{d.x} {d.w} {(-d).y} {a.scale(3.0f).z}");
+            d.x = 10.0f;
+            print(f"{d.x} {d.hsum()} {a.dot(a)}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "0.5 2 3.5 5\n0.25 2.5 -1 9\n10 15.25 30\n");
+    }
+
+    TEST_CASE_TEMPLATE("compound assignment updates the vector in place", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        struct Body { pos: f64x2; vel: f64x2; }
+        fun main(): i32 {
+            var acc: f64x2 = f64x2.splat(0.0);
+            for (var i: i32 = 1; i <= 4; i = i + 1) {
+                acc += f64x2(f64(i), f64(i) * 0.5);
+            }
+            var b: Body = Body { pos = f64x2(0.0, 0.0), vel = f64x2(1.0, -2.0) };
+            b.pos += b.vel.scale(0.5);
+            b.vel *= f64x2.splat(3.0);
+            b.pos -= f64x2(0.25, 0.25);
+            print(f"{acc.x} {acc.y}");
+            print(f"{b.pos.x} {b.pos.y} {b.vel.x} {b.vel.y}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "10 5\n0.25 -1.25 3 -6\n");
+    }
+
+    TEST_CASE_TEMPLATE("vector results are independent copies", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: i32x4 = i32x4(1, 2, 3, 4);
+            var sums: List<i32> = List<i32>();
+            var prev: i32x4 = a;
+            for (var i: i32 = 0; i < 3; i = i + 1) {
+                var next: i32x4 = prev + a;
+                sums.push(prev.hsum());
+                prev = next;
+            }
+            print(f"{sums} {a.x} {prev.w}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "[10, 20, 30] 1 16\n");
+    }
+
+    TEST_CASE_TEMPLATE("compare masks, select, min and max", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: f32x4 = f32x4(1.0f, 5.0f, -2.0f, 7.0f);
+            var b: f32x4 = f32x4(3.0f, 5.0f, -4.0f, 0.0f);
+            var lt: i32x4 = a.cmp_lt(b);
+            var ge: i32x4 = a.cmp_ge(b);
+            var pick: f32x4 = a.select(lt, b);
+            var lo: f32x4 = a.min(b);
+            var hi: f32x4 = a.max(b);
+            print(f"{lt.x} {lt.y} {lt.z} {lt.w} {ge.x} {ge.y}");
+            print(f"{pick.x} {pick.y} {pick.z} {pick.w}");
+            print(f"{lo.x} {lo.z} {hi.z} {hi.w}");
+
+            var ints: i32x4 = i32x4(-3, 8, 0, 12);
+            var neg: i32x4 = ints.cmp_lt(i32x4.splat(0));
+            var masked: i32x4 = ints.bit_and(neg.bit_xor(i32x4.splat(-1)));
+            print(f"{masked.x} {masked.y} {masked.z} {masked.w} {ints.abs().x}");
+
+            var d: f64x2 = f64x2(1.5, -2.5);
+            var m: i32x4 = d.cmp_gt(f64x2.splat(0.0));
+            var clamped: f64x2 = d.select(m, f64x2.splat(0.0));
+            print(f"{m.x} {m.y} {m.z} {m.w} {clamped.x} {clamped.y}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output ==
+              "-1 0 0 0 0 -1\n1 5 -4 0\n1 -4 -2 7\n0 8 0 12 3\n-1 -1 0 0 1.5 0\n");
+    }
+
+    TEST_CASE_TEMPLATE("shuffle, sqrt, abs and equality", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: f32x4 = f32x4(1.0f, 4.0f, 9.0f, 16.0f);
+            var r: f32x4 = a.shuffle(3, 2, 1, 0);
+            var s: f32x4 = a.sqrt();
+            var bc: f32x4 = a.shuffle(1, 1, 1, 1);
+            print(f"{r.x} {r.w} {s.y} {s.w} {bc.z}");
+            var d: f64x2 = f64x2(-1.0, 2.0).shuffle(1, 0);
+            print(f"{d.x} {d.y} {d.abs().y}");
+            print(f"{a == f32x4(1.0f, 4.0f, 9.0f, 16.0f)} {a != r} {a == r}");
+            var nan: f32x4 = f32x4.splat(0.0f / 0.0f);
+            print(f"{nan == nan} {nan.cmp_ne(nan).x}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "16 1 2 4 4\n2 -1 1\ntrue true false\nfalse -1\n");
+    }
+
+    TEST_CASE_TEMPLATE("i32x4 lanes wrap and convert to and from f32x4", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var big: i32x4 = i32x4.splat(2147483647);
+            var w: i32x4 = big + i32x4(1, 2, 0, 0);
+            var p: i32x4 = i32x4(65536, 3, -7, 0) * i32x4(65536, 3, 2, 9);
+            print(f"{w.x} {w.y} {w.z} {p.x} {p.y} {p.z}");
+            var f: f32x4 = f32x4(2.9f, -2.9f, 30000000000.0f, 0.0f / 0.0f);
+            var t: i32x4 = f.to_i32x4();
+            print(f"{t.x} {t.y} {t.z} {t.w}");
+            var back: f32x4 = i32x4(-5, 0, 7, 100).to_f32x4();
+            print(f"{back.x} {back.w} {back.hsum()}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output ==
+              "-2147483648 -2147483647 2147483647 0 9 -14\n2 -2 2147483647 0\n-5 100 102\n");
+    }
+
+    TEST_CASE_TEMPLATE("load and store move lanes to and from a List", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun scale_all(xs: ref List<f32>, k: f32) {
+            var i: i32 = 0;
+            while (i + 4 <= xs.len()) {
+                f32x4.load(xs, i).scale(k).store(xs, i);
+                i = i + 4;
+            }
+            while (i < xs.len()) {
+                xs[i] = xs[i] * k;
+                i = i + 1;
+            }
+        }
+
+        fun main(): i32 {
+            var xs: List<f32> = List<f32>();
+            for (var i: i32 = 0; i < 10; i = i + 1) { xs.push(f32(i)); }
+            scale_all(xs, 2.0f);
+            print(f"{xs}");
+
+            var ds: List<f64> = List<f64>();
+            ds.push(1.0); ds.push(2.0); ds.push(3.0);
+            var v: f64x2 = f64x2.load(ds, 1);
+            (v + v).store(ds, 0);
+            print(f"{ds}");
+
+            var ns: List<i32> = List<i32>();
+            for (var i: i32 = 0; i < 8; i = i + 1) { ns.push(i); }
+            var total: i32x4 = i32x4.splat(0);
+            for (var i: i32 = 0; i < 8; i = i + 4) { total += i32x4.load(ns, i); }
+            print(f"{total.hsum()}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output ==
+              "[0, 2, 4, 6, 8, 10, 12, 14, 16, 18]\n[4, 6, 3]\n28\n");
+    }
+
+    TEST_CASE_TEMPLATE("vectors pass through functions and containers", Backend,
+                       RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun lerp(a: f32x4, b: f32x4, t: f32): f32x4 {
+            return a + (b - a).scale(t);
+        }
+
+        fun main(): i32 {
+            var l: f32x4 = lerp(f32x4.splat(0.0f), f32x4(2.0f, 4.0f, 6.0f, 8.0f), 0.5f);
+            var vs: List<f32x4> = List<f32x4>();
+            vs.push(l);
+            vs.push(l * l);
+            var sum: f32x4 = f32x4.splat(0.0f);
+            for v in vs { sum += v; }
+            print(f"{l.y} {vs[1].w} {sum.x} {sum.w}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "2 16 2 20\n");
+    }
+
+    TEST_CASE("out-of-range vector load and store trap") {
+        const char* bad_load = R"(
+        fun main(): i32 {
+            var xs: List<f32> = List<f32>();
+            xs.push(1.0f); xs.push(2.0f); xs.push(3.0f);
+            var v: f32x4 = f32x4.load(xs, 0);
+            return i32(v.x);
+        }
+    )";
+        const char* bad_store = R"(
+        fun main(): i32 {
+            var xs: List<f64> = List<f64>();
+            xs.push(1.0); xs.push(2.0);
+            f64x2.splat(0.0).store(xs, -1);
+            return 0;
+        }
+    )";
+        CHECK(VMBackend::run(bad_load).success == false);
+        CHECK(VMBackend::run(bad_store).success == false);
+    }
+
+    TEST_CASE("vector ops compile to VEC opcodes") {
+        const char* source = R"(
+        fun main(): i32 {
+            var a: f32x4 = f32x4.splat(1.0f);
+            var b: f32x4 = a + a;
+            var c: f64x2 = f64x2.splat(2.0) * f64x2.splat(3.0);
+            var d: i32x4 = i32x4.splat(1).bit_or(i32x4.splat(2));
+            return i32(b.hsum()) + i32(c.x) + d.hsum();
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        BCModule* module = compile(allocator, source);
+        REQUIRE(module != nullptr);
+        i32 main_index = module->find_function("main");
+        REQUIRE(main_index >= 0);
+        const BCFunction& func = *module->functions[main_index];
+        u32 f32_ops = 0;
+        u32 f64_ops = 0;
+        u32 i32_ops = 0;
+        u32 calls = 0;
+        for (u32 i = 0; i < func.code.size(); i++) {
+            Opcode op = decode_opcode(func.code[i]);
+            f32_ops += op == Opcode::VEC_F32X4;
+            f64_ops += op == Opcode::VEC_F64X2;
+            i32_ops += op == Opcode::VEC_I32X4;
+            calls += op == Opcode::CALL || op == Opcode::CALL_NATIVE;
+            if (is_two_word_instruction(op)) {
+                i++;
+            }
+        }
+        CHECK(f32_ops == 3);
+        CHECK(f64_ops == 3);
+        CHECK(i32_ops == 4);
+        CHECK(calls == 0);
+        delete module;
+
+        E2EResult run = VMBackend::run(source);
+        CHECK(run.success);
+    }
+
+    TEST_CASE("SIMD misuse is rejected") {
+        const char* dynamic_shuffle = R"(
+        fun main(): i32 {
+            var lane: i32 = 2;
+            var v: f32x4 = f32x4.splat(1.0f).shuffle(lane, 0, 0, 0);
+            return 0;
+        }
+    )";
+        const char* lane_out_of_range = R"(
+        fun main(): i32 {
+            var v: f64x2 = f64x2.splat(1.0).shuffle(0, 2);
+            return 0;
+        }
+    )";
+        const char* int_sqrt = R"(
+        fun main(): i32 {
+            var v: i32x4 = i32x4.splat(4).sqrt();
+            return 0;
+        }
+    )";
+        const char* float_bitwise = R"(
+        fun main(): i32 {
+            var v: f32x4 = f32x4.splat(1.0f).bit_and(f32x4.splat(2.0f));
+            return 0;
+        }
+    )";
+        const char* heap_vector = R"(
+        fun main(): i32 {
+            var v: uniq f32x4 = uniq f32x4(1.0f, 2.0f, 3.0f, 4.0f);
+            return 0;
+        }
+    )";
+        const char* wrong_list = R"(
+        fun main(): i32 {
+            var xs: List<f64> = List<f64>();
+            var v: f32x4 = f32x4.load(xs, 0);
+            return 0;
+        }
+    )";
+
+        BumpAllocator allocator(65536);
+        CHECK(compile(allocator, dynamic_shuffle) == nullptr);
+        CHECK(compile(allocator, lane_out_of_range) == nullptr);
+        CHECK(compile(allocator, int_sqrt) == nullptr);
+        CHECK(compile(allocator, float_bitwise) == nullptr);
+        CHECK(compile(allocator, heap_vector) == nullptr);
+        CHECK(compile(allocator, wrong_list) == nullptr);
+    }
+}
@@ -609,6 +609,105 @@ TEST_SUITE("E2E Strings") {
         CHECK(result.stdout_output == "A\nz\n");
     }
 
+    TEST_CASE_TEMPLATE("str_find and str_find_char", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var s: string = "hello world, hello roxy";
+            print(f"{str_find(s, "hello", 0)} {str_find(s, "hello", 1)} {str_find(s, "roxy", 0)}");
+            print(f"{str_find(s, "xyz", 0)} {str_find(s, "", 5)} {str_find(s, "y", 99)}");
+            print(f"{str_find_char(s, 111, 0)} {str_find_char(s, 111, 5)} {str_find_char(s, 122, 0)}");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "0 13 19\n-1 5 -1\n4 7 -1\n");
+    }
+
+    TEST_CASE_TEMPLATE("str_starts_with, str_ends_with and str_trim", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            print(f"{str_starts_with("prefix", "pre")} {str_starts_with("pre", "prefix")} {str_starts_with("x", "")}");
+            print(f"{str_ends_with("prefix", "fix")} {str_ends_with("prefix", "pre")}");
+            print(f"[{str_trim("  \t padded \r\n")}] [{str_trim("   ")}] [{str_trim("bare")}]");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "true false true\ntrue false\n[padded] [] [bare]\n");
+    }
+
+    TEST_CASE_TEMPLATE("str_split and str_join round-trip", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            var parts: List<string> = str_split("a,,b,c", ",");
+            print(f"{parts.len()} {parts}");
+            print(str_join(parts, ", "));
+            var words: List<string> = str_split("one -> two -> three", " -> ");
+            words.push("four");
+            print(str_join(words, "/"));
+            var one: List<string> = str_split("", ",");
+            var none: List<string> = List<string>();
+            print(f"{one.len()} [{str_join(none, ",")}] [{str_join(one, ",")}]");
+            return parts.len();
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.value == 4);
+        CHECK(result.stdout_output == "4 [a, , b, c]\na, , b, c\none/two/three/four\n1 [] []\n");
+    }
+
+    TEST_CASE_TEMPLATE("str_replace", Backend, RX_E2E_BACKENDS) {
+        const char* source = R"(
+        fun main(): i32 {
+            print(str_replace("a-b-c", "-", " + "));
+            print(str_replace("aaaa", "aa", "b"));
+            print(str_replace("unchanged", "zz", "y"));
+            print(f"[{str_replace("--", "-", "")}]");
+            return 0;
+        }
+    )";
+
+        auto result = Backend::run(source);
+        CHECK(result.success);
+        CHECK(result.stdout_output == "a + b + c\nbb\nunchanged\n[]\n");
+    }
+
+    TEST_CASE("string search misuse is a runtime error") {
+        const char* negative_start = R"(
+        fun main(): i32 {
+            return str_find("abc", "c", -1);
+        }
+    )";
+        const char* empty_sep = R"(
+        fun main(): i32 {
+            var parts: List<string> = str_split("abc", "");
+            return parts.len();
+        }
+    )";
+        const char* empty_target = R"(
+        fun main(): i32 {
+            print(str_replace("abc", "", "x"));
+            return 0;
+        }
+    )";
+        // 0x141 would truncate to 'A' if the code weren't range-checked.
+        const char* wide_code = R"(
+        fun main(): i32 {
+            return str_find_char("ABC", 321, 0);
+        }
+    )";
+        CHECK(VMBackend::run(negative_start).success == false);
+        CHECK(VMBackend::run(wide_code).success == false);
+        CHECK(VMBackend::run(empty_sep).success == false);
+        CHECK(VMBackend::run(empty_target).success == false);
+    }
+
     TEST_CASE_TEMPLATE("clock returns positive value", Backend, RX_E2E_BACKENDS) {
         const char* source = R"(
         fun main(): i32 {
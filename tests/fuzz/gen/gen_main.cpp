@@ -9,6 +9,13 @@
 // Generate the same project at several --modules sizes and plot per-phase
 // compile time against LOC to spot super-linear behavior (see
 // docs/internals/profiling.md).
+//
+// With --preset, the project is an executable workload instead: every module
+// also exports a runtime kernel (List/Map, closures, coroutines, generics) and
+// main prints a deterministic checksum over all of them. roxy_bench
+// (benchmarks/roxy_bench.py) sweeps presets x sizes through `roxy --time=json`:
+//
+//   roxy_gen --preset=dag --modules=1000 --out=/tmp/dag_1000
 
 #include "generator.hpp"
 
@@ -25,6 +32,11 @@ static void print_usage() {
     fprintf(stderr, "  --seed=N     RNG seed (default 1); same seed -> identical corpus\n");
     fprintf(stderr, "  --modules=N  number of modules incl. main (default 50)\n");
     fprintf(stderr, "  --funcs=N    max free functions per module (default 14)\n");
+    fprintf(stderr, "  --preset=P   executable workload corpus; P is one of:\n              ");
+    for (const char* const* name = rx::gen::GenConfig::workload_preset_names(); *name; name++) {
+        fprintf(stderr, " %s", *name);
+    }
+    fprintf(stderr, "\n  --work=N     per-kernel work size for --preset (default 64)\n");
     fprintf(stderr, "  --out=DIR    write <module>.roxy files into DIR (created if needed)\n");
     fprintf(stderr, "  --print      dump all modules to stdout instead of writing files\n");
     fprintf(stderr, "\nCompile the result with: roxy --time DIR/main.roxy\n");
@@ -36,8 +48,29 @@ int main(int argc, char** argv) {
     bool print_to_stdout = false;
     rx::gen::GenConfig config = rx::gen::GenConfig::benchmark_default();
 
+    // The preset replaces the whole config, so apply it before the flags that
+    // adjust individual fields, wherever it appears on the command line.
     for (int i = 1; i < argc; i++) {
-        if (strncmp(argv[i], "--seed=", 7) == 0) {
+        if (strncmp(argv[i], "--preset=", 9) == 0 &&
+            !rx::gen::GenConfig::workload_preset(argv[i] + 9, config)) {
+            fprintf(stderr, "Unknown preset: %s\n\n", argv[i] + 9);
+            print_usage();
+            return 1;
+        }
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--preset=", 9) == 0) {
+            continue;
+        } else if (strncmp(argv[i], "--work=", 7) == 0) {
+            if (config.kernel_work == 0) {
+                fprintf(stderr, "Error: --work requires --preset\n");
+                return 1;
+            }
+            config.kernel_work = static_cast<uint32_t>(strtoul(argv[i] + 7, nullptr, 10));
+            if (config.kernel_work == 0)
+                config.kernel_work = 1;
+        } else if (strncmp(argv[i], "--seed=", 7) == 0) {
             seed = strtoull(argv[i] + 7, nullptr, 10);
         } else if (strncmp(argv[i], "--modules=", 10) == 0) {
             config.num_modules = static_cast<uint32_t>(strtoul(argv[i] + 10, nullptr, 10));
@@ -91,8 +124,9 @@ int main(int argc, char** argv) {
 
     const rx::gen::GenStats& stats = program.stats;
     fprintf(stderr,
-            "Generated: %u modules, %u functions, %u structs, %u enums, %u lines (seed %llu)\n",
-            stats.modules, stats.functions, stats.structs, stats.enums, stats.lines,
+            "Generated: %u modules, %u functions, %u structs, %u enums, %u kernels, %u lines "
+            "(seed %llu)\n",
+            stats.modules, stats.functions, stats.structs, stats.enums, stats.kernels, stats.lines,
             static_cast<unsigned long long>(seed));
     if (out_dir) {
         fprintf(stderr, "Compile with: roxy --time %s/main.roxy\n", out_dir);
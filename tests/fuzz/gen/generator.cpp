@@ -1,5 +1,6 @@
 #include "generator.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 
@@ -28,6 +29,41 @@ GenConfig GenConfig::benchmark_default() {
     return config;
 }
 
+static const char* const WORKLOAD_PRESETS[] = {
+    "mixed", "dag", "collections", "closures", "coroutines", "generics", nullptr,
+};
+
+const char* const* GenConfig::workload_preset_names() {
+    return WORKLOAD_PRESETS;
+}
+
+bool GenConfig::workload_preset(const char* preset, GenConfig& config) {
+    config = benchmark_default();
+    config.num_modules = 100;
+    config.min_funcs_per_module = 2;
+    config.max_funcs_per_module = 5;
+    config.max_structs_per_module = 2;
+    config.max_methods_per_struct = 2;
+    config.max_expr_depth = 3;
+    config.max_params = 3;
+    config.max_stmts_per_function = 30;
+    config.kernel_work = 64;
+
+    std::string name = preset;
+    if (name == "mixed")
+        return true;
+    if (name == "dag") {
+        config.deep_imports = true;
+        return true;
+    }
+    config.kernel_collections = name == "collections";
+    config.kernel_closures = name == "closures";
+    config.kernel_coroutines = name == "coroutines";
+    config.kernel_generics = name == "generics";
+    return config.kernel_collections || config.kernel_closures || config.kernel_coroutines ||
+           config.kernel_generics;
+}
+
 namespace {
 
 // ── Type model ─────────────────────────────────────────────────────────────
@@ -105,11 +141,26 @@ struct Generator {
     std::vector<GenericFnInfo> generic_fns;
     std::vector<GenericStructInfo> generic_structs;
     std::vector<std::string> module_names;
+    std::vector<std::string> kernel_names; // per module; empty for main
+    // funcs[] index where each module's functions start. Modules are emitted
+    // in order, so module m owns [module_func_begin[m], module_func_begin[m+1]).
+    std::vector<size_t> module_func_begin;
 
     // Per-module state
     uint32_t cur_module = 0;
     std::vector<uint32_t> imports;    // module indices imported by cur module
     std::vector<size_t> from_imports; // func indices callable unqualified
+    // Ascending imports + cur_module: the only modules whose functions can be
+    // visible. Candidate scans walk just these modules' ranges (in ascending
+    // index order, as a scan of all funcs would), which keeps generation
+    // linear in corpus size instead of quadratic.
+    std::vector<uint32_t> visible_modules;
+    // First index of the current module's structs/enums/generics (each is
+    // appended in module order, so locals are a suffix).
+    size_t struct_begin = 0;
+    size_t enum_begin = 0;
+    size_t generic_fn_begin = 0;
+    size_t generic_struct_begin = 0;
 
     // Per-function state
     size_t cur_func = 0; // index of the function whose body is being generated
@@ -228,19 +279,15 @@ struct Generator {
     // Module-local structs/enums declared so far (usable for fields, vars).
     std::vector<uint32_t> local_structs() const {
         std::vector<uint32_t> result;
-        for (uint32_t i = 0; i < structs.size(); i++) {
-            if (structs[i].module_idx == cur_module)
-                result.push_back(i);
-        }
+        for (size_t i = struct_begin; i < structs.size(); i++)
+            result.push_back(static_cast<uint32_t>(i));
         return result;
     }
 
     std::vector<uint32_t> local_enums() const {
         std::vector<uint32_t> result;
-        for (uint32_t i = 0; i < enums.size(); i++) {
-            if (enums[i].module_idx == cur_module)
-                result.push_back(i);
-        }
+        for (size_t i = enum_begin; i < enums.size(); i++)
+            result.push_back(static_cast<uint32_t>(i));
         return result;
     }
 
@@ -378,26 +425,44 @@ struct Generator {
         return module_names[func.module_idx] + "." + func.name;
     }
 
+    // Functions of `module` generated strictly before the current one.
+    std::pair<size_t, size_t> module_func_range(uint32_t module) const {
+        size_t end = module == cur_module ? std::min(cur_func, funcs.size())
+                                          : module_func_begin[module + 1];
+        return {module_func_begin[module], end};
+    }
+
+    // Calls `fn(i)` for every function generated before the current one that
+    // is visible from the current module, in ascending index order.
+    template <typename Fn>
+    void for_each_visible_func(Fn&& fn) const {
+        for (uint32_t module : visible_modules) {
+            auto [begin, end] = module_func_range(module);
+            for (size_t i = begin; i < end; i++) {
+                if (func_visible(i))
+                    fn(i);
+            }
+        }
+    }
+
     // Functions generated strictly before the current one (acyclic call graph),
     // visible from the current module, matching the wanted return type, and
     // affordable under the current loop nesting (dynamic-cost bound).
     std::vector<size_t> calls_returning(GType want) const {
         std::vector<size_t> result;
-        for (size_t i = 0; i < cur_func && i < funcs.size(); i++) {
-            if (funcs[i].has_ret && funcs[i].ret == want && func_visible(i) &&
-                affordable(funcs[i])) {
+        for_each_visible_func([&](size_t i) {
+            if (funcs[i].has_ret && funcs[i].ret == want && affordable(funcs[i]))
                 result.push_back(i);
-            }
-        }
+        });
         return result;
     }
 
     std::vector<size_t> void_calls() const {
         std::vector<size_t> result;
-        for (size_t i = 0; i < cur_func && i < funcs.size(); i++) {
-            if (!funcs[i].has_ret && func_visible(i) && affordable(funcs[i]))
+        for_each_visible_func([&](size_t i) {
+            if (!funcs[i].has_ret && affordable(funcs[i]))
                 result.push_back(i);
-        }
+        });
         return result;
     }
 
@@ -407,7 +472,9 @@ struct Generator {
         for (size_t v = 0; v < scope.size(); v++) {
             if (scope[v].type.kind != GType::StructT)
                 continue;
-            for (size_t f = 0; f < cur_func && f < funcs.size(); f++) {
+            // Methods live in their struct's (i.e. the current) module.
+            auto [begin, end] = module_func_range(cur_module);
+            for (size_t f = begin; f < end; f++) {
                 if (funcs[f].receiver == static_cast<int>(scope[v].type.index) &&
                     funcs[f].has_ret && funcs[f].ret == want && affordable(funcs[f])) {
                     result.push_back({v, f});
@@ -434,19 +501,15 @@ struct Generator {
 
     std::vector<size_t> local_generic_fns() const {
         std::vector<size_t> result;
-        for (size_t i = 0; i < generic_fns.size(); i++) {
-            if (generic_fns[i].module_idx == cur_module)
-                result.push_back(i);
-        }
+        for (size_t i = generic_fn_begin; i < generic_fns.size(); i++)
+            result.push_back(i);
         return result;
     }
 
     std::vector<size_t> local_generic_structs() const {
         std::vector<size_t> result;
-        for (size_t i = 0; i < generic_structs.size(); i++) {
-            if (generic_structs[i].module_idx == cur_module)
-                result.push_back(i);
-        }
+        for (size_t i = generic_struct_begin; i < generic_structs.size(); i++)
+            result.push_back(i);
         return result;
     }
 
@@ -893,11 +956,9 @@ struct Generator {
     }
 
     bool any_calls_exist() const {
-        for (size_t i = 0; i < cur_func && i < funcs.size(); i++) {
-            if (func_visible(i))
-                return true;
-        }
-        return false;
+        bool found = false;
+        for_each_visible_func([&](size_t) { found = true; });
+        return found;
     }
 
     // ── Declarations ────────────────────────────────────────────────────────
@@ -1060,6 +1121,197 @@ struct Generator {
         stats.structs++;
     }
 
+    // ── Runtime kernels (workload presets) ──────────────────────────────────
+    // Each kernel is `pub fun k(n: i32): i32`, O(n) per call, with an i32
+    // accumulator kept below KERNEL_MOD so no intermediate can overflow for
+    // any n a benchmark would pass. Helper types and functions are emitted
+    // just before the kernel and are module-private.
+
+    static constexpr const char* KERNEL_MOD = "1000003";
+
+    std::string fold(const std::string& acc, const std::string& term) const {
+        return acc + " = (" + acc + " + " + term + ") % " + KERNEL_MOD + ";";
+    }
+
+    void gen_collections_kernel(const std::string& name) {
+        std::string mul = std::to_string(3 + ent.range(60));
+        std::string add = std::to_string(ent.range(1000));
+        std::string buckets = std::to_string(7 + ent.range(40));
+        open("pub fun " + name + "(n: i32): i32");
+        line("var acc: i32 = 0;");
+        line("var items: List<i32> = List<i32>();");
+        open("for (var i: i32 = 0; i < n; i = i + 1)");
+        line("items.push(((i % 1009) * " + mul + " + " + add + ") % 1009);");
+        close();
+        line("var counts: Map<i32, i32> = Map<i32, i32>();");
+        line("var names: Map<string, i32> = Map<string, i32>();");
+        open("for (var i: i32 = 0; i < n; i = i + 1)");
+        line("var key: i32 = items[i] % " + buckets + ";");
+        open("if (counts.contains(key))");
+        line("counts[key] = counts[key] + 1;");
+        indent--;
+        line("} else {");
+        indent++;
+        line("counts.insert(key, 1);");
+        close();
+        line("names[f\"k{key % 5}\"] = i;");
+        line(fold("acc", "items[i] * (counts[key] % 64)"));
+        close();
+        line(fold("acc", "counts.len() * 7 + names.len()"));
+    }
+
+    void gen_closures_kernel(const std::string& name) {
+        std::string apply = fresh_name(false);
+        open("fun " + apply + "(f: fun(i32) -> i32, x: i32): i32");
+        line("return f(x);");
+        close();
+        line("");
+        std::string scale = std::to_string(2 + ent.range(30));
+        open("pub fun " + name + "(n: i32): i32");
+        line("var acc: i32 = " + std::to_string(1 + ent.range(100)) + ";");
+        line("var scale: i32 = " + scale + ";");
+        open("for (var i: i32 = 0; i < n; i = i + 1)");
+        line("var bias: i32 = i % " + std::to_string(3 + ent.range(13)) + ";");
+        line("var step = fun(x: i32): i32 => (x * scale + bias) % " + std::string(KERNEL_MOD) +
+             ";");
+        line("acc = " + apply + "(step, acc);");
+        close();
+    }
+
+    void gen_coroutines_kernel(const std::string& name) {
+        std::string stream = fresh_name(false);
+        open("fun " + stream + "(count: i32, seed: i32): Coro<i32>");
+        line("var x: i32 = seed;");
+        open("for (var i: i32 = 0; i < count; i = i + 1)");
+        line("x = (x * " + std::to_string(3 + ent.range(29)) + " + i % 101) % 10007;");
+        line("yield x;");
+        close();
+        close();
+        line("");
+        open("pub fun " + name + "(n: i32): i32");
+        line("var acc: i32 = 0;");
+        line("var a = " + stream + "(n, " + std::to_string(ent.range(10007)) + ");");
+        line("var b = " + stream + "(n, " + std::to_string(ent.range(10007)) + ");");
+        open("for (var i: i32 = 0; i < n; i = i + 1)");
+        line(fold("acc", "a.resume() * 3 + b.resume()"));
+        close();
+    }
+
+    void gen_generics_kernel(const std::string& name) {
+        std::string cell = fresh_name(true);
+        std::string spot = fresh_name(true);
+        std::string pick = fresh_name(false);
+        open("struct " + cell + "<T>");
+        line("value: T;");
+        close();
+        line("");
+        open("struct " + spot);
+        line("x: i32;");
+        line("y: i32;");
+        close();
+        line("");
+        open("fun " + pick + "<T>(a: T, b: T, first: bool): T");
+        open("if (first)");
+        line("return a;");
+        close();
+        line("return b;");
+        close();
+        line("");
+        open("pub fun " + name + "(n: i32): i32");
+        line("var acc: i32 = 0;");
+        open("for (var i: i32 = 0; i < n; i = i + 1)");
+        line("var ci = " + cell + " { value = i % 1009 };");
+        line("var cl = " + cell + " { value = i64(i) * 3 };");
+        line("var cf = " + cell + " { value = f64(i) * 0.5 };");
+        line("var cs = " + cell + " { value = " + spot + " { x = i, y = " +
+             std::to_string(1 + ent.range(9)) + " } };");
+        line(fold("acc", pick + "(ci.value, 1, i % 2 == 0) + i32(" + pick +
+                             "(cl.value, i64(1), true) % 1000)"));
+        open("if (" + pick + "(cf.value, 0.0, true) > 10.0 && " + pick + "(true, false, i % 3 == 0))");
+        line("acc = acc + 1;");
+        close();
+        line(fold("acc", pick + "(cs.value, " + spot + " { x = 1, y = 1 }, false).y + str_len(" +
+                             pick + "(\"ab\", \"c\", i % 5 == 0))"));
+        close();
+    }
+
+    void gen_kernel() {
+        enum KernelKind { Collections, Closures, Coroutines, Generics };
+        std::vector<KernelKind> kinds;
+        if (cfg.kernel_collections)
+            kinds.push_back(Collections);
+        if (cfg.kernel_closures)
+            kinds.push_back(Closures);
+        if (cfg.kernel_coroutines)
+            kinds.push_back(Coroutines);
+        if (cfg.kernel_generics)
+            kinds.push_back(Generics);
+        if (kinds.empty())
+            kinds.push_back(Collections);
+
+        std::string name = fresh_name(false);
+        switch (kinds[ent.range(static_cast<uint32_t>(kinds.size()))]) {
+            case Collections:
+                gen_collections_kernel(name);
+                break;
+            case Closures:
+                gen_closures_kernel(name);
+                break;
+            case Coroutines:
+                gen_coroutines_kernel(name);
+                break;
+            case Generics:
+                gen_generics_kernel(name);
+                break;
+        }
+        // Walk the import DAG at a quarter of the work: the n > 8 guard bounds
+        // the recursion depth at log4(n), so total work stays O(n) per kernel
+        // however deep or wide the DAG is.
+        if (!imports.empty()) {
+            open("if (n > 8)");
+            for (uint32_t imported : imports) {
+                line(fold("acc", module_names[imported] + "." + kernel_names[imported] + "(n / 4)"));
+            }
+            close();
+        }
+        line("return acc;");
+        close();
+        line("");
+        kernel_names[cur_module] = name;
+        stats.kernels++;
+        stats.functions++;
+    }
+
+    // main's side of the workload: kernels are called from batch functions
+    // of at most KERNEL_BATCH calls each, so a 10,000-module corpus doesn't
+    // turn main into one 10,000-call function. Returns the batch names.
+    static constexpr uint32_t KERNEL_BATCH = 32;
+
+    std::vector<std::string> gen_kernel_batches() {
+        std::vector<std::string> batches;
+        std::vector<uint32_t> with_kernels;
+        for (uint32_t imported : imports) {
+            if (!kernel_names[imported].empty())
+                with_kernels.push_back(imported);
+        }
+        for (size_t begin = 0; begin < with_kernels.size(); begin += KERNEL_BATCH) {
+            std::string batch = fresh_name(false);
+            open("fun " + batch + "(n: i32): i32");
+            line("var acc: i32 = 0;");
+            size_t end = std::min(begin + KERNEL_BATCH, with_kernels.size());
+            for (size_t i = begin; i < end; i++) {
+                uint32_t module = with_kernels[i];
+                line(fold("acc", module_names[module] + "." + kernel_names[module] + "(n)"));
+            }
+            line("return acc;");
+            close();
+            line("");
+            batches.push_back(batch);
+            stats.functions++;
+        }
+        return batches;
+    }
+
     // ── main() ──────────────────────────────────────────────────────────────
     // Accumulates an i32 checksum from cross-module pub calls (guaranteeing
     // every imported module is exercised, not just discovered) plus ordinary
@@ -1101,7 +1353,7 @@ struct Generator {
         }
     }
 
-    void gen_main_fn() {
+    void gen_main_fn(const std::vector<std::string>& kernel_batches) {
         cur_func = funcs.size(); // main can call everything generated so far
         cur_has_ret = true;
         cur_ret = GType{GType::I32, 0};
@@ -1125,10 +1377,10 @@ struct Generator {
             if (checksum_budget == 0)
                 break;
             std::vector<size_t> pub_funcs;
-            for (size_t i = 0; i < funcs.size(); i++) {
-                if (funcs[i].module_idx == imported && funcs[i].is_pub && affordable(funcs[i])) {
+            auto [begin, end] = module_func_range(imported);
+            for (size_t i = begin; i < end; i++) {
+                if (funcs[i].is_pub && affordable(funcs[i]))
                     pub_funcs.push_back(i);
-                }
             }
             if (pub_funcs.empty())
                 continue;
@@ -1140,9 +1392,19 @@ struct Generator {
             }
         }
 
-        gen_block_stmts(1 + ent.range(cfg.max_stmts_per_block));
-        line(acc + " = (" + acc + " + " + gen_expr(GType{GType::I32, 0}, cfg.max_expr_depth) +
-             ");");
+        // Workloads skip main's random statements: they may `return` early,
+        // which would skip the kernels and the checksum print.
+        if (cfg.kernel_work == 0) {
+            gen_block_stmts(1 + ent.range(cfg.max_stmts_per_block));
+            line(acc + " = (" + acc + " + " +
+                 gen_expr(GType{GType::I32, 0}, cfg.max_expr_depth) + ");");
+        }
+        // Kernel results stay below KERNEL_MOD, so folding them in with a
+        // plain add cannot overflow the checksum for any realistic batch count.
+        for (const std::string& batch : kernel_batches) {
+            line(acc + " = (" + acc + " % " + KERNEL_MOD + " + " + batch + "(" +
+                 std::to_string(cfg.kernel_work) + "));");
+        }
         if (cfg.allow_print) {
             // Benchmark corpora: print the checksum (observable output for a
             // future VM-vs-C differential) and exit 0 so the CLI's exit code
@@ -1173,8 +1435,9 @@ struct Generator {
             if (!ent.chance(25))
                 continue;
             std::vector<size_t> pub_funcs;
-            for (size_t i = 0; i < funcs.size(); i++) {
-                if (funcs[i].module_idx == imported && funcs[i].is_pub)
+            auto [begin, end] = module_func_range(imported);
+            for (size_t i = begin; i < end; i++) {
+                if (funcs[i].is_pub)
                     pub_funcs.push_back(i);
             }
             if (pub_funcs.empty())
@@ -1186,6 +1449,14 @@ struct Generator {
         if (!imports.empty())
             line("");
 
+        // A workload's main imports every module, so its own random code
+        // would see every pub function in the corpus; generating it would be
+        // quadratic in corpus size. main is just the kernel driver instead.
+        if (is_main && cfg.kernel_work > 0) {
+            gen_main_fn(gen_kernel_batches());
+            return;
+        }
+
         uint32_t enum_count = ent.range(cfg.max_enums_per_module + 1);
         for (uint32_t i = 0; i < enum_count; i++)
             gen_enum();
@@ -1220,8 +1491,11 @@ struct Generator {
             gen_function(-1, force_pub_prim);
         }
 
+        if (cfg.kernel_work > 0 && !is_main)
+            gen_kernel();
+
         if (is_main)
-            gen_main_fn();
+            gen_main_fn({});
     }
 
     GeneratedProgram run() {
@@ -1230,6 +1504,7 @@ struct Generator {
             module_names.push_back("m" + std::to_string(i) + "_" + make_word());
         }
         module_names.push_back("main");
+        kernel_names.assign(module_count, std::string());
 
         GeneratedProgram program;
         std::vector<bool> imported_by_someone(module_count, false);
@@ -1243,11 +1518,22 @@ struct Generator {
                 if (is_main) {
                     // main imports every module nothing else imports (so the
                     // CLI's import-driven discovery reaches all files), plus a
-                    // few extras.
+                    // few extras. Workloads import everything: main runs
+                    // every module's kernel.
                     for (uint32_t j = 0; j + 1 < module_count; j++) {
-                        if (!imported_by_someone[j] || ent.chance(10))
+                        if (cfg.kernel_work > 0 || !imported_by_someone[j] || ent.chance(10))
                             imports.push_back(j);
                     }
+                } else if (cfg.deep_imports) {
+                    // A chain through every module, plus 0-2 uniformly chosen
+                    // earlier modules as cross edges.
+                    imports.push_back(i - 1);
+                    uint32_t extra_count = ent.range(3);
+                    for (uint32_t c = 0; c < extra_count; c++) {
+                        uint32_t candidate = ent.range(i);
+                        if (std::find(imports.begin(), imports.end(), candidate) == imports.end())
+                            imports.push_back(candidate);
+                    }
                 } else {
                     // Import 1-3 earlier modules, biased toward low indices —
                     // early modules accumulate high fan-in like real "core"
@@ -1268,6 +1554,15 @@ struct Generator {
                     imported_by_someone[imported] = true;
             }
 
+            module_func_begin.push_back(funcs.size());
+            struct_begin = structs.size();
+            enum_begin = enums.size();
+            generic_fn_begin = generic_fns.size();
+            generic_struct_begin = generic_structs.size();
+            visible_modules = imports;
+            std::sort(visible_modules.begin(), visible_modules.end());
+            visible_modules.push_back(cur_module);
+
             out.clear();
             indent = 0;
             emit_module_body(is_main);
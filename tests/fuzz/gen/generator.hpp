@@ -28,7 +28,8 @@
 //
 // Two consumers share this generator via `Entropy`'s two modes:
 //  - roxy_gen CLI: seeded PRNG -> reproducible benchmark corpora at any scale
-//    (compile-time profiling with `roxy --time`).
+//    (compile-time profiling with `roxy --time`), and with a workload preset,
+//    executable corpora whose runtime kernels roxy_bench times end to end.
 //  - fuzz_structured: libFuzzer bytes -> coverage-guided program mutation,
 //    reaching sema/IR/lowering/VM with valid programs.
 namespace rx::gen {
@@ -62,10 +63,31 @@ struct GenConfig {
     bool use_fstrings = true;
     bool use_cross_module = true; // import / from-import + qualified calls
 
+    // Executable workloads. With kernel_work > 0, every non-main module also
+    // exports one runtime kernel `pub fun k(n: i32): i32` drawn from the
+    // enabled kinds below; each kernel calls its imports' kernels at n / 4, and
+    // main runs every kernel at n = kernel_work and folds the results into the
+    // checksum. Kernel cost is O(n) per call, so runtime scales with
+    // modules x kernel_work instead of the per-function cost budget above.
+    uint32_t kernel_work = 0;
+    bool kernel_collections = true; // List/Map build, probe and update
+    bool kernel_closures = true;    // capturing closures through a higher-order call
+    bool kernel_coroutines = true;  // interleaved Coro<i32> generators
+    bool kernel_generics = true;    // generic fn/struct instantiated at 5 types
+    // Module i always imports module i-1 (plus 0-2 random earlier ones), so
+    // the import DAG is as deep as the corpus is wide.
+    bool deep_imports = false;
+
     // Small program shapes for per-input fuzz iterations and CI regression.
     static GenConfig fuzz_default();
     // Meatier per-module content for compile-time benchmark corpora.
     static GenConfig benchmark_default();
+    // Executable workload corpus for roxy_bench: lighter per-module content
+    // than benchmark_default (so 10,000 modules stays tractable) plus kernels.
+    // `preset` selects the kernel mix and import shape; see
+    // workload_preset_names(). Returns false for an unknown preset.
+    static bool workload_preset(const char* preset, GenConfig& config);
+    static const char* const* workload_preset_names(); // nullptr-terminated
 };
 
 struct GeneratedModule {
@@ -78,6 +100,7 @@ struct GenStats {
     uint32_t functions = 0; // free functions + methods + generic functions
     uint32_t structs = 0;
     uint32_t enums = 0;
+    uint32_t kernels = 0; // runtime kernels (workload presets only)
     uint32_t lines = 0;
 };
 
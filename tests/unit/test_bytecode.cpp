@@ -190,4 +190,48 @@ TEST_SUITE("Bytecode") {
         CHECK(strstr(out.data(), "RET") != nullptr);
     }
 
+    TEST_CASE("Superinstruction table") {
+        // Every row of superinstructions.def: the lookups agree with each
+        // other, the byte is in the 0x70-0x7F block, and the superinstruction
+        // has its first op's width and disassembles with its operands.
+        struct Row {
+            Opcode op;
+            Opcode first;
+            Opcode second;
+        };
+        Vector<Row> rows;
+#define RX_SUPERINSTRUCTION(byte, NAME, FIRST, SECOND)                                             \
+    rows.push_back(Row{Opcode::NAME, Opcode::FIRST, Opcode::SECOND});
+#include "roxy/vm/superinstructions.def"
+
+        for (const Row& row : rows) {
+            CHECK(static_cast<u8>(row.op) >= 0x70);
+            CHECK(static_cast<u8>(row.op) <= 0x7F);
+            CHECK(superinstruction_first_op(row.op) == row.first);
+            CHECK(find_superinstruction(row.first, row.second) == row.op);
+            CHECK(is_two_word_instruction(row.op) == is_two_word_instruction(row.first));
+            CHECK(strcmp(opcode_to_string(row.op), "UNKNOWN") != 0);
+
+            u32 plain = encode_abc(row.first, 1, 2, 3);
+            u32 fused = encode_abc(row.op, 1, 2, 3);
+            String plain_out;
+            String fused_out;
+            u32 plain_words = disassemble_instruction(plain, 4, 0, plain_out);
+            u32 fused_words = disassemble_instruction(fused, 4, 0, fused_out);
+            CHECK(plain_words == fused_words);
+            plain_out.push_back('\0');
+            fused_out.push_back('\0');
+            // Same operand text after the (differing) opcode name column
+            const char* plain_operands = strstr(plain_out.data(), "R1");
+            const char* fused_operands = strstr(fused_out.data(), "R1");
+            if (plain_operands && fused_operands) {
+                CHECK(strcmp(plain_operands, fused_operands) == 0);
+            }
+        }
+
+        // Ops outside the table map to themselves / to no superinstruction
+        CHECK(superinstruction_first_op(Opcode::ADD_I) == Opcode::ADD_I);
+        CHECK(find_superinstruction(Opcode::HALT, Opcode::HALT) == Opcode::NOP);
+    }
+
 } // TEST_SUITE("Bytecode")
@@ -178,6 +178,12 @@ TEST_SUITE("Container Pin") {
             CHECK(*static_cast<uint64_t*>(roxy_map_get(m, &k1)) == 100);
             CHECK(!roxy_runtime_error_pending());
 
+            // Overwriting an existing key moves nothing, so it stays allowed.
+            uint64_t v1b = 101;
+            roxy_map_insert(m, &k1, &v1b);
+            CHECK(!roxy_runtime_error_pending());
+            CHECK(*static_cast<uint64_t*>(roxy_map_get(m, &k1)) == 101);
+
             // Unpin → insert works again.
             roxy_map_unpin(m);
             roxy_map_insert(m, &k2, &v2);
@@ -156,6 +156,27 @@ TEST_SUITE("CST Lowering") {
         CHECK(fun_decl->fun_decl.body->block.declarations[1]->kind == AstKind::DeclVar);
     }
 
+    TEST_CASE("ForInStmt over a map") {
+        BumpAllocator parse_alloc(4096);
+        BumpAllocator ast_alloc(4096);
+        Program* program =
+            parse_and_lower("fun main() { for (k, v) in m { k; } }", parse_alloc, ast_alloc);
+
+        REQUIRE(program != nullptr);
+        REQUIRE(program->declarations.size() == 1);
+
+        Decl* fun_decl = program->declarations[0];
+        REQUIRE(fun_decl->fun_decl.body != nullptr);
+        REQUIRE(fun_decl->fun_decl.body->block.declarations.size() == 1);
+        Decl* loop = fun_decl->fun_decl.body->block.declarations[0];
+        REQUIRE(loop->kind == AstKind::StmtForIn);
+        CHECK(loop->stmt.for_in_stmt.key_name == StringView("k"));
+        CHECK(loop->stmt.for_in_stmt.value_name == StringView("v"));
+        REQUIRE(loop->stmt.for_in_stmt.iterable != nullptr);
+        CHECK(loop->stmt.for_in_stmt.iterable->kind == AstKind::ExprIdentifier);
+        CHECK(loop->stmt.for_in_stmt.body != nullptr);
+    }
+
     TEST_CASE("Error recovery produces nullptr") {
         BumpAllocator parse_alloc(4096);
         BumpAllocator ast_alloc(4096);
@@ -64,6 +64,33 @@ int count_op(IRFunction* func, IROp op) {
     return n;
 }
 
+// True if every operand (instruction and terminator) names a value that is
+// still defined somewhere in the function.
+bool all_operands_defined(IRFunction* func) {
+    Vector<bool> defined(func->next_value_id, false);
+    for (const BlockParam& param : func->params)
+        defined[param.value.id] = true;
+    for (IRBlock* block : func->blocks) {
+        for (const BlockParam& param : block->params)
+            defined[param.value.id] = true;
+        for (IRInst* inst : block->instructions) {
+            if (inst->result.is_valid())
+                defined[inst->result.id] = true;
+        }
+    }
+    bool ok = true;
+    auto check = [&](ValueId& v) {
+        if (v.is_valid() && (v.id >= defined.size() || !defined[v.id]))
+            ok = false;
+    };
+    for (IRBlock* block : func->blocks) {
+        for (IRInst* inst : block->instructions)
+            for_each_operand(inst, check);
+        for_each_terminator_operand(block->terminator, check);
+    }
+    return ok;
+}
+
 IRFunction* find_function(IRModule* module, const char* name) {
     for (IRFunction* func : module->functions) {
         if (func->name == name)
@@ -423,6 +450,31 @@ TEST_SUITE("IR Optimize") {
         CHECK(func->blocks[0]->terminator.kind == TerminatorKind::Return);
     }
 
+    TEST_CASE("block merging resolves a param chain merged in one pass") {
+        BumpAllocator allocator(4096);
+        // The constant `&&`/`||` folds into a chain of single-predecessor join
+        // blocks whose params feed each other (v_and -> v_and2 -> v_or ->
+        // const). All three merges land in one pass, so the substitution chain
+        // is three deep; every use must resolve to the surviving constant, not
+        // to an intermediate, merged-away param. Found by roxy_gen's dag preset.
+        const char* source = R"(
+        fun chain(): i32 {
+            if (true) {
+                var z: bool = (i32(677l) >= 39) && (true && (false || true));
+                if (!z) {
+                    return 1;
+                }
+            }
+            return 0;
+        }
+    )";
+        IRModule* module = build_and_optimize(allocator, source);
+        REQUIRE(module != nullptr);
+        IRFunction* func = find_function(module, "chain");
+        REQUIRE(func != nullptr);
+        CHECK(all_operands_defined(func));
+    }
+
     TEST_CASE("trivial block-arg elimination on if/else with same value") {
         BumpAllocator allocator(4096);
         const char* source = R"(
@@ -235,6 +235,13 @@ TEST_SUITE("LSP Parser") {
             CHECK(tree.root != nullptr);
             CHECK(tree.diagnostics.empty());
         }
+
+        SUBCASE("For-in statements") {
+            SyntaxTree tree =
+                parse_source("for x in items { y = y + x; } for (k, v) in m { n = k; }", allocator);
+            CHECK(tree.root != nullptr);
+            CHECK(tree.diagnostics.empty());
+        }
     }
 
     TEST_CASE("Enum declaration") {
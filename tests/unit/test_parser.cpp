@@ -435,6 +435,26 @@ TEST_SUITE("Parser") {
             CHECK(stmt.for_stmt.condition == nullptr);
             CHECK(stmt.for_stmt.increment == nullptr);
         }
+
+        SUBCASE("Range over a list") {
+            Program* program = parse_source("for x in items { y; }", allocator);
+            REQUIRE(program != nullptr);
+            auto& stmt = program->declarations[0]->stmt;
+            CHECK(stmt.kind == AstKind::StmtForIn);
+            CHECK(stmt.for_in_stmt.key_name.empty());
+            CHECK(stmt.for_in_stmt.value_name == "x");
+            CHECK(stmt.for_in_stmt.iterable != nullptr);
+            CHECK(stmt.for_in_stmt.body != nullptr);
+        }
+
+        SUBCASE("Range over a map") {
+            Program* program = parse_source("for (k, v) in table x;", allocator);
+            REQUIRE(program != nullptr);
+            auto& stmt = program->declarations[0]->stmt;
+            CHECK(stmt.kind == AstKind::StmtForIn);
+            CHECK(stmt.for_in_stmt.key_name == "k");
+            CHECK(stmt.for_in_stmt.value_name == "v");
+        }
     }
 
     TEST_CASE("Control Flow Statements") {
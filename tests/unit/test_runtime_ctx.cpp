@@ -2,6 +2,14 @@
 
 #include "roxy/rt/roxy_rt.h"
 
+#include <string>
+#include <vector>
+
+// Collects each batch the output sink receives.
+static void collect_output(void* userdata, const char* data, uint32_t length) {
+    static_cast<std::vector<std::string>*>(userdata)->emplace_back(data, length);
+}
+
 TEST_SUITE("Runtime Context") {
 
     TEST_CASE("init installs the runtime's default allocator") {
@@ -64,6 +72,50 @@ TEST_SUITE("Runtime Context") {
         roxy_ctx_destroy(&ctx);
     }
 
+    TEST_CASE("free pools belong to the context and drain on destroy") {
+        REQUIRE(roxy_rt_default_allocator() == &roxy_malloc_allocator);
+        roxy_rt_init();
+
+        const uint32_t type_id = 100;
+        roxy_ctx a;
+        roxy_ctx b;
+        roxy_ctx_init(&a);
+        roxy_ctx_init(&b);
+
+        void* parked = nullptr;
+        {
+            roxy::ScopedContext guard(&a);
+            parked = roxy_pool_alloc(32, type_id);
+            REQUIRE(parked != nullptr);
+            roxy_pool_free(parked);
+            REQUIRE(a.pool_count > type_id);
+            CHECK(a.pools[type_id].count == 1);
+        }
+        {
+            // Another context doesn't see what `a` parked.
+            roxy::ScopedContext guard(&b);
+            void* fresh = roxy_pool_alloc(32, type_id);
+            CHECK(fresh != parked);
+            roxy_pool_free(fresh);
+        }
+        {
+            roxy::ScopedContext guard(&a);
+            void* reused = roxy_pool_alloc(32, type_id);
+            CHECK(reused == parked);
+            CHECK(roxy_get_header(reused)->weak_generation != 0);
+            roxy_pool_free(reused);
+        }
+        CHECK(roxy_rt_heap_stats().leaked == 2);
+
+        // Neither context is active here: destroy drains through its own allocator.
+        roxy_ctx_destroy(&a);
+        roxy_ctx_destroy(&b);
+        CHECK(a.pools == nullptr);
+        CHECK(a.pool_count == 0);
+        CHECK(roxy_rt_heap_stats().leaked == 0);
+        roxy_rt_shutdown();
+    }
+
     TEST_CASE("set/get round-trip") {
         roxy_set_ctx(nullptr);
         CHECK(roxy_get_ctx() == nullptr);
@@ -147,4 +199,67 @@ TEST_SUITE("Runtime Context") {
         roxy_ctx_destroy(&ctx);
     }
 
+    TEST_CASE("print output is batched into the context's sink") {
+        std::vector<std::string> batches;
+        roxy_ctx ctx;
+        roxy_ctx_init(&ctx);
+        CHECK(ctx.output_sink == nullptr);
+        roxy_ctx_set_output_sink(&ctx, collect_output, &batches);
+        {
+            roxy::ScopedContext guard(&ctx);
+            roxy_print_i32(-2147483647 - 1);
+            roxy_print_u64(18446744073709551615ull);
+            roxy_print_bool(false);
+            roxy_print_f64(0.25);
+            CHECK(batches.empty()); // nothing reaches the sink per line
+            roxy_output_flush();
+            REQUIRE(batches.size() == 1);
+            CHECK(batches[0] == "-2147483648\n18446744073709551615\nfalse\n0.25\n");
+
+            // A write larger than the buffer goes through in one piece after
+            // what was pending.
+            roxy_print_i64(7);
+            std::string big(ROXY_OUTPUT_BUFFER_SIZE + 10, 'x');
+            roxy_output_write(big.data(), static_cast<uint32_t>(big.size()));
+            REQUIRE(batches.size() == 3);
+            CHECK(batches[1] == "7\n");
+            CHECK(batches[2].size() == big.size());
+
+            roxy_print_u32(12);
+        }
+        // Destroy delivers what is still buffered.
+        roxy_ctx_destroy(&ctx);
+        REQUIRE(batches.size() == 4);
+        CHECK(batches[3] == "12\n");
+    }
+
+    TEST_CASE("string hashes are computed on first use") {
+        roxy_ctx ctx;
+        roxy_ctx_init(&ctx);
+        {
+            roxy::ScopedContext guard(&ctx);
+            void* a = roxy_string_new_owned("key-", 4);
+            void* b = roxy_string_new_owned("42", 2);
+            void* joined = roxy_string_concat(a, b);
+            void* same = roxy_string_new_owned("key-42", 6);
+            CHECK(reinterpret_cast<roxy_string_header*>(joined)->hash == ROXY_STR_HASH_UNSET);
+            CHECK(roxy_string_eq(joined, same));
+
+            uint64_t h = roxy_string_hash(joined);
+            CHECK(h != ROXY_STR_HASH_UNSET);
+            CHECK(reinterpret_cast<roxy_string_header*>(joined)->hash == h);
+            CHECK(reinterpret_cast<roxy_string_header*>(same)->hash == ROXY_STR_HASH_UNSET);
+            CHECK(roxy_string_hash(same) == h);
+            CHECK(roxy_string_eq(joined, same));
+
+            void* other = roxy_string_new_owned("key-43", 6);
+            CHECK(roxy_string_hash(other) != h);
+            CHECK(!roxy_string_eq(joined, other));
+
+            for (void* s : {a, b, joined, same, other})
+                roxy_string_release(s);
+        }
+        roxy_ctx_destroy(&ctx);
+    }
+
 } // TEST_SUITE("Runtime Context")
@@ -108,6 +108,36 @@ TEST_SUITE("Structured Gen") {
         check_seed_range(200, 205, config);
     }
 
+    TEST_CASE("fixed seeds compile and run: workload presets") {
+        // roxy_bench's executable corpora: runtime kernels in every module,
+        // main running all of them. Small work size keeps the suite fast.
+        for (const char* const* preset = rx::gen::GenConfig::workload_preset_names(); *preset;
+             preset++) {
+            CAPTURE(*preset);
+            rx::gen::GenConfig config;
+            REQUIRE(rx::gen::GenConfig::workload_preset(*preset, config));
+            config.num_modules = 8;
+            config.kernel_work = 16;
+            config.allow_print = false;
+            check_seed_range(300, 302, config);
+        }
+    }
+
+    TEST_CASE("workload checksum is deterministic per seed") {
+        rx::gen::GenConfig config;
+        REQUIRE(rx::gen::GenConfig::workload_preset("mixed", config));
+        config.num_modules = 5;
+        config.kernel_work = 16;
+        config.allow_print = false;
+        rx::gen::Entropy entropy_a(7);
+        rx::gen::Entropy entropy_b(7);
+        RunOutcome outcome_a = compile_and_run_generated(rx::gen::generate_program(entropy_a, config));
+        RunOutcome outcome_b = compile_and_run_generated(rx::gen::generate_program(entropy_b, config));
+        REQUIRE(outcome_a.ran);
+        REQUIRE(outcome_b.ran);
+        CHECK(outcome_a.result == outcome_b.result);
+    }
+
     TEST_CASE("byte-buffer entropy: dry buffer degrades to a minimal program") {
         // Byte mode is what fuzz_structured uses; an (almost) empty buffer
         // must still yield a compiling, running program.
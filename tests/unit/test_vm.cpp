@@ -406,6 +406,59 @@ TEST_SUITE("VM") {
         delete module;
     }
 
+    TEST_CASE("Resolved function handles") {
+        RoxyVM vm;
+        vm_init(&vm);
+
+        BCModule* module = new BCModule();
+        module->name = "test";
+        module->functions.push_back(create_return_int_func("answer", 42));
+        BCFunction* add = create_add_func("add");
+        add->param_register_count = 2;
+        module->functions.push_back(add);
+        vm_load_module(&vm, module);
+
+        SUBCASE("Load indexes the function names") {
+            CHECK(module->names_indexed);
+            CHECK(module->find_function("add") == 1);
+            CHECK(module->find_function("missing") == -1);
+        }
+
+        SUBCASE("Call through a handle") {
+            RoxyFunctionHandle answer = vm_resolve(&vm, "answer");
+            REQUIRE(answer.valid());
+            for (int i = 0; i < 3; i++) {
+                REQUIRE(vm_call_handle(&vm, answer, {}));
+                CHECK(vm_get_result(&vm).as_int == 42);
+            }
+
+            RoxyFunctionHandle add_handle = vm_resolve(&vm, "add");
+            Value args[] = {Value::make_int(40), Value::make_int(2)};
+            REQUIRE(vm_call_handle(&vm, add_handle, Span<Value>(args, 2)));
+            CHECK(vm_get_result(&vm).as_int == 42);
+        }
+
+        SUBCASE("Raw register arguments") {
+            RoxyFunctionHandle add_handle = vm_resolve(&vm, "add");
+            u64 regs[] = {static_cast<u64>(-5), 12};
+            REQUIRE(vm_call_handle_regs(&vm, add_handle, regs, 2));
+            CHECK(static_cast<i64>(vm_get_result_reg(&vm)) == 7);
+
+            CHECK(!vm_call_handle_regs(&vm, add_handle, regs, 1));
+            CHECK(strstr(vm_get_error(&vm), "arguments") != nullptr);
+        }
+
+        SUBCASE("Unresolved handle") {
+            RoxyFunctionHandle missing = vm_resolve(&vm, "missing");
+            CHECK(!missing.valid());
+            CHECK(!vm_call_handle(&vm, missing, {}));
+            CHECK(vm_get_error(&vm) != nullptr);
+        }
+
+        vm_destroy(&vm);
+        delete module;
+    }
+
     TEST_CASE("Error handling") {
         RoxyVM vm;
         vm_init(&vm);